@@ -0,0 +1,174 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/concurrent_demo: test concurrent GrB_setElement
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Many OpenMP user threads call GrB_Matrix_setElement on a single matrix that
+// allows concurrent insertion (GxB_CONCURRENT_INSERT), and the result is
+// checked once all the threads are done.  Each thread writes the same new
+// entries many times, in increasing order, so the last value written by each
+// thread must be the one kept.  All the threads also overwrite a few entries
+// already present in the matrix, with a complex value whose real and
+// imaginary parts are equal; a torn write would break that equality.  This
+// is done for each sparsity format of the matrix.  If OpenMP is not
+// available, a single user thread is used.
+
+#include "GraphBLAS.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined __INTEL_COMPILER
+#pragma warning (disable: 58 167 144 177 181 186 188 589 593 869 981 1418 1419 1572 1599 2259 2282 2557 2547 3280 )
+#elif defined __GNUC__
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+#define NTHREADS 16
+#define NTRIALS 50
+#define N 64
+#define NSHARED 4
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS)                                        \
+    {                                                               \
+        printf ("Failure (line %d, info: %d): %s\n",                \
+            __LINE__, info, GrB_error ( )) ;                        \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+#define CHECK(condition)                                            \
+{                                                                   \
+    if (!(condition))                                               \
+    {                                                               \
+        printf ("Failure (line %d): %s\n", __LINE__, #condition) ;  \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+//------------------------------------------------------------------------------
+// concurrent_test: insert into A from many threads, for one sparsity format
+//------------------------------------------------------------------------------
+
+// Thread t owns row t of A, except for the NSHARED entries A(N-1,0:NSHARED-1),
+// which are present in A before the threads start and are written by all of
+// them.  A(t,j) is new for all j, and thread t writes it NTRIALS times with
+// the values 1 to NTRIALS (plus the thread and column ids in the imaginary
+// part).
+
+bool concurrent_test (int sparsity, double hyper)
+{
+
+    bool ok = true ;
+    GrB_Matrix A = NULL ;
+    OK (GrB_Matrix_new (&A, GxB_FC64, N, N)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_HYPER, hyper)) ;
+    for (int j = 0 ; j < NSHARED ; j++)
+    {
+        OK (GxB_Matrix_setElement_FC64 (A, GxB_CMPLX (-1, -1), N-1, j)) ;
+    }
+    OK (GrB_Matrix_wait (&A)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_CONCURRENT_INSERT, true)) ;
+
+    int nthreads = 1 ;
+    #ifdef _OPENMP
+    nthreads = NTHREADS ;
+    #endif
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static,1)
+    for (int t = 0 ; t < NTHREADS ; t++)
+    {
+        for (int trial = 1 ; trial <= NTRIALS ; trial++)
+        {
+            for (int j = 0 ; j < N ; j++)
+            {
+                GxB_FC64_t x = GxB_CMPLX (trial, t*N + j) ;
+                GrB_Info info = GxB_Matrix_setElement_FC64 (A, x, t, j) ;
+                if (info != GrB_SUCCESS)
+                {
+                    #pragma omp critical
+                    ok = false ;
+                }
+            }
+            for (int j = 0 ; j < NSHARED ; j++)
+            {
+                GxB_FC64_t x = GxB_CMPLX (t, t) ;
+                GrB_Info info = GxB_Matrix_setElement_FC64 (A, x, N-1, j) ;
+                if (info != GrB_SUCCESS)
+                {
+                    #pragma omp critical
+                    ok = false ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // check the result
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_wait (&A)) ;
+    GrB_Index nvals ;
+    OK (GrB_Matrix_nvals (&nvals, A)) ;
+    CHECK (nvals == NTHREADS * N + NSHARED) ;
+
+    for (int t = 0 ; t < NTHREADS ; t++)
+    {
+        for (int j = 0 ; j < N ; j++)
+        {
+            GxB_FC64_t x = GxB_CMPLX (0, 0) ;
+            OK (GxB_Matrix_extractElement_FC64 (&x, A, t, j)) ;
+            CHECK (creal (x) == NTRIALS && cimag (x) == t*N + j) ;
+        }
+    }
+
+    for (int j = 0 ; j < NSHARED ; j++)
+    {
+        GxB_FC64_t x = GxB_CMPLX (-1, -1) ;
+        OK (GxB_Matrix_extractElement_FC64 (&x, A, N-1, j)) ;
+        CHECK (creal (x) == cimag (x)) ;
+        CHECK (creal (x) >= 0 && creal (x) < NTHREADS) ;
+    }
+
+    GrB_Matrix_free (&A) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// concurrent_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    GrB_init (GrB_NONBLOCKING) ;
+    #ifdef _OPENMP
+    fprintf (stderr, "concurrent_demo: with OpenMP\n") ;
+    #else
+    fprintf (stderr, "concurrent_demo: without OpenMP\n") ;
+    #endif
+
+    bool ok = true ;
+    int sparsity [3] = { GxB_SPARSE, GxB_SPARSE, GxB_BITMAP } ;
+    double hyper [3] = { GxB_ALWAYS_HYPER, GxB_NEVER_HYPER, GxB_NEVER_HYPER } ;
+    char *name [3] = { "hypersparse", "sparse", "bitmap" } ;
+    for (int k = 0 ; k < 3 ; k++)
+    {
+        bool ok_k = concurrent_test (sparsity [k], hyper [k]) ;
+        printf ("concurrent_demo %-12s: %s\n", name [k],
+            ok_k ? "ok" : "FAILED") ;
+        ok = ok && ok_k ;
+    }
+
+    GrB_finalize ( ) ;
+    return (ok ? 0 : 1) ;
+}
@@ -0,0 +1,257 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/extract_demo: test GxB_Matrix_extractElements
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_extractElements is compared with GrB_Matrix_extractElement, for
+// a matrix held in each format (sparse, hypersparse, bitmap, and full, by
+// column and by row), and for a matrix with zombies.  The lookups are done
+// in random order and grouped by vector, with X and Xb each optionally NULL.
+// An invalid index must be reported without modifying X or Xb.
+
+#include "GraphBLAS.h"
+
+#if defined __INTEL_COMPILER
+#pragma warning (disable: 58 167 144 177 181 186 188 589 593 869 981 1418 1419 1572 1599 2259 2282 2557 2547 3280 )
+#elif defined __GNUC__
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+#define NROWS 50
+#define NCOLS 40
+#define NLOOKUPS (2 * NROWS * NCOLS)
+#define XNONE (-999)
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS)                                        \
+    {                                                               \
+        printf ("Failure (line %d, info: %d): %s\n",                \
+            __LINE__, info, GrB_error ( )) ;                        \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+#define CHECK(condition)                                            \
+{                                                                   \
+    if (!(condition))                                               \
+    {                                                               \
+        printf ("Failure (line %d): %s\n", __LINE__, #condition) ;  \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+// a simple portable random number generator, so that each platform uses the
+// same matrices and lookups
+static uint64_t seed = 1 ;
+static uint64_t next_rand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((seed / 65536) % 32768) ;
+}
+
+//------------------------------------------------------------------------------
+// check_lookups: compare extractElements with extractElement
+//------------------------------------------------------------------------------
+
+// X and Xb were computed by GxB_Matrix_extractElements for the n lookups
+// I and J, with X initialized to XNONE.  If have_X or have_Xb are false,
+// that array was not computed.
+
+static bool check_lookups (GrB_Matrix A, const GrB_Index *I,
+    const GrB_Index *J, GrB_Index n, const double *X, const int8_t *Xb,
+    bool have_X, bool have_Xb)
+{
+    bool ok = true ;
+    for (GrB_Index k = 0 ; ok && k < n ; k++)
+    {
+        double x = XNONE ;
+        GrB_Info info = GrB_Matrix_extractElement_FP64 (&x, A, I [k], J [k]) ;
+        CHECK (info == GrB_SUCCESS || info == GrB_NO_VALUE) ;
+        bool found = (info == GrB_SUCCESS) ;
+        if (have_Xb) CHECK (Xb [k] == found) ;
+        if (have_X)  CHECK (X [k] == (found ? x : XNONE)) ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// extract_test: test extractElements on one matrix
+//------------------------------------------------------------------------------
+
+// The matrix A has type GrB_INT32, so the values are typecasted to double.
+// If zombies is true, some entries are deleted from A with
+// GrB_Matrix_removeElement just before the lookups, so they are still
+// zombies when GxB_Matrix_extractElements is called.
+
+static bool extract_test (int sparsity, double hyper, GxB_Format_Value format,
+    bool zombies)
+{
+
+    bool ok = true ;
+    GrB_Matrix A = NULL ;
+    GrB_Index *I = NULL, *J = NULL ;
+    double *X = NULL ;
+    int8_t *Xb = NULL ;
+
+    //--------------------------------------------------------------------------
+    // create the matrix
+    //--------------------------------------------------------------------------
+
+    OK (GrB_Matrix_new (&A, GrB_INT32, NROWS, NCOLS)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_FORMAT, format)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+    OK (GxB_Matrix_Option_set (A, GxB_HYPER, hyper)) ;
+    for (GrB_Index i = 0 ; i < NROWS ; i++)
+    {
+        for (GrB_Index j = 0 ; j < NCOLS ; j++)
+        {
+            // full matrices have all their entries; the others have 1 in 5
+            if (sparsity == GxB_FULL || next_rand ( ) % 5 == 0)
+            {
+                int32_t x = (int32_t) (next_rand ( ) % 1000) - 500 ;
+                OK (GrB_Matrix_setElement_INT32 (A, x, i, j)) ;
+            }
+        }
+    }
+    OK (GrB_Matrix_wait (&A)) ;
+
+    //--------------------------------------------------------------------------
+    // create the lookups
+    //--------------------------------------------------------------------------
+
+    // The first NROWS*NCOLS lookups are all of A, grouped by column.  The
+    // rest are random, and include duplicates.
+    I  = malloc (NLOOKUPS * sizeof (GrB_Index)) ;
+    J  = malloc (NLOOKUPS * sizeof (GrB_Index)) ;
+    X  = malloc (NLOOKUPS * sizeof (double)) ;
+    Xb = malloc (NLOOKUPS * sizeof (int8_t)) ;
+    if (I == NULL || J == NULL || X == NULL || Xb == NULL)
+    {
+        printf ("out of memory\n") ;
+        ok = false ;
+        goto done ;
+    }
+    GrB_Index n = 0 ;
+    for (GrB_Index j = 0 ; j < NCOLS ; j++)
+    {
+        for (GrB_Index i = 0 ; i < NROWS ; i++)
+        {
+            I [n] = i ;
+            J [n] = j ;
+            n++ ;
+        }
+    }
+    for ( ; n < NLOOKUPS ; n++)
+    {
+        I [n] = next_rand ( ) % NROWS ;
+        J [n] = next_rand ( ) % NCOLS ;
+    }
+
+    if (zombies)
+    {
+        // delete every 7th entry of A; A now has zombies
+        for (GrB_Index k = 0 ; k < NROWS * NCOLS ; k += 7)
+        {
+            OK (GrB_Matrix_removeElement (A, I [k], J [k])) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // extract the entries, with both X and Xb
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index k = 0 ; k < NLOOKUPS ; k++) X [k] = XNONE ;
+    OK (GxB_Matrix_extractElements_FP64 (X, Xb, I, J, NLOOKUPS, A)) ;
+    CHECK (check_lookups (A, I, J, NLOOKUPS, X, Xb, true, true)) ;
+
+    //--------------------------------------------------------------------------
+    // extract only X, and only Xb
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index k = 0 ; k < NLOOKUPS ; k++) X [k] = XNONE ;
+    OK (GxB_Matrix_extractElements_FP64 (X, NULL, I, J, NLOOKUPS, A)) ;
+    CHECK (check_lookups (A, I, J, NLOOKUPS, X, Xb, true, false)) ;
+
+    OK (GxB_Matrix_extractElements_FP64 (NULL, Xb, I, J, NLOOKUPS, A)) ;
+    CHECK (check_lookups (A, I, J, NLOOKUPS, X, Xb, false, true)) ;
+
+    OK (GxB_Matrix_extractElements_FP64 (NULL, NULL, I, J, NLOOKUPS, A)) ;
+
+    //--------------------------------------------------------------------------
+    // an invalid row or column index leaves X and Xb unmodified
+    //--------------------------------------------------------------------------
+
+    for (int bad = 0 ; bad < 2 ; bad++)
+    {
+        for (GrB_Index k = 0 ; k < NLOOKUPS ; k++)
+        {
+            X [k] = XNONE ;
+            Xb [k] = -1 ;
+        }
+        GrB_Index save = (bad == 0) ? I [NLOOKUPS-1] : J [NLOOKUPS-1] ;
+        if (bad == 0) I [NLOOKUPS-1] = NROWS ; else J [NLOOKUPS-1] = NCOLS ;
+        GrB_Info info = GxB_Matrix_extractElements_FP64 (X, Xb, I, J,
+            NLOOKUPS, A) ;
+        CHECK (info == GrB_INDEX_OUT_OF_BOUNDS) ;
+        for (GrB_Index k = 0 ; k < NLOOKUPS ; k++)
+        {
+            CHECK (X [k] == XNONE && Xb [k] == -1) ;
+            if (!ok) break ;
+        }
+        if (bad == 0) I [NLOOKUPS-1] = save ; else J [NLOOKUPS-1] = save ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    done:
+    GrB_Matrix_free (&A) ;
+    free (I) ;
+    free (J) ;
+    free (X) ;
+    free (Xb) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// extract_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    GrB_init (GrB_NONBLOCKING) ;
+    GxB_Global_Option_set (GxB_CHUNK, (double) 64) ;
+    fprintf (stderr, "extract_demo:\n") ;
+
+    #define NTESTS 7
+    int sparsity [NTESTS] = { GxB_SPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL,
+        GxB_SPARSE, GxB_BITMAP, GxB_SPARSE } ;
+    double hyper [NTESTS] = { GxB_NEVER_HYPER, GxB_ALWAYS_HYPER,
+        GxB_NEVER_HYPER, GxB_NEVER_HYPER, GxB_NEVER_HYPER, GxB_NEVER_HYPER,
+        GxB_NEVER_HYPER } ;
+    GxB_Format_Value format [NTESTS] = { GxB_BY_COL, GxB_BY_COL, GxB_BY_COL,
+        GxB_BY_COL, GxB_BY_ROW, GxB_BY_ROW, GxB_BY_COL } ;
+    bool zombies [NTESTS] = { false, false, false, false, false, false, true } ;
+    char *name [NTESTS] = { "sparse", "hypersparse", "bitmap", "full",
+        "sparse CSR", "bitmap CSR", "zombies" } ;
+
+    bool ok = true ;
+    for (int k = 0 ; k < NTESTS ; k++)
+    {
+        bool ok_k = extract_test (sparsity [k], hyper [k], format [k],
+            zombies [k]) ;
+        printf ("extract_demo %-12s: %s\n", name [k], ok_k ? "ok" : "FAILED") ;
+        ok = ok && ok_k ;
+    }
+
+    GrB_finalize ( ) ;
+    return (ok ? 0 : 1) ;
+}
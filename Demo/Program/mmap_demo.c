@@ -0,0 +1,291 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/mmap_demo: test GxB_Matrix_import_mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A matrix is serialized into a file and imported with GxB_Matrix_import_mmap,
+// for each format (sparse, hypersparse, bitmap, and full), with and without
+// compression.  The imported matrix is then modified: its entries are
+// overwritten in place, new entries are added and old ones deleted, and it is
+// resized, transposed in place, and exported.  The same operations are done to
+// the original matrix, and the two must stay identical.  The file itself must
+// not change, so a second import, modified in the same way, must match too.
+
+#include "GraphBLAS.h"
+
+#if defined __INTEL_COMPILER
+#pragma warning (disable: 58 167 144 177 181 186 188 589 593 869 981 1418 1419 1572 1599 2259 2282 2557 2547 3280 )
+#elif defined __GNUC__
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+#define NROWS 250
+#define NCOLS 250
+#define NOPS 7
+#define FILENAME "mmap_demo.blob"
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS)                                        \
+    {                                                               \
+        printf ("Failure (line %d, info: %d): %s\n",                \
+            __LINE__, info, GrB_error ( )) ;                        \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+#define CHECK(condition)                                            \
+{                                                                   \
+    if (!(condition))                                               \
+    {                                                               \
+        printf ("Failure (line %d): %s\n", __LINE__, #condition) ;  \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+// a simple portable random number generator, so that each platform uses the
+// same matrices
+static uint64_t seed = 1 ;
+static uint64_t next_rand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((seed / 65536) % 32768) ;
+}
+
+//------------------------------------------------------------------------------
+// same_matrix: check if two GrB_FP64 matrices have the same entries
+//------------------------------------------------------------------------------
+
+static bool same_matrix (GrB_Matrix A, GrB_Matrix C)
+{
+    bool ok = true ;
+    GrB_Index anrows, ancols, anvals, cnrows, cncols, cnvals ;
+    OK (GrB_Matrix_nrows (&anrows, A)) ;
+    OK (GrB_Matrix_ncols (&ancols, A)) ;
+    OK (GrB_Matrix_nvals (&anvals, A)) ;
+    OK (GrB_Matrix_nrows (&cnrows, C)) ;
+    OK (GrB_Matrix_ncols (&cncols, C)) ;
+    OK (GrB_Matrix_nvals (&cnvals, C)) ;
+    CHECK (anrows == cnrows && ancols == cncols && anvals == cnvals) ;
+    if (!ok) return (false) ;
+
+    // D = (A == C), for all entries in both A and C
+    GrB_Matrix D = NULL ;
+    GrB_Index dnvals = 0 ;
+    bool all_equal = true ;
+    OK (GrB_Matrix_new (&D, GrB_BOOL, anrows, ancols)) ;
+    OK (GrB_eWiseMult (D, NULL, NULL, GrB_EQ_FP64, A, C, NULL)) ;
+    OK (GrB_Matrix_nvals (&dnvals, D)) ;
+    OK (GrB_reduce (&all_equal, NULL, GrB_LAND_MONOID_BOOL, D, NULL)) ;
+    CHECK (dnvals == anvals && all_equal) ;
+    GrB_Matrix_free (&D) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// modify: apply one operation to a matrix
+//------------------------------------------------------------------------------
+
+static bool modify (GrB_Matrix A, int op)
+{
+    bool ok = true ;
+    GrB_Index I [3] = { 1, 7, 8 } ;
+    switch (op)
+    {
+        case 0:
+            // overwrite all entries in place
+            OK (GrB_apply (A, NULL, NULL, GrB_AINV_FP64, A, NULL)) ;
+            break ;
+        case 1:
+            // add new entries, in new vectors as well as existing ones
+            OK (GrB_Matrix_setElement_FP64 (A, 42, 0, 0)) ;
+            OK (GrB_Matrix_setElement_FP64 (A, 43, NROWS-1, NCOLS-1)) ;
+            OK (GrB_Matrix_setElement_FP64 (A, 44, 5, 3)) ;
+            OK (GrB_Matrix_wait (&A)) ;
+            break ;
+        case 2:
+            // delete some entries
+            OK (GrB_Matrix_removeElement (A, 1, 1)) ;
+            OK (GrB_Matrix_removeElement (A, 7, 9)) ;
+            OK (GrB_Matrix_wait (&A)) ;
+            break ;
+        case 3:
+            // C(I,I) += 1
+            OK (GrB_Matrix_assign_FP64 (A, NULL, GrB_PLUS_FP64, 1, I, 3, I, 3,
+                NULL)) ;
+            break ;
+        case 4:
+            // change the dimensions
+            OK (GrB_Matrix_resize (A, NROWS/2, 2*NCOLS)) ;
+            break ;
+        case 5:
+            // transpose in place (A is square)
+            OK (GrB_transpose (A, NULL, NULL, A, NULL)) ;
+            break ;
+        case 6:
+            // change the format
+            OK (GxB_Matrix_Option_set (A, GxB_FORMAT, GxB_BY_ROW)) ;
+            break ;
+    }
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// mmap_test: import a matrix from a file, and modify it
+//------------------------------------------------------------------------------
+
+static bool mmap_test (int sparsity, double hyper, GrB_Descriptor desc)
+{
+
+    bool ok = true ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+
+    for (int op = 0 ; op < NOPS ; op++)
+    {
+
+        //----------------------------------------------------------------------
+        // create the matrix and write it to the file
+        //----------------------------------------------------------------------
+
+        GrB_Matrix A = NULL, C = NULL, E = NULL ;
+        OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity)) ;
+        OK (GxB_Matrix_Option_set (A, GxB_HYPER, hyper)) ;
+        for (GrB_Index i = 0 ; i < NROWS ; i++)
+        {
+            for (GrB_Index j = 0 ; j < NCOLS ; j++)
+            {
+                // only a few entries, so hypersparse A has empty vectors
+                if (sparsity == GxB_FULL || next_rand ( ) % 50 == 0)
+                {
+                    double x = (double) (next_rand ( ) % 8) / 4 ;
+                    OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                }
+            }
+        }
+        OK (GrB_Matrix_wait (&A)) ;
+
+        OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+        FILE *f = fopen (FILENAME, "wb") ;
+        CHECK (f != NULL) ;
+        if (f != NULL)
+        {
+            CHECK (fwrite (blob, 1, blob_size, f) == blob_size) ;
+            fclose (f) ;
+        }
+        free (blob) ;
+        if (!ok)
+        {
+            GrB_Matrix_free (&A) ;
+            return (false) ;
+        }
+
+        //----------------------------------------------------------------------
+        // import the file, and modify both matrices in the same way
+        //----------------------------------------------------------------------
+
+        OK (GxB_Matrix_import_mmap (&C, NULL, FILENAME, NULL)) ;
+        CHECK (same_matrix (A, C)) ;
+        CHECK (modify (A, op)) ;
+        CHECK (modify (C, op)) ;
+        CHECK (same_matrix (A, C)) ;
+        GrB_Matrix_free (&A) ;
+
+        //----------------------------------------------------------------------
+        // the file must be unchanged
+        //----------------------------------------------------------------------
+
+        OK (GxB_Matrix_import_mmap (&E, NULL, FILENAME, NULL)) ;
+        OK (GxB_Matrix_import_mmap (&A, NULL, FILENAME, NULL)) ;
+        CHECK (modify (A, op)) ;
+        CHECK (same_matrix (A, C)) ;
+        GrB_Matrix_free (&A) ;
+        GrB_Matrix_free (&C) ;
+
+        //----------------------------------------------------------------------
+        // export a matrix that is still backed by the file
+        //----------------------------------------------------------------------
+
+        if (sparsity == GxB_SPARSE && hyper == GxB_NEVER_HYPER)
+        {
+            GrB_Type type ;
+            GrB_Index nrows, ncols, nvals, *Ap = NULL, *Ai = NULL ;
+            int64_t nonempty ;
+            void *Ax = NULL ;
+            OK (GxB_Matrix_export_CSC (&E, &type, &nrows, &ncols, &nvals,
+                &nonempty, &Ap, &Ai, &Ax, NULL)) ;
+            CHECK (E == NULL && type == GrB_FP64 && Ap [ncols] == nvals) ;
+            free (Ap) ;
+            free (Ai) ;
+            free (Ax) ;
+        }
+        GrB_Matrix_free (&E) ;
+        remove (FILENAME) ;
+    }
+
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// mmap_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    GrB_init (GrB_NONBLOCKING) ;
+    fprintf (stderr, "mmap_demo:\n") ;
+    bool ok = true ;
+
+    GrB_Descriptor desc [2] = { NULL, NULL } ;
+    OK (GrB_Descriptor_new (&(desc [1]))) ;
+    OK (GxB_Desc_set (desc [1], GxB_COMPRESSION, GxB_COMPRESSION_LZ4)) ;
+    char *compression [2] = { "none", "lz4" } ;
+
+    #define NFORMATS 4
+    int sparsity [NFORMATS] = { GxB_SPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+    double hyper [NFORMATS] = { GxB_NEVER_HYPER, GxB_ALWAYS_HYPER,
+        GxB_NEVER_HYPER, GxB_NEVER_HYPER } ;
+    char *name [NFORMATS] = { "sparse", "hypersparse", "bitmap", "full" } ;
+
+    for (int k = 0 ; k < NFORMATS ; k++)
+    {
+        for (int c = 0 ; c < 2 ; c++)
+        {
+            bool ok_k = mmap_test (sparsity [k], hyper [k], desc [c]) ;
+            printf ("mmap_demo %-12s %-5s: %s\n", name [k], compression [c],
+                ok_k ? "ok" : "FAILED") ;
+            ok = ok && ok_k ;
+        }
+    }
+
+    // a missing file, and a file that does not hold a blob
+    bool ok_all = ok ;
+    ok = true ;
+    GrB_Matrix A = NULL ;
+    remove (FILENAME) ;
+    CHECK (GxB_Matrix_import_mmap (&A, NULL, FILENAME, NULL)
+        == GrB_INVALID_VALUE) ;
+    FILE *f = fopen (FILENAME, "w") ;
+    if (f != NULL)
+    {
+        fprintf (f, "this file does not hold a serialized matrix\n") ;
+        fclose (f) ;
+        CHECK (GxB_Matrix_import_mmap (&A, NULL, FILENAME, NULL)
+            == GrB_INVALID_OBJECT) ;
+        remove (FILENAME) ;
+    }
+    CHECK (A == NULL) ;
+    printf ("mmap_demo %-18s: %s\n", "invalid files", ok ? "ok" : "FAILED") ;
+    ok = ok && ok_all ;
+
+    GrB_Descriptor_free (&(desc [1])) ;
+    GrB_finalize ( ) ;
+    return (ok ? 0 : 1) ;
+}
@@ -0,0 +1,323 @@
+//------------------------------------------------------------------------------
+// GraphBLAS/Demo/Program/serialize_demo: test GxB_Matrix_serialize/deserialize
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A matrix in each format (sparse, hypersparse, bitmap, and full, by row and
+// by column) is serialized, with and without compression, and deserialized
+// again.  The result must match the original matrix, in the same format.  A
+// matrix with a user-defined type is also tested.  Every truncated prefix of
+// each blob must be rejected, as must a blob with a corrupted header.  A blob
+// with a flipped bit elsewhere is either rejected, or gives a valid matrix
+// (the bit may be part of a numerical value).
+
+#include "GraphBLAS.h"
+
+#if defined __INTEL_COMPILER
+#pragma warning (disable: 58 167 144 177 181 186 188 589 593 869 981 1418 1419 1572 1599 2259 2282 2557 2547 3280 )
+#elif defined __GNUC__
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+#define NROWS 200
+#define NCOLS 150
+#define NFLIPS 200
+
+#define OK(method)                                                  \
+{                                                                   \
+    GrB_Info info = method ;                                        \
+    if (info != GrB_SUCCESS)                                        \
+    {                                                               \
+        printf ("Failure (line %d, info: %d): %s\n",                \
+            __LINE__, info, GrB_error ( )) ;                        \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+#define CHECK(condition)                                            \
+{                                                                   \
+    if (!(condition))                                               \
+    {                                                               \
+        printf ("Failure (line %d): %s\n", __LINE__, #condition) ;  \
+        ok = false ;                                                \
+    }                                                               \
+}
+
+// a simple portable random number generator, so that each platform uses the
+// same matrices and corruptions
+static uint64_t seed = 1 ;
+static uint64_t next_rand (void)
+{
+    seed = seed * 1103515245 + 12345 ;
+    return ((seed / 65536) % 32768) ;
+}
+
+// a user-defined type
+typedef struct
+{
+    double x ;
+    double y ;
+    double z ;
+}
+triple ;
+
+//------------------------------------------------------------------------------
+// same_matrix: check if two matrices are identical, including their format
+//------------------------------------------------------------------------------
+
+// A and C must have the same type, dimensions, pattern, values, sparsity
+// status, and CSR/CSC format.  Only GrB_FP64 and user-defined types are used
+// in this test.
+
+static bool same_matrix (GrB_Matrix A, GrB_Matrix C)
+{
+    bool ok = true ;
+    GrB_Index anrows, ancols, anvals, cnrows, cncols, cnvals ;
+    GrB_Type atype, ctype ;
+    int asparsity, csparsity ;
+    GxB_Format_Value aformat, cformat ;
+    size_t asize ;
+
+    OK (GrB_Matrix_nrows (&anrows, A)) ;
+    OK (GrB_Matrix_ncols (&ancols, A)) ;
+    OK (GrB_Matrix_nvals (&anvals, A)) ;
+    OK (GxB_Matrix_type (&atype, A)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_SPARSITY_STATUS, &asparsity)) ;
+    OK (GxB_Matrix_Option_get (A, GxB_FORMAT, &aformat)) ;
+    OK (GrB_Matrix_nrows (&cnrows, C)) ;
+    OK (GrB_Matrix_ncols (&cncols, C)) ;
+    OK (GrB_Matrix_nvals (&cnvals, C)) ;
+    OK (GxB_Matrix_type (&ctype, C)) ;
+    OK (GxB_Matrix_Option_get (C, GxB_SPARSITY_STATUS, &csparsity)) ;
+    OK (GxB_Matrix_Option_get (C, GxB_FORMAT, &cformat)) ;
+    CHECK (anrows == cnrows && ancols == cncols && anvals == cnvals) ;
+    CHECK (atype == ctype) ;
+    CHECK (asparsity == csparsity && aformat == cformat) ;
+    OK (GxB_Type_size (&asize, atype)) ;
+    if (!ok) return (false) ;
+
+    GrB_Index n = anvals + 1 ;
+    GrB_Index *AI = malloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *AJ = malloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *CI = malloc (n * sizeof (GrB_Index)) ;
+    GrB_Index *CJ = malloc (n * sizeof (GrB_Index)) ;
+    void *AX = malloc (n * asize) ;
+    void *CX = malloc (n * asize) ;
+    if (AI == NULL || AJ == NULL || CI == NULL || CJ == NULL || AX == NULL
+        || CX == NULL)
+    {
+        printf ("out of memory\n") ;
+        ok = false ;
+    }
+    else
+    {
+        GrB_Index na = anvals, nc = cnvals ;
+        if (atype == GrB_FP64)
+        {
+            OK (GrB_Matrix_extractTuples_FP64 (AI, AJ, AX, &na, A)) ;
+            OK (GrB_Matrix_extractTuples_FP64 (CI, CJ, CX, &nc, C)) ;
+        }
+        else
+        {
+            OK (GrB_Matrix_extractTuples_UDT (AI, AJ, AX, &na, A)) ;
+            OK (GrB_Matrix_extractTuples_UDT (CI, CJ, CX, &nc, C)) ;
+        }
+        CHECK (na == anvals && nc == cnvals) ;
+        CHECK (memcmp (AI, CI, anvals * sizeof (GrB_Index)) == 0) ;
+        CHECK (memcmp (AJ, CJ, anvals * sizeof (GrB_Index)) == 0) ;
+        CHECK (memcmp (AX, CX, anvals * asize) == 0) ;
+    }
+    free (AI) ; free (AJ) ; free (CI) ; free (CJ) ; free (AX) ; free (CX) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// serialize_test: serialize and deserialize one matrix
+//------------------------------------------------------------------------------
+
+// A is serialized with the descriptor desc (which selects the compression
+// method), and then deserialized, truncated, and corrupted.  type is passed
+// to GxB_Matrix_deserialize, and must be non-NULL for a user-defined type.
+
+static bool serialize_test (GrB_Matrix A, GrB_Type type, GrB_Descriptor desc)
+{
+
+    bool ok = true ;
+    GrB_Matrix C = NULL ;
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    GrB_Info info ;
+
+    //--------------------------------------------------------------------------
+    // round trip
+    //--------------------------------------------------------------------------
+
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, desc)) ;
+    if (!ok) return (false) ;
+    OK (GxB_Matrix_deserialize (&C, type, blob, blob_size, NULL)) ;
+    if (ok) CHECK (same_matrix (A, C)) ;
+    GrB_Matrix_free (&C) ;
+
+    // the type must match the blob
+    info = GxB_Matrix_deserialize (&C, GrB_INT16, blob, blob_size, NULL) ;
+    CHECK (info == GrB_DOMAIN_MISMATCH && C == NULL) ;
+
+    //--------------------------------------------------------------------------
+    // truncated blobs
+    //--------------------------------------------------------------------------
+
+    for (GrB_Index t = 0 ; ok && t < blob_size ; t += 1 + blob_size / 500)
+    {
+        info = GxB_Matrix_deserialize (&C, type, blob, t, NULL) ;
+        CHECK (info == GrB_INVALID_OBJECT && C == NULL) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // corrupted blobs
+    //--------------------------------------------------------------------------
+
+    uint8_t *blob2 = malloc (blob_size) ;
+    if (blob2 == NULL)
+    {
+        printf ("out of memory\n") ;
+        ok = false ;
+    }
+
+    // a corrupted magic number, version, size, or format is always rejected;
+    // these are the first three words and the eleventh word of the header
+    int64_t header_words [4] = { 0, 1, 2, 10 } ;
+    for (int k = 0 ; ok && k < 4 ; k++)
+    {
+        memcpy (blob2, blob, blob_size) ;
+        blob2 [header_words [k] * sizeof (int64_t)] ^= 0x40 ;
+        info = GxB_Matrix_deserialize (&C, type, blob2, blob_size, NULL) ;
+        CHECK (info == GrB_INVALID_OBJECT && C == NULL) ;
+    }
+
+    // a flipped bit anywhere else gives a valid matrix, or is rejected
+    for (int trial = 0 ; ok && trial < NFLIPS ; trial++)
+    {
+        memcpy (blob2, blob, blob_size) ;
+        GrB_Index p = (next_rand ( ) * 32768 + next_rand ( )) % blob_size ;
+        blob2 [p] ^= (uint8_t) (1 << (next_rand ( ) % 8)) ;
+        info = GxB_Matrix_deserialize (&C, type, blob2, blob_size, NULL) ;
+        CHECK (info == GrB_SUCCESS || info == GrB_INVALID_OBJECT
+            || info == GrB_DOMAIN_MISMATCH) ;
+        if (info == GrB_SUCCESS)
+        {
+            OK (GxB_Matrix_fprint (C, "C", GxB_SILENT, NULL)) ;
+        }
+        GrB_Matrix_free (&C) ;
+    }
+
+    free (blob2) ;
+    free (blob) ;
+    return (ok) ;
+}
+
+//------------------------------------------------------------------------------
+// serialize_demo main program
+//------------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+
+    GrB_init (GrB_NONBLOCKING) ;
+    fprintf (stderr, "serialize_demo:\n") ;
+    bool ok = true ;
+
+    GrB_Descriptor desc [2] = { NULL, NULL } ;
+    OK (GrB_Descriptor_new (&(desc [1]))) ;
+    OK (GxB_Desc_set (desc [1], GxB_COMPRESSION, GxB_COMPRESSION_LZ4)) ;
+    char *compression [2] = { "none", "lz4" } ;
+
+    //--------------------------------------------------------------------------
+    // each built-in format
+    //--------------------------------------------------------------------------
+
+    #define NFORMATS 4
+    int sparsity [NFORMATS] = { GxB_SPARSE, GxB_SPARSE, GxB_BITMAP, GxB_FULL } ;
+    double hyper [NFORMATS] = { GxB_NEVER_HYPER, GxB_ALWAYS_HYPER,
+        GxB_NEVER_HYPER, GxB_NEVER_HYPER } ;
+    char *name [NFORMATS] = { "sparse", "hypersparse", "bitmap", "full" } ;
+    GxB_Format_Value format [2] = { GxB_BY_COL, GxB_BY_ROW } ;
+    char *fname [2] = { "CSC", "CSR" } ;
+
+    for (int k = 0 ; k < NFORMATS ; k++)
+    {
+        for (int f = 0 ; f < 2 ; f++)
+        {
+            GrB_Matrix A = NULL ;
+            OK (GrB_Matrix_new (&A, GrB_FP64, NROWS, NCOLS)) ;
+            OK (GxB_Matrix_Option_set (A, GxB_FORMAT, format [f])) ;
+            OK (GxB_Matrix_Option_set (A, GxB_SPARSITY_CONTROL, sparsity [k])) ;
+            OK (GxB_Matrix_Option_set (A, GxB_HYPER, hyper [k])) ;
+            for (GrB_Index i = 0 ; i < NROWS ; i++)
+            {
+                for (GrB_Index j = 0 ; j < NCOLS ; j++)
+                {
+                    // only a few entries, so hypersparse A has empty vectors
+                    if (sparsity [k] == GxB_FULL || next_rand ( ) % 50 == 0)
+                    {
+                        double x = (double) (next_rand ( ) % 8) / 4 ;
+                        OK (GrB_Matrix_setElement_FP64 (A, x, i, j)) ;
+                    }
+                }
+            }
+            OK (GrB_Matrix_wait (&A)) ;
+            for (int c = 0 ; c < 2 ; c++)
+            {
+                bool ok_k = serialize_test (A, NULL, desc [c]) ;
+                printf ("serialize_demo %-12s %s %-5s: %s\n", name [k],
+                    fname [f], compression [c], ok_k ? "ok" : "FAILED") ;
+                ok = ok && ok_k ;
+            }
+            GrB_Matrix_free (&A) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // a user-defined type
+    //--------------------------------------------------------------------------
+
+    GrB_Type Triple = NULL ;
+    GrB_Matrix A = NULL, C = NULL ;
+    OK (GrB_Type_new (&Triple, sizeof (triple))) ;
+    OK (GrB_Matrix_new (&A, Triple, NROWS, NCOLS)) ;
+    for (int k = 0 ; k < 500 ; k++)
+    {
+        triple t = { k, -k, 0.5 * k } ;
+        OK (GrB_Matrix_setElement_UDT (A, &t, next_rand ( ) % NROWS,
+            next_rand ( ) % NCOLS)) ;
+    }
+    OK (GrB_Matrix_wait (&A)) ;
+    for (int c = 0 ; c < 2 ; c++)
+    {
+        bool ok_k = serialize_test (A, Triple, desc [c]) ;
+        printf ("serialize_demo %-12s %s %-5s: %s\n", "user-defined",
+            "CSC", compression [c], ok_k ? "ok" : "FAILED") ;
+        ok = ok && ok_k ;
+    }
+
+    // the type of a matrix with a user-defined type must be given
+    void *blob = NULL ;
+    GrB_Index blob_size = 0 ;
+    OK (GxB_Matrix_serialize (&blob, &blob_size, A, NULL)) ;
+    GrB_Info info = GxB_Matrix_deserialize (&C, NULL, blob, blob_size, NULL) ;
+    CHECK (info == GrB_DOMAIN_MISMATCH && C == NULL) ;
+    free (blob) ;
+
+    //--------------------------------------------------------------------------
+    // free workspace
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix_free (&A) ;
+    GrB_Type_free (&Triple) ;
+    GrB_Descriptor_free (&(desc [1])) ;
+    GrB_finalize ( ) ;
+    return (ok ? 0 : 1) ;
+}
@@ -3621,6 +3621,197 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
     _Generic ((X), GB_(*, GrB, Matrix_extractTuples)) (I, J, X, nvals, A)
 #endif
 
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements
+//------------------------------------------------------------------------------
+
+// Extracts a list of n entries from a matrix: X(k) = A(I(k),J(k)) for each
+// k = 0:n-1.  If the entry A(I(k),J(k)) is present, Xb [k] is set to 1 and
+// X(k) is set to its value, typecasted to the type of X.  Otherwise, Xb [k]
+// is set to 0 and X(k) is not modified.  If X and/or Xb are NULL, that
+// component is not extracted.  The lookups are done in parallel.  If the list
+// is grouped by column (for a CSC matrix) or by row (for a CSR matrix), the
+// search for each column or row is done just once per thread.  All the
+// indices are checked before any entry is extracted.  If any index is out of
+// range, GrB_INDEX_OUT_OF_BOUNDS is returned, and X and Xb are not modified.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_BOOL   // X(k) = A(I(k),J(k))
+(
+    bool *X,                        // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT8   // X(k) = A(I(k),J(k))
+(
+    int8_t *X,                      // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT8  // X(k) = A(I(k),J(k))
+(
+    uint8_t *X,                     // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT16  // X(k) = A(I(k),J(k))
+(
+    int16_t *X,                     // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT16 // X(k) = A(I(k),J(k))
+(
+    uint16_t *X,                    // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT32  // X(k) = A(I(k),J(k))
+(
+    int32_t *X,                     // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT32 // X(k) = A(I(k),J(k))
+(
+    uint32_t *X,                    // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_INT64  // X(k) = A(I(k),J(k))
+(
+    int64_t *X,                     // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UINT64 // X(k) = A(I(k),J(k))
+(
+    uint64_t *X,                    // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FP32   // X(k) = A(I(k),J(k))
+(
+    float *X,                       // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FP64   // X(k) = A(I(k),J(k))
+(
+    double *X,                      // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FC32   // X(k) = A(I(k),J(k))
+(
+    GxB_FC32_t *X,                  // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_FC64   // X(k) = A(I(k),J(k))
+(
+    GxB_FC64_t *X,                  // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements_UDT    // X(k) = A(I(k),J(k))
+(
+    void *X,                        // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+// Type-generic version:  X can be a pointer to any supported C type or void *
+// for a user-defined type.
+
+/*
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_extractElements     // X(k) = A(I(k),J(k))
+(
+    <type> *X,                      // array for returning values of entries
+    int8_t *Xb,                     // Xb [k] = 1 if A(I(k),J(k)) is present
+    const GrB_Index *I,             // row indices of entries to extract
+    const GrB_Index *J,             // column indices of entries to extract
+    GrB_Index n,                    // number of entries to extract
+    const GrB_Matrix A              // matrix to extract entries from
+) ;
+
+*/
+
+#if GxB_STDC_VERSION >= 201112L
+#define GxB_Matrix_extractElements(X,Xb,I,J,n,A) \
+    _Generic ((X), GB_(*, GxB, Matrix_extractElements)) (X, Xb, I, J, n, A)
+#endif
+
 //==============================================================================
 //=== GraphBLAS Descriptor =====================================================
 //==============================================================================
@@ -3669,8 +3860,8 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //      floating-point data types.
 //
 //      GxB_AxB_SAXPY:  C(:,j)=A*B(:,j) is computed using a mix of Gustavson,
-//          Hash, and (in the future) the Heap method.  Each task in the
-//          parallel computation makes its own decision, via a heuristic.
+//          Hash, and Heap methods.  Each task in the parallel computation
+//          makes its own decision, via a heuristic.
 //
 //      GxB_AxB_GUSTAVSON:  This is the same as GxB_AxB_SAXPY, except that
 //          every task uses Gustavon's method, computing C(:,j)=A*B(:,j) via a
@@ -3682,8 +3873,9 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //          C(:,j)=A*B(:,j) via a heap of size equal to the maximum number of
 //          entries in any column of B.  Very good for hypersparse matrices,
 //          particularly when nnz(B) is less than the number of rows of A.
-//          The Heap method is no longer available in v3.2, so it is silently
-//          replaced with GxB_AxB_HASH.  It may reappear in a future version.
+//          The pattern of each C(:,j) is computed in sorted order.  If a
+//          single vector C(:,j) must be split across many threads, those
+//          threads use the Hash method instead.
 //
 //      GxB_AxB_HASH: This is the same as GxB_AxB_SAXPY, except that every
 //          task uses the Hash method.  Like the Heap method, it is very good
@@ -3696,6 +3888,12 @@ GrB_Info GrB_Matrix_extractTuples           // [I,J,X] = find (A)
 //          vector or matrix, or when C is tiny.  It is impossibly slow if C is
 //          large and the mask is not present, since it takes Omega(m*n) time
 //          if C is m-by-n.
+//
+// GxB_COMPRESSION: selects the compression method for GxB_Matrix_serialize.
+//      GxB_DEFAULT and GxB_COMPRESSION_NONE store the arrays of the matrix
+//      as-is.  GxB_COMPRESSION_LZ4 compresses each block of each array with
+//      an LZ4-style method, in parallel.  GxB_Matrix_deserialize ignores this
+//      setting, since the method is recorded in the blob.
 
 // The following are enumerated values in both the GrB_Desc_Field and the
 // GxB_Option_Field.  They are defined with the same integer value for both
@@ -3765,7 +3963,8 @@ typedef enum
 
     // SuiteSparse:GraphBLAS extensions are given large values so they do not
     // conflict with future enum values added to the spec:
-    GxB_AxB_METHOD = 1000   // descriptor for selecting C=A*B algorithm
+    GxB_AxB_METHOD = 1000,  // descriptor for selecting C=A*B algorithm
+    GxB_COMPRESSION = 1001  // descriptor for GxB_Matrix_serialize
 }
 GrB_Desc_Field ;
 
@@ -3799,7 +3998,11 @@ typedef enum
     GxB_AxB_HEAP      = 1002,   // heap-based saxpy method
     GxB_AxB_DOT       = 1003,   // dot product
     GxB_AxB_HASH      = 1004,   // hash-based saxpy method
-    GxB_AxB_SAXPY     = 1005    // saxpy method (any kind)
+    GxB_AxB_SAXPY     = 1005,   // saxpy method (any kind)
+
+    // for GxB_COMPRESSION only:
+    GxB_COMPRESSION_NONE = 3001,    // no compression
+    GxB_COMPRESSION_LZ4  = 3002     // LZ4-style block compression
 }
 GrB_Desc_Value ;
 
@@ -3980,9 +4183,28 @@ typedef enum            // for global options or matrix options
     GxB_GLOBAL_CHUNK = GxB_CHUNK,       // chunk size for small problems.
                         // If <= GxB_DEFAULT, then the default is used.
 
+    GxB_WORKSPACE_MAX = 32,     // max total size of the workspace pool, in
+                        // bytes (an int64_t value).  If zero, the pool is
+                        // not used.
+
     // GxB_Matrix_Option_get only:
     GxB_IS_HYPER = 6,   // query a matrix to see if it hypersparse or not
 
+    // GxB_Matrix_Option_get/set and GxB_Global_Option_get/set:
+    GxB_SPARSITY_CONTROL = 24,  // formats a matrix may take (an int value):
+                        // any sum of GxB_SPARSE, GxB_BITMAP, and GxB_FULL
+
+    GxB_BITMAP_SWITCH = 26, // defines switch to bitmap format (a double value)
+
+    // GxB_Matrix_Option_get/set only:
+    GxB_CONCURRENT_INSERT = 33, // if true, user threads may call
+                        // GrB_Matrix_setElement on the matrix concurrently
+                        // (a bool value)
+
+    // GxB_Matrix_Option_get only:
+    GxB_SPARSITY_STATUS = 25,   // query the current format of a matrix:
+                        // GxB_SPARSE, GxB_BITMAP, or GxB_FULL
+
     // GxB_Global_Option_get only:
     GxB_LIBRARY_NAME = 8,           // name of the library (char *)
     GxB_LIBRARY_VERSION = 9,        // library version (3 int's)
@@ -4019,6 +4241,20 @@ typedef enum
 }
 GxB_Format_Value ;
 
+// GxB_SPARSITY_CONTROL is the sum of the formats that a matrix may take.  A
+// matrix with all of its entries present is held in full format only if its
+// GxB_SPARSITY_CONTROL includes GxB_FULL.  Otherwise, it is held in bitmap
+// format if permitted, and if nvals(A) is at least GxB_BITMAP_SWITCH times
+// nrows(A)*ncols(A) (or always, if GxB_SPARSE is not included).  Otherwise
+// it is held as sparse or hypersparse, as determined by GxB_HYPER.
+// GxB_SPARSITY_STATUS reports which of the formats a matrix currently uses.
+// The default is GxB_SPARSE.
+#define GxB_SPARSE  1   // sparse or hypersparse (see GxB_HYPER)
+#define GxB_BITMAP  2   // bitmap: a dense array of values, and a byte for
+                        // each entry to denote if it is present or not
+#define GxB_FULL    4   // full: all entries present, no pattern held
+#define GxB_AUTO_SPARSITY (GxB_SPARSE + GxB_BITMAP + GxB_FULL)
+
 // GxB_THREAD_SAFETY and GxB_THREADING can be one of the following:
 typedef enum
 {
@@ -4073,6 +4309,21 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
     ...                             // return value of the matrix option
 ) ;
 
+// GxB_CONCURRENT_INSERT: if a matrix allows concurrent insertion, then any
+// number of user threads may call GrB_Matrix_setElement or
+// GrB_Vector_setElement on it at the same time, without any synchronization
+// by the application.  An entry already present in the matrix is overwritten
+// in place.  Otherwise, each thread appends the new entry to its own list of
+// pending tuples, typecast to the type of the matrix.  If a single thread
+// modifies the same entry more than once, the last value it wrote is kept.  If
+// several threads modify the same entry, its final value is one of the values
+// written, but which one is unspecified.  These lists are
+// merged and assembled by GrB_Matrix_wait, or by any other method that uses
+// the matrix, which must not be called while any thread is still inserting
+// entries.  The pending tuples are not assembled by GrB_Matrix_setElement,
+// even in blocking mode.  This option requires GraphBLAS to be compiled with
+// OpenMP, and it is false by default.
+
 // GxB_Global_Option_set controls the global defaults used when a new matrix is
 // created.  GrB_init defines the following initial settings:
 //
@@ -4101,6 +4352,17 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
     ...                             // return value of the global option
 ) ;
 
+// Workspace used internally by GraphBLAS (by GrB_mxm in particular) is kept
+// in a workspace pool when it is no longer needed, so that it can be reused
+// by the next call to GraphBLAS instead of being freed and allocated again.
+// The total size of the pool is limited by GxB_WORKSPACE_MAX (256 MB by
+// default).  Setting GxB_WORKSPACE_MAX to a smaller value empties the pool.
+// GxB_Workspace_release frees all the workspace in the pool, and is done by
+// GrB_finalize as well.
+
+GB_PUBLIC
+GrB_Info GxB_Workspace_release (void) ; // free all workspace in the pool
+
 //==============================================================================
 // === GxB_set and GxB_get =====================================================
 //==============================================================================
@@ -4127,6 +4389,15 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GxB_CHUNK, double chunk) ;
 //      GxB_get (GxB_CHUNK, double *chunk) ;
 //
+//      GxB_set (GxB_SPARSITY_CONTROL, GxB_AUTO_SPARSITY) ;
+//      GxB_get (GxB_SPARSITY_CONTROL, int *sparsity) ;
+//
+//      GxB_set (GxB_BITMAP_SWITCH, double bitmap_switch) ;
+//      GxB_get (GxB_BITMAP_SWITCH, double *bitmap_switch) ;
+//
+//      GxB_set (GxB_WORKSPACE_MAX, int64_t workspace_max) ;
+//      GxB_get (GxB_WORKSPACE_MAX, int64_t *workspace_max) ;
+//
 //      GxB_set (GxB_BURBLE, bool burble) ;
 //      GxB_get (GxB_BURBLE, bool *burble) ;
 
@@ -4163,6 +4434,16 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 //      GxB_set (GrB_Matrix A, GxB_FORMAT, GxB_BY_ROW) ;
 //      GxB_set (GrB_Matrix A, GxB_FORMAT, GxB_BY_COL) ;
 //      GxB_get (GrB_Matrix A, GxB_FORMAT, GxB_Format_Value *s) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_SPARSITY_CONTROL, GxB_AUTO_SPARSITY) ;
+//      GxB_set (GrB_Matrix A, GxB_SPARSITY_CONTROL, GxB_SPARSE) ;
+//      GxB_get (GrB_Matrix A, GxB_SPARSITY_CONTROL, int *sparsity) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_BITMAP_SWITCH, double bitmap_switch) ;
+//      GxB_get (GrB_Matrix A, GxB_BITMAP_SWITCH, double *bitmap_switch) ;
+//
+//      GxB_set (GrB_Matrix A, GxB_CONCURRENT_INSERT, bool concurrent) ;
+//      GxB_get (GrB_Matrix A, GxB_CONCURRENT_INSERT, bool *concurrent) ;
 
 // To set/get the matrix GPU options: (DRAFT: in progress, do not use)
 //
@@ -4177,6 +4458,10 @@ GrB_Info GxB_Global_Option_get      // gets the current global default option
 // To get a matrix status (modified with GxB_HYPER, double h parameter):
 //
 //      GxB_get (GrB_Matrix A, GxB_IS_HYPER, bool *is_hyper) ;
+//
+// To get the current format of a matrix (modified with GxB_SPARSITY_CONTROL):
+//
+//      GxB_get (GrB_Matrix A, GxB_SPARSITY_STATUS, int *sparsity) ;
 
 // To set/get a descriptor field:
 //
@@ -8839,6 +9124,94 @@ GrB_Info GxB_Vector_export  // export and free a vector
 // first reformats the GrB_Matrix A into the desired format, and then exports
 // the result.
 
+//------------------------------------------------------------------------------
+// serialize/deserialize
+//------------------------------------------------------------------------------
+
+// GxB_Matrix_serialize copies the contents of a GrB_Matrix into a single
+// block of memory (the "blob"), in its native format (sparse, hypersparse,
+// bitmap, or full, and by row or by column).  The blob can be written to a
+// file, and later read back in and converted into a GrB_Matrix by
+// GxB_Matrix_deserialize, without the cost of sorting or building the matrix
+// from tuples.  The input matrix A is not modified, except that any pending
+// work is finished first.
+
+// The blob holds a header (with the dimensions, type, format, hyper_ratio,
+// and other settings of the matrix) followed by each array of the matrix.
+// Each array is split into blocks, which are compressed (if requested) and
+// decompressed in parallel.  The compression method is selected with the
+// GxB_COMPRESSION descriptor field (GxB_COMPRESSION_NONE by default, or
+// GxB_COMPRESSION_LZ4).  Blocks that do not compress are stored as-is.
+
+// On output, *blob_handle is allocated with the same malloc function used by
+// GraphBLAS (see GxB_init), and must be freed by the user application with
+// the corresponding free function.  The blob is specific to the word size and
+// byte order of the machine that created it.
+
+// GxB_Matrix_deserialize creates a new matrix C from a blob.  The type of C
+// must be given if the matrix has a user-defined type, and its size must
+// match the size recorded in the blob.  For built-in types, the type may be
+// NULL, in which case the type recorded in the blob is used, or it may be
+// the same built-in type.  GrB_INVALID_OBJECT is returned if the blob is
+// corrupted.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob in bytes
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor for compression and threads
+) ;
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_deserialize     // deserialize a blob into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,                  // output matrix created from the blob
+    // input:
+    GrB_Type type,                  // type of C; may be NULL if built-in
+    const void *blob,               // the blob
+    GrB_Index blob_size,            // size of the blob in bytes
+    const GrB_Descriptor desc       // descriptor for # of threads to use
+) ;
+
+// GxB_Matrix_import_mmap creates a new matrix A from a file that holds a
+// blob created by GxB_Matrix_serialize.  The file is mapped into memory, and
+// the arrays of A point directly into the mapping wherever the blob holds
+// them uncompressed (with GxB_COMPRESSION_NONE, or for blocks that did not
+// compress), so the matrix is available at once and its pages are read from
+// the file only as they are used.  Processes on the same machine that import
+// the same file share a single copy of it in the page cache.  Compressed
+// arrays, and the bitmap of a bitmap matrix, are copied into memory owned by
+// A instead.  The file itself is never modified.
+
+// The mapping is private and copy-on-write: A can be used as the output of
+// any GraphBLAS operation.  Entries modified in place are copied into private
+// pages, and A is given its own copy of all of its content when its structure
+// must change (or when it is exported).  The mapping is released when A is
+// freed or when it no longer refers to the file.  The file may be deleted
+// once A is created, but it must not be truncated or modified while A refers
+// to it.
+
+// Only the header and block structure of the file are checked, since
+// checking the content of A would require reading all of it; the file must be
+// one written from a valid blob.  If memory-mapped files are not available,
+// the file is read into memory with GxB_Matrix_deserialize instead.
+
+GB_PUBLIC
+GrB_Info GxB_Matrix_import_mmap     // import a matrix from a file, via mmap
+(
+    // output:
+    GrB_Matrix *A,                  // handle of matrix to create
+    // input:
+    GrB_Type type,                  // type of A; may be NULL if built-in
+    const char *filename,           // file holding a serialized matrix
+    const GrB_Descriptor desc       // descriptor for # of threads to use
+) ;
+
 //------------------------------------------------------------------------------
 // CUDA memory management (DRAFT: in progress, do not use)
 //------------------------------------------------------------------------------
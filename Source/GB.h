@@ -11,11 +11,7 @@
 // GraphBLAS itself.
 
 // Future plans: (see also 'grep -r FUTURE')
-// FUTURE: support for dense matrices (A->i and A->p as NULL pointers)
 // FUTURE: implement v1.3 of the API
-// FUTURE: add matrix I/O in binary format (see draft LAGraph_binread/binwrite)
-// FUTURE: add Heap method to GB_AxB_saxpy3 (inspector-executor style)
-// FUTURE: allow matrices and vectors to be left jumbled (sort left pending)
 
 #ifndef GB_H
 #define GB_H
@@ -351,6 +347,14 @@ GB_PUBLIC int GB_cover_max ;
 #define GB_ALWAYS_HYPER (1.0)
 #define GB_NEVER_HYPER  (-1.0)
 
+// the default sparsity control: matrices are never held in bitmap or full
+// format unless requested via GxB_SPARSITY_CONTROL
+#define GB_SPARSITY_DEFAULT GxB_SPARSE
+
+// default fraction of entries at which a matrix is converted to bitmap, if
+// its sparsity control includes GxB_BITMAP
+#define GB_BITMAP_SWITCH_DEFAULT (0.04)
+
 #define GB_FORCE_HYPER 1
 #define GB_FORCE_NONHYPER 0
 #define GB_AUTO_HYPER (-1)
@@ -367,12 +371,32 @@ GB_PUBLIC int GB_cover_max ;
 // macros for matrices and vectors
 //------------------------------------------------------------------------------
 
+// true if A is held in full format, with no A->p, A->h, A->i, or A->b
+#define GB_IS_FULL(A) \
+    (((A) != NULL) && (A)->p == NULL && (A)->h == NULL && (A)->i == NULL \
+    && (A)->b == NULL && (A)->x != NULL)
+
+// true if A is held in bitmap format
+#define GB_IS_BITMAP(A) (((A) != NULL) && (A)->b != NULL)
+
 // If A->nzmax is zero, then A->p might not be allocated.  Note that this
 // function does not count pending tuples; use GB_MATRIX_WAIT(A) first, if
 // needed.  For sparse or hypersparse matrix, Ap [0] == 0.  For a slice or
 // hyperslice, Ap [0] >= 0 points to the first entry in the slice.  For all 4
 // cases (sparse, hypersparse, slice, hyperslice), nnz(A) = Ap [nvec] - Ap [0].
-#define GB_NNZ(A) (((A)->nzmax > 0) ? ((A)->p [(A)->nvec] - (A)->p [0]) : 0 )
+// A full matrix has no A->p, and all vlen*vdim entries are present.  A
+// bitmap matrix has no A->p either, and A->nvals entries are present.
+#define GB_NNZ(A) \
+    (((A)->nzmax <= 0) ? 0 : (((A)->p != NULL) ?                           \
+    ((A)->p [(A)->nvec] - (A)->p [0]) :                                     \
+    (((A)->b != NULL) ? (A)->nvals : ((A)->vlen * (A)->vdim))))
+
+// Ap [k] and Ai [p] for a sparse, hypersparse, or full matrix A.  If A is
+// full, Ap and Ai are NULL, and are implicitly Ap [k] = k*avlen and
+// Ai [p] = p % avlen.  For a bitmap matrix, these give the position of
+// each entry that may be present, which must then be checked in A->b.
+#define GBP(Ap,k,avlen) (((Ap) == NULL) ? ((k) * (avlen)) : (Ap) [k])
+#define GBI(Ai,p,avlen) (((Ai) == NULL) ? ((p) % (avlen)) : (Ai) [p])
 
 // Upper bound on nnz(A) when the matrix has zombies and pending tuples;
 // does not need GB_MATRIX_WAIT(A) first.
@@ -1064,6 +1088,17 @@ GrB_Info GB_phix_free           // free all content of a matrix
     GrB_Matrix A                // matrix with content to free
 ) ;
 
+void GB_mmap_free               // release the file mapping of a matrix
+(
+    GrB_Matrix A                // matrix with mapping to release
+) ;
+
+GrB_Info GB_unshare             // give a matrix its own copy of its content
+(
+    GrB_Matrix A,               // matrix to modify
+    GB_Context Context
+) ;
+
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 bool GB_Type_compatible         // check if two types can be typecast
 (
@@ -1322,6 +1357,48 @@ void GB_free_memory
 #define GB_REALLOC(p,nnew,nold,type,ok) \
     p = (type *) GB_realloc_memory (nnew, nold, sizeof (type), (void *) p, ok)
 
+//------------------------------------------------------------------------------
+// workspace management
+//------------------------------------------------------------------------------
+
+// Workspace allocated by GB_workspace_malloc or GB_workspace_calloc may come
+// from the workspace pool, in which case it can be larger than requested.
+// Its size is returned in size_allocated, which must be passed to
+// GB_workspace_free when the workspace is no longer needed.
+
+void *GB_workspace_malloc   // pointer to workspace
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    size_t *size_allocated  // # of bytes in the workspace
+) ;
+
+void *GB_workspace_calloc   // pointer to workspace, set to zero
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    size_t *size_allocated, // # of bytes in the workspace
+    GB_Context Context
+) ;
+
+void GB_workspace_free
+(
+    void *p,                // workspace to free, or to return to the pool
+    size_t size_allocated   // # of bytes in the workspace
+) ;
+
+#define GB_WORK_CALLOC(n,type,s) \
+    (type *) GB_workspace_calloc (n, sizeof (type), s, Context)
+#define GB_WORK_MALLOC(n,type,s) \
+    (type *) GB_workspace_malloc (n, sizeof (type), s)
+
+#define GB_WORK_FREE(p,s)                                                     \
+{                                                                             \
+    GB_workspace_free ((void *) p, s) ;                                       \
+    (p) = NULL ;                                                              \
+    (s) = 0 ;                                                                 \
+}
+
 //------------------------------------------------------------------------------
 // macros to create/free matrices, vectors, and scalars
 //------------------------------------------------------------------------------
@@ -1466,7 +1543,19 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     void *X,                    // array for returning values of tuples
     GrB_Index *p_nvals,         // I,J,X size on input; # tuples on output
     const GB_Type_code xcode,   // type of array X
-    const GrB_Matrix A,         // matrix to extract tuples from
+    const GrB_Matrix A_in,      // matrix to extract tuples from
+    GB_Context Context
+) ;
+
+GrB_Info GB_extractElements     // X(k) = A(I(k),J(k)) for k = 0:n-1
+(
+    void *X,                    // array of size n for returning the values
+    int8_t *GB_RESTRICT Xb,     // array of size n: Xb [k] = 1 if present
+    const GrB_Index *I_in,      // row indices, of size n
+    const GrB_Index *J_in,      // column indices, of size n
+    const GrB_Index n,          // number of entries to extract
+    const GB_Type_code xcode,   // type of array X
+    const GrB_Matrix A,         // matrix to extract entries from
     GB_Context Context
 ) ;
 
@@ -1490,8 +1579,10 @@ static inline bool GB_is_dense
 )
 {
     // check if A is competely dense:  all entries present.
-    // zombies and pending tuples are not considered
-    if (A == NULL) return (false) ;
+    // zombies and pending tuples are not considered.  A bitmap matrix is
+    // never considered dense, since the dense methods do not access A->b, and
+    // neither is a jumbled matrix, since they do not access A->i.
+    if (A == NULL || A->b != NULL || A->jumbled) return (false) ;
     GrB_Index anzmax ;
     bool ok = GB_Index_multiply (&anzmax, A->vlen, A->vdim) ;
     return (ok && (anzmax == GB_NNZ (A))) ;
@@ -1529,6 +1620,10 @@ static inline bool GB_is_dense
 // by default, give each thread at least 64K units of work to do
 #define GB_CHUNK_DEFAULT (64*1024)
 
+// the workspace pool holds at most 16 blocks, of total size 256 MB by default
+#define GB_WORKSPACE_POOL 16
+#define GB_WORKSPACE_MAX_DEFAULT ((size_t) 256 * 1024 * 1024)
+
 //------------------------------------------------------------------------------
 
 GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
@@ -1615,6 +1710,76 @@ GrB_Info GB_to_hyper_conform    // conform a matrix to its desired format
     GB_Context Context
 ) ;
 
+GrB_Info GB_conform             // conform a matrix to its desired sparsity
+(
+    GrB_Matrix A,               // matrix to conform
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
+(
+    GrB_Matrix A,               // matrix to convert from full to sparse
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_sparse_to_full      // convert matrix from sparse to full
+(
+    GrB_Matrix A,               // matrix to convert from sparse to full
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
+(
+    GrB_Matrix A,               // matrix to convert from sparse to bitmap
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
+(
+    GrB_Matrix A,               // matrix to convert from bitmap to sparse
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_bitmap_worker   // extract the sparse content of a bitmap
+(
+    int64_t **Ap_handle,            // output: vector pointers, size avdim+1
+    int64_t **Ai_handle,            // output: indices, size max (anz,1)
+    GB_void **Ax_handle,            // output: values, size max (anz,1)
+    const GrB_Matrix A,             // bitmap matrix, not modified
+    GB_Context Context
+) ;
+
+GrB_Info GB_sparse_copy         // S = sparse copy of a full or bitmap matrix
+(
+    GrB_Matrix *Shandle,        // output matrix S
+    const GrB_Matrix A,         // full or bitmap input matrix, not modified
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_full_to_bitmap      // convert matrix from full to bitmap
+(
+    GrB_Matrix A,               // matrix to convert from full to bitmap
+    GB_Context Context
+) ;
+
+GrB_Info GB_convert_bitmap_to_full      // convert matrix from bitmap to full
+(
+    GrB_Matrix A,               // matrix to convert from bitmap to full
+    GB_Context Context
+) ;
+
+GrB_Info GB_create_full         // create a full matrix, with only A->x
+(
+    GrB_Matrix *Ahandle,        // output matrix to create
+    const GrB_Type type,        // type of output matrix
+    const int64_t vlen,         // length of each vector
+    const int64_t vdim,         // number of vectors
+    const bool is_csc,          // true if CSC, false if CSR
+    const double hyper_ratio,   // A->hyper_ratio
+    const int sparsity,         // A->sparsity
+    GB_Context Context
+) ;
+
 GrB_Info GB_hyper_prune
 (
     // output, not allocated on input:
@@ -1787,6 +1952,12 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     GB_Context Context
 ) ;
 
+GrB_Info GB_unjumble            // sort the vectors of a matrix
+(
+    GrB_Matrix A,               // matrix to sort
+    GB_Context Context
+) ;
+
 #define GB_FLIP(i)             (-(i)-2)
 #define GB_IS_FLIPPED(i)       ((i) < 0)
 #define GB_IS_ZOMBIE(i)        ((i) < 0)
@@ -1794,8 +1965,9 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
 #define GB_IS_NOT_ZOMBIE(i)    ((i) >= 0)
 #define GB_UNFLIP(i)           (((i) < 0) ? GB_FLIP(i) : (i))
 
-// true if a matrix has pending tuples
-#define GB_PENDING(A) ((A) != NULL && (A)->Pending != NULL)
+// true if a matrix has pending tuples, in A->Pending or in its slots
+#define GB_PENDING(A) \
+    ((A) != NULL && ((A)->Pending != NULL || (A)->Pending_slots_used))
 
 // true if a matrix is allowed to have pending tuples
 #define GB_PENDING_OK(A) (GB_PENDING (A) || !GB_PENDING (A))
@@ -1809,15 +1981,51 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
 // true if a matrix has pending tuples or zombies
 #define GB_PENDING_OR_ZOMBIES(A) (GB_PENDING (A) || GB_ZOMBIES (A))
 
-// do all pending updates:  delete zombies and assemble any pending tuples
+// true if a matrix may have unsorted vectors
+#define GB_JUMBLED(A) ((A) != NULL && (A)->jumbled)
+
+// true if a matrix is allowed to be jumbled
+#define GB_JUMBLED_OK(A) (GB_JUMBLED (A) || !GB_JUMBLED (A))
+
+// true if a matrix has pending tuples, zombies, or unsorted vectors
+#define GB_ANY_PENDING_WORK(A) (GB_PENDING_OR_ZOMBIES (A) || GB_JUMBLED (A))
+
+// do all pending updates:  delete zombies, sort any jumbled vectors, and
+// assemble any pending tuples
 #define GB_MATRIX_WAIT(A)                                               \
+{                                                                       \
+    if (GB_ANY_PENDING_WORK (A))                                        \
+    {                                                                   \
+        GB_OK (GB_Matrix_wait ((GrB_Matrix) A, Context)) ;              \
+        ASSERT (!GB_ZOMBIES (A)) ;                                      \
+        ASSERT (!GB_JUMBLED (A)) ;                                      \
+        ASSERT (!GB_PENDING (A)) ;                                      \
+    }                                                                   \
+}
+
+// do all pending updates, but only if zombies or pending tuples appear; a
+// jumbled matrix is left jumbled.  This is used by methods that do not depend
+// on the order of the entries in each vector.
+#define GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES(A)                         \
 {                                                                       \
     if (GB_PENDING_OR_ZOMBIES (A))                                      \
     {                                                                   \
         GB_OK (GB_Matrix_wait ((GrB_Matrix) A, Context)) ;              \
         ASSERT (!GB_ZOMBIES (A)) ;                                      \
+        ASSERT (!GB_JUMBLED (A)) ;                                      \
         ASSERT (!GB_PENDING (A)) ;                                      \
     }                                                                   \
+    ASSERT (GB_JUMBLED_OK (A)) ;                                        \
+}
+
+// sort the vectors of a jumbled matrix; zombies and pending tuples are OK
+#define GB_MATRIX_WAIT_IF_JUMBLED(A)                                    \
+{                                                                       \
+    if (GB_JUMBLED (A))                                                 \
+    {                                                                   \
+        GB_OK (GB_unjumble ((GrB_Matrix) A, Context)) ;                 \
+        ASSERT (!GB_JUMBLED (A)) ;                                      \
+    }                                                                   \
 }
 
 #define GB_VECTOR_WAIT(v) GB_MATRIX_WAIT (v)
@@ -1836,6 +2044,57 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     ASSERT (GB_ZOMBIES_OK (A)) ;                                              \
 }
 
+// convert a full or bitmap matrix to sparse, for methods that require its
+// pattern
+#define GB_ENSURE_SPARSE(A)                                                 \
+{                                                                           \
+    if (GB_IS_FULL (A))                                                     \
+    {                                                                       \
+        GB_OK (GB_convert_full_to_sparse ((GrB_Matrix) A, Context)) ;       \
+        ASSERT (!GB_IS_FULL (A)) ;                                          \
+    }                                                                       \
+    else if (GB_IS_BITMAP (A))                                              \
+    {                                                                       \
+        GB_OK (GB_convert_bitmap_to_sparse ((GrB_Matrix) A, Context)) ;     \
+        ASSERT (!GB_IS_BITMAP (A)) ;                                        \
+    }                                                                       \
+}
+
+// convert a bitmap matrix to sparse, for methods that can operate on full
+// matrices but not on bitmap matrices
+#define GB_ENSURE_SPARSE_OR_FULL(A)                                         \
+{                                                                           \
+    if (GB_IS_BITMAP (A))                                                   \
+    {                                                                       \
+        GB_OK (GB_convert_bitmap_to_sparse ((GrB_Matrix) A, Context)) ;     \
+        ASSERT (!GB_IS_BITMAP (A)) ;                                        \
+    }                                                                       \
+}
+
+// Replace a full or bitmap input matrix A with a temporary sparse copy,
+// A_sparse, for methods that require its pattern.  The matrix A itself is not
+// modified.  A_sparse must be NULL on input, and the caller must free it
+// (with GB_MATRIX_FREE) when done, or if an error occurs.
+#define GB_SPARSE_INPUT(A,A_sparse)                                         \
+{                                                                           \
+    if (GB_IS_FULL (A) || GB_IS_BITMAP (A))                                 \
+    {                                                                       \
+        GB_OK (GB_sparse_copy (&(A_sparse), A, Context)) ;                  \
+        A = A_sparse ;                                                      \
+    }                                                                       \
+}
+
+// as GB_SPARSE_INPUT, for methods that can operate on full matrices but not
+// on bitmap matrices
+#define GB_SPARSE_OR_FULL_INPUT(A,A_sparse)                                 \
+{                                                                           \
+    if (GB_IS_BITMAP (A))                                                   \
+    {                                                                       \
+        GB_OK (GB_sparse_copy (&(A_sparse), A, Context)) ;                  \
+        A = A_sparse ;                                                      \
+    }                                                                       \
+}
+
 // true if a matrix has no entries; zombies OK
 #define GB_EMPTY(A) ((GB_NNZ (A) == 0) && !GB_PENDING (A))
 
@@ -24,14 +24,8 @@
 #define GB_FREE_WORK                                            \
 {                                                               \
     GB_FREE (B_slice) ;                                         \
-    if (C_counts != NULL)                                       \
-    {                                                           \
-        for (int taskid = 0 ; taskid < naslice ; taskid++)      \
-        {                                                       \
-            GB_FREE (C_counts [taskid]) ;                       \
-        }                                                       \
-    }                                                           \
     GB_FREE (C_counts) ;                                        \
+    GB_WORK_FREE (C_count_all, C_count_all_size) ;              \
 }
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -84,6 +78,8 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
 
     int64_t *GB_RESTRICT B_slice = NULL ;
     int64_t **C_counts = NULL ;
+    int64_t *GB_RESTRICT C_count_all = NULL ;
+    size_t C_count_all_size = 0 ;
     int64_t cnvec = B->nvec ;
 
     //--------------------------------------------------------------------------
@@ -122,8 +118,12 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
         B->nvec_nonempty = GB_nvec_nonempty (B, NULL) ;
     }
 
-    C_counts = GB_CALLOC (naslice, int64_t *) ;
-    if (C_counts == NULL)
+    // C_counts [a_taskid] is a slice of C_count_all, of size B->nvec,
+    // taken from the workspace pool
+    C_counts = GB_MALLOC (naslice, int64_t *) ;
+    C_count_all = GB_WORK_CALLOC (naslice * B->nvec, int64_t,
+        &C_count_all_size) ;
+    if (C_counts == NULL || C_count_all == NULL)
     { 
         // out of memory
         GB_FREE_WORK ;
@@ -131,15 +131,8 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
     }
 
     for (int a_taskid = 0 ; a_taskid < naslice ; a_taskid++)
-    {
-        int64_t *GB_RESTRICT C_count = GB_CALLOC (B->nvec, int64_t) ;
-        if (C_count == NULL)
-        { 
-            // out of memory
-            GB_FREE_WORK ;
-            return (GrB_OUT_OF_MEMORY) ;
-        }
-        C_counts [a_taskid] = C_count ;
+    { 
+        C_counts [a_taskid] = C_count_all + a_taskid * B->nvec ;
     }
 
     for (int a_taskid = 0 ; a_taskid < naslice ; a_taskid++)
@@ -197,8 +190,6 @@ GrB_Info GB_AxB_dot2                // C=A'*B or C<!M>=A'*B, dot product method
         GB_memcpy (C->h, B->h, cnvec * sizeof (int64_t), nthreads) ;
     }
 
-    // free C_count for the first thread; it is no longer needed
-    GB_FREE (C_counts [0]) ;
     C->magic = GB_MAGIC ;
 
     //--------------------------------------------------------------------------
@@ -287,11 +287,20 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
     //--------------------------------------------------------------------------
 
     GB_FREE (TaskList) ;
+    int nfine ;
     GB_OK (GB_AxB_dot3_slice (&TaskList, &max_ntasks, &ntasks, &nthreads,
-        C, Context)) ;
+        &nfine, C, M, A, B, Context)) ;
 
     GBBURBLE ("nthreads %d ntasks %d ", nthreads, ntasks) ;
 
+    if (nfine > 0)
+    { 
+        // Costly entries C(i,j) are computed by teams of ultra-fine tasks.
+        // Their partial results are held in Ci,Cx [cnz:cnz+nfine-1].
+        GBBURBLE ("(%d ultra-fine) ", nfine) ;
+        GB_OK (GB_ix_realloc (C, cnz + nfine + 1, true, Context)) ;
+    }
+
     //--------------------------------------------------------------------------
     // C<M> = A'*B, via masked dot product method and built-in semiring
     //--------------------------------------------------------------------------
@@ -442,6 +451,66 @@ GrB_Info GB_AxB_dot3                // C<M> = A'*B using dot product method
         }
     }
 
+    //--------------------------------------------------------------------------
+    // sum up the partial results of the ultra-fine tasks
+    //--------------------------------------------------------------------------
+
+    if (nfine > 0)
+    {
+        GxB_binary_function fadd = add->op->function ;
+        size_t csize = C->type->size ;
+        int64_t *GB_RESTRICT Ci = C->i ;
+        GB_void *GB_RESTRICT Cx = (GB_void *) C->x ;
+        int64_t nzombies = 0 ;
+
+        int taskid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+            reduction(+:nzombies)
+        for (taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+            // get the team of ultra-fine tasks that computes C(i,j)
+            int team_size = TaskList [taskid].len ;
+            if (TaskList [taskid].klast != -1 || team_size == 0) continue ;
+            int64_t pM = TaskList [taskid].pM ;
+            int64_t pC = TaskList [taskid].pC ;
+            int64_t i = Mi [pM] ;
+
+            // C(i,j) = sum of the partial results of the team
+            bool cij_exists = false ;
+            for (int64_t p = pC ; p < pC + team_size ; p++)
+            {
+                if (Ci [p] < 0)
+                { 
+                    // this partial result does not exist
+                    continue ;
+                }
+                else if (cij_exists)
+                { 
+                    // C(i,j) += partial result
+                    fadd (Cx +(pM*csize), Cx +(pM*csize), Cx +(p*csize)) ;
+                }
+                else
+                { 
+                    // C(i,j) = partial result
+                    memcpy (Cx +(pM*csize), Cx +(p*csize), csize) ;
+                    cij_exists = true ;
+                }
+            }
+
+            if (cij_exists)
+            { 
+                Ci [pM] = i ;
+            }
+            else
+            { 
+                // C(i,j) is a zombie
+                nzombies++ ;
+                Ci [pM] = GB_FLIP (i) ;
+            }
+        }
+        C->nzombies += nzombies ;
+    }
+
     //--------------------------------------------------------------------------
     // free workspace and return result
     //--------------------------------------------------------------------------
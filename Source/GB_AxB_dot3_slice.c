@@ -15,13 +15,25 @@
 
 // The strategy for slicing of C and M is like GB_ek_slice, for coarse tasks.
 // These coarse tasks differ from the tasks generated by GB_ewise_slice,
-// since they may start in the middle of a vector.  If a single entry C(i,j)
-// is costly to compute, it is possible that it is placed by itself in a
-// single coarse task.
-
-// FUTURE:: Ultra-fine tasks could also be constructed, so that the computation
-// of a single entry C(i,j) can be broken into multiple tasks.  The slice of
-// A(:,i) and B(:,j) would use GB_slice_vector, where no mask would be used.
+// since they may start in the middle of a vector.
+
+// If a single entry C(i,j) is costly to compute, the dot product for that
+// entry is split into a team of ultra-fine tasks.  Each ultra-fine task
+// computes a partial dot product A(k1:k2,i)'*B(k1:k2,j), for a unique range
+// k1:k2.  The ranges are found by slicing the shorter of the two vectors
+// A(:,i) and B(:,j) into equal parts, since the work to compute C(i,j) is
+// proportional to the length of the shorter vector.  The partial result of
+// each ultra-fine task is held in the workspace in Ci and Cx [cnz ...], past
+// the end of the entries of C.  These are summed by GB_AxB_dot3 when all
+// tasks are finished.
+
+// An ultra-fine task is denoted by TaskList [taskid].klast == -1, where
+// kfirst is the vector C(:,j) that contains C(i,j), and pM is the position
+// of C(i,j) and M(i,j).  Its partial result is computed from A(:,i) in Ai,Ax
+// [pA ... pA_end-1] and B(:,j) in Bi,Bx [pB ... pB_end-1], and held in Ci,Cx
+// [pC].  The ultra-fine tasks for a single C(i,j) are consecutive in the
+// TaskList, and len is the size of the team for the first task in the team,
+// and zero for the others.
 
 #define GB_FREE_WORK \
     GB_FREE (Coarse) ;
@@ -35,6 +47,53 @@
 #include "GB_mxm.h"
 #include "GB_ek_slice.h"
 
+// a single entry C(i,j) is split if its work exceeds GB_COSTLY times the
+// target task size
+#define GB_COSTLY 2
+
+// the work for each entry is scaled, if needed, so that its cumulative sum
+// is at most GB_DOT3_WORK_MAX + cnz
+#define GB_DOT3_WORK_MAX ((double) (INT64_MAX / 4))
+
+//------------------------------------------------------------------------------
+// GB_create_dot3_coarse_task: create a coarse task for Ci,Cx [pfirst:plast]
+//------------------------------------------------------------------------------
+
+static inline void GB_create_dot3_coarse_task
+(
+    GB_task_struct *GB_RESTRICT TaskList,
+    const int taskid,
+    const int64_t pfirst,
+    const int64_t plast,
+    const int64_t *GB_RESTRICT Cp,
+    const int64_t cnvec
+)
+{
+    ASSERT (pfirst <= plast) ;
+
+    // find the first vector of the slice for task taskid: the
+    // vector that owns the entry Ci [pfirst] and Cx [pfirst].
+    int64_t kfirst = GB_search_for_vector (pfirst, Cp, 0, cnvec) ;
+
+    // find the last vector of the slice for task taskid: the
+    // vector that owns the entry Ci [plast] and Cx [plast].
+    int64_t klast = GB_search_for_vector (plast, Cp, kfirst, cnvec) ;
+
+    // construct a coarse task that computes Ci,Cx [pfirst:plast].
+    // These entries appear in C(:,kfirst:klast), but this task does
+    // not compute all of C(:,kfirst), but just the subset starting at
+    // Ci,Cx [pstart].  The task computes all of the vectors
+    // C(:,kfirst+1:klast-1).  The task computes only part of the last
+    // vector, ending at Ci,Cx [pC_end-1] or Ci,Cx [plast].  This
+    // slice strategy is the same as GB_ek_slice.
+
+    TaskList [taskid].kfirst = kfirst ;
+    TaskList [taskid].klast  = klast ;
+    ASSERT (kfirst <= klast) ;
+    TaskList [taskid].pC     = pfirst ;
+    TaskList [taskid].pC_end = plast + 1 ;
+}
+
 //------------------------------------------------------------------------------
 // GB_AxB_dot3_slice
 //------------------------------------------------------------------------------
@@ -46,8 +105,12 @@ GrB_Info GB_AxB_dot3_slice
     int *p_max_ntasks,              // size of TaskList
     int *p_ntasks,                  // # of tasks constructed
     int *p_nthreads,                // # of threads to use
+    int *p_nfine,                   // # of ultra-fine tasks constructed
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix; C has the same pattern
+    const GrB_Matrix A,             // input matrix, for C<M>=A'*B
+    const GrB_Matrix B,             // input matrix
     GB_Context Context
 )
 {
@@ -60,6 +123,7 @@ GrB_Info GB_AxB_dot3_slice
     ASSERT (p_max_ntasks != NULL) ;
     ASSERT (p_ntasks != NULL) ;
     ASSERT (p_nthreads != NULL) ;
+    ASSERT (p_nfine != NULL) ;
     // ASSERT_MATRIX_OK (C, ...) cannot be done since C->i is the work need to
     // compute the entry, not the row index itself.
 
@@ -67,6 +131,7 @@ GrB_Info GB_AxB_dot3_slice
     (*p_max_ntasks) = 0 ;
     (*p_ntasks    ) = 0 ;
     (*p_nthreads  ) = 1 ;
+    (*p_nfine     ) = 0 ;
 
     //--------------------------------------------------------------------------
     // determine # of threads to use
@@ -75,22 +140,65 @@ GrB_Info GB_AxB_dot3_slice
     GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
 
     //--------------------------------------------------------------------------
-    // get C
+    // get C, M, A, and B
     //--------------------------------------------------------------------------
 
     const int64_t *GB_RESTRICT Cp = C->p ;
+    const int64_t *GB_RESTRICT Ch = C->h ;
     int64_t *GB_RESTRICT Cwork = C->i ;
     const int64_t cnvec = C->nvec ;
     const int64_t cnz = GB_NNZ (C) ;
 
+    const int64_t *GB_RESTRICT Mi = M->i ;
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+    const bool A_is_hyper = A->is_hyper ;
+
+    const int64_t *GB_RESTRICT Bp = B->p ;
+    const int64_t *GB_RESTRICT Bh = B->h ;
+    const int64_t *GB_RESTRICT Bi = B->i ;
+    const int64_t bnvec = B->nvec ;
+    const bool B_is_hyper = B->is_hyper ;
+
     //--------------------------------------------------------------------------
-    // compute the cumulative sum of the work
+    // compute the total work, and scale it if it could overflow
     //--------------------------------------------------------------------------
 
-    // FUTURE:: handle possible int64_t overflow
+    // The work for each entry is at most min (nnz (A (:,i)), nnz (B (:,j)))+1,
+    // but the total work can exceed INT64_MAX.  If so, the work for each entry
+    // is scaled down, so that the cumulative sum below does not overflow.
+    // Only the relative work of each entry is needed to construct the tasks.
+
+    int nth = GB_nthreads (cnz, chunk, nthreads_max) ;
+    double total_work = 0 ;
+    int64_t p ;
+    #pragma omp parallel for num_threads(nth) schedule(static) \
+        reduction(+:total_work)
+    for (p = 0 ; p < cnz ; p++)
+    {
+        total_work += (double) Cwork [p] ;
+    }
+
+    if (total_work > GB_DOT3_WORK_MAX)
+    {
+        double scale = GB_DOT3_WORK_MAX / total_work ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (p = 0 ; p < cnz ; p++)
+        {
+            // round up so that each entry still has some work
+            Cwork [p] = (int64_t) ceil (((double) Cwork [p]) * scale) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // compute the cumulative sum of the work
+    //--------------------------------------------------------------------------
 
-    GB_cumsum (Cwork, cnz, NULL, GB_nthreads (cnz, chunk, nthreads_max)) ;
-    double total_work = (double) Cwork [cnz] ;
+    GB_cumsum (Cwork, cnz, NULL, nth) ;
+    double total_scaled_work = (double) Cwork [cnz] ;
 
     //--------------------------------------------------------------------------
     // allocate the initial TaskList
@@ -102,6 +210,7 @@ GrB_Info GB_AxB_dot3_slice
     GB_task_struct *GB_RESTRICT TaskList = NULL ;
     int max_ntasks = 0 ;
     int ntasks = 0 ;
+    int nfine = 0 ;
     int ntasks0 = (nthreads == 1) ? 1 : (32 * nthreads) ;
     GB_REALLOC_TASK_LIST (TaskList, ntasks0, max_ntasks) ;
 
@@ -110,7 +219,7 @@ GrB_Info GB_AxB_dot3_slice
     //--------------------------------------------------------------------------
 
     if (cnvec == 0 || ntasks0 == 1)
-    { 
+    {
         // construct a single coarse task that does all the work
         TaskList [0].kfirst = 0 ;
         TaskList [0].klast  = cnvec-1 ;
@@ -127,9 +236,9 @@ GrB_Info GB_AxB_dot3_slice
     // determine # of threads and tasks
     //--------------------------------------------------------------------------
 
-    double target_task_size = total_work / (double) (ntasks0) ;
+    double target_task_size = total_scaled_work / (double) (ntasks0) ;
     target_task_size = GB_IMAX (target_task_size, chunk) ;
-    ntasks1 = total_work / target_task_size ;
+    ntasks1 = total_scaled_work / target_task_size ;
     ntasks1 = GB_IMIN (ntasks1, cnz) ;
     ntasks1 = GB_IMAX (ntasks1, 1) ;
 
@@ -138,14 +247,14 @@ GrB_Info GB_AxB_dot3_slice
     //--------------------------------------------------------------------------
 
     if (!GB_pslice (&Coarse, Cwork, cnz, ntasks1))
-    { 
+    {
         // out of memory
         GB_FREE_ALL ;
         return (GB_OUT_OF_MEMORY) ;
     }
 
     //--------------------------------------------------------------------------
-    // construct all tasks, both coarse and fine
+    // construct all tasks, both coarse and ultra-fine
     //--------------------------------------------------------------------------
 
     for (int t = 0 ; t < ntasks1 ; t++)
@@ -158,41 +267,121 @@ GrB_Info GB_AxB_dot3_slice
         int64_t pfirst = Coarse [t] ;
         int64_t plast  = Coarse [t+1] - 1 ;
 
-        if (pfirst <= plast)
-        { 
-            // find the first vector of the slice for task taskid: the
-            // vector that owns the entry Ci [pfirst] and Cx [pfirst].
-            int64_t kfirst = GB_search_for_vector (pfirst, Cp, 0, cnvec) ;
-
-            // find the last vector of the slice for task taskid: the
-            // vector that owns the entry Ci [plast] and Cx [plast].
-            int64_t klast = GB_search_for_vector (plast, Cp, kfirst, cnvec) ;
-
-            // construct a coarse task that computes Ci,Cx [pfirst:plast].
-            // These entries appear in C(:,kfirst:klast), but this task does
-            // not compute all of C(:,kfirst), but just the subset starting at
-            // Ci,Cx [pstart].  The task computes all of the vectors
-            // C(:,kfirst+1:klast-1).  The task computes only part of the last
-            // vector, ending at Ci,Cx [pC_end-1] or Ci,Cx [plast].  This
-            // slice strategy is the same as GB_ek_slice.
+        if (pfirst > plast)
+        {
+            // This task is empty, which means the coarse task that computes
+            // C(i,j) is doing too much work.  Its work is split below.
+            continue ;
+        }
 
+        double task_work = (double) (Cwork [plast+1] - Cwork [pfirst]) ;
+        if (task_work <= GB_COSTLY * target_task_size)
+        {
+            // This coarse task is OK as-is.
             GB_REALLOC_TASK_LIST (TaskList, ntasks + 1, max_ntasks) ;
-            TaskList [ntasks].kfirst = kfirst ;
-            TaskList [ntasks].klast  = klast ;
-            ASSERT (kfirst <= klast) ;
-            TaskList [ntasks].pC     = pfirst ;
-            TaskList [ntasks].pC_end = plast + 1 ;
-            ntasks++ ;
+            GB_create_dot3_coarse_task (TaskList, ntasks++, pfirst, plast,
+                Cp, cnvec) ;
+            continue ;
+        }
 
+        //----------------------------------------------------------------------
+        // split a costly coarse task into coarse and ultra-fine tasks
+        //----------------------------------------------------------------------
+
+        // Each costly entry C(i,j) in Ci,Cx [pfirst:plast] is computed by a
+        // team of ultra-fine tasks, and the entries between them are
+        // computed by coarse tasks.
+
+        int64_t pcoarse_start = pfirst ;
+        for (int64_t pC = pfirst ; pC <= plast ; pC++)
+        {
+            double pwork = (double) (Cwork [pC+1] - Cwork [pC]) ;
+            if (pwork <= GB_COSTLY * target_task_size) continue ;
+
+            //------------------------------------------------------------------
+            // get A(:,i) and B(:,j) for this costly entry C(i,j)
+            //------------------------------------------------------------------
+
+            int64_t k = GB_search_for_vector (pC, Cp, 0, cnvec) ;
+            int64_t j = (Ch == NULL) ? k : Ch [k] ;
+            int64_t i = Mi [pC] ;
+            int64_t pA, pA_end, pB, pB_end ;
+            int64_t apleft = 0, bpleft = 0 ;
+            GB_lookup (A_is_hyper, Ah, Ap, &apleft, anvec-1, i, &pA, &pA_end) ;
+            GB_lookup (B_is_hyper, Bh, Bp, &bpleft, bnvec-1, j, &pB, &pB_end) ;
+            int64_t ainz = pA_end - pA ;
+            int64_t bjnz = pB_end - pB ;
+
+            // each ultra-fine task has at least one entry of the shorter
+            // vector, A(:,i) or B(:,j)
+            int team_size = (int) GB_IMIN (ceil (pwork / target_task_size),
+                GB_IMIN (ainz, bjnz)) ;
+            if (team_size <= 1) continue ;
+
+            //------------------------------------------------------------------
+            // flush the prior coarse task, if any
+            //------------------------------------------------------------------
+
+            GB_REALLOC_TASK_LIST (TaskList, ntasks + team_size + 1, max_ntasks);
+            if (pcoarse_start < pC)
+            {
+                GB_create_dot3_coarse_task (TaskList, ntasks++, pcoarse_start,
+                    pC-1, Cp, cnvec) ;
+            }
+            pcoarse_start = pC+1 ;
+
+            //------------------------------------------------------------------
+            // construct the team of ultra-fine tasks for C(i,j)
+            //------------------------------------------------------------------
+
+            // slice the shorter vector into equal parts, and find the
+            // matching part of the longer vector with a binary search
+            bool slice_A = (ainz <= bjnz) ;
+            const int64_t *GB_RESTRICT Si = slice_A ? Ai : Bi ;
+            int64_t ps  = slice_A ? pA : pB ;
+            int64_t snz = slice_A ? ainz : bjnz ;
+
+            for (int fid = 0 ; fid < team_size ; fid++)
+            {
+                int64_t pA_last = pA_end ;
+                int64_t pB_last = pB_end ;
+                if (fid < team_size - 1)
+                {
+                    // this task does A(k1:k2-1,i)'*B(k1:k2-1,j), where k2 is
+                    // the first index in the next part of the shorter vector
+                    int64_t k2 = Si [ps + (int64_t) GB_PART (fid+1, snz,
+                        team_size)] ;
+                    int64_t pright = pA_end ;
+                    pA_last = pA ;
+                    GB_TRIM_BINARY_SEARCH (k2, Ai, pA_last, pright) ;
+                    pright = pB_end ;
+                    pB_last = pB ;
+                    GB_TRIM_BINARY_SEARCH (k2, Bi, pB_last, pright) ;
+                }
+                TaskList [ntasks].kfirst = k ;
+                TaskList [ntasks].klast  = -1 ;
+                TaskList [ntasks].pC     = cnz + nfine ;
+                TaskList [ntasks].pC_end = cnz + nfine + 1 ;
+                TaskList [ntasks].pM     = pC ;
+                TaskList [ntasks].pM_end = pC + 1 ;
+                TaskList [ntasks].pA     = pA ;
+                TaskList [ntasks].pA_end = pA_last ;
+                TaskList [ntasks].pB     = pB ;
+                TaskList [ntasks].pB_end = pB_last ;
+                TaskList [ntasks].len    = (fid == 0) ? team_size : 0 ;
+                ntasks++ ;
+                nfine++ ;
+                pA = pA_last ;
+                pB = pB_last ;
+            }
         }
-        else
-        { 
-            // This task is empty, which means the coarse task that computes
-            // C(i,j) is doing too much work.
-            // FUTURE:: Use ultra-fine tasks here instead, and split the work
-            // for computing the single dot product C(i,j) amongst several
-            // ultra-fine tasks.
-            ;
+
+        // flush the last coarse task, if any
+        if (pcoarse_start <= plast)
+        {
+            GB_REALLOC_TASK_LIST (TaskList, ntasks + 1, max_ntasks) ;
+            GB_create_dot3_coarse_task (TaskList, ntasks++, pcoarse_start,
+                plast, Cp, cnvec) ;
         }
     }
 
@@ -207,6 +396,7 @@ GrB_Info GB_AxB_dot3_slice
     (*p_max_ntasks) = max_ntasks ;
     (*p_ntasks    ) = ntasks ;
     (*p_nthreads  ) = nthreads ;
+    (*p_nfine     ) = nfine ;
     return (GrB_SUCCESS) ;
 }
 
@@ -78,7 +78,7 @@ GrB_Info GB_AxB_dot4                // C+=A'*B, dot product method
         (semiring == GrB_PLUS_TIMES_SEMIRING_FP32 ||
          semiring == GxB_PLUS_SECOND_FP32) && GB_VECTOR_OK (C)
         && GB_is_dense (C) && GB_is_dense (B) && GB_VECTOR_OK (B) && !flipxy
-        && !GB_IS_HYPER (A))
+        && !GB_IS_HYPER (A) && !GB_IS_FULL (A) && !GB_IS_FULL (B))
     {
 
         info = // GrB_NO_VALUE ;
@@ -21,9 +21,8 @@
 // (Gustavson), a heap-based saxpy method, or a dot product method.  The
 // AxB_method can modify this automatic choice, if set to a non-default value.
 // AxB_method_used is DOT, SAXPY, or DEFAULT (the latter denotes the row/col
-// scaling methods).
-
-// FUTURE:: an outer-product method for C=A*B'
+// scaling methods).  C=A*B' may be computed by an outer-product method,
+// without transposing B, if it does less work than the saxpy method.
 
 #define GB_FREE_ALL             \
 {                               \
@@ -31,6 +30,9 @@
     GB_MATRIX_FREE (&AT) ;      \
     GB_MATRIX_FREE (&BT) ;      \
     GB_MATRIX_FREE (&MT) ;      \
+    GB_MATRIX_FREE (&A_sparse) ;\
+    GB_MATRIX_FREE (&B_sparse) ;\
+    GB_MATRIX_FREE (&M_sparse) ;\
 }
 
 #include "GB_mxm.h"
@@ -89,17 +91,14 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
     GrB_Matrix AT = NULL ;
     GrB_Matrix BT = NULL ;
     GrB_Matrix MT = NULL ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix B_sparse = NULL ;
+    GrB_Matrix M_sparse = NULL ;
 
     (*mask_applied) = false ;
     (*done_in_place) = false ;
     (*AxB_method_used) = GxB_DEFAULT ;
 
-    if (AxB_method == GxB_AxB_HEAP)
-    { 
-        // FUTURE::: Heap method not yet reinstalled; using Hash instead
-        AxB_method = GxB_AxB_HASH ;
-    }
-
     //--------------------------------------------------------------------------
     // see if the work can be done in place
     //--------------------------------------------------------------------------
@@ -277,7 +276,13 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         M_transposed = false ;
     }
 
+    // All methods require the mask to have sorted vectors.  A and B can be
+    // left jumbled by GB_mxm; they are sorted below only if the method
+    // selected requires it.  Only saxpy3 can use a jumbled A or B, and then
+    // only if M is not present and the Heap method is not requested.
+    GB_MATRIX_WAIT_IF_JUMBLED (M) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "final M for A*B", GB0) ;
+    bool saxpy3_A_sorted = (M != NULL || AxB_method == GxB_AxB_HEAP) ;
 
     //--------------------------------------------------------------------------
     // check additional conditions for in-place computation of C
@@ -420,8 +425,10 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
                 // when C is a matrix, C=A'*B uses the dot product method if A
                 // or B are dense, since the dot product method requires no
                 // workspace in that case and can exploit dense vectors of A
-                // and/or B.
-                do_adotb = GB_is_dense (A) || GB_is_dense (B) ;
+                // and/or B.  It is also used if B is bitmap, since the dot
+                // product method can then find each B(k,j) in O(1) time.
+                do_adotb = GB_is_dense (A) || GB_is_dense (B)
+                    || GB_IS_BITMAP (B) ;
             }
         }
         else
@@ -430,6 +437,44 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
             do_adotb = (AxB_method == GxB_AxB_DOT) ;
         }
 
+        //----------------------------------------------------------------------
+        // convert A and B to sparse, if needed
+        //----------------------------------------------------------------------
+
+        // The in-place dot4 method can operate on full matrices A and B.  The
+        // dot2 method (C=A'*B or C<!M>=A'*B) can operate on a full or bitmap
+        // B, and a full or bitmap mask M.  All other methods require A, B,
+        // and M to be sparse.  The inputs are not modified; temporary sparse
+        // copies are used instead, and freed when done.
+
+        bool do_dot4 = do_adotb && can_do_in_place && M == NULL && !Mask_comp ;
+        bool do_dot2 = do_adotb && !do_dot4 && (M == NULL || Mask_comp) ;
+
+        if (do_dot4)
+        { 
+            GB_SPARSE_OR_FULL_INPUT (A, A_sparse) ;
+            GB_SPARSE_OR_FULL_INPUT (B, B_sparse) ;
+        }
+        else if (do_dot2)
+        { 
+            GB_SPARSE_INPUT (A, A_sparse) ;
+        }
+        else
+        { 
+            GB_SPARSE_INPUT (A, A_sparse) ;
+            GB_SPARSE_INPUT (B, B_sparse) ;
+            GB_SPARSE_INPUT (M, M_sparse) ;
+        }
+
+        // A is transposed for colscale and saxpy3, which sorts it, and B is
+        // diagonal for colscale.  The dot product and rowscale methods
+        // require A and B to be sorted.
+        if (do_rowscale || do_adotb)
+        { 
+            GB_MATRIX_WAIT_IF_JUMBLED (A) ;
+            GB_MATRIX_WAIT_IF_JUMBLED (B) ;
+        }
+
         //----------------------------------------------------------------------
         // C<M>=A'*B
         //----------------------------------------------------------------------
@@ -477,10 +522,15 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // C<M> = A*B'
         //----------------------------------------------------------------------
 
+        GB_SPARSE_INPUT (A, A_sparse) ;
+        GB_SPARSE_INPUT (B, B_sparse) ;
+        GB_SPARSE_INPUT (M, M_sparse) ;
+
         if (M == NULL && GB_is_diagonal (B, Context))
         { 
             // C = A*D
             GBBURBLE ("C%s=A*B', colscale ", M_str) ;
+            GB_MATRIX_WAIT_IF_JUMBLED (A) ;
             GB_OK (GB_AxB_colscale (Chandle, A, B, semiring, flipxy, Context)) ;
         }
         else if (M == NULL && GB_is_diagonal (A, Context))
@@ -507,13 +557,32 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         }
         else
         { 
-            // C = A*B' via saxpy3: Gustavson + Hash method
-            GBBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
-            GB_OK (GB_transpose (&BT, btype_required, true, B,
-                NULL, NULL, NULL, false, Context)) ;
-            GB_OK (GB_AxB_saxpy3 (Chandle, M, Mask_comp, Mask_struct,
-                A, BT, semiring, flipxy, mask_applied, AxB_method, Context)) ;
-            (*AxB_method_used) = GxB_AxB_SAXPY ;
+            bool done_outer = false ;
+            if (M == NULL && AxB_method == GxB_DEFAULT
+                && !GB_JUMBLED (A) && !GB_JUMBLED (B))
+            {
+                // try C = A*B' via outer products, without transposing B
+                info = GB_AxB_outer (Chandle, A, B, semiring, flipxy, Context);
+                if (info != GrB_NO_VALUE)
+                { 
+                    GB_OK (info) ;
+                    GBBURBLE ("C=A*B', outer_product ") ;
+                    (*AxB_method_used) = GxB_AxB_SAXPY ;
+                    done_outer = true ;
+                }
+            }
+            if (!done_outer)
+            {
+                // C = A*B' via saxpy3: Gustavson + Hash method
+                GBBURBLE ("C%s=A*B', saxpy (transposed %s) ", M_str, B_str) ;
+                if (saxpy3_A_sorted) GB_MATRIX_WAIT_IF_JUMBLED (A) ;
+                GB_OK (GB_transpose (&BT, btype_required, true, B,
+                    NULL, NULL, NULL, false, Context)) ;
+                GB_OK (GB_AxB_saxpy3 (Chandle, M, Mask_comp, Mask_struct,
+                    A, BT, semiring, flipxy, mask_applied, AxB_method,
+                    Context)) ;
+                (*AxB_method_used) = GxB_AxB_SAXPY ;
+            }
         }
 
     }
@@ -524,22 +593,29 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         // C<M> = A*B
         //----------------------------------------------------------------------
 
+        GB_SPARSE_INPUT (A, A_sparse) ;
+        GB_SPARSE_INPUT (B, B_sparse) ;
+        GB_SPARSE_INPUT (M, M_sparse) ;
+
         if (M == NULL && GB_is_diagonal (B, Context))
         { 
             // C = A*D, column scale
             GBBURBLE ("C%s=A*B, colscale ", M_str) ;
+            GB_MATRIX_WAIT_IF_JUMBLED (A) ;
             GB_OK (GB_AxB_colscale (Chandle, A, B, semiring, flipxy, Context)) ;
         }
         else if (M == NULL && GB_is_diagonal (A, Context))
         { 
             // C = D*B, row scale
             GBBURBLE ("C%s=A*B, rowscale ", M_str) ;
+            GB_MATRIX_WAIT_IF_JUMBLED (B) ;
             GB_OK (GB_AxB_rowscale (Chandle, A, B, semiring, flipxy, Context)) ;
         }
         else if (AxB_method == GxB_AxB_DOT)
         { 
             // C<M>=A*B via dot product, or C_in_place<M>+=A*B if in place
             GBBURBLE ("C%s=A*B', dot_product (transposed %s) ", M_str, A_str) ;
+            GB_MATRIX_WAIT_IF_JUMBLED (B) ;
             GB_OK (GB_transpose (&AT, atype_required, true, A,
                 NULL, NULL, NULL, false, Context)) ;
             GB_OK (GB_AxB_dot (Chandle, (can_do_in_place) ? C_in_place : NULL,
@@ -551,6 +627,7 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
         { 
             // C = A*B via saxpy3: Gustavson + Hash method
             GBBURBLE ("C%s=A*B, saxpy ", M_str) ;
+            if (saxpy3_A_sorted) GB_MATRIX_WAIT_IF_JUMBLED (A) ;
             GB_OK (GB_AxB_saxpy3 (Chandle, M, Mask_comp, Mask_struct,
                 A, B, semiring, flipxy, mask_applied, AxB_method, Context)) ;
             (*AxB_method_used) = GxB_AxB_SAXPY ;
@@ -589,6 +666,9 @@ GrB_Info GB_AxB_meta                // C<M>=A*B meta algorithm
 
     GB_MATRIX_FREE (&AT) ;
     GB_MATRIX_FREE (&BT) ;
+    GB_MATRIX_FREE (&A_sparse) ;
+    GB_MATRIX_FREE (&B_sparse) ;
+    GB_MATRIX_FREE (&M_sparse) ;
     ASSERT_MATRIX_OK_OR_NULL (MT, "MT if computed", GB0) ;
     if (MT_handle != NULL)
     { 
@@ -0,0 +1,499 @@
+//------------------------------------------------------------------------------
+// GB_AxB_outer: compute C=A*B' via outer products
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C = A*B' is computed as the sum of the outer products A(:,k)*B(:,k)', for
+// each k, without forming B' explicitly.  A is m-by-K and B is n-by-K, and
+// both are sparse or hypersparse (not bitmap or full), so C is m-by-n.  No
+// mask is used.
+
+// The columns of C are partitioned into ntasks slices, C(:,j1:j2-1), each
+// with roughly the same number of flops.  Each task traverses all vectors
+// B(:,k), and finds the entries B(j,k) with j in the range j1:j2-1 by a
+// binary search (if ntasks > 1).  Each product A(i,k)*B(j,k) is accumulated
+// into a workspace private to the task, for all (i,j) in its slice of C.
+// If m*(j2-j1) is small enough, the workspace is dense (Gustavson's method),
+// and the entries C(i,j) are found by direct addressing.  Otherwise, the task
+// uses a hash table of size at least twice its number of flops, whose
+// entries are sorted by column and row index once all flops are done.  The
+// entries of all tasks are then gathered into C, which is not jumbled.
+
+// The method is selected only if it costs less than transposing B for the
+// saxpy3 method.  Since each task must scan all of B, the total work is
+// O(flops + ntasks*bnvec*log(bnz)), plus the time to sort the result of each
+// hash task.  Each flop costs much more here than in saxpy3, since this
+// method uses function pointers and its hash tables are sorted, while the
+// transpose of B costs O(nnz(B) + B->vlen + B->vdim).  As a result, the
+// method is only worthwhile if the flops are a small fraction of the size of
+// B.  If the method is not worthwhile, it returns GrB_NO_VALUE, and C is
+// computed by GB_AxB_saxpy3 instead, with B explicitly transposed.
+
+// This method uses function pointers and typecasting for all types and
+// operators.
+
+#include "GB_mxm.h"
+#include "GB_sort.h"
+#include "GB_atomics.h"
+
+// the method is used only if
+// flops * GB_OUTER_RATIO <= nnz (B) + B->vlen + B->vdim
+#define GB_OUTER_RATIO 16
+
+// each task computes C(:,j1:j2-1) in its own workspace
+typedef struct
+{
+    int64_t j1 ;            // first column of C for this task
+    int64_t j2 ;            // the task computes C(:,j1:j2-1)
+    int64_t hoff ;          // task workspace is in Hf [hoff:hoff+hsize-1]
+    int64_t hsize ;         // size of workspace for this task
+    int64_t cnz ;           // # of entries in C(:,j1:j2-1)
+    bool use_Gustavson ;    // if true: hsize is m*(j2-j1), else a hash table
+}
+GB_outertask_struct ;
+
+#define GB_FREE_WORK                \
+{                                   \
+    GB_FREE (Slice) ;               \
+    GB_FREE (TaskList) ;            \
+    GB_FREE (Apos) ;                \
+    GB_WORK_FREE (Hf, Hf_size) ;    \
+    GB_WORK_FREE (Hj, Hj_size) ;    \
+    GB_WORK_FREE (Hs, Hs_size) ;    \
+    GB_WORK_FREE (Hx, Hx_size) ;    \
+}
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_FREE_WORK ;                  \
+    GB_MATRIX_FREE (Chandle) ;      \
+}
+
+GrB_Info GB_AxB_outer               // C = A*B' via outer products
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, not transposed
+    const GrB_Semiring semiring,    // semiring that defines C=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for outer A*B'", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for outer A*B'", GB0) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (B)) ; ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (!GB_JUMBLED (A)) ; ASSERT (!GB_JUMBLED (B)) ;
+    ASSERT (!GB_IS_BITMAP (A)) ; ASSERT (!GB_IS_BITMAP (B)) ;
+    ASSERT_SEMIRING_OK (semiring, "semiring for outer A*B'", GB0) ;
+    ASSERT (A->vdim == B->vdim) ;
+
+    (*Chandle) = NULL ;
+
+    int64_t *GB_RESTRICT Slice = NULL ;
+    GB_outertask_struct *GB_RESTRICT TaskList = NULL ;
+    int64_t *GB_RESTRICT Apos = NULL ;
+    int64_t *GB_RESTRICT Hf = NULL ;
+    int64_t *GB_RESTRICT Hj = NULL ;
+    int64_t *GB_RESTRICT Hs = NULL ;
+    GB_void *GB_RESTRICT Hx = NULL ;
+    size_t Hf_size = 0, Hj_size = 0, Hs_size = 0, Hx_size = 0 ;
+
+    //--------------------------------------------------------------------------
+    // get A and B
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const int64_t anvec = A->nvec ;
+    const bool A_is_hyper = A->is_hyper ;
+
+    const int64_t *GB_RESTRICT Bp = B->p ;
+    const int64_t *GB_RESTRICT Bh = B->h ;
+    const int64_t *GB_RESTRICT Bi = B->i ;
+    const int64_t bnvec = B->nvec ;
+    const int64_t bnz = GB_NNZ (B) ;
+    const bool B_is_hyper = B->is_hyper ;
+
+    const int64_t m = A->vlen ;
+    const int64_t n = B->vlen ;
+
+    if (n > bnz + B->vdim)
+    {
+        // C would be hypersparse; use saxpy3 instead
+        return (GrB_NO_VALUE) ;
+    }
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (bnz + bnvec, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // find A(:,k) for each vector B(:,k), and count the flops
+    //--------------------------------------------------------------------------
+
+    // A(:,k) is in Ai [Apos [kk] ... Apos [bnvec+kk]-1], where k = Bh [kk]
+    // if B is hypersparse, or k = kk otherwise.
+
+    Apos = GB_MALLOC (2*bnvec + 1, int64_t) ;
+    if (Apos == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t flops = 0 ;
+    int64_t kk ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:flops)
+    for (kk = 0 ; kk < bnvec ; kk++)
+    {
+        int64_t k = (B_is_hyper) ? Bh [kk] : kk ;
+        int64_t pleft = 0, pA_start, pA_end ;
+        GB_lookup (A_is_hyper, Ah, Ap, &pleft, anvec-1, k, &pA_start, &pA_end);
+        Apos [kk] = pA_start ;
+        Apos [bnvec+kk] = pA_end ;
+        flops += (pA_end - pA_start) * (Bp [kk+1] - Bp [kk]) ;
+    }
+
+    if (flops > (bnz + n + B->vdim) / GB_OUTER_RATIO)
+    {
+        // transposing B and using saxpy3 is faster
+        GB_FREE_ALL ;
+        return (GrB_NO_VALUE) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the semiring operators
+    //--------------------------------------------------------------------------
+
+    GrB_BinaryOp mult = semiring->multiply ;
+    GrB_Monoid add = semiring->add ;
+    ASSERT (mult->ztype == add->op->ztype) ;
+
+    GxB_binary_function fmult = mult->function ;
+    GxB_binary_function fadd  = add->op->function ;
+
+    bool A_is_pattern, B_is_pattern ;
+    GB_AxB_pattern (&A_is_pattern, &B_is_pattern, flipxy, mult->opcode) ;
+
+    GrB_Type ctype = add->op->ztype ;
+    size_t csize = ctype->size ;
+    size_t asize = A_is_pattern ? 0 : A->type->size ;
+    size_t bsize = B_is_pattern ? 0 : B->type->size ;
+
+    // flipxy false: aik = (xtype) A(i,k) and bjk = (ytype) B(j,k)
+    // flipxy true:  aik = (ytype) A(i,k) and bjk = (xtype) B(j,k)
+    size_t xsize = mult->xtype->size ;
+    size_t ysize = mult->ytype->size ;
+    size_t aik_size = flipxy ? ysize : xsize ;
+    size_t bjk_size = flipxy ? xsize : ysize ;
+
+    GB_cast_function cast_A = A_is_pattern ? NULL :
+        GB_cast_factory ((flipxy ? mult->ytype : mult->xtype)->code,
+        A->type->code) ;
+    GB_cast_function cast_B = B_is_pattern ? NULL :
+        GB_cast_factory ((flipxy ? mult->xtype : mult->ytype)->code,
+        B->type->code) ;
+
+    const GB_void *GB_RESTRICT Ax = A_is_pattern ? NULL : A->x ;
+    const GB_void *GB_RESTRICT Bx = B_is_pattern ? NULL : B->x ;
+
+    //--------------------------------------------------------------------------
+    // allocate C, and count the flops for each column of C
+    //--------------------------------------------------------------------------
+
+    // calloc Cp so it can be used as the Cflops workspace
+    info = GB_new (Chandle, ctype, m, n, GB_Ap_calloc, true,
+        GB_FORCE_NONHYPER, B->hyper_ratio, n, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    GrB_Matrix C = (*Chandle) ;
+    int64_t *GB_RESTRICT Cp = C->p ;
+
+    // Cflops [j] = # of flops to compute C(:,j)
+    int64_t *GB_RESTRICT Cflops = Cp ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (kk = 0 ; kk < bnvec ; kk++)
+    {
+        int64_t aknz = Apos [bnvec+kk] - Apos [kk] ;
+        if (aknz == 0) continue ;
+        for (int64_t pB = Bp [kk] ; pB < Bp [kk+1] ; pB++)
+        {
+            int64_t j = Bi [pB] ;
+            GB_ATOMIC_UPDATE
+            Cflops [j] += aknz ;
+        }
+    }
+
+    // Cflops = cumsum (Cflops)
+    GB_cumsum (Cflops, n, NULL, nthreads) ;
+    ASSERT (Cflops [n] == flops) ;
+
+    //--------------------------------------------------------------------------
+    // construct the tasks
+    //--------------------------------------------------------------------------
+
+    int ntasks = (nthreads == 1) ? 1 : (4 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, n) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    if (!GB_pslice (&Slice, Cflops, n, ntasks))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    TaskList = GB_MALLOC (ntasks, GB_outertask_struct) ;
+    if (TaskList == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t hwork = 0 ;
+    for (int taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+        int64_t j1 = Slice [taskid] ;
+        int64_t j2 = Slice [taskid+1] ;
+        int64_t task_flops = Cflops [j2] - Cflops [j1] ;
+        int64_t hsize = 0 ;
+        bool use_Gustavson = false ;
+        if (task_flops > 0)
+        {
+            // hash table of size 2^b >= 2*task_flops
+            hsize = 1 ;
+            while (hsize < 2 * task_flops) hsize = hsize << 1 ;
+            // use a dense workspace instead, if it is no larger
+            use_Gustavson = ((j2 - j1) <= hsize / m) ;
+            if (use_Gustavson) hsize = m * (j2 - j1) ;
+        }
+        TaskList [taskid].j1 = j1 ;
+        TaskList [taskid].j2 = j2 ;
+        TaskList [taskid].hoff = hwork ;
+        TaskList [taskid].hsize = hsize ;
+        TaskList [taskid].cnz = 0 ;
+        TaskList [taskid].use_Gustavson = use_Gustavson ;
+        hwork += hsize ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the workspace for all tasks
+    //--------------------------------------------------------------------------
+
+    // Hf [h] is zero if the entry is not present in the workspace, and
+    // i+1 if C(i,j) is present, where j = Hj [h], and C(i,j) = Hx [h].
+
+    int64_t hwork1 = GB_IMAX (hwork, 1) ;
+    Hf = GB_WORK_CALLOC (hwork1, int64_t, &Hf_size) ;
+    Hj = GB_WORK_MALLOC (hwork1, int64_t, &Hj_size) ;
+    Hs = GB_WORK_MALLOC (hwork1, int64_t, &Hs_size) ;
+    Hx = GB_WORK_MALLOC (hwork1 * csize, GB_void, &Hx_size) ;
+    if (Hf == NULL || Hj == NULL || Hs == NULL || Hx == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A*B' via outer products, one slice of C for each task
+    //--------------------------------------------------------------------------
+
+    int taskid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        const int64_t j1 = TaskList [taskid].j1 ;
+        const int64_t j2 = TaskList [taskid].j2 ;
+        const int64_t hoff = TaskList [taskid].hoff ;
+        const int64_t hsize = TaskList [taskid].hsize ;
+        const bool use_Gustavson = TaskList [taskid].use_Gustavson ;
+        int64_t *GB_RESTRICT Hf_task = Hf + hoff ;
+        int64_t *GB_RESTRICT Hj_task = Hj + hoff ;
+        int64_t *GB_RESTRICT Hs_task = Hs + hoff ;
+        GB_void *GB_RESTRICT Hx_task = Hx + hoff * csize ;
+        const uint64_t hash_bits = (uint64_t) (hsize - 1) ;
+
+        GB_void aik [GB_VLA(aik_size)] ;
+        GB_void bjk [GB_VLA(bjk_size)] ;
+        GB_void t [GB_VLA(csize)] ;
+
+        //----------------------------------------------------------------------
+        // accumulate A(:,k)*B(j1:j2-1,k)' into the workspace, for all k
+        //----------------------------------------------------------------------
+
+        for (int64_t kk = 0 ; hsize > 0 && kk < bnvec ; kk++)
+        {
+            int64_t pA_start = Apos [kk] ;
+            int64_t pA_end = Apos [bnvec+kk] ;
+            if (pA_end == pA_start) continue ;
+            int64_t pB = Bp [kk] ;
+            int64_t pB_end = Bp [kk+1] ;
+            if (ntasks > 1)
+            {
+                // find the first entry B(j,k) with j >= j1
+                int64_t pright = pB_end ;
+                GB_TRIM_BINARY_SEARCH (j1, Bi, pB, pright) ;
+            }
+            for ( ; pB < pB_end && Bi [pB] < j2 ; pB++)
+            {
+                // bjk = B(j,k)
+                const int64_t j = Bi [pB] ;
+                const uint64_t jkey = (uint64_t) (j - j1) * (uint64_t) m ;
+                if (!B_is_pattern) cast_B (bjk, Bx +(pB*bsize), bsize) ;
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)
+                {
+                    // t = A(i,k) * B(j,k)
+                    const int64_t i = Ai [pA] ;
+                    if (!A_is_pattern) cast_A (aik, Ax +(pA*asize), asize) ;
+                    if (flipxy)
+                    {
+                        fmult (t, bjk, aik) ;
+                    }
+                    else
+                    {
+                        fmult (t, aik, bjk) ;
+                    }
+                    // find C(i,j) in the workspace
+                    uint64_t h = jkey + (uint64_t) i ;
+                    if (!use_Gustavson)
+                    {
+                        h = (h * GB_HASH_FACTOR) & hash_bits ;
+                        while (Hf_task [h] != 0 &&
+                            (Hf_task [h] != i+1 || Hj_task [h] != j))
+                        {
+                            // hash collision: try the next slot
+                            h = (h + 1) & hash_bits ;
+                        }
+                    }
+                    GB_void *GB_RESTRICT cij = Hx_task +(h*csize) ;
+                    if (Hf_task [h] == 0)
+                    {
+                        // C(i,j) = t is a new entry
+                        Hf_task [h] = i+1 ;
+                        Hj_task [h] = j ;
+                        memcpy (cij, t, csize) ;
+                    }
+                    else
+                    {
+                        // C(i,j) += t
+                        fadd (cij, cij, t) ;
+                    }
+                }
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // gather the pattern of C(:,j1:j2-1) at the start of the workspace
+        //----------------------------------------------------------------------
+
+        // The kth entry in C(:,j1:j2-1) is C(i,j), where i = Hf [k],
+        // j = Hj [k], and its value is in Hx [Hs [k]].  Since k <= h always
+        // holds, this can be done in place.
+
+        int64_t task_cnz = 0 ;
+        for (int64_t h = 0 ; h < hsize ; h++)
+        {
+            if (Hf_task [h] != 0)
+            {
+                Hf_task [task_cnz] = Hf_task [h] - 1 ;
+                Hj_task [task_cnz] = Hj_task [h] ;
+                Hs_task [task_cnz] = h ;
+                task_cnz++ ;
+            }
+        }
+
+        if (!use_Gustavson)
+        {
+            // sort the entries of the hash table by column and row index;
+            // the Gustavson workspace is already in this order
+            GB_qsort_3 (Hj_task, Hf_task, Hs_task, task_cnz) ;
+        }
+
+        //----------------------------------------------------------------------
+        // count the entries in each column C(:,j1:j2-1)
+        //----------------------------------------------------------------------
+
+        for (int64_t j = j1 ; j < j2 ; j++)
+        {
+            Cp [j] = 0 ;
+        }
+        for (int64_t p = 0 ; p < task_cnz ; p++)
+        {
+            Cp [Hj_task [p]]++ ;
+        }
+        TaskList [taskid].cnz = task_cnz ;
+    }
+
+    //--------------------------------------------------------------------------
+    // Cp = cumsum (Cp), and allocate C->i and C->x
+    //--------------------------------------------------------------------------
+
+    Cp [n] = 0 ;
+    GB_cumsum (Cp, n, &(C->nvec_nonempty), nthreads) ;
+    int64_t cnz = Cp [n] ;
+    C->magic = GB_MAGIC ;
+
+    info = GB_ix_alloc (C, cnz, true, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // gather the entries of each task into C
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Ci = C->i ;
+    GB_void *GB_RESTRICT Cx = C->x ;
+
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (taskid = 0 ; taskid < ntasks ; taskid++)
+    {
+        const int64_t hoff = TaskList [taskid].hoff ;
+        const int64_t task_cnz = TaskList [taskid].cnz ;
+        const int64_t pC_start = Cp [TaskList [taskid].j1] ;
+        for (int64_t p = 0 ; p < task_cnz ; p++)
+        {
+            int64_t pC = pC_start + p ;
+            Ci [pC] = Hf [hoff + p] ;
+            memcpy (Cx +(pC*csize), Hx +((hoff + Hs [hoff + p])*csize), csize);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    ASSERT_MATRIX_OK (C, "outer product C=A*B'", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
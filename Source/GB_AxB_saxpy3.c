@@ -20,18 +20,25 @@
 // Those vectors are not shared with any other tasks.  A fine task works with a
 // team of other fine tasks to compute C(:,j) for a single vector j.  Each fine
 // task computes A*B(k1:k2,j) for a unique range k1:k2, and sums its results
-// into C(:,j) via atomic operations.
+// into C(:,j) via atomic operations.  The flops for A*B(:,j) are divided
+// evenly between the fine tasks in the team, so the first and last entries
+// B(k1,j) and B(k2,j) of a fine task may be shared with its neighbors.  Such
+// an ultra-fine task computes A(i1:i2,k)*B(k,j) for only a part of A(:,k).
+// This allows a single costly A(:,k)*B(k,j), for a column A(:,k) with many
+// entries, to be computed in parallel.
 
 // Each coarse or fine task uses either Gustavson's method [1] or the Hash
-// method [2].  There are 4 kinds of tasks:
+// method [2].  A coarse task may also use the Heap method [3].  There are 5
+// kinds of tasks:
 
 //      fine Gustavson task
 //      fine hash task
 //      coarse Gustason task
 //      coarse hash task
+//      coarse heap task
 
-// Each of the 4 kinds tasks are then subdivided into 3 variants, for C=A*B,
-// C<M>=A*B, and C<!M>=A*B, giving a total of 12 different types of tasks.
+// Each of the 5 kinds tasks are then subdivided into 3 variants, for C=A*B,
+// C<M>=A*B, and C<!M>=A*B, giving a total of 15 different types of tasks.
 
 // Fine tasks are used when there would otherwise be too much work for a single
 // task to compute the single vector C(:,j).  Fine tasks share all of their
@@ -55,6 +62,17 @@
 // table size is set to m, to serve as the gather/scatter workspace for
 // Gustavson's method.
 
+// The Heap method is used for a coarse task if every vector B(:,j) in the
+// task has at most GB_HEAP_FANIN entries (and the Hash method would otherwise
+// be used).  This is an inspector-executor method: the flop count analysis
+// (the inspector) finds the max # of entries in any B(:,j) for the task, and
+// the heap is sized to match.  The executor then merges the sorted vectors
+// A(:,k) for each B(k,j) with a heap of size nnz (B (:,j)), in O(f log b)
+// time for a vector C(:,j) that takes f flops, where b = nnz (B (:,j)).  It
+// needs no hash table, and the pattern of C(:,j) is computed in sorted order.
+// The Heap method is used for all coarse tasks if AxB_method is GxB_AxB_HEAP.
+// Fine tasks never use the Heap method.
+
 // The workspace allocated depends on the type of task.  Let s be the hash
 // table size for the task, and C is m-by-n (assuming all matrices are CSC; if
 // CSR, then m is replaced with n).
@@ -64,10 +82,16 @@
 //      coarse Gustavson task:          int64_t Hf [m] ; ctype Hx [m] ;
 //      coarse hash task:               int64_t Hf [s] ; ctype Hx [s] ;
 //                                      int64_t Hi [s] ; 
+//      coarse heap task:               GB_Element Heap [b+1] ;
+//                                      int64_t Hi [2*b] ;
 //
-// Note that the Hi array is needed only for the coarse hash task.  Additional
+// where b is the max # of entries in any vector B(:,j) of a coarse heap task.
+// Note that the Hi array is needed only for the coarse hash and heap tasks,
+// and the Heap array is needed only for coarse heap tasks.  Additional
 // workspace is allocated to construct the list of tasks, but this is freed
-// before C is constructed.
+// before C is constructed.  The Hi, Hf, Hx, and Heap workspace is taken from
+// the workspace pool and returned to it when done (see GB_workspace_malloc),
+// so that it can be reused by the next call to GB_AxB_saxpy3.
 
 // References:
 
@@ -81,6 +105,10 @@
 // Association for Computing Machinery, New York, NY, USA, Article 34, 1–10.
 // DOI:https://doi.org/10.1145/3229710.3229720
 
+// [3] Aydın Buluç and John R. Gilbert. 2008. On the representation and
+// multiplication of hypersparse matrices. In Proc. IEEE Intl. Symp. on
+// Parallel and Distributed Processing (IPDPS '08), 1-11.
+
 //------------------------------------------------------------------------------
 
 #include "GB_mxm.h"
@@ -98,6 +126,7 @@
 #define GB_COSTLY 1.2
 #define GB_FINE_WORK 2
 #define GB_MWORK_ALPHA 0.01
+#define GB_HEAP_FANIN 4
 
 //------------------------------------------------------------------------------
 // free workspace
@@ -110,15 +139,18 @@
     GB_FREE (Coarse_Work) ;                                                 \
     GB_FREE (Coarse_initial) ;                                              \
     GB_FREE (Fine_slice) ;                                                  \
+    GB_FREE (Fine_offset) ;                                                 \
 }
 
 #define GB_FREE_WORK                                                        \
 {                                                                           \
     GB_FREE_INITIAL_WORK ;                                                  \
     GB_FREE (TaskList) ;                                                    \
-    GB_FREE (Hi_all) ;                                                      \
-    GB_FREE (Hf_all) ;                                                      \
-    GB_FREE (Hx_all) ;                                                      \
+    GB_FREE (B_to_M) ;                                                      \
+    GB_WORK_FREE (Hi_all, Hi_all_size) ;                                    \
+    GB_WORK_FREE (Hf_all, Hf_all_size) ;                                    \
+    GB_WORK_FREE (Hx_all, Hx_all_size) ;                                    \
+    GB_WORK_FREE (Heap_all, Heap_all_size) ;                                \
 }
 
 #define GB_FREE_ALL                                                         \
@@ -142,13 +174,15 @@
 // selected via the descriptor or a global setting, as the non-default
 // GxB_AxB_GUSTAVSON or GxB_AxB_HASH settings, to enforce the selection of
 // either of those methods.  However, if Hash is selected by the hash table
-// exceeds cvlen, then Gustavson's method is used instead.
+// exceeds cvlen, then Gustavson's method is used instead.  GxB_AxB_HEAP is
+// treated as the default here; it only affects coarse tasks (see
+// GB_create_coarse_task), and fine tasks use Gustavson or Hash.
 
 static inline int64_t GB_hash_table_size
 (
     int64_t flmax,      // max flop count for any vector computed by this task
     int64_t cvlen,      // vector length of C
-    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method     // Default, Gustavson, Hash, or Heap
 )
 {
     // hash_size = 2 * (smallest power of 2 >= flmax)
@@ -180,12 +214,53 @@ static inline int64_t GB_hash_table_size
     return (hash_size) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_fine_slice: slice the flops for A*B(:,j) into a team of fine tasks
+//------------------------------------------------------------------------------
+
+// The work to compute A*B(:,j) is split evenly, so that each fine task does
+// the same number of flops.  A task boundary may fall inside the work for a
+// single entry B(k,j), so that a single costly A(:,k)*B(k,j) is shared by two
+// or more ultra-fine tasks, each doing A(i1:i2,k)*B(k,j) for a part of A(:,k).
+// The boundary of task fid is the flop at position Fine_offset [fid] in
+// A(:,k), for the entry B(k,j) at position Fine_slice [fid] in B(:,j).  This
+// is always an entry with a nonzero flop count, unless the boundary is at the
+// end of B(:,j).
+
+static inline void GB_fine_slice
+(
+    int64_t *GB_RESTRICT Fine_slice,    // size team_size+1
+    int64_t *GB_RESTRICT Fine_offset,   // size team_size+1
+    const int64_t *GB_RESTRICT Bflops2, // size bjnz+1; cum sum of flops
+    const int64_t bjnz,                 // nnz (B (:,j))
+    const int team_size                 // # of fine tasks for A*B(:,j)
+)
+{
+    const int64_t total_flops = Bflops2 [bjnz] ;
+    int64_t s = 0 ;
+    for (int fid = 0 ; fid <= team_size ; fid++)
+    {
+        // find the entry B(k,j) that does the flop f
+        int64_t f = (fid == team_size) ? total_flops :
+            (int64_t) GB_PART (fid, total_flops, team_size) ;
+        while (s < bjnz && Bflops2 [s+1] <= f)
+        { 
+            s++ ;
+        }
+        Fine_slice  [fid] = s ;
+        Fine_offset [fid] = f - Bflops2 [s] ;
+        ASSERT (GB_IMPLIES (s == bjnz, Fine_offset [fid] == 0)) ;
+    }
+}
+
 //------------------------------------------------------------------------------
 // GB_create_coarse_task: create a single coarse task
 //------------------------------------------------------------------------------
 
 // Compute the max flop count for any vector in a coarse task, determine the
-// hash table size, and construct the coarse task.
+// hash table size, and construct the coarse task.  The max # of entries in
+// any vector B(:,j) in the task is also found, to select the Heap method if
+// every vector of C in the task has a tiny fan-in.
 
 static inline void GB_create_coarse_task
 (
@@ -194,14 +269,17 @@ static inline void GB_create_coarse_task
     GB_saxpy3task_struct *TaskList,
     int taskid,         // taskid for this coarse task
     int64_t *Bflops,    // size bnvec; cum sum of flop counts for vectors of B
+    const int64_t *GB_RESTRICT Bp,     // vector pointers of B
     int64_t cvlen,      // vector length of B and C
     double chunk,
     int nthreads_max,
-    int64_t *Coarse_Work,   // workspace for parallel reduction for flop count
-    const GrB_Desc_Value AxB_method     // Default, Gustavson, or Hash
+    int64_t *Coarse_Work,   // size 2*nthreads_max, for parallel reduction
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, Hash, or Heap
+    const bool heap_ok      // if false, Heap is not selected automatically
 )
 {
-    // find the max # of flops for any vector in this task
+    // find the max # of flops, and max nnz (B (:,j)), for any vector in this
+    // task
     int64_t nk = klast - kfirst + 1 ;
     int nth = GB_nthreads (nk, chunk, nthreads_max) ;
     int64_t tid ;
@@ -210,47 +288,67 @@ static inline void GB_create_coarse_task
     #pragma omp parallel for num_threads(nth) schedule(static)
     for (tid = 0 ; tid < nth ; tid++)
     {
-        int64_t my_flmax = 1, istart, iend ;
+        int64_t my_flmax = 1, my_bjnz_max = 1, istart, iend ;
         GB_PARTITION (istart, iend, nk, tid, nth) ;
         for (int64_t i = istart ; i < iend ; i++)
         {
             int64_t kk = kfirst + i ;
             int64_t fl = Bflops [kk+1] - Bflops [kk] ;
             my_flmax = GB_IMAX (my_flmax, fl) ;
+            int64_t bjnz = Bp [kk+1] - Bp [kk] ;
+            my_bjnz_max = GB_IMAX (my_bjnz_max, bjnz) ;
         }
         Coarse_Work [tid] = my_flmax ;
+        Coarse_Work [nth + tid] = my_bjnz_max ;
     }
 
     // combine results from each thread
-    int64_t flmax = 1 ;
+    int64_t flmax = 1, bjnz_max = 1 ;
     for (tid = 0 ; tid < nth ; tid++)
     {
         flmax = GB_IMAX (flmax, Coarse_Work [tid]) ;
+        bjnz_max = GB_IMAX (bjnz_max, Coarse_Work [nth + tid]) ;
     }
 
     // check the parallel computation
     #ifdef GB_DEBUG
-    int64_t flmax2 = 1 ;
+    int64_t flmax2 = 1, bjnz_max2 = 1 ;
     for (int64_t kk = kfirst ; kk <= klast ; kk++)
     {
         int64_t fl = Bflops [kk+1] - Bflops [kk] ;
         flmax2 = GB_IMAX (flmax2, fl) ;
+        bjnz_max2 = GB_IMAX (bjnz_max2, Bp [kk+1] - Bp [kk]) ;
     }
     ASSERT (flmax == flmax2) ;
+    ASSERT (bjnz_max == bjnz_max2) ;
     #endif
 
+    // select the Heap method if requested, or if the fan-in of each C(:,j)
+    // is tiny and the Hash method would otherwise be used
+    int64_t hsize = GB_hash_table_size (flmax, cvlen, AxB_method) ;
+    bool use_heap = (AxB_method == GxB_AxB_HEAP) ||
+        (AxB_method == GxB_DEFAULT && heap_ok && bjnz_max <= GB_HEAP_FANIN
+            && hsize != cvlen) ;
+    if (use_heap)
+    { 
+        // the heap holds one entry for each entry in B(:,j)
+        hsize = bjnz_max ;
+    }
+
     // define the coarse task
     TaskList [taskid].start   = kfirst ;
     TaskList [taskid].end     = klast ;
     TaskList [taskid].vector  = -1 ;
-    TaskList [taskid].hsize   = GB_hash_table_size (flmax, cvlen, AxB_method) ;
+    TaskList [taskid].hsize   = hsize ;
     TaskList [taskid].Hi      = NULL ;      // assigned later
     TaskList [taskid].Hf      = NULL ;      // assigned later
     TaskList [taskid].Hx      = NULL ;      // assigned later
+    TaskList [taskid].Heap    = NULL ;      // assigned later
     TaskList [taskid].my_cjnz = 0 ;         // unused
     TaskList [taskid].flops   = Bflops [klast+1] - Bflops [kfirst] ;
     TaskList [taskid].master  = taskid ;
     TaskList [taskid].team_size = 1 ;
+    TaskList [taskid].use_heap = use_heap ;
 }
 
 //------------------------------------------------------------------------------
@@ -268,7 +366,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, then mask was applied
-    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, Hash, or Heap
     GB_Context Context
 )
 {
@@ -293,6 +391,15 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     ASSERT_SEMIRING_OK (semiring, "semiring for saxpy3 A*B", GB0) ;
     ASSERT (A->vdim == B->vlen) ;
 
+    // A and B may be jumbled, but M and A must be sorted if M is present,
+    // and A must be sorted if the Heap method is requested.  The Heap method
+    // merges the sorted vectors of A, so it is not selected automatically if
+    // A is jumbled.
+    ASSERT (!GB_JUMBLED (M)) ;
+    ASSERT (GB_IMPLIES (M != NULL || AxB_method == GxB_AxB_HEAP,
+        !GB_JUMBLED (A))) ;
+    const bool heap_ok = !GB_JUMBLED (A) ;
+
     (*Chandle) = NULL ;
 
     //--------------------------------------------------------------------------
@@ -346,17 +453,23 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int64_t *GB_RESTRICT Hi_all = NULL ;
     int64_t *GB_RESTRICT Hf_all = NULL ;
     GB_void *GB_RESTRICT Hx_all = NULL ;
+    GB_Element *GB_RESTRICT Heap_all = NULL ;
+    size_t Hi_all_size = 0, Hf_all_size = 0, Hx_all_size = 0 ;
+    size_t Heap_all_size = 0 ;
     int64_t *GB_RESTRICT Coarse_initial = NULL ;    // initial coarse tasks
     int64_t *GB_RESTRICT Coarse_Work = NULL ;       // workspace for flop counts
     GB_saxpy3task_struct *GB_RESTRICT TaskList = NULL ;
     int64_t *GB_RESTRICT Fine_slice = NULL ;
+    int64_t *GB_RESTRICT Fine_offset = NULL ;
     int64_t *GB_RESTRICT Bflops2 = NULL ;
+    int64_t *GB_RESTRICT B_to_M = NULL ;
 
     int ntasks = 0 ;
     int ntasks_initial = 0 ;
     size_t Hi_size_total = 0 ;
     size_t Hf_size_total = 0 ;
     size_t Hx_size_total = 0 ;
+    size_t Heap_size_total = 0 ;
     int64_t max_bjnz = 0 ;
 
     //--------------------------------------------------------------------------
@@ -529,8 +642,6 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int ncoarse = 0 ;       // # of coarse tasks
     max_bjnz = 0 ;          // max (nnz (B (:,j))) of fine tasks
 
-    // FUTURE: also use ultra-fine tasks that compute A(i1:i2,k)*B(k,j)
-
     if (ntasks_initial > 1)
     {
 
@@ -578,7 +689,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = Bp [kk+1] - Bp [kk] ;
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -622,10 +733,12 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         // entire computation in a single fine or coarse task
         //----------------------------------------------------------------------
 
-        if (bnvec == 1)
+        if (bnvec == 1 && !(AxB_method == GxB_AxB_HEAP
+            || (AxB_method == GxB_DEFAULT && bnz <= GB_HEAP_FANIN)))
         { 
             // If B is a single vector, and is computed by a single thread,
-            // then a single fine task is used.
+            // then a single fine task is used, unless the Heap method might
+            // be used for that vector.
             nfine = 1 ;
             ncoarse = 0 ;
         }
@@ -644,16 +757,18 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //--------------------------------------------------------------------------
 
     TaskList    = GB_CALLOC (ntasks, GB_saxpy3task_struct) ;
-    Coarse_Work = GB_MALLOC (nthreads_max, int64_t) ;
+    Coarse_Work = GB_MALLOC (2 * nthreads_max, int64_t) ;
     if (max_bjnz > 0)
     { 
         // also allocate workspace to construct fine tasks
         Fine_slice = GB_MALLOC (ntasks+1  , int64_t) ;
+        Fine_offset = GB_MALLOC (ntasks+1 , int64_t) ;
         Bflops2    = GB_MALLOC (max_bjnz+1, int64_t) ;
     }
 
     if (TaskList == NULL || Coarse_Work == NULL ||
-        (max_bjnz > 0 && (Fine_slice == NULL || Bflops2 == NULL)))
+        (max_bjnz > 0 && (Fine_slice == NULL || Fine_offset == NULL
+            || Bflops2 == NULL)))
     { 
         // out of memory
         GB_FREE_ALL ;
@@ -702,7 +817,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                     // bjnz = nnz (B (:,j))
                     int64_t bjnz = Bp [kk+1] - Bp [kk] ;
 
-                    if (jflops > GB_COSTLY * target_task_size && bjnz > 1)
+                    if (jflops > GB_COSTLY * target_task_size && bjnz > 0)
                     {
                         // A*B(:,j) is costly; split it into 2 or more fine
                         // tasks.  First flush the prior coarse task, if any.
@@ -710,8 +825,9 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                         { 
                             // kcoarse_start:kk-1 form a single coarse task
                             GB_create_coarse_task (kcoarse_start, kk-1,
-                                TaskList, nc++, Bflops, cvlen,
-                                chunk, nthreads_max, Coarse_Work, AxB_method) ;
+                                TaskList, nc++, Bflops, Bp, cvlen,
+                                chunk, nthreads_max, Coarse_Work, AxB_method,
+                                heap_ok) ;
                         }
 
                         // next coarse task (if any) starts at kk+1
@@ -774,10 +890,13 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                         // cumulative sum of flops to compute A*B(:,j)
                         GB_cumsum (Bflops2, bjnz, NULL, nth) ;
 
-                        // slice B(:,j) into fine tasks
+                        // slice the flops for A*B(:,j) evenly into fine
+                        // tasks, even inside a single A(:,k)*B(k,j)
                         int team_size = ceil (jflops / target_fine_size) ;
                         ASSERT (Fine_slice != NULL) ;
-                        GB_pslice (&Fine_slice, Bflops2, bjnz, team_size) ;
+                        ASSERT (Fine_offset != NULL) ;
+                        GB_fine_slice (Fine_slice, Fine_offset, Bflops2, bjnz,
+                            team_size) ;
 
                         // shared hash table for all fine tasks for A*B(:,j)
                         int64_t hsize = 
@@ -787,11 +906,26 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                         int master = nf ;
                         for (int fid = 0 ; fid < team_size ; fid++)
                         { 
+                            // task fid does the flops from the (afirst)th
+                            // entry of A(:,k) for B(k,j) at pstart, up to
+                            // but not including the (alast)th entry of A(:,k)
+                            // for B(k,j) at pend.
                             int64_t pstart = Fine_slice [fid] ;
                             int64_t pend   = Fine_slice [fid+1] ;
-                            int64_t fl = Bflops2 [pend] - Bflops2 [pstart] ;
+                            int64_t afirst = Fine_offset [fid] ;
+                            int64_t alast  = Fine_offset [fid+1] ;
+                            int64_t fl = (Bflops2 [pend] + alast)
+                                       - (Bflops2 [pstart] + afirst) ;
+                            if (alast == 0)
+                            { 
+                                // B(k,j) at pend is not used by this task
+                                pend-- ;
+                                alast = -1 ;
+                            }
                             TaskList [nf].start  = pB_start + pstart ;
-                            TaskList [nf].end    = pB_start + pend - 1 ;
+                            TaskList [nf].end    = pB_start + pend ;
+                            TaskList [nf].afirst = afirst ;
+                            TaskList [nf].alast  = alast ;
                             TaskList [nf].vector = kk ;
                             TaskList [nf].hsize  = hsize ;
                             TaskList [nf].Hi = NULL ;   // assigned later
@@ -811,8 +945,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
                 { 
                     // kcoarse_start:klast-1 form a single coarse task
                     GB_create_coarse_task (kcoarse_start, klast-1, TaskList,
-                        nc++, Bflops, cvlen, chunk, nthreads_max, Coarse_Work,
-                        AxB_method) ;
+                        nc++, Bflops, Bp, cvlen, chunk, nthreads_max,
+                        Coarse_Work, AxB_method, heap_ok) ;
                 }
 
             }
@@ -820,7 +954,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             { 
                 // This coarse task is OK as-is.
                 GB_create_coarse_task (kfirst, klast-1, TaskList, nc++, Bflops,
-                    cvlen, chunk, nthreads_max, Coarse_Work, AxB_method) ;
+                    Bp, cvlen, chunk, nthreads_max, Coarse_Work, AxB_method,
+                    heap_ok) ;
             }
         }
 
@@ -833,14 +968,17 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         //----------------------------------------------------------------------
 
         // create a single coarse task
-        GB_create_coarse_task (0, bnvec-1, TaskList, 0, Bflops, cvlen, 1, 1,
-            Coarse_Work, AxB_method) ;
+        GB_create_coarse_task (0, bnvec-1, TaskList, 0, Bflops, Bp, cvlen, 1,
+            1, Coarse_Work, AxB_method, heap_ok) ;
 
-        if (bnvec == 1)
+        if (nfine == 1)
         { 
             // convert the single coarse task into a single fine task
+            ASSERT (!(TaskList [0].use_heap)) ;
             TaskList [0].start  = 0 ;           // first entry in B(:,0)
             TaskList [0].end    = bnz - 1 ;     // last entry in B(:,0)
+            TaskList [0].afirst = 0 ;           // all of each A(:,k)
+            TaskList [0].alast  = -1 ;
             TaskList [0].vector = 0 ;
         }
     }
@@ -849,7 +987,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // free workspace used to create the tasks
     //--------------------------------------------------------------------------
 
-    // Frees Bflops2, Coarse_initial, Coarse_Work, and Fine_slice.  These do
+    // Frees Bflops2, Coarse_initial, Coarse_Work, Fine_slice, and Fine_offset.
+    // These do
     // not need to be freed in the GB_Asaxpy3B worker below.
 
     GB_FREE_INITIAL_WORK ;
@@ -862,6 +1001,7 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     int ncoarse_hash = 0 ;
     int ncoarse_1hash = 0 ;
     int ncoarse_gus = 0 ;
+    int ncoarse_heap = 0 ;
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
         int64_t hash_size = TaskList [taskid].hsize ;
@@ -886,7 +1026,12 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             // coarse task
             int64_t kfirst = TaskList [taskid].start ;
             int64_t klast = TaskList [taskid].end ;
-            if (use_Gustavson)
+            if (TaskList [taskid].use_heap)
+            {
+                // coarse heap task
+                ncoarse_heap++ ;
+            }
+            else if (use_Gustavson)
             {
                 // coarse Gustavson task
                 ncoarse_gus++ ;
@@ -899,9 +1044,9 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         }
     }
 
-    GBBURBLE ("nthreads %d ntasks %d coarse: (gus: %d hash: %d)"
+    GBBURBLE ("nthreads %d ntasks %d coarse: (gus: %d hash: %d heap: %d)"
         " fine: (gus: %d hash: %d) ", nthreads, ntasks,
-        ncoarse_gus, ncoarse_hash, nfine_gus, nfine_hash) ;
+        ncoarse_gus, ncoarse_hash, ncoarse_heap, nfine_gus, nfine_hash) ;
     #endif
 
     // Bflops is no longer needed as an alias for Cp
@@ -945,6 +1090,14 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     //      Hf starts out all zero (via calloc), and mark starts out as 1.  To
     //      clear Hf, mark is incremented, so that all entries in Hf are not
     //      equal to mark.
+    //
+    // If the Heap method is used (coarse tasks only):
+    //
+    //      hash_size is the max # of entries in any B(:,j) for the task.
+    //      Hf and Hx are not allocated.
+    //      Heap is of size hash_size+1, since Heap [0] is not used.
+    //      Hi is of size 2*hash_size, for the position of the next entry
+    //      in each A(:,k) being merged, and the end of A(:,k).
 
     // add some padding to the end of each hash table, to avoid false
     // sharing of cache lines between the hash tables.
@@ -955,7 +1108,8 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     Hf_size_total = 0 ;
     Hx_size_total = 0 ;
 
-    // determine the total size of all hash tables
+    // determine the total size of all hash tables and heaps
+    int nheap_tasks = 0 ;
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
         if (taskid != TaskList [taskid].master)
@@ -972,6 +1126,15 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         // int64_t kfirst = TaskList [taskid].start ;
         // int64_t klast = TaskList [taskid].end ;
 
+        if (TaskList [taskid].use_heap)
+        { 
+            // coarse heap tasks need just Heap and Hi
+            Heap_size_total += (hash_size + 1 + hi_pad) ;
+            Hi_size_total += (2 * hash_size + hi_pad) ;
+            nheap_tasks++ ;
+            continue ;
+        }
+
         if (is_fine && use_Gustavson)
         { 
             // Hf is int8_t for the fine Gustavson tasks, but round up
@@ -999,30 +1162,37 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     // allocate space for all hash tables
     if (Hi_size_total > 0)
     { 
-        Hi_all = GB_MALLOC (Hi_size_total, int64_t) ;
+        Hi_all = GB_WORK_MALLOC (Hi_size_total, int64_t, &Hi_all_size) ;
     }
     if (Hf_size_total > 0)
     { 
-        Hf_all = GB_CALLOC (Hf_size_total, int64_t) ;
+        Hf_all = GB_WORK_CALLOC (Hf_size_total, int64_t, &Hf_all_size) ;
     }
     if (Hx_size_total > 0)
     { 
-        Hx_all = GB_MALLOC (Hx_size_total, GB_void) ;
+        Hx_all = GB_WORK_MALLOC (Hx_size_total, GB_void, &Hx_all_size) ;
+    }
+    if (Heap_size_total > 0)
+    { 
+        Heap_all = GB_WORK_MALLOC (Heap_size_total, GB_Element,
+            &Heap_all_size) ;
     }
 
     if ((Hi_size_total > 0 && Hi_all == NULL) ||
         (Hf_size_total > 0 && Hf_all == NULL) || 
-        (Hx_size_total > 0 && Hx_all == NULL))
+        (Hx_size_total > 0 && Hx_all == NULL) ||
+        (Heap_size_total > 0 && Heap_all == NULL))
     { 
         // out of memory
         GB_FREE_ALL ;
         return (GB_OUT_OF_MEMORY) ;
     }
 
-    // split the space into separate hash tables
+    // split the space into separate hash tables and heaps
     int64_t *GB_RESTRICT Hi_split = Hi_all ;
     int64_t *GB_RESTRICT Hf_split = Hf_all ;
     GB_void *GB_RESTRICT Hx_split = Hx_all ;
+    GB_Element *GB_RESTRICT Heap_split = Heap_all ;
 
     for (int taskid = 0 ; taskid < ntasks ; taskid++)
     {
@@ -1033,10 +1203,6 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
             continue ;
         }
 
-        TaskList [taskid].Hi = Hi_split ;
-        TaskList [taskid].Hf = (GB_void *) Hf_split ;
-        TaskList [taskid].Hx = Hx_split ;
-
         int64_t hash_size = TaskList [taskid].hsize ;
         int64_t k = TaskList [taskid].vector ;
         bool is_fine = (k >= 0) ;
@@ -1044,6 +1210,20 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         // int64_t kfirst = TaskList [taskid].start ;
         // int64_t klast = TaskList [taskid].end ;
 
+        if (TaskList [taskid].use_heap)
+        { 
+            // coarse heap tasks need just Heap and Hi
+            TaskList [taskid].Heap = Heap_split ;
+            TaskList [taskid].Hi = Hi_split ;
+            Heap_split += (hash_size + 1 + hi_pad) ;
+            Hi_split += (2 * hash_size + hi_pad) ;
+            continue ;
+        }
+
+        TaskList [taskid].Hi = Hi_split ;
+        TaskList [taskid].Hf = (GB_void *) Hf_split ;
+        TaskList [taskid].Hx = Hx_split ;
+
         if (is_fine && use_Gustavson)
         { 
             // Hf is int8_t for the fine Gustavson method
@@ -1081,6 +1261,52 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         }
     }
 
+    //--------------------------------------------------------------------------
+    // find M(:,j) for all vectors of B, if M is hypersparse
+    //--------------------------------------------------------------------------
+
+    // The symbolic and numeric phases each need M(:,j) for every vector
+    // B(:,j), in every task.  If M is hypersparse, this requires a binary
+    // search of M->h.  Instead, all of M(:,j) are found here in a single pass
+    // over the vectors of B, and the mapping is shared by all tasks.
+
+    if (M_is_hyper && bnvec > 0)
+    {
+        B_to_M = GB_MALLOC (bnvec, int64_t) ;
+        if (B_to_M == NULL)
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+
+        int nth = GB_nthreads (bnvec, chunk, nthreads_max) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (tid = 0 ; tid < nth ; tid++)
+        {
+            int64_t kfirst, klast ;
+            GB_PARTITION (kfirst, klast, bnvec, tid, nth) ;
+            // the vectors of B are sorted, so the search for each M(:,j)
+            // can start where the search for the prior one ended
+            int64_t mpleft = 0 ;
+            int64_t mpright = mnvec-1 ;
+            for (int64_t kk = kfirst ; kk < klast ; kk++)
+            {
+                int64_t j = (Bh == NULL) ? kk : Bh [kk] ;
+                int64_t pM, pM_end ;
+                bool found = GB_lookup (true, Mh, Mp, &mpleft, mpright, j,
+                    &pM, &pM_end) ;
+                B_to_M [kk] = found ? mpleft : -1 ;
+            }
+        }
+
+        for (int taskid = 0 ; taskid < ntasks ; taskid++)
+        { 
+            TaskList [taskid].B_to_M = B_to_M ;
+        }
+    }
+
     //==========================================================================
     // phase1: symbolic analysis
     //==========================================================================
@@ -1142,6 +1368,12 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
         return (GB_OUT_OF_MEMORY) ;
     }
 
+    // The pattern of each vector of C is left unsorted, except for vectors
+    // computed by a dense gather or by the Heap method.  C is sorted later by
+    // GB_Matrix_wait, only if the caller needs it.  If all tasks use the
+    // Heap method, C is not jumbled.
+    C->jumbled = (nheap_tasks < ntasks) ;
+
     //==========================================================================
     // prune empty vectors, free workspace, and return result
     //==========================================================================
@@ -7,12 +7,13 @@
 
 //------------------------------------------------------------------------------
 
-// GB_AxB_saxpy3 method uses a mix of Gustavson's method and the Hash method,
-// combining the two for any given C=A*B computation.
+// GB_AxB_saxpy3 method uses a mix of Gustavson's method, the Hash method,
+// and the Heap method, combining them for any given C=A*B computation.
 
 #ifndef GB_AXB_SAXPY3_H
 #define GB_AXB_SAXPY3_H
 #include "GB.h"
+#include "GB_heap.h"
 
 //------------------------------------------------------------------------------
 // functions for the Hash method for C=A*B
@@ -57,6 +58,14 @@
 // C(:,j), via atomics.  The vector index j is either kk if B is standard, or j
 // = B->h [kk] if B is hypersparse.
 
+// A fine task may also be ultra-fine, if it splits the work for a single
+// entry B(k,j) with other tasks in its team.  For the first entry B(k1,j) of
+// the task, it uses only A(:,k1) from position afirst onwards (relative to the
+// start of A(:,k1)), and for its last entry B(k2,j), only positions 0 to
+// alast-1 of A(:,k2).  If alast is -1, all of A(:,k2) is used.  Since the
+// row indices in each A(:,k) are sorted, each ultra-fine task computes
+// A(i1:i2,k)*B(k,j) for a contiguous range i1:i2.
+
 // Both tasks use a hash table allocated uniquely for the task, in Hi, Hf, and
 // Hx.  The size of the hash table is determined by the maximum # of flops
 // needed to compute any vector in C(:,j1:j2) for a coarse task, or the entire
@@ -66,19 +75,36 @@
 // Hash method is not used, and Gustavson's method is used, with the hash size
 // is set to C->vlen.
 
+// A coarse task may instead use the Heap method, if each vector B(:,j) in the
+// task has only a few entries.  The vectors A(:,k) for each entry B(k,j) are
+// merged in order with a heap of size nnz (B (:,j)), so the pattern of each
+// C(:,j) is found in sorted order, and no hash table is needed.  For a coarse
+// heap task, hsize is the size of the heap (the max nnz (B (:,j)) for any
+// vector in the task), Hf and Hx are not used, and Hi holds the position of
+// the next entry in each A(:,k) being merged.
+
 typedef struct
 {
     int64_t start ;     // starting vector for coarse task, p for fine task
     int64_t end ;       // ending vector for coarse task, p for fine task
     int64_t vector ;    // -1 for coarse task, vector j for fine task
-    int64_t hsize ;     // size of hash table
-    int64_t *Hi ;       // Hi array for hash table (coarse hash tasks only)
+    int64_t hsize ;     // size of hash table, or of heap (coarse heap tasks)
+    int64_t *Hi ;       // Hi array for hash table (coarse hash tasks), or
+                        // position in each A(:,k) (coarse heap tasks)
+    GB_Element *Heap ;  // heap for coarse heap tasks only
     GB_void *Hf ;       // Hf array for hash table (int8_t or int64_t)
     GB_void *Hx ;       // Hx array for hash table
     int64_t my_cjnz ;   // # entries in C(:,j) found by this fine task
     int64_t flops ;     // # of flops in this task
+    int64_t afirst ;    // fine task: A(:,k) for B(k,j) at start, from afirst
+    int64_t alast ;     // fine task: A(:,k) for B(k,j) at end, to alast-1,
+                        // or to the end of A(:,k) if alast is -1
     int master ;        // master fine task for the vector C(:,j)
     int team_size ;     // # of fine tasks in the team for vector C(:,j)
+    bool use_heap ;     // true for a coarse heap task
+    const int64_t *B_to_M ; // if M is hypersparse: B(:,j) maps to M(:,j) as
+                        // the (B_to_M [kk])th vector of M, or -1 if M(:,j) is
+                        // empty.  Shared by all tasks.  NULL otherwise.
 }
 GB_saxpy3task_struct ;
 
@@ -207,7 +207,98 @@ void GB_AxB_saxpy3_symbolic
             int64_t mark = 0 ;
             // int64_t nk = klast - kfirst + 1 ;
 
-            if (use_Gustavson)
+            if (TaskList [taskid].use_heap)
+            {
+
+                //--------------------------------------------------------------
+                // phase1: coarse heap task
+                //--------------------------------------------------------------
+
+                GB_Element *GB_RESTRICT Heap = TaskList [taskid].Heap ;
+                int64_t *GB_RESTRICT Hpos = TaskList [taskid].Hi ;
+                int64_t *GB_RESTRICT Hpos_end = Hpos + hash_size ;
+
+                if (M == NULL)
+                {
+
+                    //----------------------------------------------------------
+                    // phase1: coarse heap task, C=A*B
+                    //----------------------------------------------------------
+
+                    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+                    {
+                        GB_GET_B_j ;            // get B(:,j)
+                        if (bjnz == 0)
+                        { 
+                            Cp [kk] = 0 ;
+                            continue ;
+                        }
+                        if (bjnz == 1)
+                        { 
+                            int64_t k = Bi [pB] ;   // get B(k,j)
+                            GB_GET_A_k ;            // get A(:,k)
+                            Cp [kk] = aknz ;        // nnz(C(:,j)) = nnz(A(:,k))
+                            continue ;
+                        }
+                        ASSERT (bjnz <= hash_size) ;
+                        int64_t cjnz = 0, ilast = -1 ;
+                        #define GB_HEAP_IKJ                                    \
+                        {                                                      \
+                            if (i != ilast)                                    \
+                            {                                                  \
+                                ilast = i ;     /* C(i,j) is a new entry */    \
+                                cjnz++ ;                                       \
+                            }                                                  \
+                        }
+                        GB_HEAP_MERGE_j ;
+                        #undef GB_HEAP_IKJ
+                        Cp [kk] = cjnz ;    // count the entries in C(:,j)
+                    }
+
+                }
+                else
+                {
+
+                    //----------------------------------------------------------
+                    // phase1: coarse heap task, C<M>=A*B or C<!M>=A*B
+                    //----------------------------------------------------------
+
+                    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+                    {
+                        GB_GET_M_j ;            // get M(:,j)
+                        if (mask_is_M && mjnz == 0)
+                        { 
+                            // C(:,j) is empty; skip B(:,j) entirely
+                            Cp [kk] = 0 ;
+                            continue ;
+                        }
+                        GB_GET_B_j ;            // get B(:,j)
+                        if (bjnz == 0)
+                        { 
+                            Cp [kk] = 0 ;
+                            continue ;
+                        }
+                        ASSERT (bjnz <= hash_size) ;
+                        int64_t pM = pM_start ;
+                        int64_t cjnz = 0, ilast = -1 ;
+                        #define GB_HEAP_IKJ                                    \
+                        {                                                      \
+                            if (i != ilast)                                    \
+                            {                                                  \
+                                ilast = i ;                                    \
+                                GB_HEAP_GET_M_ij (i) ;      /* get M(i,j) */   \
+                                /* C(i,j) is new, if permitted by mask */      \
+                                if (mij == mask_is_M) cjnz++ ;                 \
+                            }                                                  \
+                        }
+                        GB_HEAP_MERGE_j ;
+                        #undef GB_HEAP_IKJ
+                        Cp [kk] = cjnz ;    // count the entries in C(:,j)
+                    }
+                }
+
+            }
+            else if (use_Gustavson)
             {
 
                 //--------------------------------------------------------------
@@ -280,14 +371,15 @@ void GB_AxB_saxpy3_symbolic
 
                     for (int64_t kk = kfirst ; kk <= klast ; kk++)
                     {
-                        GB_GET_B_j ;            // get B(:,j)
-                        if (bjnz == 0)
+                        GB_GET_M_j ;            // get M(:,j)
+                        if (mjnz == 0)
                         { 
+                            // C(:,j) is empty; skip B(:,j) entirely
                             Cp [kk] = 0 ;
                             continue ;
                         }
-                        GB_GET_M_j ;            // get M(:,j)
-                        if (mjnz == 0)
+                        GB_GET_B_j ;            // get B(:,j)
+                        if (bjnz == 0)
                         { 
                             Cp [kk] = 0 ;
                             continue ;
@@ -446,14 +538,15 @@ void GB_AxB_saxpy3_symbolic
 
                     for (int64_t kk = kfirst ; kk <= klast ; kk++)
                     {
-                        GB_GET_B_j ;            // get B(:,j)
-                        if (bjnz == 0)
+                        GB_GET_M_j ;            // get M(:,j)
+                        if (mjnz == 0)
                         { 
+                            // C(:,j) is empty; skip B(:,j) entirely
                             Cp [kk] = 0 ;
                             continue ;
                         }
-                        GB_GET_M_j ;            // get M(:,j)
-                        if (mjnz == 0)
+                        GB_GET_B_j ;            // get B(:,j)
+                        if (bjnz == 0)
                         { 
                             Cp [kk] = 0 ;
                             continue ;
@@ -15,7 +15,7 @@
 
 static GrB_Info GB_dc
 (
-    int kind,                           // 0, 1, or 2
+    int kind,                           // 0, 1, 2, or 3
     const char *field,
     const GrB_Desc_Value v,
     const GrB_Desc_Value nondefault,    // for kind == 0
@@ -42,6 +42,8 @@ static GrB_Info GB_dc
         case GxB_AxB_HEAP           : GBPR0 ("heap      ") ; break ;
         case GxB_AxB_HASH           : GBPR0 ("hash      ") ; break ;
         case GxB_AxB_DOT            : GBPR0 ("dot       ") ; break ;
+        case GxB_COMPRESSION_NONE   : GBPR0 ("none      ") ; break ;
+        case GxB_COMPRESSION_LZ4    : GBPR0 ("LZ4       ") ; break ;
         default                     : GBPR0 ("unknown   ") ;
             info = GrB_INVALID_OBJECT ;
             ok = false ;
@@ -68,7 +70,7 @@ static GrB_Info GB_dc
                 ok = false ;
             }
         }
-        else // kind == 2
+        else if (kind == 2)
         {
             // GxB_AxB_METHOD:
             if (! (v == GxB_DEFAULT || v == GxB_AxB_GUSTAVSON
@@ -78,6 +80,15 @@ static GrB_Info GB_dc
                 ok = false ;
             }
         }
+        else // kind == 3
+        {
+            // GxB_COMPRESSION:
+            if (! (v == GxB_DEFAULT || v == GxB_COMPRESSION_NONE
+                || v == GxB_COMPRESSION_LZ4))
+            { 
+                ok = false ;
+            }
+        }
     }
 
     if (!ok)
@@ -127,14 +138,16 @@ GrB_Info GB_Descriptor_check    // check a GraphBLAS descriptor
 
     GBPR0 ("\n") ;
 
-    GrB_Info info [5] ;
+    GrB_Info info [6] ;
     info [0] = GB_dc (0, "out     ", D->out,  GrB_REPLACE, pr, f, Context) ;
     info [1] = GB_dc (1, "mask    ", D->mask, GxB_DEFAULT, pr, f, Context) ;
     info [2] = GB_dc (0, "in0     ", D->in0,  GrB_TRAN,    pr, f, Context) ;
     info [3] = GB_dc (0, "in1     ", D->in1,  GrB_TRAN,    pr, f, Context) ;
     info [4] = GB_dc (2, "axb     ", D->axb,  GxB_DEFAULT, pr, f, Context) ;
+    info [5] = GB_dc (3, "compress", D->compression, GxB_DEFAULT, pr, f,
+        Context) ;
 
-    for (int i = 0 ; i < 5 ; i++)
+    for (int i = 0 ; i < 6 ; i++)
     {
         if (info [i] != GrB_SUCCESS)
         { 
@@ -44,6 +44,8 @@ typedef struct
     //--------------------------------------------------------------------------
 
     double hyper_ratio ;        // default hyper_ratio for new matrices
+    int sparsity ;              // default sparsity control for new matrices
+    double bitmap_switch ;      // default bitmap_switch for new matrices
     bool is_csc ;               // default CSR/CSC format for new matrices
 
     //--------------------------------------------------------------------------
@@ -92,6 +94,21 @@ typedef struct
     bool malloc_debug ;             // if true, test memory handling
     int64_t malloc_debug_count ;    // for testing memory handling
 
+    //--------------------------------------------------------------------------
+    // workspace pool
+    //--------------------------------------------------------------------------
+
+    // Blocks of workspace freed by GB_workspace_free are kept in a small pool,
+    // and reused by GB_workspace_malloc and GB_workspace_calloc, so that
+    // repeated calls to GrB_mxm do not spend their time in malloc and free.
+    // The total size of the blocks in the pool is at most workspace_max
+    // bytes.  Access to the pool is protected by a critical section.
+
+    void *workspace [GB_WORKSPACE_POOL] ;       // blocks in the pool
+    size_t workspace_size [GB_WORKSPACE_POOL] ; // size of each block
+    size_t workspace_total ;        // total size of all blocks in the pool
+    size_t workspace_max ;          // max total size of the pool
+
     //--------------------------------------------------------------------------
     // for testing and development
     //--------------------------------------------------------------------------
@@ -140,6 +157,8 @@ GB_Global_struct GB_Global =
 
     // default format
     .hyper_ratio = GB_HYPER_DEFAULT,
+    .sparsity = GB_SPARSITY_DEFAULT,
+    .bitmap_switch = GB_BITMAP_SWITCH_DEFAULT,
     .is_csc = (GB_FORMAT_DEFAULT != GxB_BY_ROW),    // default is GxB_BY_ROW
 
     // abort function for debugging only
@@ -158,6 +177,10 @@ GB_Global_struct GB_Global =
     .malloc_debug = false,       // do not test memory handling
     .malloc_debug_count = 0,     // counter for testing memory handling
 
+    // workspace pool, initially empty
+    .workspace_total = 0,
+    .workspace_max = GB_WORKSPACE_MAX_DEFAULT,
+
     // for testing and development only
     .hack = 0,
 
@@ -271,6 +294,34 @@ double GB_Global_hyper_ratio_get (void)
     return (GB_Global.hyper_ratio) ;
 }
 
+//------------------------------------------------------------------------------
+// sparsity
+//------------------------------------------------------------------------------
+
+void GB_Global_sparsity_set (int sparsity)
+{ 
+    GB_Global.sparsity = sparsity ;
+}
+
+int GB_Global_sparsity_get (void)
+{ 
+    return (GB_Global.sparsity) ;
+}
+
+//------------------------------------------------------------------------------
+// bitmap_switch
+//------------------------------------------------------------------------------
+
+void GB_Global_bitmap_switch_set (double bitmap_switch)
+{ 
+    GB_Global.bitmap_switch = bitmap_switch ;
+}
+
+double GB_Global_bitmap_switch_get (void)
+{ 
+    return (GB_Global.bitmap_switch) ;
+}
+
 //------------------------------------------------------------------------------
 // use_mkl
 //------------------------------------------------------------------------------
@@ -550,6 +601,117 @@ int64_t GB_Global_hack_get (void)
     return (GB_Global.hack) ;
 }
 
+//------------------------------------------------------------------------------
+// workspace pool
+//------------------------------------------------------------------------------
+
+void GB_Global_workspace_max_set (size_t workspace_max)
+{ 
+    GB_Global.workspace_max = workspace_max ;
+}
+
+size_t GB_Global_workspace_max_get (void)
+{ 
+    return (GB_Global.workspace_max) ;
+}
+
+size_t GB_Global_workspace_total_get (void)
+{ 
+    return (GB_Global.workspace_total) ;
+}
+
+// Remove the smallest block of at least size bytes from the pool, and return
+// it and its size.  Returns NULL if no such block is in the pool.
+
+void *GB_Global_workspace_get (size_t size, size_t *size_allocated)
+{
+    void *p = NULL ;
+    (*size_allocated) = 0 ;
+    #pragma omp critical(GB_workspace_pool)
+    {
+        int kbest = -1 ;
+        for (int k = 0 ; k < GB_WORKSPACE_POOL ; k++)
+        {
+            size_t ksize = GB_Global.workspace_size [k] ;
+            if (GB_Global.workspace [k] != NULL && ksize >= size &&
+                (kbest < 0 || ksize < GB_Global.workspace_size [kbest]))
+            { 
+                kbest = k ;
+            }
+        }
+        if (kbest >= 0)
+        { 
+            p = GB_Global.workspace [kbest] ;
+            (*size_allocated) = GB_Global.workspace_size [kbest] ;
+            GB_Global.workspace [kbest] = NULL ;
+            GB_Global.workspace_size [kbest] = 0 ;
+            GB_Global.workspace_total -= (*size_allocated) ;
+        }
+    }
+    return (p) ;
+}
+
+// Add a block of the given size to the pool.  If the pool is full, the
+// smallest block in the pool is evicted, if it is smaller than the new block.
+// Returns the block that the caller must free: either the new block itself if
+// it does not fit in the pool, the evicted block, or NULL.
+
+void *GB_Global_workspace_put (void *p, size_t size)
+{
+    void *pfree = p ;
+    #pragma omp critical(GB_workspace_pool)
+    {
+        // find an empty slot, or the smallest block in the pool
+        int kbest = -1 ;
+        for (int k = 0 ; k < GB_WORKSPACE_POOL ; k++)
+        {
+            if (GB_Global.workspace [k] == NULL)
+            { 
+                kbest = k ;
+                break ;
+            }
+            if (kbest < 0 ||
+                GB_Global.workspace_size [k] < GB_Global.workspace_size [kbest])
+            { 
+                kbest = k ;
+            }
+        }
+        size_t evict = GB_Global.workspace_size [kbest] ;
+        if (evict < size &&
+            GB_Global.workspace_total - evict + size <= GB_Global.workspace_max)
+        { 
+            // place p in the pool, and return the evicted block, if any
+            pfree = GB_Global.workspace [kbest] ;
+            GB_Global.workspace [kbest] = p ;
+            GB_Global.workspace_size [kbest] = size ;
+            GB_Global.workspace_total += (size - evict) ;
+        }
+    }
+    return (pfree) ;
+}
+
+// Remove any block from the pool and return it, or NULL if the pool is empty.
+
+void *GB_Global_workspace_pop (void)
+{
+    void *p = NULL ;
+    #pragma omp critical(GB_workspace_pool)
+    {
+        for (int k = 0 ; k < GB_WORKSPACE_POOL ; k++)
+        {
+            if (GB_Global.workspace [k] != NULL)
+            { 
+                p = GB_Global.workspace [k] ;
+                GB_Global.workspace_total -= GB_Global.workspace_size [k] ;
+                GB_Global.workspace [k] = NULL ;
+                GB_Global.workspace_size [k] = 0 ;
+                break ;
+            }
+        }
+    }
+    return (p) ;
+}
+
 //------------------------------------------------------------------------------
 // burble: for controlling the burble output
 //------------------------------------------------------------------------------
@@ -42,6 +42,12 @@ double   GB_Global_chunk_get (void) ;
 void     GB_Global_hyper_ratio_set (double hyper_ratio) ;
 double   GB_Global_hyper_ratio_get (void) ;
 
+void     GB_Global_sparsity_set (int sparsity) ;
+int      GB_Global_sparsity_get (void) ;
+
+void     GB_Global_bitmap_switch_set (double bitmap_switch) ;
+double   GB_Global_bitmap_switch_get (void) ;
+
 void     GB_Global_is_csc_set (bool is_csc) ;
 bool     GB_Global_is_csc_get (void) ;
 
@@ -110,6 +116,13 @@ void     GB_Global_hack_set (int64_t hack) ;
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 int64_t  GB_Global_hack_get (void) ;
 
+void     GB_Global_workspace_max_set (size_t workspace_max) ;
+size_t   GB_Global_workspace_max_get (void) ;
+size_t   GB_Global_workspace_total_get (void) ;
+void  *  GB_Global_workspace_get (size_t size, size_t *size_allocated) ;
+void  *  GB_Global_workspace_put (void *p, size_t size) ;
+void  *  GB_Global_workspace_pop (void) ;
+
 void     GB_Global_burble_set (bool burble) ;
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 bool     GB_Global_burble_get (void) ;
@@ -11,13 +11,26 @@
 // contiguous.  Scatter I into the I inverse buckets (Mark and Inext) for quick
 // lookup.
 
-// FUTURE:: this code is sequential.  Constructing the I inverse buckets in
-// parallel would require synchronization (a critical section for each bucket,
-// or atomics).  A more parallel approach might use qsort first, to find
-// duplicates in I, and then construct the buckets in parallel after the qsort.
-// But the time complexity would be higher.
+// With a single thread, the buckets are constructed in O(nI) time with a
+// single backwards pass over I.  With multiple threads, the list I is first
+// sorted (with its positions inew as a tie-breaker) by a parallel mergesort,
+// unless I is already sorted, which is the common case.  Each index i then
+// appears in a contiguous run of the sorted list, and the buckets are
+// constructed in parallel with no synchronization.  The time complexity is
+// higher (O(nI log nI) if I must be sorted), but all the work is parallel.
+// In both cases, each bucket lists the positions inew in ascending order,
+// which Case 11 of GB_subref_template relies on.
 
 #include "GB_subref.h"
+#include "GB_sort.h"
+
+#define GB_FREE_WORK    \
+{                       \
+    GB_FREE (I1) ;      \
+    GB_FREE (I1k) ;     \
+    GB_FREE (W0) ;      \
+    GB_FREE (W1) ;      \
+}
 
 GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
 (
@@ -39,11 +52,22 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     int64_t *Mark = NULL ;
     int64_t *Inext = NULL ;
     int64_t ndupl = 0 ;
+    int64_t *GB_RESTRICT I1  = NULL ;
+    int64_t *GB_RESTRICT I1k = NULL ;
+    int64_t *GB_RESTRICT W0 = NULL ;
+    int64_t *GB_RESTRICT W1 = NULL ;
 
     (*p_Mark ) = NULL ;
     (*p_Inext) = NULL ;
     (*p_ndupl) = 0 ;
 
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (nI, chunk, nthreads_max) ;
+
     //--------------------------------------------------------------------------
     // allocate workspace
     //--------------------------------------------------------------------------
@@ -65,24 +89,123 @@ GrB_Info GB_I_inverse           // invert the I list for C=A(I,:)
     // at this point, Mark is all zero, so Mark [i] < 1 for all i in
     // the range 0 to avlen-1.
 
-    // O(nI) time; not parallel
-    for (int64_t inew = nI-1 ; inew >= 0 ; inew--)
+    if (nthreads == 1)
+    {
+
+        //----------------------------------------------------------------------
+        // sequential construction of the buckets
+        //----------------------------------------------------------------------
+
+        // O(nI) time
+        for (int64_t inew = nI-1 ; inew >= 0 ; inew--)
+        {
+            int64_t i = I [inew] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            int64_t ihead = (Mark [i] - 1) ;
+            if (ihead < 0)
+            { 
+                // first time i has been seen in the list I
+                ihead = -1 ;
+            }
+            else
+            { 
+                // i has already been seen in the list I
+                ndupl++ ;
+            }
+            Mark [i] = inew + 1 ;       // (Mark [i] - 1) = inew
+            Inext [inew] = ihead ;
+        }
+
+    }
+    else
     {
-        int64_t i = I [inew] ;
-        ASSERT (i >= 0 && i < avlen) ;
-        int64_t ihead = (Mark [i] - 1) ;
-        if (ihead < 0)
-        { 
-            // first time i has been seen in the list I
-            ihead = -1 ;
+
+        //----------------------------------------------------------------------
+        // check if I is already sorted
+        //----------------------------------------------------------------------
+
+        int64_t nunsorted = 0 ;
+        int64_t k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:nunsorted)
+        for (k = 1 ; k < nI ; k++)
+        {
+            if (I [k-1] > I [k]) nunsorted++ ;
+        }
+
+        //----------------------------------------------------------------------
+        // sort [I1 I1k] if I is not sorted
+        //----------------------------------------------------------------------
+
+        const int64_t *GB_RESTRICT Key = (const int64_t *) I ;
+        if (nunsorted > 0)
+        {
+            I1  = GB_MALLOC (nI, int64_t) ;
+            I1k = GB_MALLOC (nI, int64_t) ;
+            int nth = GB_MSORT_NTHREADS (nthreads) ;
+            if (nth > 1)
+            { 
+                W0 = GB_MALLOC (nI, int64_t) ;
+                W1 = GB_MALLOC (nI, int64_t) ;
+            }
+            if (I1 == NULL || I1k == NULL ||
+                (nth > 1 && (W0 == NULL || W1 == NULL)))
+            { 
+                // out of memory
+                GB_FREE_WORK ;
+                GB_FREE (Mark) ;
+                GB_FREE (Inext) ;
+                return (GB_OUT_OF_MEMORY) ;
+            }
+            GB_memcpy (I1, I, nI * sizeof (int64_t), nthreads) ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (k = 0 ; k < nI ; k++)
+            { 
+                I1k [k] = k ;
+            }
+            // sort by index i, and then by position inew
+            GB_msort_2 (I1, I1k, W0, W1, nI, nth) ;
+            Key = I1 ;
         }
-        else
-        { 
-            // i has already been seen in the list I
-            ndupl++ ;
+
+        //----------------------------------------------------------------------
+        // construct the buckets in parallel
+        //----------------------------------------------------------------------
+
+        // Key [0:nI-1] is sorted, and the kth entry in Key is the index i
+        // = I [inew] where inew = I1k [k] (or inew = k if I is sorted).  Each
+        // run of duplicate indices i in Key is bucket i, in increasing order.
+
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+            reduction(+:ndupl)
+        for (k = 0 ; k < nI ; k++)
+        {
+            int64_t i = Key [k] ;
+            ASSERT (i >= 0 && i < avlen) ;
+            int64_t inew = (I1k == NULL) ? k : I1k [k] ;
+            if (k == 0 || Key [k-1] != i)
+            { 
+                // inew is the first time i appears in the list I
+                Mark [i] = inew + 1 ;
+            }
+            else
+            { 
+                // i has already been seen in the list I
+                ndupl++ ;
+            }
+            if (k < nI-1 && Key [k+1] == i)
+            { 
+                // the next position of i in the list I
+                Inext [inew] = (I1k == NULL) ? (k+1) : I1k [k+1] ;
+            }
+            else
+            { 
+                // inew is the last position of i in the list I
+                Inext [inew] = -1 ;
+            }
         }
-        Mark [i] = inew + 1 ;       // (Mark [i] - 1) = inew
-        Inext [inew] = ihead ;
+
+        GB_FREE_WORK ;
     }
 
     // indices in I are now in buckets.  An index i might appear more than once
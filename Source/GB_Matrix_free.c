@@ -10,7 +10,7 @@
 // Free all the content of a matrix.  After GB_Matrix_free (&A), A is set to
 // NULL.
 
-#include "GB.h"
+#include "GB_Pending.h"
 #include "GB_mkl.h"
 
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
@@ -27,6 +27,9 @@ GrB_Info GB_Matrix_free         // free a matrix
         { 
             // free all content of A
             GB_PHIX_FREE (A) ;
+
+            // free the slots for concurrent insertion, if any
+            GB_Pending_slots_free (A) ;
             // free the MKL optimization, if it exists
             #if GB_HAS_MKL
             GB_MKL_GRAPH_MATRIX_DESTROY (A->mkl) ;
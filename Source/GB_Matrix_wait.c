@@ -15,10 +15,12 @@
 // The matrix A has zombies and/or pending tuples placed there by
 // GrB_setElement, GrB_*assign, or GB_mxm.  Zombies must now be deleted, and
 // pending tuples must now be assembled together and added into the matrix.
+// A may also be jumbled (by GB_AxB_saxpy3), in which case its vectors are
+// sorted once the zombies are gone.
 
 // When the function returns, and all pending tuples and zombies have been
-// deleted.  This is true even the function fails due to lack of memory (in
-// that case, the matrix is cleared as well).
+// deleted, and A is no longer jumbled.  This is true even the function fails
+// due to lack of memory (in that case, the matrix is cleared as well).
 
 // If A is hypersparse, the time taken is at most O(nnz(A) + t log t), where t
 // is the number of pending tuples in A, and nnz(A) includes both zombies and
@@ -29,11 +31,17 @@
 // If A is non-hypersparse, then O(n) is added in the worst case, to prune
 // zombies and to update the vector pointers for A.
 
+// If the zombies and pending tuples are all in the last few vectors of A, so
+// that A = [A0 A1] where A0 is large and A1 is small, then only A1 is pruned
+// and merged with the pending tuples, and A0 is not modified.  The time is
+// then proportional to nnz (A1) plus the number of pending tuples.
+
 #include "GB_select.h"
 #include "GB_add.h"
 #include "GB_Pending.h"
 #include "GB_build.h"
 #include "GB_jappend.h"
+#include "GB_ek_slice.h"
 
 #define GB_FREE_ALL                     \
 {                                       \
@@ -44,6 +52,271 @@
     GB_MATRIX_FREE (&(Aslice [1])) ;    \
 }
 
+//------------------------------------------------------------------------------
+// GB_wait_prune: delete the zombies in the trailing vectors of A
+//------------------------------------------------------------------------------
+
+// If all the zombies of A appear in A (:, kzombie:end), and that part of A is
+// small compared with A (:, 0:kzombie-1), then the zombies are removed in
+// place from just A (:, kzombie:end), and true is returned.  The leading part
+// of A is not accessed.  This is the typical case when A is modified by a
+// stream of updates that touch only a few vectors at the end of A.  Otherwise,
+// A is not modified and false is returned, and all of A is pruned with
+// GB_selector instead.
+
+// The first zombie is found by scanning A backwards from its last entry,
+// counting zombies until all A->nzombies of them have been seen.  The scan
+// gives up as soon as the part of A it has traversed is too large, so the
+// work is proportional to the size of the trailing part of A in either case.
+// No memory is allocated so this step always succeeds.
+
+static bool GB_wait_prune       // true if A has been pruned
+(
+    GrB_Matrix A                // matrix with zombies to prune
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_ZOMBIES (A)) ;
+    int64_t *GB_RESTRICT Ap = A->p ;
+    int64_t *GB_RESTRICT Ai = A->i ;
+    GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+    const size_t asize = A->type->size ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_NNZ (A) ;
+    const int64_t nzombies = A->nzombies ;
+
+    //--------------------------------------------------------------------------
+    // find the first zombie, pzombie, in A
+    //--------------------------------------------------------------------------
+
+    int64_t pzombie = anz ;
+    int64_t nz = 0 ;
+    for (int64_t p = anz-1 ; nz < nzombies ; p--)
+    {
+        // A (:, kzombie:end) includes Ai [p:anz-1], so give up if that part
+        // of A is not small compared with the rest of A.
+        if (2 * (anz - p) >= p) return (false) ;
+        if (GB_IS_ZOMBIE (Ai [p]))
+        { 
+            nz++ ;
+            pzombie = p ;
+        }
+    }
+
+    // find the vector kzombie that contains the first zombie
+    int64_t kzombie = GB_search_for_vector (pzombie, Ap, 0, anvec) ;
+    ASSERT (Ap [kzombie] <= pzombie && pzombie < Ap [kzombie+1]) ;
+
+    //--------------------------------------------------------------------------
+    // remove the zombies from A (:, kzombie:end)
+    //--------------------------------------------------------------------------
+
+    // Entries in A (:, kzombie) before the first zombie do not move, and
+    // Ap [kzombie] does not change.
+
+    int64_t pA = pzombie ;          // next entry to examine
+    int64_t pC = pzombie ;          // next live entry is placed here
+    int64_t nempty = 0 ;            // # of vectors that have become empty
+    for (int64_t k = kzombie ; k < anvec ; k++)
+    {
+        // A (:,k) is in Ai [pA ... pA_end-1] on input, and Ap [k] has already
+        // been set to its new position
+        int64_t pA_end = Ap [k+1] ;
+        bool was_nonempty = (pA < pA_end) ;
+        for ( ; pA < pA_end ; pA++)
+        {
+            int64_t i = Ai [pA] ;
+            if (GB_IS_NOT_ZOMBIE (i))
+            { 
+                Ai [pC] = i ;
+                memcpy (Ax +(pC*asize), Ax +(pA*asize), asize) ;
+                pC++ ;
+            }
+        }
+        if (was_nonempty && Ap [k] == pC) nempty++ ;
+        Ap [k+1] = pC ;
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize A
+    //--------------------------------------------------------------------------
+
+    ASSERT (anz - pC == nzombies) ;
+    if (A->nvec_nonempty >= 0)
+    { 
+        A->nvec_nonempty -= nempty ;
+    }
+    A->nzombies = 0 ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_wait_prune_slices: delete the zombies of A, one slice at a time
+//------------------------------------------------------------------------------
+
+// The entries of A are split into slices with GB_ek_slice, and the zombies in
+// each slice are counted in parallel.  The entries before the first slice
+// with any zombies are not modified.  After that, each slice with no zombies
+// is shifted down as a single block with memmove, and the vector pointers
+// that end in it are adjusted by the same amount.  Only the slices that
+// contain zombies are pruned entry by entry, one vector at a time.  If the
+// slice workspace cannot be allocated, A is not modified and false is
+// returned, and all of A is pruned with GB_selector instead.
+
+static bool GB_wait_prune_slices    // true if A has been pruned
+(
+    GrB_Matrix A,               // matrix with zombies to prune
+    int nthreads_max,
+    double chunk
+)
+{
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    ASSERT (GB_ZOMBIES (A)) ;
+    int64_t *GB_RESTRICT Ap = A->p ;
+    int64_t *GB_RESTRICT Ai = A->i ;
+    GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+    const size_t asize = A->type->size ;
+    const int64_t anvec = A->nvec ;
+    const int64_t anz = GB_NNZ (A) ;
+    ASSERT (anz > 0) ;
+
+    //--------------------------------------------------------------------------
+    // slice the entries of A
+    //--------------------------------------------------------------------------
+
+    // Many more slices than threads are used, so that the zombies are
+    // confined to as few entries of A as possible.
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+    int ntasks = (int) GB_IMIN (anz, 64 * nthreads) ;
+    int64_t *GB_RESTRICT pstart_slice = NULL ;
+    int64_t *GB_RESTRICT kfirst_slice = NULL ;
+    int64_t *GB_RESTRICT klast_slice = NULL ;
+    int64_t *GB_RESTRICT Zcount = NULL ;
+    Zcount = GB_MALLOC (ntasks, int64_t) ;
+    if (Zcount == NULL ||
+        !GB_ek_slice (&pstart_slice, &kfirst_slice, &klast_slice, A, ntasks))
+    { 
+        // out of memory
+        GB_FREE (Zcount) ;
+        return (false) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the zombies in each slice
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t nz = 0 ;
+        for (int64_t p = pstart_slice [tid] ; p < pstart_slice [tid+1] ; p++)
+        { 
+            if (GB_IS_ZOMBIE (Ai [p])) nz++ ;
+        }
+        Zcount [tid] = nz ;
+    }
+
+    int tfirst = 0 ;
+    while (Zcount [tfirst] == 0) tfirst++ ;
+    ASSERT (tfirst < ntasks) ;
+
+    //--------------------------------------------------------------------------
+    // remove the zombies from the slices tfirst:ntasks-1
+    //--------------------------------------------------------------------------
+
+    // A (:,k) is the vector that holds the first entry of slice tfirst.  All
+    // prior vectors end at or before that entry, and are not modified.
+
+    int64_t pA = pstart_slice [tfirst] ;    // next entry to examine
+    int64_t pC = pA ;                       // next live entry is placed here
+    int64_t k = kfirst_slice [tfirst] ;
+    while (Ap [k+1] <= pA)
+    { 
+        // skip any leading empty vectors (kfirst_slice [0] is always zero)
+        k++ ;
+    }
+    ASSERT (Ap [k] <= pA && pA < Ap [k+1]) ;
+
+    for (tid = tfirst ; tid < ntasks ; tid++)
+    {
+        int64_t pA_end = pstart_slice [tid+1] ;
+        if (Zcount [tid] == 0)
+        {
+
+            //------------------------------------------------------------------
+            // no zombies in this slice: shift all of it down
+            //------------------------------------------------------------------
+
+            int64_t shift = pA - pC ;
+            int64_t n = pA_end - pA ;
+            memmove (Ai + pC, Ai + pA, n * sizeof (int64_t)) ;
+            memmove (Ax +(pC*asize), Ax +(pA*asize), n * asize) ;
+            while (k < anvec && Ap [k+1] <= pA_end)
+            { 
+                Ap [k+1] -= shift ;
+                k++ ;
+            }
+            pA = pA_end ;
+            pC += n ;
+
+        }
+        else
+        {
+
+            //------------------------------------------------------------------
+            // prune each vector in this slice
+            //------------------------------------------------------------------
+
+            while (pA < pA_end)
+            {
+                // Ap [k+1] has not yet been modified
+                int64_t pA_vend = GB_IMIN (Ap [k+1], pA_end) ;
+                for ( ; pA < pA_vend ; pA++)
+                {
+                    int64_t i = Ai [pA] ;
+                    if (GB_IS_NOT_ZOMBIE (i))
+                    { 
+                        Ai [pC] = i ;
+                        memcpy (Ax +(pC*asize), Ax +(pA*asize), asize) ;
+                        pC++ ;
+                    }
+                }
+                // finalize A (:,k), and any empty vectors that follow it
+                while (k < anvec && Ap [k+1] == pA)
+                { 
+                    Ap [k+1] = pC ;
+                    k++ ;
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // finalize A
+    //--------------------------------------------------------------------------
+
+    ASSERT (k == anvec) ;
+    ASSERT (anz - pC == A->nzombies) ;
+    GB_ek_slice_free (&pstart_slice, &kfirst_slice, &klast_slice) ;
+    GB_FREE (Zcount) ;
+    A->nvec_nonempty = -1 ;     // recomputed by the caller
+    A->nzombies = 0 ;
+    return (true) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_Matrix_wait
+//------------------------------------------------------------------------------
+
 GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
 GrB_Info GB_Matrix_wait         // finish all pending computations
 (
@@ -78,16 +351,32 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     GrB_Matrix T = NULL, S = NULL, Aslice [2] = { NULL, NULL } ;
     GrB_Info info = GrB_SUCCESS ;
 
+    // move any pending tuples from concurrent GrB_setElement into A->Pending
+    GB_OK (GB_Pending_merge (A, Context)) ;
+
     int64_t nzombies = A->nzombies ;
     int64_t npending = GB_Pending_n (A) ;
 
-    if (nzombies > 0 || npending > 0)
+    if (nzombies > 0 || npending > 0 || A->jumbled)
     { 
-        GB_BURBLE_MATRIX (A, "wait (zombies: " GBd ", pending: " GBd ") ",
-            nzombies, npending) ;
+        GB_BURBLE_MATRIX (A, "wait (zombies: " GBd ", pending: " GBd
+            "%s) ", nzombies, npending, A->jumbled ? ", jumbled" : "") ;
     }
 
-    if (nzombies > 0)
+    if (nzombies > 0 && (GB_wait_prune (A) ||
+        GB_wait_prune_slices (A, nthreads_max, chunk)))
+    { 
+        // Either all the zombies are in A (:, kzombie:end), which is small
+        // compared with A (:, 0:kzombie-1), and only that part of A has been
+        // compacted, or A has been pruned one slice at a time, and the
+        // entries before the first slice with zombies have not been moved.
+        if (A->nvec_nonempty < 0)
+        { 
+            A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
+        }
+        ASSERT (A->nvec_nonempty == GB_nvec_nonempty (A, NULL)) ;
+    }
+    else if (nzombies > 0)
     { 
         // remove all zombies from A.  Also compute A->nvec_nonempty
         #ifdef GB_DEBUG
@@ -108,6 +397,17 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     // all the zombies are gone
     ASSERT (!GB_ZOMBIES (A)) ;
 
+    //--------------------------------------------------------------------------
+    // sort the vectors of A if it is jumbled
+    //--------------------------------------------------------------------------
+
+    // The pending tuples are ignored, and the zombies have been deleted, so
+    // the vectors of A can now be sorted in place.  If A has pending tuples,
+    // GB_add below requires A to be sorted.
+
+    GB_OK (GB_unjumble (A, Context)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+
     //--------------------------------------------------------------------------
     // check for pending tuples
     //--------------------------------------------------------------------------
@@ -124,8 +424,8 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
         // guaranteed not to fail.
         GB_OK (GB_ix_resize (A, anz, Context)) ;
 
-        // conform A to its desired hypersparsity
-        return (GB_to_hyper_conform (A, Context)) ;
+        // conform A to its desired sparsity structure
+        return (GB_conform (A, Context)) ;
     }
 
     // There are pending tuples that will now be assembled.
@@ -217,7 +517,7 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
     if (anz == 0)
     { 
         // A has no entries so just transplant T into A, then free T and
-        // conform A to its desired hypersparsity.
+        // conform A to its desired sparsity structure.
         return (GB_transplant_conform (A, A->type, &T, Context)) ;
     }
 
@@ -280,10 +580,10 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
         // If anz1 is zero, or small compared to anz0, then it is faster to
         // leave A0 unmodified, and to update just A1.
 
-        // FUTURE:: this does not tolerate zombies.  So do it only if A has no
-        // zombies on input.  Or, when GB_add can tolerate zombies, set the
-        // Aslice [1] to start at the first zombie.  Keep track of the vector
-        // containing the first zombie.
+        // If the zombies of A were all in a small trailing part of A, then
+        // GB_wait_prune has compacted just that part, and A0 has not been
+        // touched at all.  The total work is then proportional to the size of
+        // A1 and T, not nnz (A).
 
         // make sure A has enough space for the new tuples
         if (anz_new > A->nzmax)
@@ -380,8 +680,8 @@ GrB_Info GB_Matrix_wait         // finish all pending computations
 
         GB_MATRIX_FREE (&T) ;
 
-        // conform A to its desired hypersparsity
-        return (GB_to_hyper_conform (A, Context)) ;
+        // conform A to its desired sparsity structure
+        return (GB_conform (A, Context)) ;
 
     }
     else
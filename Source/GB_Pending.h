@@ -10,6 +10,7 @@
 #ifndef GB_PENDING_H
 #define GB_PENDING_H
 #include "GB.h"
+#include "GB_atomics.h"
 
 //------------------------------------------------------------------------------
 // GB_Pending data structure
@@ -31,6 +32,62 @@ struct GB_Pending_struct    // list of pending tuples for a matrix
 // initial size of the pending tuples
 #define GB_PENDING_INIT 256
 
+//------------------------------------------------------------------------------
+// GB_Pending_slots: per-thread lists of pending tuples
+//------------------------------------------------------------------------------
+
+// A matrix that allows concurrent insertion has GB_PENDING_NSLOTS slots, each
+// with its own list of pending tuples and a lock.  A user thread calling
+// GrB_setElement owns a slot for just the duration of a single append.  The
+// tuples in the slots always have type A->type, with an implicit SECOND
+// operator (Pending->op is NULL).  The slot locks also serialize the in-place
+// updates of live entries: the entry at position p of A->x is written while
+// holding the lock of slot (p % GB_PENDING_NSLOTS).
+
+#define GB_PENDING_NSLOTS 64
+
+struct GB_Pending_slot_struct   // one slot of pending tuples
+{
+    GB_Pending Pending ;    // list of pending tuples in this slot
+    int8_t lock ;           // 1 if a thread owns this slot, 0 otherwise
+    // pad each slot to its own cache line, to avoid false sharing
+    int8_t pad [64 - sizeof (GB_Pending) - sizeof (int8_t)] ;
+} ;
+
+//------------------------------------------------------------------------------
+// GB_Pending_slot_lock and GB_Pending_slot_unlock: acquire/release a slot
+//------------------------------------------------------------------------------
+
+// A thread spins until it owns slot k.  A slot is owned for just a single
+// append or a single in-place update, and no thread ever holds two slots, so
+// the wait is short and cannot deadlock.
+
+static inline void GB_Pending_slot_lock
+(
+    GB_Pending_slots slots,
+    int k
+)
+{
+    while (true)
+    {
+        int8_t owner ;
+        GB_ATOMIC_CAPTURE_INT8 (owner, slots [k].lock, 1) ;
+        if (owner == 0) break ;
+    }
+    GB_PRAGMA (omp flush)
+}
+
+static inline void GB_Pending_slot_unlock
+(
+    GB_Pending_slots slots,
+    int k
+)
+{
+    GB_PRAGMA (omp flush)
+    GB_ATOMIC_WRITE
+    slots [k].lock = 0 ;
+}
+
 //------------------------------------------------------------------------------
 // GB_Pending functions
 //------------------------------------------------------------------------------
@@ -55,6 +112,60 @@ void GB_Pending_free        // free a list of pending tuples
     GB_Pending *PHandle
 ) ;
 
+GrB_Info GB_Pending_slots_add   // add a tuple to a slot of a matrix
+(
+    GrB_Matrix C,               // matrix that allows concurrent insertion
+    const GB_void *cwork,       // scalar to add, already typecast to C->type
+    const int64_t i,            // index into vector
+    const int64_t j             // vector index
+) ;
+
+GrB_Info GB_Pending_merge       // move the tuples in the slots to A->Pending
+(
+    GrB_Matrix A,               // matrix to modify
+    GB_Context Context
+) ;
+
+void GB_Pending_slots_free      // free all the slots of a matrix
+(
+    GrB_Matrix A
+) ;
+
+//------------------------------------------------------------------------------
+// GB_Pending_slots_clear: discard the tuples in the slots of a matrix
+//------------------------------------------------------------------------------
+
+// The slots themselves are kept, so the matrix still allows concurrent
+// insertion.
+
+static inline void GB_Pending_slots_clear
+(
+    GrB_Matrix A
+)
+{
+    if (A->Pending_slots != NULL)
+    {
+        for (int k = 0 ; k < GB_PENDING_NSLOTS ; k++)
+        { 
+            GB_Pending_free (&(A->Pending_slots [k].Pending)) ;
+        }
+    }
+    A->Pending_slots_used = false ;
+}
+
+//------------------------------------------------------------------------------
+// GB_PENDING_IS_SECOND: true if A->Pending can take tuples from the slots
+//------------------------------------------------------------------------------
+
+// The tuples in the slots can be appended to A->Pending only if A->Pending is
+// empty, or if it holds tuples of type A->type with an implicit or explicit
+// SECOND operator.
+
+#define GB_PENDING_IS_SECOND(A)                                             \
+    ((A)->Pending == NULL ||                                                \
+    ((A)->Pending->type == (A)->type &&                                     \
+    GB_op_is_second ((A)->Pending->op, (A)->type)))
+
 //------------------------------------------------------------------------------
 // GB_Pending_ensure: make sure the list of pending tuples is large enough
 //------------------------------------------------------------------------------
@@ -195,7 +306,7 @@ static inline bool GB_shall_block
 )
 {
 
-    if (!GB_PENDING_OR_ZOMBIES (A)) return (false) ;
+    if (!GB_ANY_PENDING_WORK (A)) return (false) ;
     double npending = (double) GB_Pending_n (A) ;
     double anzmax = ((double) A->vlen) * ((double) A->vdim) ;
     bool many_pending = (npending >= anzmax) ;
@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+// GB_Pending_merge: move the pending tuples in the slots of A to A->Pending
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A matrix that allows concurrent insertion holds the pending tuples from
+// GrB_setElement in its slots (see GB_Pending_slots_add).  This function
+// appends all of them to A->Pending, in parallel, so that they can be
+// assembled by GB_Matrix_wait (via GB_builder), or extended by GB_subassigner.
+// No user thread may be inserting into A while this function is called.
+
+// The tuples in each slot were added in order, but the order of tuples in
+// different slots is arbitrary, since the user threads that added them did so
+// concurrently.  A user thread always appends to the same slot, so the tuples
+// it added remain in their original order here, and the last value it wrote
+// to any given C(i,j) is the one kept when the tuples are assembled.  The
+// order of tuples with the same (i,j) from different threads is arbitrary,
+// just as it would be for any other concurrent writes to the same entry.  The
+// tuples in the slots never have the same (i,j) as an entry already in the
+// pattern of A, since such an entry is modified in place by GrB_setElement.  A->Pending is always empty or uses the implicit SECOND
+// operator, with type A->type (see GB_PENDING_IS_SECOND), so all the tuples
+// can be placed in a single list.
+
+// If A is bitmap, it is converted to sparse, since pending tuples can only be
+// assembled into a sparse or hypersparse matrix.  If out of memory, all
+// content of A is freed.
+
+#include "GB_Pending.h"
+
+#define GB_FREE_ALL GB_PHIX_FREE (A) ;
+
+GrB_Info GB_Pending_merge       // move the tuples in the slots to A->Pending
+(
+    GrB_Matrix A,               // matrix to modify
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL) ;
+    if (!(A->Pending_slots_used))
+    { 
+        // no pending tuples in the slots of A
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT (A->Pending_slots != NULL) ;
+    ASSERT (GB_PENDING_IS_SECOND (A)) ;
+    ASSERT (!GB_IS_FULL (A)) ;
+
+    //--------------------------------------------------------------------------
+    // count the tuples in each slot
+    //--------------------------------------------------------------------------
+
+    GB_Pending_slots slots = A->Pending_slots ;
+    bool is_matrix = (A->vdim > 1) ;
+    int64_t Slot_start [GB_PENDING_NSLOTS+1] ;
+    int nslots_used = 0, klast = -1 ;
+    for (int k = 0 ; k < GB_PENDING_NSLOTS ; k++)
+    {
+        GB_Pending S = slots [k].Pending ;
+        Slot_start [k] = (S == NULL) ? 0 : S->n ;
+        if (Slot_start [k] > 0)
+        { 
+            nslots_used++ ;
+            klast = k ;
+        }
+    }
+    GB_cumsum (Slot_start, GB_PENDING_NSLOTS, NULL, 1) ;
+    int64_t nnew = Slot_start [GB_PENDING_NSLOTS] ;
+    if (nnew == 0)
+    { 
+        GB_Pending_slots_clear (A) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    GBBURBLE ("(merge " GBd " pending from %d threads) ", nnew, nslots_used) ;
+
+    //--------------------------------------------------------------------------
+    // detach A->Pending from A
+    //--------------------------------------------------------------------------
+
+    // A bitmap matrix never has tuples in A->Pending.  It is converted to
+    // sparse below, once the tuples in the slots have been moved.
+
+    ASSERT (GB_IMPLIES (GB_IS_BITMAP (A), A->Pending == NULL)) ;
+    GB_Pending Pending = A->Pending ;
+    A->Pending = NULL ;
+
+    if (Pending == NULL && nslots_used == 1)
+    { 
+
+        //----------------------------------------------------------------------
+        // a single slot holds all the tuples: move its list to A->Pending
+        //----------------------------------------------------------------------
+
+        Pending = slots [klast].Pending ;
+        slots [klast].Pending = NULL ;
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // make sure A->Pending can hold all the tuples
+        //----------------------------------------------------------------------
+
+        if (!GB_Pending_ensure (&Pending, A->type, NULL, is_matrix, nnew))
+        { 
+            // out of memory
+            GB_FREE_ALL ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+
+        int64_t n = Pending->n ;
+        size_t asize = Pending->size ;
+        ASSERT (Pending->type == A->type) ;
+        ASSERT (n + nnew <= Pending->nmax) ;
+
+        //----------------------------------------------------------------------
+        // determine if all the tuples remain in sorted order
+        //----------------------------------------------------------------------
+
+        bool sorted = (n == 0 || Pending->sorted) ;
+        int64_t ilast = (n == 0) ? -1 : Pending->i [n-1] ;
+        int64_t jlast = (n == 0 || !is_matrix) ? -1 : Pending->j [n-1] ;
+        for (int k = 0 ; sorted && k < GB_PENDING_NSLOTS ; k++)
+        {
+            GB_Pending S = slots [k].Pending ;
+            if (S == NULL || S->n == 0) continue ;
+            int64_t i = S->i [0] ;
+            int64_t j = is_matrix ? S->j [0] : -1 ;
+            sorted = S->sorted && ((jlast < j) || (jlast == j && ilast <= i)) ;
+            ilast = S->i [S->n-1] ;
+            jlast = is_matrix ? S->j [S->n-1] : -1 ;
+        }
+
+        //----------------------------------------------------------------------
+        // append the tuples in each slot to A->Pending
+        //----------------------------------------------------------------------
+
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        int nthreads = GB_nthreads (nnew, chunk, nthreads_max) ;
+        nthreads = GB_IMIN (nthreads, nslots_used) ;
+
+        int64_t *GB_RESTRICT Pending_i = Pending->i ;
+        int64_t *GB_RESTRICT Pending_j = Pending->j ;
+        GB_void *GB_RESTRICT Pending_x = Pending->x ;
+
+        int k ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (k = 0 ; k < GB_PENDING_NSLOTS ; k++)
+        {
+            GB_Pending S = slots [k].Pending ;
+            if (S == NULL || S->n == 0) continue ;
+            int64_t p = n + Slot_start [k] ;
+            memcpy (Pending_i + p, S->i, S->n * sizeof (int64_t)) ;
+            if (is_matrix)
+            { 
+                memcpy (Pending_j + p, S->j, S->n * sizeof (int64_t)) ;
+            }
+            memcpy (Pending_x + p * asize, S->x, S->n * asize) ;
+        }
+
+        Pending->n = n + nnew ;
+        Pending->sorted = sorted ;
+    }
+
+    GB_Pending_slots_clear (A) ;
+
+    //--------------------------------------------------------------------------
+    // pending tuples can only be added to a sparse or hypersparse matrix
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_BITMAP (A))
+    {
+        // A has no pending work while its pending tuples are detached
+        if (!GB_queue_remove (A)) GB_PANIC ;    // TODO in 4.0: delete
+        info = GB_convert_bitmap_to_sparse (A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_Pending_free (&Pending) ;
+            GB_FREE_ALL ;
+            return (info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // reattach A->Pending to A
+    //--------------------------------------------------------------------------
+
+    A->Pending = Pending ;
+    if (!GB_queue_insert (A)) GB_PANIC ;    // TODO in 4.0: delete
+    return (GrB_SUCCESS) ;
+}
@@ -22,6 +22,18 @@ int64_t GB_Pending_n        // return # of pending tuples in A
         { 
             n = A->Pending->n ;
         }
+        if (A->Pending_slots_used)
+        {
+            // add the tuples held in the slots, for concurrent insertion
+            for (int k = 0 ; k < GB_PENDING_NSLOTS ; k++)
+            {
+                GB_Pending Pending = A->Pending_slots [k].Pending ;
+                if (Pending != NULL)
+                { 
+                    n += Pending->n ;
+                }
+            }
+        }
     }
     return (n) ;
 }
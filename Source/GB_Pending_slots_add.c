@@ -0,0 +1,86 @@
+//------------------------------------------------------------------------------
+// GB_Pending_slots_add: add a pending tuple to one slot of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Appends the tuple (i,j,cwork) to one of the slots of C, where the scalar
+// cwork has already been typecast to C->type.  Any number of user threads may
+// call this function at the same time, on the same matrix C.  Each thread
+// always uses the slot selected by a hash of the address of its thread-local
+// storage, and waits if that slot is currently owned by another thread.  A
+// thread never moves on to another slot, so all the tuples added by a single
+// thread appear in a single slot, in the order the thread added them.  This
+// order is required, since the pending tuples are assembled with the implicit
+// SECOND operator, and the last value written to C(i,j) by that thread must
+// prevail (see GB_Pending_merge).  Since there are many more slots than threads
+// that insert at the same time, a thread rarely has to wait.
+
+// If out of memory, the tuple is not added but C is otherwise unchanged,
+// since other threads may still be appending to its slots.
+
+#include "GB_Pending.h"
+#include "GB_atomics.h"
+#include "GB_thread_local.h"
+
+GrB_Info GB_Pending_slots_add   // add a tuple to a slot of a matrix
+(
+    GrB_Matrix C,               // matrix that allows concurrent insertion
+    const GB_void *cwork,       // scalar to add, already typecast to C->type
+    const int64_t i,            // index into vector
+    const int64_t j             // vector index
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (C != NULL && C->Pending_slots != NULL) ;
+    ASSERT (cwork != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // acquire a slot
+    //--------------------------------------------------------------------------
+
+    uint64_t h = (uint64_t) GB_thread_local_get ( ) ;
+    h = (h ^ (h >> 29)) * ((uint64_t) 0x9E3779B97F4A7C15) ;
+    int k = (int) ((h >> 32) % GB_PENDING_NSLOTS) ;
+
+    GB_Pending_slots slots = C->Pending_slots ;
+    GB_Pending_slot_lock (slots, k) ;
+
+    //--------------------------------------------------------------------------
+    // append the tuple to the list of pending tuples in slot k
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    if (!GB_Pending_add (&(slots [k].Pending), cwork, C->type, NULL, i, j,
+        C->vdim > 1))
+    { 
+        info = GrB_OUT_OF_MEMORY ;
+    }
+    else
+    {
+        bool used ;
+        GB_ATOMIC_READ
+        used = C->Pending_slots_used ;
+        if (!used)
+        { 
+            // this is the first pending tuple in any slot of C
+            GB_ATOMIC_WRITE
+            C->Pending_slots_used = true ;
+            if (!GB_queue_insert (C)) info = GrB_PANIC ; // TODO in 4.0: delete
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // release the slot
+    //--------------------------------------------------------------------------
+
+    GB_Pending_slot_unlock (slots, k) ;
+    return (info) ;
+}
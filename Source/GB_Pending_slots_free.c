@@ -0,0 +1,26 @@
+//------------------------------------------------------------------------------
+// GB_Pending_slots_free: free the slots of a matrix, for concurrent insertion
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Any pending tuples left in the slots are discarded, and the matrix no longer
+// allows concurrent insertion.
+
+#include "GB_Pending.h"
+
+void GB_Pending_slots_free      // free all the slots of a matrix
+(
+    GrB_Matrix A
+)
+{
+
+    if (A != NULL)
+    { 
+        GB_Pending_slots_clear (A) ;
+        GB_FREE (A->Pending_slots) ;
+    }
+}
@@ -37,6 +37,8 @@ GxB_Scalar GB_Scalar_wrap   // create a new GxB_Scalar with one entry
     s->type = type ;
     s->type_size = type->size ;
     s->hyper_ratio = GB_HYPER_DEFAULT ;
+    s->sparsity = GxB_SPARSE ;
+    s->bitmap_switch = GB_BITMAP_SWITCH_DEFAULT ;
     s->plen = 1 ;
     s->vlen = 1 ;
     s->vdim = 1 ;
@@ -47,9 +49,14 @@ GxB_Scalar GB_Scalar_wrap   // create a new GxB_Scalar with one entry
     s->i = Si ; Si [0] = 0 ;
     s->x = Sx ;
     s->nzmax = 1 ;
+    s->b = NULL ;
+    s->nvals = 0 ;
     s->hfirst = 0 ;
     s->Pending = NULL ;
+    s->Pending_slots = NULL ;
+    s->Pending_slots_used = false ;
     s->nzombies = 0 ;
+    s->jumbled = false ;
     s->AxB_method_used = GxB_DEFAULT ;
     s->queue_next = NULL ;  // TODO in 4.0: delete
     s->queue_prev = NULL ;  // TODO in 4.0: delete
@@ -58,6 +65,8 @@ GxB_Scalar GB_Scalar_wrap   // create a new GxB_Scalar with one entry
     s->h_shallow = false ;
     s->i_shallow = true ;
     s->x_shallow = true ;
+    s->mmap_base = NULL ;
+    s->mmap_size = 0 ;
     s->is_hyper = false ;
     s->is_csc = true ;
     s->is_slice = false ;
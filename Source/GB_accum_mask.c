@@ -167,10 +167,14 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
     ASSERT_MATRIX_OK_OR_JUMBLED (T, "[T = results of computation]", GB0) ;
 
     //--------------------------------------------------------------------------
-    // remove zombies and pending tuples from T
+    // remove zombies and pending tuples from T, and sort it if needed
     //--------------------------------------------------------------------------
 
-    if (GB_PENDING_OR_ZOMBIES (T))
+    // If T is jumbled, it can be left that way only if neither M nor accum
+    // are present, since in that case C=T is done by GB_transplant.
+
+    if (GB_PENDING_OR_ZOMBIES (T)
+        || (GB_JUMBLED (T) && (M != NULL || accum != NULL)))
     { 
         // if this fails, *Thandle must be freed
         GB_OK (GB_Matrix_wait (T, Context)) ;
@@ -207,7 +211,7 @@ GrB_Info GB_accum_mask          // C<M> = accum (C,T)
         // transpose: typecast, no op, not in place
         if (MT_in == NULL)
         { 
-            if (GB_PENDING_OR_ZOMBIES (M))
+            if (GB_ANY_PENDING_WORK (M))
             {
                 // remove zombies and pending tuples from M
                 GB_OK (GB_Matrix_wait (M, Context)) ;
@@ -35,10 +35,11 @@
 
 #include "GB_add.h"
 
-#define GB_FREE_ALL ;
+//------------------------------------------------------------------------------
+// GB_add_phased: C=A+B or C<M>=A+B, where M, A, and B are sparse or hyper
+//------------------------------------------------------------------------------
 
-GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
-GrB_Info GB_add             // C=A+B or C<M>=A+B
+static GrB_Info GB_add_phased   // C=A+B or C<M>=A+B, via phase0 to phase2
 (
     GrB_Matrix *Chandle,    // output matrix (unallocated on input)
     const GrB_Type ctype,   // type of output matrix C
@@ -52,28 +53,10 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
 )
 {
 
-    //--------------------------------------------------------------------------
-    // check inputs
-    //--------------------------------------------------------------------------
-
+    ASSERT (!GB_IS_FULL (M) && !GB_IS_BITMAP (M)) ;
+    ASSERT (!GB_IS_FULL (A) && !GB_IS_BITMAP (A)) ;
+    ASSERT (!GB_IS_FULL (B) && !GB_IS_BITMAP (B)) ;
     GrB_Info info ;
-    GBBURBLE ((M == NULL) ? "add " : "masked_add ") ;
-
-    ASSERT (Chandle != NULL) ;
-    ASSERT_MATRIX_OK (A, "A for add", GB0) ;
-    ASSERT_MATRIX_OK (B, "B for add", GB0) ;
-    ASSERT_BINARYOP_OK_OR_NULL (op, "op for add", GB0) ;
-    ASSERT_MATRIX_OK_OR_NULL (M, "M for add", GB0) ;
-    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
-    if (M != NULL)
-    { 
-        ASSERT (A->vdim == M->vdim && A->vlen == M->vlen) ;
-    }
-
-    // delete any lingering zombies and assemble any pending tuples
-    GB_MATRIX_WAIT (M) ;
-    GB_MATRIX_WAIT (A) ;
-    GB_MATRIX_WAIT (B) ;
 
     //--------------------------------------------------------------------------
     // initializations
@@ -192,3 +175,77 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     return (GrB_SUCCESS) ;
 }
 
+//------------------------------------------------------------------------------
+// GB_add: C=A+B or C<M>=A+B
+//------------------------------------------------------------------------------
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_MATRIX_FREE (&M_sparse) ;    \
+    GB_MATRIX_FREE (&A_sparse) ;    \
+    GB_MATRIX_FREE (&B_sparse) ;    \
+}
+
+GB_PUBLIC   // accessed by the MATLAB tests in GraphBLAS/Test only
+GrB_Info GB_add             // C=A+B or C<M>=A+B
+(
+    GrB_Matrix *Chandle,    // output matrix (unallocated on input)
+    const GrB_Type ctype,   // type of output matrix C
+    const bool C_is_csc,    // format of output matrix C
+    const GrB_Matrix M_in,  // optional mask for C, unused if NULL
+    const bool Mask_struct, // if true, use the only structure of M
+    const GrB_Matrix A_in,  // input A matrix
+    const GrB_Matrix B_in,  // input B matrix
+    const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix M_sparse = NULL, A_sparse = NULL, B_sparse = NULL ;
+    GrB_Matrix M = M_in, A = A_in, B = B_in ;
+    GBBURBLE ((M == NULL) ? "add " : "masked_add ") ;
+
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for add", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for add", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (op, "op for add", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for add", GB0) ;
+    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
+    if (M != NULL)
+    { 
+        ASSERT (A->vdim == M->vdim && A->vlen == M->vlen) ;
+    }
+
+    // delete any lingering zombies and assemble any pending tuples
+    GB_MATRIX_WAIT (M) ;
+    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT (B) ;
+
+    //--------------------------------------------------------------------------
+    // C = A+B where A and B are both full
+    //--------------------------------------------------------------------------
+
+    if (M == NULL && op != NULL && GB_IS_FULL (A) && GB_IS_FULL (B))
+    { 
+        return (GB_ewise_full (Chandle, ctype, C_is_csc, A, B, op, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A+B or C<M>=A+B via the phased method
+    //--------------------------------------------------------------------------
+
+    // The phased method requires the pattern of each matrix.  Any full or
+    // bitmap matrix is replaced with a temporary sparse copy.
+    GB_SPARSE_INPUT (M, M_sparse) ;
+    GB_SPARSE_INPUT (A, A_sparse) ;
+    GB_SPARSE_INPUT (B, B_sparse) ;
+    info = GB_add_phased (Chandle, ctype, C_is_csc, M, Mask_struct, A, B, op,
+        Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
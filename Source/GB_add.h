@@ -25,6 +25,29 @@ GrB_Info GB_add             // C=A+B or C<M>=A+B
     GB_Context Context
 ) ;
 
+GrB_Info GB_ewise_full      // C = op (A,B) where A and B are full
+(
+    GrB_Matrix *Chandle,    // output matrix (unallocated on input)
+    const GrB_Type ctype,   // type of output matrix C
+    const bool C_is_csc,    // format of output matrix C
+    const GrB_Matrix A,     // input A matrix, full
+    const GrB_Matrix B,     // input B matrix, full
+    const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    GB_Context Context
+) ;
+
+GrB_Info GB_add_sparse_dense    // C<S>=A+B, where S is A or B
+(
+    GrB_Matrix *Chandle,    // output matrix (unallocated on input)
+    const GrB_Type ctype,   // type of output matrix C
+    const GrB_Matrix A,     // input A matrix
+    const GrB_Matrix B,     // input B matrix
+    const bool A_is_sparse, // if true, A is sparse and B is dense; else
+                            // A is dense and B is sparse
+    const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    GB_Context Context
+) ;
+
 GrB_Info GB_add_phase0          // find vectors in C for C=A+B or C<M>=A+B
 (
     int64_t *p_Cnvec,           // # of vectors to compute in C
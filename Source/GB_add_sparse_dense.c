@@ -0,0 +1,206 @@
+//------------------------------------------------------------------------------
+// GB_add_sparse_dense: C<S>=A+B where S is A or B, and the other is dense
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C<A,struct> = A+B where A is sparse and B is dense, or C<B,struct> = A+B
+// where A is dense and B is sparse.  The mask is the sparse matrix itself, so
+// the pattern of C is identical to the pattern of the sparse matrix S.  The
+// pattern of S is copied into C, and then C(i,j) = op (A(i,j), B(i,j)) is
+// computed for each entry in S.  The work is O(nnz(S)), with no symbolic
+// analysis of the mask or the dense matrix, as required by the relaxation
+// step of SSSP: C<A> = A+B where B is the dense vector of distances.
+
+// C is sparse or hypersparse, the same as S.  The dense matrix D may be full,
+// or sparse or hypersparse with all of its entries present.  In either case,
+// the entry D(i,j) is located at position i + j*vlen.  The built-in operators
+// without typecasting use the hard-coded workers in Generated/GB_binop__*; all
+// other cases use the generic worker with typecasting and an arbitrary
+// operator.
+
+#include "GB_add.h"
+#include "GB_binop.h"
+#include "GB_ek_slice.h"
+#ifndef GBCOMPACT
+#include "GB_binop__include.h"
+#endif
+
+#define GB_FREE_WORK \
+    GB_ek_slice_free (&pstart_slice, &kfirst_slice, &klast_slice) ;
+
+GrB_Info GB_add_sparse_dense    // C<S>=A+B, where S is A or B
+(
+    GrB_Matrix *Chandle,    // output matrix (unallocated on input)
+    const GrB_Type ctype,   // type of output matrix C
+    const GrB_Matrix A,     // input A matrix
+    const GrB_Matrix B,     // input B matrix
+    const bool A_is_sparse, // if true, A is sparse and B is dense; else
+                            // A is dense and B is sparse
+    const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for add sparse dense", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for add sparse dense", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for add sparse dense", GB0) ;
+    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
+    ASSERT (A->is_csc == B->is_csc) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (B)) ; ASSERT (!GB_ZOMBIES (B)) ;
+
+    GrB_Matrix S = A_is_sparse ? A : B ;
+    ASSERT (!GB_IS_FULL (S) && !GB_IS_BITMAP (S)) ;
+    ASSERT (GB_is_dense (A_is_sparse ? B : A)) ;
+
+    GBBURBLE ("(sparse+dense) ") ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int64_t snz   = GB_NNZ (S) ;
+    int64_t snvec = S->nvec ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (snz + snvec, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, snz) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // slice the entries for each task
+    //--------------------------------------------------------------------------
+
+    // Task tid does entries pstart_slice [tid] to pstart_slice [tid+1]-1 and
+    // vectors kfirst_slice [tid] to klast_slice [tid].  The first and last
+    // vectors may be shared with prior slices and subsequent slices.
+
+    int64_t *pstart_slice = NULL, *kfirst_slice = NULL, *klast_slice = NULL ;
+    if (!GB_ek_slice (&pstart_slice, &kfirst_slice, &klast_slice, S, ntasks))
+    {
+        // out of memory
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the pattern of S into C
+    //--------------------------------------------------------------------------
+
+    // allocate but do not initialize C->x
+    (*Chandle) = NULL ;
+    info = GB_dup (Chandle, S, false, ctype, Context) ;
+    if (info != GrB_SUCCESS)
+    {
+        // out of memory
+        GB_FREE_WORK ;
+        return (info) ;
+    }
+
+    GrB_Matrix C = (*Chandle) ;
+
+    //--------------------------------------------------------------------------
+    // C<S> = A+B, via built-in binary operators
+    //--------------------------------------------------------------------------
+
+    bool done = false ;
+
+    #ifndef GBCOMPACT
+
+        //----------------------------------------------------------------------
+        // define the worker for the switch factory
+        //----------------------------------------------------------------------
+
+        #define GB_AaddB_sparse_dense(mult,xname) \
+            GB_AaddB_sparse_dense_ ## mult ## xname
+
+        #define GB_BINOP_WORKER(mult,xname)                                  \
+        {                                                                    \
+            info = GB_AaddB_sparse_dense(mult,xname) (C, A, B, A_is_sparse,  \
+                kfirst_slice, klast_slice, pstart_slice, ntasks, nthreads) ; \
+            done = (info != GrB_NO_VALUE) ;                                  \
+        }                                                                    \
+        break ;
+
+        //----------------------------------------------------------------------
+        // launch the switch factory
+        //----------------------------------------------------------------------
+
+        GB_Opcode opcode ;
+        GB_Type_code xcode, ycode, zcode ;
+
+        if (ctype == op->ztype && GB_binop_builtin (A->type, false, B->type,
+            false, op, false, &opcode, &xcode, &ycode, &zcode))
+        {
+            #include "GB_binop_factory.c"
+        }
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // generic worker: with typecasting and arbitrary operators
+    //--------------------------------------------------------------------------
+
+    if (!done)
+    {
+        GB_BURBLE_MATRIX (C, "generic ") ;
+
+        GxB_binary_function fadd = op->function ;
+        const size_t asize = A->type->size ;
+        const size_t bsize = B->type->size ;
+        const size_t csize = ctype->size ;
+        const size_t xsize = op->xtype->size ;
+        const size_t ysize = op->ytype->size ;
+        const size_t zsize = op->ztype->size ;
+        GB_cast_function cast_A_to_X, cast_B_to_Y, cast_Z_to_C ;
+        cast_A_to_X = GB_cast_factory (op->xtype->code, A->type->code) ;
+        cast_B_to_Y = GB_cast_factory (op->ytype->code, B->type->code) ;
+        cast_Z_to_C = GB_cast_factory (ctype->code,     op->ztype->code) ;
+
+        // aij = (xtype) A(i,j), located in Ax [pA]
+        #define GB_GETA(aij,Ax,pA)                                          \
+            GB_void aij [GB_VLA(xsize)] ;                                   \
+            cast_A_to_X (aij, Ax +((pA)*asize), asize) ;
+
+        // bij = (ytype) B(i,j), located in Bx [pB]
+        #define GB_GETB(bij,Bx,pB)                                          \
+            GB_void bij [GB_VLA(ysize)] ;                                   \
+            cast_B_to_Y (bij, Bx +((pB)*bsize), bsize) ;
+
+        // C(i,j) = (ctype) (A(i,j) + B(i,j))
+        #define GB_BINOP(cij, aij, bij)                                     \
+            GB_void z [GB_VLA(zsize)] ;                                     \
+            fadd (z, aij, bij) ;                                            \
+            cast_Z_to_C (cij, z, csize) ;
+
+        // address of Cx [p]
+        #define GB_CX(p) Cx +((p)*csize)
+
+        #define GB_ATYPE GB_void
+        #define GB_BTYPE GB_void
+        #define GB_CTYPE GB_void
+
+        // no vectorization
+        #define GB_PRAGMA_SIMD_VECTORIZE ;
+
+        #include "GB_add_sparse_dense_template.c"
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    ASSERT_MATRIX_OK (C, "C output for add sparse dense", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -15,7 +15,7 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_MATRIX_FREE (&A_sparse) ;
 
 GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
 (
@@ -29,7 +29,7 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         const GrB_BinaryOp op2_in,      // binary operator to apply
         const GxB_Scalar scalar,        // scalar to bind to binary operator
         bool binop_bind1st,             // if true, binop(x,A) else binop(A,y)
-    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix A_in,          // first input:  matrix A
     bool A_transpose,               // A matrix descriptor
     GB_Context Context
 )
@@ -41,6 +41,8 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
 
     // C may be aliased with M and/or A
 
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
     GB_RETURN_IF_FAULTY (accum) ;
     ASSERT_MATRIX_OK (C, "C input for GB_apply", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_apply", GB0) ;
@@ -157,9 +159,10 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp) ;
 
-    // delete any lingering zombies and assemble any pending tuples
+    // delete any lingering zombies and assemble any pending tuples.  A can
+    // be left jumbled, since op(A) does not depend on the order of entries.
     GB_MATRIX_WAIT (M) ;
-    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
     GB_SCALAR_WAIT (scalar) ;
 
     if (op2 != NULL && GB_NNZ (scalar) != 1)
@@ -286,6 +289,8 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         // of the output of the operator with the matrix C.  Always succeeds.
         // No work to do if the op is identity.
         // FUTURE::: also handle C += op(C), with accum.
+        // A is C itself, the output, so a bitmap C is converted in place.
+        GB_ENSURE_SPARSE_OR_FULL (C) ;
         if (opcode != GB_IDENTITY_opcode)
         { 
             GB_void *Cx = (GB_void *) C->x ;
@@ -298,7 +303,10 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     else
     { 
         // T = op (A), pattern is a shallow copy of A, type is op*->ztype.
+        // T cannot share the bitmap of A, so a bitmap A is replaced with
+        // a temporary sparse copy.
         GBBURBLE ("(shallow-op) ") ;
+        GB_SPARSE_OR_FULL_INPUT (A, A_sparse) ;
         info = GB_shallow_op (&T, C_is_csc,
             op1, op2, scalar, binop_bind1st,
             A, Context) ;
@@ -307,6 +315,7 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     if (info != GrB_SUCCESS)
     { 
         GB_MATRIX_FREE (&T) ;
+        GB_FREE_ALL ;
         return (info) ;
     }
 
@@ -316,7 +325,9 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
     // C<M> = accum (C,T): accumulate the results into C via the M
     //--------------------------------------------------------------------------
 
-    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
-        Mask_struct, Context)) ;
+    info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
 }
 
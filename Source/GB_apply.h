@@ -23,7 +23,7 @@ GrB_Info GB_apply                   // C<M> = accum (C, op(A)) or op(A')
         const GrB_BinaryOp op2,         // binary operator to apply
         const GxB_Scalar scalar,        // scalar to bind to binary operator
         bool binop_bind1st,             // if true, binop(x,A) else binop(A,y)
-    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix A_in,          // first input:  matrix A
     bool A_transpose,               // A matrix descriptor
     GB_Context Context
 ) ;
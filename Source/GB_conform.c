@@ -0,0 +1,126 @@
+//------------------------------------------------------------------------------
+// GB_conform: conform a matrix to its desired sparsity structure
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A->sparsity controls which formats A may take on.  A is converted to full
+// if it has all of its entries present (and no zombies or pending tuples),
+// and if A->sparsity includes GxB_FULL.  Otherwise, if A->sparsity includes
+// GxB_BITMAP, A is converted to bitmap if GxB_SPARSE is not permitted, or if
+// its number of entries is large enough, as determined by A->bitmap_switch.
+// Otherwise, A is held as sparse, and its hypersparsity is conformed with
+// GB_to_hyper_conform.
+
+// If the method fails, all content of A is freed.
+
+#include "GB.h"
+
+#define GB_FREE_ALL GB_PHIX_FREE (A) ;
+
+GrB_Info GB_conform             // conform a matrix to its desired sparsity
+(
+    GrB_Matrix A,               // matrix to conform
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK_OR_JUMBLED (A, "A to conform", GB0) ;
+    ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    GrB_Info info ;
+    bool sparse_ok = (A->sparsity & GxB_SPARSE) != 0 ;
+    bool bitmap_ok = (A->sparsity & GxB_BITMAP) != 0 ;
+    bool full_ok   = (A->sparsity & GxB_FULL  ) != 0 ;
+
+    //--------------------------------------------------------------------------
+    // determine the desired format
+    //--------------------------------------------------------------------------
+
+    bool is_full   = GB_IS_FULL (A) ;
+    bool is_bitmap = GB_IS_BITMAP (A) ;
+    bool is_sparse = !(is_full || is_bitmap) ;
+
+    GrB_Index anzmax ;
+    bool ok = GB_Index_multiply (&anzmax, A->vlen, A->vdim) ;
+    bool can_be_dense = ok && anzmax > 0 && !A->is_slice
+        && !GB_ZOMBIES (A) && !GB_PENDING (A) ;
+    int64_t anz = GB_NNZ (A) ;
+
+    bool to_full = false, to_bitmap = false ;
+    if (can_be_dense)
+    {
+        if (full_ok && anz == (int64_t) anzmax && !A->jumbled)
+        { 
+            // all entries are present.  A jumbled matrix is left sparse,
+            // since the values of a full matrix must be in order.
+            to_full = true ;
+        }
+        else if (bitmap_ok)
+        { 
+            // the switch to sparse has hysteresis, like the hyper_ratio
+            double bswitch = A->bitmap_switch * ((double) anzmax) ;
+            to_bitmap = !sparse_ok
+                || (is_bitmap && ((double) anz) >= bswitch / 2)
+                || (is_sparse && ((double) anz) >= bswitch) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // conform the matrix
+    //--------------------------------------------------------------------------
+
+    if (to_full)
+    {
+        if (is_bitmap)
+        { 
+            // free the bitmap
+            GB_OK (GB_convert_bitmap_to_full (A, Context)) ;
+        }
+        else if (is_sparse)
+        { 
+            // remove the pattern
+            GB_OK (GB_convert_sparse_to_full (A, Context)) ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+    else if (to_bitmap)
+    {
+        if (is_full)
+        { 
+            // add a bitmap with all entries present
+            GB_OK (GB_convert_full_to_bitmap (A, Context)) ;
+        }
+        else if (is_sparse)
+        {
+            // scatter the entries into a bitmap; if out of memory, A is
+            // left as-is, and is conformed to its hypersparsity instead
+            info = GB_convert_sparse_to_bitmap (A, Context) ;
+            if (info != GrB_SUCCESS)
+            { 
+                return (GB_to_hyper_conform (A, Context)) ;
+            }
+        }
+        return (GrB_SUCCESS) ;
+    }
+    else if (is_full)
+    { 
+        // convert from full to sparse, then conform its hypersparsity
+        GB_OK (GB_convert_full_to_sparse (A, Context)) ;
+    }
+    else if (is_bitmap)
+    { 
+        // convert from bitmap to sparse, then conform its hypersparsity
+        GB_OK (GB_convert_bitmap_to_sparse (A, Context)) ;
+    }
+
+    return (GB_to_hyper_conform (A, Context)) ;
+}
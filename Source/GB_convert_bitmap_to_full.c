@@ -0,0 +1,48 @@
+//------------------------------------------------------------------------------
+// GB_convert_bitmap_to_full: convert a matrix from bitmap to full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The bitmap matrix A must have all of its entries present.  Its values are
+// already in the right place for the full format, so A->b is simply freed.
+
+// This function takes O(1) time and cannot fail.
+
+#include "GB.h"
+
+GrB_Info GB_convert_bitmap_to_full      // convert matrix from bitmap to full
+(
+    GrB_Matrix A,               // matrix to convert from bitmap to full
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converting bitmap to full", GB0) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+    ASSERT (A->nvals == A->vlen * A->vdim) ;
+    GBBURBLE ("(bitmap to full) ") ;
+
+    //--------------------------------------------------------------------------
+    // free the bitmap
+    //--------------------------------------------------------------------------
+
+    GB_FREE (A->b) ;
+    A->nvals = 0 ;
+    A->nvec_nonempty = A->vdim ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted from bitmap to full", GB0) ;
+    ASSERT (GB_IS_FULL (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,90 @@
+//------------------------------------------------------------------------------
+// GB_convert_bitmap_to_sparse: convert a matrix from bitmap to sparse
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The bitmap matrix A is converted to the standard sparse format (not
+// hypersparse; the caller can use GB_to_hyper_conform afterwards, if needed).
+// The entries are gathered by GB_convert_bitmap_worker.  If the matrix is not
+// bitmap on input, it is not modified.
+
+// If an out-of-memory condition occurs, A is not modified.
+
+#include "GB_Pending.h"
+
+GrB_Info GB_convert_bitmap_to_sparse    // convert matrix from bitmap to sparse
+(
+    GrB_Matrix A,               // matrix to convert from bitmap to sparse
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converting bitmap to sparse", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    if (!GB_IS_BITMAP (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    if (A->Pending_slots_used)
+    { 
+        // A has pending tuples from a concurrent GrB_setElement.  They are
+        // moved to A->Pending by GB_Pending_merge, which also converts A to
+        // sparse.
+        return (GB_Pending_merge (A, Context)) ;
+    }
+
+    ASSERT (!GB_PENDING (A)) ;
+
+    GBBURBLE ("(bitmap to sparse) ") ;
+
+    //--------------------------------------------------------------------------
+    // gather the entries of A
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Ap = NULL ;
+    int64_t *GB_RESTRICT Ai = NULL ;
+    GB_void *GB_RESTRICT Ax_new = NULL ;
+    GrB_Info info = GB_convert_bitmap_worker (&Ap, &Ai, &Ax_new, A, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory; A is not modified
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // free the bitmap content of A and transplant in the sparse content
+    //--------------------------------------------------------------------------
+
+    const int64_t anz = A->nvals ;
+    const int64_t avdim = A->vdim ;
+    GB_PHIX_FREE (A) ;
+
+    A->p = Ap ;
+    A->i = Ai ;
+    A->x = Ax_new ;
+    A->nzmax = GB_IMAX (anz, 1) ;
+    A->is_hyper = false ;
+    A->plen = avdim ;
+    A->nvec = avdim ;
+    A->magic = GB_MAGIC ;
+    A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted from bitmap to sparse", GB0) ;
+    ASSERT (!GB_IS_BITMAP (A)) ;
+    return (GrB_SUCCESS) ;
+}
@@ -0,0 +1,161 @@
+//------------------------------------------------------------------------------
+// GB_convert_bitmap_worker: extract the sparse content of a bitmap matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The entries of the bitmap matrix A are gathered into new arrays Ap, Ai, and
+// Ax, in the standard sparse (not hypersparse) format.  A is not modified.
+// This is the common kernel of GB_convert_bitmap_to_sparse, which transplants
+// the result back into A, and GB_sparse_copy, which places it in a new
+// temporary matrix.
+
+// The entries are gathered from A->b and A->x in two passes over the bitmap.
+// Each task operates on a contiguous range of the bitmap, which need not start
+// or end at a vector boundary, so the work is balanced even if A has very few
+// (or just one) long vectors.
+
+// If an out-of-memory condition occurs, no new arrays are returned.
+
+#include "GB.h"
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_FREE (W) ;           \
+    GB_FREE (Ap) ;          \
+    GB_FREE (Ai) ;          \
+    GB_FREE (Ax_new) ;      \
+}
+
+GrB_Info GB_convert_bitmap_worker   // extract the sparse content of a bitmap
+(
+    int64_t **Ap_handle,            // output: vector pointers, size avdim+1
+    int64_t **Ai_handle,            // output: indices, size max (anz,1)
+    GB_void **Ax_handle,            // output: values, size max (anz,1)
+    const GrB_Matrix A,             // bitmap matrix, not modified
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Ap_handle != NULL && Ai_handle != NULL && Ax_handle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for bitmap worker", GB0) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    (*Ap_handle) = NULL ;
+    (*Ai_handle) = NULL ;
+    (*Ax_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int8_t  *GB_RESTRICT Ab = A->b ;
+    const GB_void *GB_RESTRICT Ax = A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+    const int64_t anz = A->nvals ;
+    const int64_t anzmax = avlen * avdim ;
+    const size_t asize = A->type->size ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anzmax, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, anzmax) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the new content and workspace
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT W  = GB_MALLOC (ntasks+1, int64_t) ;
+    int64_t *GB_RESTRICT Ap = GB_MALLOC (avdim+1, int64_t) ;
+    int64_t *GB_RESTRICT Ai = GB_MALLOC (GB_IMAX (anz, 1), int64_t) ;
+    GB_void *GB_RESTRICT Ax_new = GB_MALLOC (GB_IMAX (anz, 1) * asize,
+        GB_void) ;
+    if (W == NULL || Ap == NULL || Ai == NULL || Ax_new == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // count the entries in each task's range of the bitmap
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t pstart, pend, task_nvals = 0 ;
+        GB_PARTITION (pstart, pend, anzmax, tid, ntasks) ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            task_nvals += Ab [p] ;
+        }
+        W [tid] = task_nvals ;
+    }
+
+    GB_cumsum (W, ntasks, NULL, 1) ;
+    ASSERT (W [ntasks] == anz) ;
+
+    //--------------------------------------------------------------------------
+    // gather the entries and construct the vector pointers
+    //--------------------------------------------------------------------------
+
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t pstart, pend, pnew = W [tid] ;
+        GB_PARTITION (pstart, pend, anzmax, tid, ntasks) ;
+        int64_t i = pstart % avlen ;
+        int64_t j = pstart / avlen ;
+        for (int64_t p = pstart ; p < pend ; p++)
+        {
+            // A(i,j) is held in position p = i + j*avlen
+            if (i == 0)
+            {
+                // this task owns the start of A(:,j)
+                Ap [j] = pnew ;
+            }
+            if (Ab [p])
+            {
+                Ai [pnew] = i ;
+                memcpy (Ax_new + pnew * asize, Ax + p * asize, asize) ;
+                pnew++ ;
+            }
+            if (++i == avlen)
+            {
+                i = 0 ;
+                j++ ;
+            }
+        }
+    }
+    if (avlen == 0)
+    { 
+        // A has no entries, and no task owns the start of any vector
+        memset (Ap, 0, avdim * sizeof (int64_t)) ;
+    }
+    Ap [avdim] = anz ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE (W) ;
+    (*Ap_handle) = Ap ;
+    (*Ai_handle) = Ai ;
+    (*Ax_handle) = Ax_new ;
+    return (GrB_SUCCESS) ;
+}
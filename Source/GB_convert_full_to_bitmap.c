@@ -0,0 +1,68 @@
+//------------------------------------------------------------------------------
+// GB_convert_full_to_bitmap: convert a matrix from full to bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The full matrix A is given a bitmap A->b with all entries present.  A->x is
+// not modified.  If the matrix is not full on input, it is not modified.
+
+// If an out-of-memory condition occurs, A is not modified.
+
+#include "GB.h"
+
+GrB_Info GB_convert_full_to_bitmap      // convert matrix from full to bitmap
+(
+    GrB_Matrix A,               // matrix to convert from full to bitmap
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converting full to bitmap", GB0) ;
+
+    if (!GB_IS_FULL (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBBURBLE ("(full to bitmap) ") ;
+
+    //--------------------------------------------------------------------------
+    // allocate A->b and set all entries as present
+    //--------------------------------------------------------------------------
+
+    int64_t anz = A->vlen * A->vdim ;
+    int8_t *GB_RESTRICT Ab = GB_MALLOC (A->nzmax, int8_t) ;
+    if (Ab == NULL)
+    { 
+        // out of memory
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    { 
+        Ab [p] = 1 ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    A->b = Ab ;
+    A->nvals = anz ;
+    ASSERT_MATRIX_OK (A, "A converted from full to bitmap", GB0) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+    return (GrB_SUCCESS) ;
+}
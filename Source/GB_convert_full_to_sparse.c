@@ -0,0 +1,104 @@
+//------------------------------------------------------------------------------
+// GB_convert_full_to_sparse: convert a matrix from full to sparse
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The full matrix A is given an explicit pattern: A->p [k] = k*avlen and
+// A->i [p] = p % avlen.  The values A->x are not modified, and remain shallow
+// if A->x is shallow on input.  A is returned as a standard (non-hypersparse)
+// sparse matrix, with all entries present.  If the matrix is not full on
+// input, it is not modified.
+
+// If an out-of-memory condition occurs, all content of the matrix is cleared.
+
+#include "GB.h"
+
+GrB_Info GB_convert_full_to_sparse      // convert matrix from full to sparse
+(
+    GrB_Matrix A,               // matrix to convert from full to sparse
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converting full to sparse", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+
+    if (!GB_IS_FULL (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBBURBLE ("(full to sparse) ") ;
+
+    int64_t avdim = A->vdim ;
+    int64_t avlen = A->vlen ;
+    int64_t anz = avdim * avlen ;
+
+    //--------------------------------------------------------------------------
+    // allocate A->p and A->i
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Ap = GB_MALLOC (avdim+1, int64_t) ;
+    int64_t *GB_RESTRICT Ai = GB_MALLOC (A->nzmax, int64_t) ;
+    if (Ap == NULL || Ai == NULL)
+    {
+        // out of memory
+        GB_FREE (Ap) ;
+        GB_FREE (Ai) ;
+        GB_PHIX_FREE (A) ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // create the pattern of A
+    //--------------------------------------------------------------------------
+
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (k = 0 ; k <= avdim ; k++)
+    {
+        Ap [k] = k * avlen ;
+    }
+
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < anz ; p++)
+    {
+        Ai [p] = p % avlen ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    A->p = Ap ;
+    A->i = Ai ;
+    A->p_shallow = false ;
+    A->i_shallow = false ;
+    A->is_hyper = false ;
+    A->plen = avdim ;
+    A->nvec = avdim ;
+    A->nvec_nonempty = (avlen == 0) ? 0 : avdim ;
+
+    ASSERT_MATRIX_OK (A, "A converted from full to sparse", GB0) ;
+    ASSERT (!GB_IS_FULL (A)) ;
+    return (GrB_SUCCESS) ;
+}
+
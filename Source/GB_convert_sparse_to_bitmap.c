@@ -0,0 +1,145 @@
+//------------------------------------------------------------------------------
+// GB_convert_sparse_to_bitmap: convert a matrix from sparse to bitmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The sparse or hypersparse matrix A is converted to bitmap format.  A must
+// have no zombies or pending tuples.  A->b and a new A->x, both of size
+// A->vlen*A->vdim, are allocated and the entries of A are scattered into them.
+// A->p, A->h, A->i, and the old A->x are freed, unless they are shallow.
+
+// If an out-of-memory condition occurs, A is not modified.
+
+#include "GB_ek_slice.h"
+
+#define GB_FREE_WORK \
+    GB_ek_slice_free (&pstart_slice, &kfirst_slice, &klast_slice) ;
+
+#define GB_FREE_ALL         \
+{                           \
+    GB_FREE_WORK ;          \
+    GB_FREE (Ab) ;          \
+    GB_FREE (Ax_new) ;      \
+}
+
+GrB_Info GB_convert_sparse_to_bitmap    // convert sparse/hypersparse to bitmap
+(
+    GrB_Matrix A,               // matrix to convert from sparse to bitmap
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converting sparse to bitmap", GB0) ;
+    ASSERT (!GB_IS_FULL (A)) ;
+    ASSERT (!GB_IS_BITMAP (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!A->is_slice) ;
+    GBBURBLE ("(sparse to bitmap) ") ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const GB_void *GB_RESTRICT Ax = A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+    const int64_t anz = GB_NNZ (A) ;
+    const size_t asize = A->type->size ;
+
+    GrB_Index anzmax ;
+    if (!GB_Index_multiply (&anzmax, avlen, avdim) || anzmax == 0)
+    {
+        // the bitmap would be too large, or empty
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads and tasks to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anzmax, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (8 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, anz) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the bitmap and the new values
+    //--------------------------------------------------------------------------
+
+    int64_t *pstart_slice = NULL, *kfirst_slice = NULL, *klast_slice = NULL ;
+    int8_t  *GB_RESTRICT Ab = GB_CALLOC (anzmax, int8_t) ;
+    GB_void *GB_RESTRICT Ax_new = GB_MALLOC (anzmax * asize, GB_void) ;
+    if (Ab == NULL || Ax_new == NULL ||
+        !GB_ek_slice (&pstart_slice, &kfirst_slice, &klast_slice, A, ntasks))
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // scatter the entries of A into the bitmap
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        int64_t kfirst = kfirst_slice [tid] ;
+        int64_t klast  = klast_slice  [tid] ;
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+            int64_t j = (Ah == NULL) ? k : Ah [k] ;
+            int64_t pA_start, pA_end ;
+            GB_get_pA_and_pC (&pA_start, &pA_end, NULL,
+                tid, k, kfirst, klast, pstart_slice, NULL, NULL, Ap) ;
+            int64_t pj = j * avlen ;
+            for (int64_t p = pA_start ; p < pA_end ; p++)
+            {
+                // A(i,j) is moved to position i + j*avlen
+                int64_t pnew = Ai [p] + pj ;
+                Ab [pnew] = 1 ;
+                memcpy (Ax_new + pnew * asize, Ax + p * asize, asize) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free the old content of A and transplant in the bitmap
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    int64_t nvec_nonempty = A->nvec_nonempty ;
+    GB_PHIX_FREE (A) ;
+
+    A->b = Ab ;
+    A->x = Ax_new ;
+    A->nzmax = anzmax ;
+    A->nvals = anz ;
+    A->is_hyper = false ;
+    A->plen = avdim ;
+    A->nvec = avdim ;
+    A->nvec_nonempty = nvec_nonempty ;
+    A->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted from sparse to bitmap", GB0) ;
+    ASSERT (GB_IS_BITMAP (A)) ;
+    return (GrB_SUCCESS) ;
+}
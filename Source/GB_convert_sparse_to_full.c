@@ -0,0 +1,75 @@
+//------------------------------------------------------------------------------
+// GB_convert_sparse_to_full: convert a matrix from sparse to full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The matrix A must have all of its entries present, with no zombies or
+// pending tuples.  Its values are already in the right order for the full
+// format, since the vectors are held in order and the indices in each vector
+// are sorted, so A->p, A->h, and A->i are simply removed.  If they are shallow
+// they are not freed.  A->x is not modified and remains shallow if it is
+// shallow on input.
+
+// This function takes O(1) time and cannot fail.
+
+#include "GB.h"
+
+GrB_Info GB_convert_sparse_to_full      // convert matrix from sparse to full
+(
+    GrB_Matrix A,               // matrix to convert from sparse to full
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converting sparse to full", GB0) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (GB_is_dense (A)) ;
+    ASSERT (GB_NNZ (A) > 0) ;
+    ASSERT (!A->is_slice) ;
+
+    if (GB_IS_FULL (A))
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    GBBURBLE ("(sparse to full) ") ;
+
+    //--------------------------------------------------------------------------
+    // remove the pattern of A
+    //--------------------------------------------------------------------------
+
+    int64_t avdim = A->vdim ;
+    if (!A->p_shallow) GB_FREE (A->p) ;
+    if (!A->h_shallow) GB_FREE (A->h) ;
+    if (!A->i_shallow) GB_FREE (A->i) ;
+    A->p = NULL ;
+    A->h = NULL ;
+    A->i = NULL ;
+    A->p_shallow = false ;
+    A->h_shallow = false ;
+    A->i_shallow = false ;
+
+    A->is_hyper = false ;
+    A->plen = avdim ;
+    A->nvec = avdim ;
+    A->nvec_nonempty = avdim ;
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (A, "A converted from sparse to full", GB0) ;
+    ASSERT (GB_IS_FULL (A)) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,94 @@
+//------------------------------------------------------------------------------
+// GB_create_full: create a full matrix and allocate space for its values
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Creates a full matrix (with GB_new), and allocates space for A->x, of size
+// vlen*vdim.  A->p, A->h, and A->i are NULL.  The values A->x are not
+// initialized; the caller must do so.  The matrix must have at least one
+// entry.
+
+// Ahandle must be non-NULL on input.  If *Ahandle is NULL on input, a new
+// header is allocated, and freed if an out-of-memory condition occurs.  If
+// *Ahandle is not NULL on input, the existing header is used, and it is not
+// freed if an out-of-memory condition occurs (see GB_create).
+
+#include "GB.h"
+
+GrB_Info GB_create_full         // create a full matrix, with only A->x
+(
+    GrB_Matrix *Ahandle,        // output matrix to create
+    const GrB_Type type,        // type of output matrix
+    const int64_t vlen,         // length of each vector
+    const int64_t vdim,         // number of vectors
+    const bool is_csc,          // true if CSC, false if CSR
+    const double hyper_ratio,   // A->hyper_ratio
+    const int sparsity,         // A->sparsity
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Ahandle != NULL) ;
+    ASSERT (vlen > 0 && vdim > 0) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the header
+    //--------------------------------------------------------------------------
+
+    bool preexisting_header = (*Ahandle != NULL) ;
+    GrB_Info info = GB_new (Ahandle, type, vlen, vdim, GB_Ap_null, is_csc,
+        GB_FORCE_NONHYPER, hyper_ratio, vdim, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        ASSERT (preexisting_header == (*Ahandle != NULL)) ;
+        return (info) ;
+    }
+
+    GrB_Matrix A = (*Ahandle) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the values
+    //--------------------------------------------------------------------------
+
+    GrB_Index anz ;
+    if (!GB_Index_multiply (&anz, vlen, vdim) || anz > GxB_INDEX_MAX)
+    { 
+        // problem too large
+        A->x = NULL ;
+    }
+    else
+    { 
+        A->x = GB_MALLOC (anz * type->size, GB_void) ;
+    }
+
+    if (A->x == NULL)
+    {
+        // out of memory
+        GB_PHIX_FREE (A) ;
+        if (!preexisting_header)
+        { 
+            GB_MATRIX_FREE (Ahandle) ;
+            ASSERT (*Ahandle == NULL) ;
+        }
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    A->nzmax = anz ;
+    A->nvec_nonempty = vdim ;
+    A->sparsity = sparsity ;
+    A->magic = GB_MAGIC ;
+    return (GrB_SUCCESS) ;
+}
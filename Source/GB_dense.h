@@ -40,19 +40,23 @@ GrB_Info GB_dense_ewise3_noaccum    // C = A+B, where A and B are dense
 ) ;
 
 //------------------------------------------------------------------------------
-// GB_dense_subassign_23: C(:,:) += A where C is dense and A is sparse or dense
+// GB_dense_subassign_23: C(:,:) += A or A' where C is dense, A sparse or dense
 //------------------------------------------------------------------------------
 
-GrB_Info GB_dense_subassign_23      // C += A; C is dense, A is sparse or dense
+GrB_Info GB_dense_subassign_23      // C += A or A'; C is dense
 (
     GrB_Matrix C,                   // input/output matrix
     const GrB_Matrix A,             // input matrix
+    const bool A_transpose,         // if true, C += A', else C += A
     const GrB_BinaryOp accum,       // operator to apply
     GB_Context Context
 ) ;
 
+// tile size for C += A' when both C and A are dense
+#define GB_DENSE_TRAN_TILE 64
+
 //------------------------------------------------------------------------------
-// GB_dense_subassign_22: C(:,:) += scalar where C is dense
+// GB_dense_subassign_22: C(:,:) += scalar where C is dense, or C<C,s> += scalar
 //------------------------------------------------------------------------------
 
 GrB_Info GB_dense_subassign_22      // C += x where C is dense and x is a scalar
@@ -116,7 +120,7 @@ GrB_Info GB_dense_subassign_24   // C = A, copy A into an existing matrix C
 ) ;
 
 //------------------------------------------------------------------------------
-// GB_dense_subassign_25: C<M> = A ; C is empty, A is dense, M is structural
+// GB_dense_subassign_25: C<M> = A ; C is empty or C == M, A dense, M struct
 //------------------------------------------------------------------------------
 
 GrB_Info GB_dense_subassign_25
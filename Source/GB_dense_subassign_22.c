@@ -7,7 +7,10 @@
 
 //------------------------------------------------------------------------------
 
-// C += b where C is a dense matrix and b is a scalar
+// C += b where C is a dense matrix and b is a scalar.  Only the values of C
+// are modified, so this method is also used for C<C,struct> += b where C is
+// sparse: the mask is the pattern of C itself, and all entries in C are
+// updated.
 
 #include "GB_dense.h"
 #include "GB_binop.h"
@@ -34,7 +37,6 @@ GrB_Info GB_dense_subassign_22      // C += b where C is dense and b is a scalar
     ASSERT_MATRIX_OK (C, "C for C+=b", GB0) ;
     ASSERT (scalar != NULL) ;
     ASSERT (!GB_PENDING (C)) ; ASSERT (!GB_ZOMBIES (C)) ;
-    ASSERT (GB_is_dense (C)) ;
     ASSERT_TYPE_OK (btype, "btype for C+=b", GB0) ;
     ASSERT_BINARYOP_OK (accum, "accum for C+=b", GB0) ;
 
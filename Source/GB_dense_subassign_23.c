@@ -1,5 +1,5 @@
 //------------------------------------------------------------------------------
-// GB_dense_subassign_23: C += B where C is dense and B is sparse or dense
+// GB_dense_subassign_23: C += B or B' where C is dense; B is sparse or dense
 //------------------------------------------------------------------------------
 
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
@@ -7,9 +7,12 @@
 
 //------------------------------------------------------------------------------
 
-// C and B must have the same vector dimension and vector length.
-// FUTURE::: the transposed case, C+=B' could easily be done.
-// The parallelism used is identical to GB_AxB_colscale.
+// C and B must have the same vector dimension and vector length, or for the
+// transposed case, C+=B', the vector length of B must be the vector dimension
+// of C and vice versa.  The parallelism used is identical to GB_AxB_colscale,
+// except when C+=B' is computed with B dense, where tiles of B are used
+// instead.  C+=B' scatters the entries of B directly into C, so the transpose
+// of B is never constructed.
 
 // The type of C must match the type of x and z for the accum function, since
 // C(i,j) = accum (C(i,j), B(i,j)) is handled.  The generic case here can
@@ -28,10 +31,11 @@
 #undef  GB_FREE_ALL
 #define GB_FREE_ALL GB_FREE_WORK
 
-GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
+GrB_Info GB_dense_subassign_23      // C += B or B'; C is dense
 (
     GrB_Matrix C,                   // input/output matrix
     const GrB_Matrix B,             // input matrix
+    const bool B_transpose,         // if true, C += B', else C += B
     const GrB_BinaryOp accum,       // operator to apply
     GB_Context Context
 )
@@ -47,8 +51,9 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
     ASSERT (!GB_PENDING (B)) ; ASSERT (!GB_ZOMBIES (B)) ;
     ASSERT (!GB_PENDING (C)) ; ASSERT (!GB_ZOMBIES (C)) ;
     ASSERT_BINARYOP_OK (accum, "accum for C+=B", GB0) ;
-    ASSERT (B->vlen == C->vlen) ;
-    ASSERT (B->vdim == C->vdim) ;
+    ASSERT (B->vlen == (B_transpose ? C->vdim : C->vlen)) ;
+    ASSERT (B->vdim == (B_transpose ? C->vlen : C->vdim)) ;
+    ASSERT (!(B_transpose && GB_aliased (C, B))) ;
 
     //--------------------------------------------------------------------------
     // get the operator
@@ -88,8 +93,16 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
     int64_t *pstart_slice = NULL, *kfirst_slice = NULL, *klast_slice = NULL ;
     if (GB_is_dense (B))
     { 
-        // both C and B are dense; no need to construct tasks
+        // both C and B are dense; no need to construct tasks.  For C += B',
+        // each task does a uniform set of tiles of B.
         GBBURBLE ("(Z dense) ") ;
+        if (B_transpose)
+        { 
+            int64_t T = GB_DENSE_TRAN_TILE ;
+            int64_t ntiles = ((B->vlen + T - 1) / T) * ((B->vdim + T - 1) / T) ;
+            ntasks = GB_IMIN (ntasks, ntiles) ;
+            ntasks = GB_IMAX (ntasks, 1) ;
+        }
     }
     else
     {
@@ -103,7 +116,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
     }
 
     //--------------------------------------------------------------------------
-    // C += B, sparse accum into dense, with built-in binary operators
+    // C += B or B', sparse accum into dense, with built-in binary operators
     //--------------------------------------------------------------------------
 
     bool done = false ;
@@ -117,10 +130,23 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
         #define GB_Cdense_accumB(accum,xname) \
             GB_Cdense_accumB_ ## accum ## xname
 
+        #define GB_Cdense_accumB_tran(accum,xname) \
+            GB_Cdense_accumB_tran_ ## accum ## xname
+
         #define GB_BINOP_WORKER(accum,xname)                                  \
         {                                                                     \
-            info = GB_Cdense_accumB(accum,xname) (C, B,                       \
-                kfirst_slice, klast_slice, pstart_slice, ntasks, nthreads) ;  \
+            if (B_transpose)                                                  \
+            {                                                                 \
+                info = GB_Cdense_accumB_tran(accum,xname) (C, B,              \
+                    kfirst_slice, klast_slice, pstart_slice, ntasks,          \
+                    nthreads) ;                                               \
+            }                                                                 \
+            else                                                              \
+            {                                                                 \
+                info = GB_Cdense_accumB(accum,xname) (C, B,                   \
+                    kfirst_slice, klast_slice, pstart_slice, ntasks,          \
+                    nthreads) ;                                               \
+            }                                                                 \
             done = (info != GrB_NO_VALUE) ;                                   \
         }                                                                     \
         break ;
@@ -141,7 +167,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
     #endif
 
     //--------------------------------------------------------------------------
-    // C += B, sparse accum into dense, with typecasting or user-defined op
+    // C += B or B', with typecasting or user-defined operators
     //--------------------------------------------------------------------------
 
     if (!done)
@@ -165,7 +191,7 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
         cast_B_to_Y = GB_cast_factory (accum->ytype->code, B->type->code) ;
 
         //----------------------------------------------------------------------
-        // C += B via function pointers, and typecasting
+        // C += B or B' via function pointers, and typecasting
         //----------------------------------------------------------------------
 
         // bij = B(i,j), located in Bx [pB].  Note that GB_GETB is used,
@@ -184,7 +210,14 @@ GrB_Info GB_dense_subassign_23      // C += B; C is dense, B is sparse or dense
         #define GB_PRAGMA_SIMD_VECTORIZE ;
 
         #define GB_BINOP(z,x,y) fadd (z,x,y)
-        #include "GB_dense_subassign_23_template.c"
+        if (B_transpose)
+        { 
+            #include "GB_dense_subassign_23_tran_template.c"
+        }
+        else
+        { 
+            #include "GB_dense_subassign_23_template.c"
+        }
     }
 
     //--------------------------------------------------------------------------
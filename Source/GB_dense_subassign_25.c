@@ -1,5 +1,5 @@
 //------------------------------------------------------------------------------
-// GB_dense_subassign_25: C(:,:)<M,s> = A; C empty, A dense, M structural
+// GB_dense_subassign_25: C(:,:)<M,s> = A; C empty or C == M, A dense
 //------------------------------------------------------------------------------
 
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
@@ -9,6 +9,10 @@
 
 // Method 25: C(:,:)<M,s> = A ; C is empty, M structure, A dense
 
+// C is either empty on input, or C and M are the same matrix (C<C,s> = A).  In
+// the latter case, the pattern of C is unchanged and only the values of C are
+// modified.
+
 // M:           present
 // Mask_comp:   false
 // Mask_struct: true
@@ -48,7 +52,7 @@ GrB_Info GB_dense_subassign_25
     ASSERT_MATRIX_OK (C, "C for subassign method_25", GB0) ;
     ASSERT_MATRIX_OK (M, "M for subassign method_25", GB0) ;
     ASSERT_MATRIX_OK (A, "A for subassign method_25", GB0) ;
-    ASSERT (GB_NNZ (C) == 0) ;
+    ASSERT (GB_NNZ (C) == 0 || C == M) ;
     ASSERT (!GB_PENDING (C)) ; ASSERT (!GB_ZOMBIES (C)) ;
     ASSERT (!GB_PENDING (M)) ; ASSERT (!GB_ZOMBIES (M)) ;
     ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
@@ -93,12 +97,16 @@ GrB_Info GB_dense_subassign_25
 
     // clear prior content and then create a copy of the pattern of M.  Keep
     // the same type and CSR/CSC for C.  Allocate the values of C but do not
-    // initialize them.
+    // initialize them.  If C and M are the same matrix, the pattern of C is
+    // already the pattern of M.
 
-    bool C_is_csc = C->is_csc ;
-    GB_PHIX_FREE (C) ;
-    GB_OK (GB_dup2 (&C, M, false, C->type, Context)) ;
-    C->is_csc = C_is_csc ;
+    if (C != M)
+    { 
+        bool C_is_csc = C->is_csc ;
+        GB_PHIX_FREE (C) ;
+        GB_OK (GB_dup2 (&C, M, false, C->type, Context)) ;
+        C->is_csc = C_is_csc ;
+    }
 
     //--------------------------------------------------------------------------
     // C<M> = A for built-in types
@@ -0,0 +1,256 @@
+//------------------------------------------------------------------------------
+// GB_deserialize: create a matrix from a serialized blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The blob is created by GxB_Matrix_serialize, and is not modified.  Its
+// header and the structure of each section are checked before the matrix is
+// built.  The new matrix C has the same format (sparse, hypersparse, bitmap,
+// or full) as the matrix that was serialized.
+
+// If the matrix has a user-defined type, the same type must be passed in.
+// For built-in types, the type parameter may be NULL.
+
+// If shallow is false (for GxB_Matrix_deserialize), the blob may come from
+// another process, so it is not trusted and the content of C is fully checked
+// as well.  If shallow is true (for GxB_Matrix_import_mmap), the components
+// of C point into the blob wherever the blob holds them uncompressed, and the
+// caller must keep the blob until C is freed.  In this case the blob is
+// trusted, since checking the content of C would touch every page of it.
+
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL GB_MATRIX_FREE (Chandle) ;
+
+GrB_Info GB_deserialize             // create a matrix from a blob
+(
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    GrB_Type type,                  // type of the matrix, or NULL for built-in
+    const GB_void *blob,            // the blob
+    size_t blob_size,               // size of the blob in bytes
+    bool shallow,                   // if true, C may point into the blob
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL && blob != NULL) ;
+    (*Chandle) = NULL ;
+    GrB_Info info ;
+
+    //--------------------------------------------------------------------------
+    // read and check the header
+    //--------------------------------------------------------------------------
+
+    if (blob_size < GB_BLOB_HEADER)
+    {
+        return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+            "blob is too small [" GBu "]", (GrB_Index) blob_size))) ;
+    }
+
+    int64_t Header [20] ;
+    memcpy (Header, blob, GB_BLOB_HEADER) ;
+    int64_t cvlen         = Header [ 3] ;
+    int64_t cvdim         = Header [ 4] ;
+    int64_t cnvec         = Header [ 5] ;
+    int64_t nvec_nonempty = Header [ 6] ;
+    int64_t nvals         = Header [ 7] ;
+    int64_t typecode      = Header [ 8] ;
+    int64_t typesize      = Header [ 9] ;
+    int64_t format        = Header [10] ;
+    bool    C_is_hyper    = (Header [11] != 0) ;
+    bool    C_is_csc      = (Header [12] != 0) ;
+    int     sparsity      = (int) Header [13] ;
+    double hyper_ratio, bitmap_switch ;
+    memcpy (&hyper_ratio,   &(Header [15]), sizeof (double)) ;
+    memcpy (&bitmap_switch, &(Header [16]), sizeof (double)) ;
+
+    if (Header [0] != GB_BLOB_MAGIC || Header [1] != GB_BLOB_VERSION)
+    {
+        return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+            "blob is not a serialized GrB_Matrix"))) ;
+    }
+
+    bool C_is_full   = (format == GxB_FULL) ;
+    bool C_is_bitmap = (format == GxB_BITMAP) ;
+    bool C_is_sparse = (format == GxB_SPARSE) ;
+
+    bool ok = (Header [2] >= (int64_t) GB_BLOB_HEADER)
+        && ((size_t) Header [2] <= blob_size)
+        && (cvlen >= 0 && cvlen <= GxB_INDEX_MAX)
+        && (cvdim >= 0 && cvdim <= GxB_INDEX_MAX)
+        && (typecode >= GB_BOOL_code && typecode <= GB_UDT_code)
+        && (typesize > 0)
+        && (C_is_full || C_is_bitmap || C_is_sparse)
+        && (C_is_sparse || !C_is_hyper)
+        && (nvals >= 0) ;
+    if (ok && C_is_sparse)
+    {
+        // Ap has cnvec+1 entries; hypersparse matrices can have fewer vectors
+        ok = C_is_hyper ? (cnvec >= 0 && cnvec <= cvdim) : (cnvec == cvdim) ;
+    }
+    if (ok && !C_is_sparse)
+    {
+        // bitmap and full matrices hold all vlen*vdim values
+        ok = (cnvec == cvdim)
+            && (cvlen == 0 || cvdim <= GxB_INDEX_MAX / cvlen)
+            && (cvlen * cvdim <= INT64_MAX / typesize)
+            && (C_is_bitmap ? (nvals <= cvlen * cvdim)
+                            : (nvals == cvlen * cvdim)) ;
+    }
+    if (ok && C_is_sparse)
+    {
+        ok = (nvals <= INT64_MAX / GB_IMAX (typesize, sizeof (int64_t))) ;
+    }
+    if (!ok)
+    {
+        return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+            "blob header is invalid"))) ;
+    }
+
+    // only the blob_size bytes written by GxB_Matrix_serialize are used
+    blob_size = (size_t) Header [2] ;
+
+    //--------------------------------------------------------------------------
+    // get the type of the matrix
+    //--------------------------------------------------------------------------
+
+    if (typecode == GB_UDT_code)
+    {
+        // a user-defined type must be given, and must have the same size
+        if (type == NULL || type->code != GB_UDT_code
+            || type->size != (size_t) typesize)
+        {
+            return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+                "user-defined type of blob does not match the given type"))) ;
+        }
+    }
+    else
+    {
+        // a built-in type, which must match the given type, if present
+        GrB_Type ctype = GB_code_type ((GB_Type_code) typecode, NULL) ;
+        if (ctype->size != (size_t) typesize ||
+            (type != NULL && type != ctype))
+        {
+            return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+                "type of blob does not match the given type"))) ;
+        }
+        type = ctype ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the header of the matrix, but not its content
+    //--------------------------------------------------------------------------
+
+    int64_t cplen = C_is_hyper ? cnvec : cvdim ;
+    GB_OK (GB_new (Chandle, type, cvlen, cvdim, GB_Ap_null, C_is_csc,
+        GB_SAME_HYPER_AS (C_is_hyper), hyper_ratio, cplen, Context)) ;
+    GrB_Matrix C = (*Chandle) ;
+    C->sparsity = sparsity ;
+    C->bitmap_switch = bitmap_switch ;
+
+    //--------------------------------------------------------------------------
+    // read each section from the blob
+    //--------------------------------------------------------------------------
+
+    size_t s = GB_BLOB_HEADER ;
+    int64_t cnz = C_is_sparse ? nvals : (cvlen * cvdim) ;
+
+    if (C_is_sparse)
+    {
+        // read Cp
+        C->p_shallow = shallow ;
+        GB_OK (GB_deserialize_array ((GB_void **) &(C->p), &(C->p_shallow),
+            (cnvec+1) * sizeof (int64_t), (cplen+1) * sizeof (int64_t),
+            blob, blob_size, &s, Context)) ;
+        if (C->p [0] != 0 || C->p [cnvec] != nvals)
+        {
+            GB_FREE_ALL ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "blob is invalid; vector pointers are corrupted"))) ;
+        }
+    }
+
+    if (C_is_hyper)
+    {
+        // read Ch
+        C->h_shallow = shallow ;
+        GB_OK (GB_deserialize_array ((GB_void **) &(C->h), &(C->h_shallow),
+            cnvec * sizeof (int64_t), cplen * sizeof (int64_t),
+            blob, blob_size, &s, Context)) ;
+    }
+
+    if (C_is_bitmap)
+    {
+        // read Cb; it is never shallow
+        bool b_shallow = false ;
+        GB_OK (GB_deserialize_array ((GB_void **) &(C->b), &b_shallow,
+            cnz * sizeof (int8_t), cnz * sizeof (int8_t),
+            blob, blob_size, &s, Context)) ;
+    }
+
+    if (C_is_sparse)
+    {
+        // read Ci
+        C->i_shallow = shallow ;
+        GB_OK (GB_deserialize_array ((GB_void **) &(C->i), &(C->i_shallow),
+            cnz * sizeof (int64_t), GB_IMAX (cnz, 1) * sizeof (int64_t),
+            blob, blob_size, &s, Context)) ;
+    }
+
+    // read Cx
+    C->x_shallow = shallow ;
+    GB_OK (GB_deserialize_array ((GB_void **) &(C->x), &(C->x_shallow),
+        cnz * typesize, GB_IMAX (cnz, 1) * typesize,
+        blob, blob_size, &s, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // finalize the matrix
+    //--------------------------------------------------------------------------
+
+    C->nzmax = GB_IMAX (cnz, 1) ;
+    C->plen = cplen ;
+    C->nvec = cnvec ;
+    C->nvec_nonempty = (nvec_nonempty >= 0 && nvec_nonempty <= cnvec) ?
+        nvec_nonempty : (-1) ;
+    if (C_is_bitmap)
+    {
+        C->nvals = nvals ;
+    }
+    C->magic = GB_MAGIC ;
+
+    //--------------------------------------------------------------------------
+    // check the content of the matrix
+    //--------------------------------------------------------------------------
+
+    // The sections are structurally valid, but their contents (Ap, Ah, Ab,
+    // and Ai) must also be checked, since a corrupted blob could otherwise
+    // lead to out-of-bounds accesses later on.  This takes O(e+n) time.
+
+    if (!shallow)
+    {
+        info = GB_Matrix_check (C, "C deserialized", GxB_SILENT, NULL,
+            Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            GB_FREE_ALL ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "blob is invalid; matrix content is corrupted"))) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C deserialized", GB0) ;
+    return (GrB_SUCCESS) ;
+}
+
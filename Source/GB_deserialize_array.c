@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+// GB_deserialize_array: read an array from a blob, decompressing each block
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The section at position *s_handle in the blob is checked, and its blocks
+// are decompressed (or copied) in parallel into a newly allocated array X of
+// size_alloc bytes.  The blob is not trusted: GrB_INVALID_OBJECT is returned
+// if the section is inconsistent with the expected size of the array, if it
+// extends past the end of the blob, or if any block fails to decompress.
+
+// If *X_shallow is true on input and all blocks of a nonempty section are
+// stored as-is, no copy is made: X is returned as a pointer into the blob
+// itself, and *X_shallow remains true.  Otherwise it is returned as false.
+
+#include "GB_serialize.h"
+
+GrB_Info GB_deserialize_array       // read an array from the blob
+(
+    GB_void **X_handle,             // array to allocate and read
+    bool *X_shallow,                // in: if X may point into the blob;
+                                    // out: true if it does
+    int64_t size,                   // size of X in bytes
+    int64_t size_alloc,             // size to allocate (>= size)
+    const GB_void *blob,            // blob to read from
+    size_t blob_size,               // size of the blob
+    size_t *s_handle,               // position in the blob; advanced on output
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (X_handle != NULL && X_shallow != NULL) ;
+    ASSERT (blob != NULL && s_handle != NULL) ;
+    ASSERT (size >= 0 && size_alloc >= size) ;
+    (*X_handle) = NULL ;
+
+    //--------------------------------------------------------------------------
+    // read and check the section header
+    //--------------------------------------------------------------------------
+
+    size_t s = (*s_handle) ;
+    int64_t blob_array_size, nblocks ;
+    if (s + 2 * sizeof (int64_t) > blob_size)
+    {
+        // blob is truncated
+        return (GrB_INVALID_OBJECT) ;
+    }
+    memcpy (&blob_array_size, blob + s, sizeof (int64_t)) ;
+    s += sizeof (int64_t) ;
+    memcpy (&nblocks, blob + s, sizeof (int64_t)) ;
+    s += sizeof (int64_t) ;
+
+    if (blob_array_size != size
+        || nblocks != GB_ICEIL (size, GB_BLOB_BLOCKSIZE)
+        || (size_t) nblocks > (blob_size - s) / sizeof (int64_t))
+    {
+        // section does not match the matrix, or is truncated
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    // Sblock [1..nblocks] are the cumulative stored block sizes
+    const GB_void *Sblock_blob = blob + s ;
+    s += nblocks * sizeof (int64_t) ;
+    int64_t slast = 0 ;
+    for (int64_t b = 0 ; b < nblocks ; b++)
+    {
+        int64_t sb ;
+        memcpy (&sb, Sblock_blob + b * sizeof (int64_t), sizeof (int64_t)) ;
+        int64_t bsize = GB_IMIN (GB_BLOB_BLOCKSIZE, size - b*GB_BLOB_BLOCKSIZE);
+        if (sb <= slast || sb - slast > bsize)
+        {
+            // invalid stored block size
+            return (GrB_INVALID_OBJECT) ;
+        }
+        slast = sb ;
+    }
+    if (GB_BLOB_PAD ((size_t) slast) > blob_size - s)
+    {
+        // blob is truncated
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // use the blob itself, if permitted
+    //--------------------------------------------------------------------------
+
+    if ((*X_shallow) && size > 0 && size_alloc == size && slast == size)
+    { 
+        // all blocks are stored as-is, and held contiguously in the blob
+        (*X_handle) = (GB_void *) (blob + s) ;
+        (*s_handle) = s + GB_BLOB_PAD ((size_t) slast) ;
+        return (GrB_SUCCESS) ;
+    }
+    (*X_shallow) = false ;
+
+    //--------------------------------------------------------------------------
+    // allocate the array
+    //--------------------------------------------------------------------------
+
+    GB_void *GB_RESTRICT X = GB_MALLOC (GB_IMAX (size_alloc, 1), GB_void) ;
+    if (X == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // decompress or copy each block
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (size, chunk, nthreads_max) ;
+    nthreads = GB_IMIN (nthreads, nblocks) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+
+    const GB_void *GB_RESTRICT Data = blob + s ;
+    bool ok = true ;
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1) \
+        reduction(&&:ok)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+        int64_t bsize = GB_IMIN (GB_BLOB_BLOCKSIZE, size - kstart) ;
+        int64_t sstart, send ;
+        if (b == 0)
+        {
+            sstart = 0 ;
+        }
+        else
+        {
+            memcpy (&sstart, Sblock_blob + (b-1) * sizeof (int64_t),
+                sizeof (int64_t)) ;
+        }
+        memcpy (&send, Sblock_blob + b * sizeof (int64_t), sizeof (int64_t)) ;
+        int64_t ssize = send - sstart ;
+        if (ssize == bsize)
+        {
+            // the block is stored as-is
+            memcpy (X + kstart, Data + sstart, bsize) ;
+        }
+        else
+        {
+            // the block is compressed
+            ok = ok && GB_lz4_decompress (X + kstart, bsize, Data + sstart,
+                ssize) ;
+        }
+    }
+
+    if (!ok)
+    {
+        // a compressed block is corrupted
+        GB_FREE (X) ;
+        return (GrB_INVALID_OBJECT) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*X_handle) = X ;
+    (*s_handle) = s + GB_BLOB_PAD ((size_t) slast) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -38,14 +38,81 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
         A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
     }
 
-    // [ create C; allocate C->p and do not initialize it
-    // C has the exact same hypersparsity as A.
     int64_t anz = GB_NNZ (A) ;
 
     // allocate a new header for C if (*Chandle) is NULL, or reuse the
     // existing header if (*Chandle) is not NULL.
     GrB_Matrix C = (*Chandle) ;
-    GrB_Info info = GB_create (&C, numeric ? A->type : ctype, A->vlen, A->vdim,
+    GrB_Info info ;
+
+    // a new matrix C inherits the sparsity control of A; an existing header
+    // keeps its own
+    int sparsity = (C == NULL) ? A->sparsity : C->sparsity ;
+
+    if (GB_IS_FULL (A))
+    {
+
+        //----------------------------------------------------------------------
+        // C = A where A is full; C is also full, with no pattern to copy
+        //----------------------------------------------------------------------
+
+        info = GB_create_full (&C, numeric ? A->type : ctype, A->vlen, A->vdim,
+            A->is_csc, A->hyper_ratio, sparsity, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+        if (numeric)
+        { 
+            int nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
+            GB_memcpy (C->x, A->x, anz * A->type->size, nthreads) ;
+            ASSERT_MATRIX_OK (C, "C full duplicate of A", GB0) ;
+        }
+        (*Chandle) = C ;
+        return (GrB_SUCCESS) ;
+    }
+
+    if (GB_IS_BITMAP (A))
+    {
+
+        //----------------------------------------------------------------------
+        // C = A where A is bitmap; copy the bitmap A->b and all of A->x
+        //----------------------------------------------------------------------
+
+        int64_t anzmax = A->vlen * A->vdim ;
+        info = GB_create_full (&C, numeric ? A->type : ctype, A->vlen, A->vdim,
+            A->is_csc, A->hyper_ratio, sparsity, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+        C->b = GB_MALLOC (anzmax, int8_t) ;
+        if (C->b == NULL)
+        { 
+            // out of memory
+            GB_PHIX_FREE (C) ;
+            if (*Chandle == NULL) GB_MATRIX_FREE (&C) ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+        int nthreads = GB_nthreads (anzmax, chunk, nthreads_max) ;
+        GB_memcpy (C->b, A->b, anzmax * sizeof (int8_t), nthreads) ;
+        C->nvals = A->nvals ;
+        C->nvec_nonempty = A->nvec_nonempty ;
+        if (*Chandle == NULL) C->bitmap_switch = A->bitmap_switch ;
+        if (numeric)
+        { 
+            GB_memcpy (C->x, A->x, anzmax * A->type->size, nthreads) ;
+            ASSERT_MATRIX_OK (C, "C bitmap duplicate of A", GB0) ;
+        }
+        (*Chandle) = C ;
+        return (GrB_SUCCESS) ;
+    }
+
+    // [ create C; allocate C->p and do not initialize it
+    // C has the exact same hypersparsity as A.
+    info = GB_create (&C, numeric ? A->type : ctype, A->vlen, A->vdim,
         GB_Ap_malloc, A->is_csc, GB_SAME_HYPER_AS (A->is_hyper),
         A->hyper_ratio, A->plen, anz, true, Context) ;
     if (info != GrB_SUCCESS)
@@ -58,6 +125,7 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
     int64_t anvec = A->nvec ;
     C->nvec = anvec ;
     C->nvec_nonempty = A->nvec_nonempty ;
+    C->sparsity = sparsity ;
     int64_t *GB_RESTRICT Cp = C->p ;
     int64_t *GB_RESTRICT Ch = C->h ;
     int64_t *GB_RESTRICT Ci = C->i ;
@@ -74,6 +142,7 @@ GrB_Info GB_dup2            // make an exact copy of a matrix
 
     nthreads = GB_nthreads (anz, chunk, nthreads_max) ;
     GB_memcpy (Ci, Ai, anz * sizeof (int64_t), nthreads) ;
+    C->jumbled = A->jumbled ;
     if (numeric)
     { 
         GB_memcpy (C->x, A->x, anz * A->type->size, nthreads) ;
@@ -25,10 +25,13 @@
 // and B, and also intersection with M if present.
 
 #include "GB_emult.h"
+#include "GB_add.h"
 
-#define GB_FREE_ALL ;
+//------------------------------------------------------------------------------
+// GB_emult_phased: C=A.*B or C<M>=A.*B, where M, A, and B are sparse or hyper
+//------------------------------------------------------------------------------
 
-GrB_Info GB_emult           // C=A.*B or C<M>=A.*B
+static GrB_Info GB_emult_phased // C=A.*B or C<M>=A.*B, via phase0 to phase2
 (
     GrB_Matrix *Chandle,    // output matrix (unallocated on input)
     const GrB_Type ctype,   // type of output matrix C
@@ -42,25 +45,10 @@ GrB_Info GB_emult           // C=A.*B or C<M>=A.*B
 )
 {
 
-    //--------------------------------------------------------------------------
-    // check inputs
-    //--------------------------------------------------------------------------
-
-    GBBURBLE ((M == NULL) ? "emult " : "masked_emult ") ;
-
-    ASSERT (Chandle != NULL) ;
-    ASSERT_MATRIX_OK (A, "A for emult phased", GB0) ;
-    ASSERT_MATRIX_OK (B, "B for emult phased", GB0) ;
-    ASSERT_BINARYOP_OK_OR_NULL (op, "op for emult phased", GB0) ;
-    ASSERT_MATRIX_OK_OR_NULL (M, "M for emult phased", GB0) ;
-    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
-    ASSERT (!GB_PENDING (B)) ; ASSERT (!GB_ZOMBIES (B)) ;
-    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
-    if (M != NULL)
-    { 
-        ASSERT (!GB_PENDING (M)) ; ASSERT (!GB_ZOMBIES (M)) ;
-        ASSERT (A->vdim == M->vdim && A->vlen == M->vlen) ;
-    }
+    ASSERT (!GB_IS_FULL (M) && !GB_IS_BITMAP (M)) ;
+    ASSERT (!GB_IS_FULL (A) && !GB_IS_BITMAP (A)) ;
+    ASSERT (!GB_IS_FULL (B) && !GB_IS_BITMAP (B)) ;
+    GrB_Info info ;
 
     //--------------------------------------------------------------------------
     // initializations
@@ -81,7 +69,7 @@ GrB_Info GB_emult           // C=A.*B or C<M>=A.*B
     // phase0: determine the vectors in C(:,j)
     //--------------------------------------------------------------------------
 
-    GrB_Info info = GB_emult_phase0 (
+    info = GB_emult_phase0 (
         // computed by phase0:
         &Cnvec, &Ch, &C_to_M, &C_to_A, &C_to_B,
         // original input:
@@ -178,3 +166,75 @@ GrB_Info GB_emult           // C=A.*B or C<M>=A.*B
     return (GrB_SUCCESS) ;
 }
 
+
+//------------------------------------------------------------------------------
+// GB_emult: C=A.*B or C<M>=A.*B
+//------------------------------------------------------------------------------
+
+#define GB_FREE_ALL                 \
+{                                   \
+    GB_MATRIX_FREE (&M_sparse) ;    \
+    GB_MATRIX_FREE (&A_sparse) ;    \
+    GB_MATRIX_FREE (&B_sparse) ;    \
+}
+
+GrB_Info GB_emult           // C=A.*B or C<M>=A.*B
+(
+    GrB_Matrix *Chandle,    // output matrix (unallocated on input)
+    const GrB_Type ctype,   // type of output matrix C
+    const bool C_is_csc,    // format of output matrix C
+    const GrB_Matrix M_in,  // optional mask, unused if NULL.  Not complemented
+    const bool Mask_struct, // if true, use the only structure of M
+    const GrB_Matrix A_in,  // input A matrix
+    const GrB_Matrix B_in,  // input B matrix
+    const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    GrB_Matrix M_sparse = NULL, A_sparse = NULL, B_sparse = NULL ;
+    GrB_Matrix M = M_in, A = A_in, B = B_in ;
+    GBBURBLE ((M == NULL) ? "emult " : "masked_emult ") ;
+
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for emult phased", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for emult phased", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (op, "op for emult phased", GB0) ;
+    ASSERT_MATRIX_OK_OR_NULL (M, "M for emult phased", GB0) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_PENDING (B)) ; ASSERT (!GB_ZOMBIES (B)) ;
+    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
+    if (M != NULL)
+    { 
+        ASSERT (!GB_PENDING (M)) ; ASSERT (!GB_ZOMBIES (M)) ;
+        ASSERT (A->vdim == M->vdim && A->vlen == M->vlen) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A.*B where A and B are both full
+    //--------------------------------------------------------------------------
+
+    if (M == NULL && op != NULL && GB_IS_FULL (A) && GB_IS_FULL (B))
+    { 
+        return (GB_ewise_full (Chandle, ctype, C_is_csc, A, B, op, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C = A.*B or C<M>=A.*B via the phased method
+    //--------------------------------------------------------------------------
+
+    // The phased method requires the pattern of each matrix.  Any full or
+    // bitmap matrix is replaced with a temporary sparse copy.
+    GB_SPARSE_INPUT (M, M_sparse) ;
+    GB_SPARSE_INPUT (A, A_sparse) ;
+    GB_SPARSE_INPUT (B, B_sparse) ;
+    info = GB_emult_phased (Chandle, ctype, C_is_csc, M, Mask_struct, A, B, op,
+        Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
+}
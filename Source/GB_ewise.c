@@ -263,12 +263,6 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
 
     #ifndef GBCOMPACT
 
-        // FUTURE: for sssp12:
-        // C<A> = A+B where C is sparse and B is dense;
-        // mask is structural, not complemented, C_replace is false.
-        // C is not empty.  Use a kernel that computes T<A>=A+B
-        // where T starts out empty; just iterate over the entries in A.
-
     if (A_is_dense                          // A and B are dense
         && B_is_dense
         && (M == NULL) && !Mask_comp        // no mask
@@ -308,6 +302,11 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
             info = GB_dense_ewise3_noaccum (C, C_is_dense, A1, B1, op, Context);
             GB_FREE_ALL ;
             if (info == GrB_SUCCESS)
+            {
+                // C takes on the sparse or full format of A
+                info = GB_conform (C, Context) ;
+            }
+            if (info == GrB_SUCCESS)
             {
                 ASSERT_MATRIX_OK (C, "C output for GB_ewise, dense C=A+B", GB0);
             }
@@ -321,7 +320,22 @@ GrB_Info GB_ewise                   // C<M> = accum (C, A+B) or A.*B
     // T = A+B or A.*B
     //--------------------------------------------------------------------------
 
-    if (eWiseAdd)
+    // T<A,struct> = A+B where A is sparse and B is dense (or T<B,struct> = A+B
+    // where A is dense and B is sparse), as in the relaxation step of SSSP:
+    // C<A> = A+B where B is a dense vector.  The pattern of T is the same as
+    // the sparse matrix, so T is computed by iterating over its entries.
+
+    bool A_sparse_B_dense = (M1 == A1) && !A_is_dense && B_is_dense ;
+    bool A_dense_B_sparse = (M1 == B1) && A_is_dense && !B_is_dense ;
+
+    if (eWiseAdd && (M1 != NULL) && Mask_struct
+        && (A_sparse_B_dense || A_dense_B_sparse)
+        && !GB_IS_BITMAP (M1))
+    { 
+        GB_OK (GB_add_sparse_dense (&T, T_type, A1, B1, A_sparse_B_dense, op,
+            Context)) ;
+    }
+    else if (eWiseAdd)
     { 
         GB_OK (GB_add (&T, T_type, C_is_csc, M1, Mask_struct, A1, B1, op,
             Context)) ;
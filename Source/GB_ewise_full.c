@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+// GB_ewise_full: C = op (A,B) where A and B are both full
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// C = op (A,B), with typecasting, where A and B are both full.  The pattern of
+// A+B and A.*B are the same in this case, so this method is used by both
+// GB_add and GB_emult when no mask is present.  C is returned as a full
+// matrix.  No pattern is computed: the result is a single pass over the
+// values, with no indices or vector pointers.
+
+// C = A+B for the built-in operators without typecasting is handled by
+// GB_dense_ewise3_noaccum, so this method is typically only used for the
+// generic case.
+
+#include "GB_add.h"
+
+GrB_Info GB_ewise_full      // C = op (A,B) where A and B are full
+(
+    GrB_Matrix *Chandle,    // output matrix (unallocated on input)
+    const GrB_Type ctype,   // type of output matrix C
+    const bool C_is_csc,    // format of output matrix C
+    const GrB_Matrix A,     // input A matrix, full
+    const GrB_Matrix B,     // input B matrix, full
+    const GrB_BinaryOp op,  // op to perform C = op (A,B)
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (Chandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for ewise full", GB0) ;
+    ASSERT_MATRIX_OK (B, "B for ewise full", GB0) ;
+    ASSERT_BINARYOP_OK (op, "op for ewise full", GB0) ;
+    ASSERT (GB_IS_FULL (A)) ;
+    ASSERT (GB_IS_FULL (B)) ;
+    ASSERT (A->vdim == B->vdim && A->vlen == B->vlen) ;
+
+    GBBURBLE ("(full) ") ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    int64_t cnz = GB_NNZ (A) ;
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (cnz, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // allocate C
+    //--------------------------------------------------------------------------
+
+    GrB_Matrix C = NULL ;
+    (*Chandle) = NULL ;
+    GrB_Info info = GB_create_full (&C, ctype, A->vlen, A->vdim, C_is_csc,
+        GB_Global_hyper_ratio_get ( ), GB_Global_sparsity_get ( ), Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // get the operator and the typecasting functions
+    //--------------------------------------------------------------------------
+
+    GxB_binary_function fop = op->function ;
+    size_t asize = A->type->size ;
+    size_t bsize = B->type->size ;
+    size_t csize = ctype->size ;
+    size_t xsize = op->xtype->size ;
+    size_t ysize = op->ytype->size ;
+    size_t zsize = op->ztype->size ;
+    GB_cast_function cast_A_to_X, cast_B_to_Y, cast_Z_to_C ;
+    cast_A_to_X = GB_cast_factory (op->xtype->code, A->type->code) ;
+    cast_B_to_Y = GB_cast_factory (op->ytype->code, B->type->code) ;
+    cast_Z_to_C = GB_cast_factory (ctype->code,     op->ztype->code) ;
+
+    const GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+    const GB_void *GB_RESTRICT Bx = (GB_void *) B->x ;
+    GB_void *GB_RESTRICT Cx = (GB_void *) C->x ;
+
+    //--------------------------------------------------------------------------
+    // C = op (A,B)
+    //--------------------------------------------------------------------------
+
+    int64_t p ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (p = 0 ; p < cnz ; p++)
+    { 
+        GB_void aij [GB_VLA(xsize)] ;
+        GB_void bij [GB_VLA(ysize)] ;
+        GB_void z [GB_VLA(zsize)] ;
+        cast_A_to_X (aij, Ax +(p*asize), asize) ;
+        cast_B_to_Y (bij, Bx +(p*bsize), bsize) ;
+        fop (z, aij, bij) ;
+        cast_Z_to_C (Cx +(p*csize), z, csize) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (C, "C output for ewise full", GB0) ;
+    (*Chandle) = C ;
+    return (GrB_SUCCESS) ;
+}
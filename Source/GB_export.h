@@ -51,8 +51,11 @@
     GB_RETURN_IF_NULL (nonempty) ;                              \
     /* get the descriptor */                                    \
     GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6) ; \
-    /* finish any pending work */                               \
+    /* finish any pending work; convert full to sparse */       \
     GB_MATRIX_WAIT (*A) ;                                       \
+    GB_ENSURE_SPARSE (*A) ;                                     \
+    /* the user will own the content of A */                \
+    GB_OK (GB_unshare (*A, Context)) ;                          \
     /* export basic attributes */                               \
     (*type) = (*A)->type ;                                      \
     (*nrows) = GB_NROWS (*A) ;                                  \
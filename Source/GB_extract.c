@@ -23,7 +23,7 @@
 #include "GB_subref.h"
 #include "GB_accum_mask.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_MATRIX_FREE (&A_sparse) ;
 
 GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
 (
@@ -33,7 +33,7 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     const bool Mask_comp,           // mask descriptor
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
-    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix A_in,          // input matrix
     const bool A_transpose,         // A matrix descriptor
     const GrB_Index *Rows,          // row indices
     const GrB_Index nRows_in,       // number of row indices
@@ -50,6 +50,8 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // C may be aliased with M and/or A
 
     GrB_Info info ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
     GB_RETURN_IF_NULL (Rows) ;
     GB_RETURN_IF_NULL (Cols) ;
     GB_RETURN_IF_FAULTY (accum) ;
@@ -98,6 +100,9 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     GB_MATRIX_WAIT (M) ;
     GB_MATRIX_WAIT (A) ;
 
+    // GB_subref requires the pattern of A
+    GB_SPARSE_INPUT (A, A_sparse) ;
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format and transpose; T = A (I,J) or T = A (J,I)
     //--------------------------------------------------------------------------
@@ -183,7 +188,9 @@ GrB_Info GB_extract                 // C<M> = accum (C, A(I,J))
     // C<M> = accum (C,T): accumulate the results into C via the mask M
     //--------------------------------------------------------------------------
 
-    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
-        Mask_struct, Context)) ;
+    info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
 }
 
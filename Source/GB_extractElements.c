@@ -0,0 +1,242 @@
+//------------------------------------------------------------------------------
+// GB_extractElements: extract a list of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// X(k) = A(I(k),J(k)) for k = 0:n-1, typecasting from the type of A to the
+// type of X, as needed.  If A(I(k),J(k)) is present, Xb [k] is set to 1 and
+// X(k) is set to its value.  Otherwise, Xb [k] is set to 0 and X(k) is not
+// modified.  Either X or Xb may be NULL, in which case it is not computed.
+// All the indices are checked first; if any is out of bounds, an error is
+// returned and neither X nor Xb is modified.
+
+// This function is not user-callable.  It does the work for the user-callable
+// GxB_Matrix_extractElements_* functions.
+
+// Each lookup is independent, and the list is split evenly across the
+// threads.  Within each task, the vector found for the prior lookup is reused
+// if the next lookup is in the same vector, so requests grouped by vector
+// avoid the search in A->h (if A is hypersparse).  Zombies are tolerated, but
+// pending tuples are assembled and jumbled vectors are sorted first, since
+// the entries are found by binary search.
+
+#include "GB.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_extractElements     // X(k) = A(I(k),J(k)) for k = 0:n-1
+(
+    void *X,                    // array of size n for returning the values
+    int8_t *GB_RESTRICT Xb,     // array of size n: Xb [k] = 1 if present
+    const GrB_Index *I_in,      // row indices, of size n
+    const GrB_Index *J_in,      // column indices, of size n
+    const GrB_Index n,          // number of entries to extract
+    const GB_Type_code xcode,   // type of array X
+    const GrB_Matrix A,         // matrix to extract entries from
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (A != NULL) ;
+    ASSERT (xcode <= GB_UDT_code) ;
+
+    // assemble any pending tuples and sort any jumbled vectors.  Zombies are
+    // left in place.
+    if (GB_PENDING (A) || GB_JUMBLED (A))
+    {
+        GB_OK (GB_Matrix_wait (A, Context)) ;
+    }
+    ASSERT (!GB_PENDING (A)) ;
+    ASSERT (!GB_JUMBLED (A)) ;
+
+    // xcode and A must be compatible
+    const GB_Type_code acode = A->type->code ;
+    if (!GB_code_compatible (xcode, acode))
+    {
+        return (GB_ERROR (GrB_DOMAIN_MISMATCH, (GB_LOG,
+            "entries in A of type [%s] cannot be typecast\n"
+            "to output array X of type [%s]",
+            A->type->name, GB_code_string (xcode)))) ;
+    }
+
+    ASSERT_MATRIX_OK (A, "A to extract elements from", GB0) ;
+
+    if (n == 0 || (X == NULL && Xb == NULL))
+    {
+        // no work to do
+        return (GrB_SUCCESS) ;
+    }
+
+    ASSERT (I_in != NULL) ;
+    ASSERT (J_in != NULL) ;
+
+    //--------------------------------------------------------------------------
+    // get A
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ah = A->h ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const int8_t  *GB_RESTRICT Ab = A->b ;
+    const GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+    const int64_t avlen = A->vlen ;
+    const int64_t avdim = A->vdim ;
+    const int64_t anvec = A->nvec ;
+    const int64_t nzombies = A->nzombies ;
+    const bool A_is_hyper = A->is_hyper ;
+    const bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    const bool A_is_full = GB_IS_FULL (A) ;
+    const bool A_is_empty = (A->nzmax == 0) ;
+    const size_t asize = A->type->size ;
+    const size_t xsize = GB_code_size (xcode, asize) ;
+    GB_cast_function cast_A_to_X = GB_cast_factory (xcode, acode) ;
+
+    // handle the CSR/CSC format
+    const GrB_Index *I = (A->is_csc) ? I_in : J_in ;
+    const GrB_Index *J = (A->is_csc) ? J_in : I_in ;
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (n, chunk, nthreads_max) ;
+
+    //--------------------------------------------------------------------------
+    // check the indices
+    //--------------------------------------------------------------------------
+
+    int64_t nbad = 0 ;
+    int64_t k ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static) \
+        reduction(+:nbad)
+    for (k = 0 ; k < (int64_t) n ; k++)
+    {
+        if (I [k] >= (GrB_Index) avlen || J [k] >= (GrB_Index) avdim)
+        {
+            nbad++ ;
+        }
+    }
+
+    if (nbad > 0)
+    {
+        // report the first invalid index
+        int64_t nrows = GB_NROWS (A) ;
+        int64_t ncols = GB_NCOLS (A) ;
+        for (k = 0 ; k < (int64_t) n ; k++)
+        {
+            if (I_in [k] >= (GrB_Index) nrows ||
+                J_in [k] >= (GrB_Index) ncols)
+            {
+                break ;
+            }
+        }
+        return (GB_ERROR (GrB_INDEX_OUT_OF_BOUNDS, (GB_LOG,
+            "index (" GBu "," GBu ") out of bounds,"
+            " must be < (" GBd ", " GBd ")",
+            I_in [k], J_in [k], nrows, ncols))) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // X(k) = A(I(k),J(k)) for k = 0:n-1
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < nthreads ; tid++)
+    {
+        int64_t kfirst, klast ;
+        GB_PARTITION (kfirst, klast, n, tid, nthreads) ;
+        int64_t jlast = -1 ;
+        int64_t pA_start = 0, pA_end = 0 ;
+        for (int64_t k = kfirst ; k < klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // get the kth index (i,j)
+            //------------------------------------------------------------------
+
+            int64_t i = I [k] ;
+            int64_t j = J [k] ;
+            bool found = false ;
+            int64_t pA = 0 ;
+            if (A_is_empty)
+            {
+                // A has no entries
+                found = false ;
+            }
+            else if (A_is_full)
+            {
+                // A(i,j) is always present
+                pA = i + j * avlen ;
+                found = true ;
+            }
+            else if (A_is_bitmap)
+            {
+                // A(i,j) is present if Ab [i+j*vlen] is nonzero
+                pA = i + j * avlen ;
+                found = (Ab [pA] != 0) ;
+            }
+            else
+            {
+
+                //--------------------------------------------------------------
+                // find A(:,j), reusing the prior vector if j is unchanged
+                //--------------------------------------------------------------
+
+                if (j != jlast)
+                {
+                    jlast = j ;
+                    int64_t kA = j ;
+                    bool jfound = true ;
+                    if (A_is_hyper)
+                    {
+                        // look for vector j in hyperlist Ah [0 ... anvec-1]
+                        int64_t pright = anvec - 1 ;
+                        kA = 0 ;
+                        GB_BINARY_SEARCH (j, Ah, kA, pright, jfound) ;
+                    }
+                    pA_start = jfound ? Ap [kA  ] : 0 ;
+                    pA_end   = jfound ? Ap [kA+1] : 0 ;
+                }
+
+                //--------------------------------------------------------------
+                // binary search in A(:,j) for index i
+                //--------------------------------------------------------------
+
+                pA = pA_start ;
+                int64_t pright = pA_end - 1 ;
+                bool is_zombie ;
+                GB_BINARY_SEARCH_ZOMBIE (i, Ai, pA, pright, found, nzombies,
+                    is_zombie) ;
+                found = found && !is_zombie ;
+            }
+
+            //------------------------------------------------------------------
+            // extract the entry
+            //------------------------------------------------------------------
+
+            if (Xb != NULL)
+            {
+                Xb [k] = found ;
+            }
+            if (found && X != NULL)
+            {
+                // X(k) = (xtype) A(i,j)
+                cast_A_to_X (((GB_void *) X) +(k*xsize), Ax +(pA*asize),
+                    asize) ;
+            }
+        }
+    }
+
+    return (GrB_SUCCESS) ;
+}
@@ -18,7 +18,7 @@
 
 #include "GB.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_MATRIX_FREE (&A_sparse) ;
 
 GrB_Info GB_extractTuples       // extract all tuples from a matrix
 (
@@ -27,7 +27,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     void *X,                    // array for returning values of tuples
     GrB_Index *p_nvals,         // I,J,X size on input; # tuples on output
     const GB_Type_code xcode,   // type of array X
-    const GrB_Matrix A,         // matrix to extract tuples from
+    const GrB_Matrix A_in,      // matrix to extract tuples from
     GB_Context Context
 )
 {
@@ -37,6 +37,8 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
 
     // delete any lingering zombies and assemble any pending tuples
     ASSERT (A != NULL) ;
@@ -74,6 +76,9 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
             "number of entries " GBd, nvals, anz))) ;
     }
 
+    // the tuples are extracted from the pattern of A
+    GB_SPARSE_INPUT (A, A_sparse) ;
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -115,6 +120,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
         if (!GB_extract_vector_list ((int64_t *) J, A, nthreads))
         { 
             // out of memory
+            GB_FREE_ALL ;
             return (GB_OUT_OF_MEMORY) ;
         }
     }
@@ -136,6 +142,7 @@ GrB_Info GB_extractTuples       // extract all tuples from a matrix
 
     *p_nvals = anz ;            // number of tuples extracted
 
+    GB_FREE_ALL ;
     return (GrB_SUCCESS) ;
 }
 
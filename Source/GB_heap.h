@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// GB_heap.h: data structure and operations for a min-heap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The heap is used by the coarse heap tasks of GB_AxB_saxpy3, to merge the
+// sorted vectors A(:,k) for each entry B(k,j), in order of their row indices.
+// Each element in the heap has a key (the next row index i of A(:,k)) and a
+// name (the position of B(k,j) in B(:,j)).
+
+// The heap is held in Heap [1..nheap], so that the parent of Heap [p] is
+// Heap [p/2], and its children are Heap [2*p] and Heap [2*p+1].  Heap [0] is
+// not used.  The smallest key is always at the top, in Heap [1].
+
+#ifndef GB_HEAP_H
+#define GB_HEAP_H
+
+typedef struct
+{
+    int64_t key ;       // the key for this element, which is >= 0
+    int64_t name ;      // the name of the element; not used in the heap
+}
+GB_Element ;
+
+//------------------------------------------------------------------------------
+// GB_heap_check: make sure the min-heap property holds (debug only)
+//------------------------------------------------------------------------------
+
+#ifdef GB_DEBUG
+static inline bool GB_heap_check    // true if Heap [1..nheap] is a min-heap
+(
+    const GB_Element *GB_RESTRICT Heap,
+    const int64_t nheap
+)
+{
+    for (int64_t p = 2 ; p <= nheap ; p++)
+    {
+        if (Heap [p/2].key > Heap [p].key) return (false) ;
+    }
+    return (true) ;
+}
+#endif
+
+//------------------------------------------------------------------------------
+// GB_heapify: move an element down the heap
+//------------------------------------------------------------------------------
+
+// The element in Heap [p] may be larger than its children; all other elements
+// satisfy the heap property.  Move Heap [p] down until the heap property is
+// restored.  O(log (nheap)) time.
+
+static inline void GB_heapify
+(
+    int64_t p,                      // node that needs to be heapified
+    GB_Element *GB_RESTRICT Heap,   // the heap, in Heap [1..nheap]
+    const int64_t nheap             // the number of nodes in the heap
+)
+{
+    if (p > nheap / 2 || nheap <= 1)
+    {
+        // Heap [p] is a leaf, or the heap has a single element
+        return ;
+    }
+
+    GB_Element e = Heap [p] ;
+    while (true)
+    {
+        int64_t left  = 2 * p ;
+        int64_t right = left + 1 ;
+        if (left > nheap) break ;   // Heap [p] is a leaf
+
+        // find the smallest child of Heap [p]
+        int64_t c = left ;
+        if (right <= nheap && Heap [right].key < Heap [left].key)
+        {
+            c = right ;
+        }
+
+        // stop if the element is no larger than its smallest child
+        if (e.key <= Heap [c].key) break ;
+
+        // move the smallest child up, and the element down
+        Heap [p] = Heap [c] ;
+        p = c ;
+    }
+    Heap [p] = e ;
+}
+
+//------------------------------------------------------------------------------
+// GB_heap_build: construct a heap
+//------------------------------------------------------------------------------
+
+// Heap [1..nheap] is rearranged so that it satisfies the heap property.
+// O(nheap) time.
+
+static inline void GB_heap_build
+(
+    GB_Element *GB_RESTRICT Heap,   // the heap, in Heap [1..nheap]
+    const int64_t nheap             // the number of nodes in the heap
+)
+{
+    for (int64_t p = nheap / 2 ; p >= 1 ; p--)
+    {
+        GB_heapify (p, Heap, nheap) ;
+    }
+    ASSERT (GB_heap_check (Heap, nheap)) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_heap_delete: delete an element from the heap
+//------------------------------------------------------------------------------
+
+// Heap [p] is removed from the heap, which is then of size nheap-1.  The last
+// element in the heap is moved into its place, and moved up or down the heap
+// as needed.  O(log (nheap)) time.
+
+static inline void GB_heap_delete
+(
+    int64_t p,                      // node to delete from the heap
+    GB_Element *GB_RESTRICT Heap,   // the heap, in Heap [1..nheap]
+    int64_t *GB_RESTRICT nheap      // the number of nodes in the heap
+)
+{
+    ASSERT (p >= 1 && p <= (*nheap)) ;
+
+    if (p == (*nheap))
+    {
+        // the last element is being deleted; the heap remains valid
+        (*nheap)-- ;
+        return ;
+    }
+
+    // replace Heap [p] with the last element in the heap
+    Heap [p] = Heap [(*nheap)--] ;
+
+    // move the element up the heap, if it is smaller than its parent
+    GB_Element e = Heap [p] ;
+    int64_t p0 = p ;
+    while (p > 1 && Heap [p/2].key > e.key)
+    {
+        Heap [p] = Heap [p/2] ;
+        p = p / 2 ;
+    }
+    Heap [p] = e ;
+
+    if (p == p0)
+    {
+        // the element did not move up, so it may need to move down
+        GB_heapify (p, Heap, (*nheap)) ;
+    }
+    ASSERT (GB_heap_check (Heap, (*nheap))) ;
+}
+
+#endif
@@ -25,8 +25,9 @@ GrB_Info GB_hyper_realloc
     //--------------------------------------------------------------------------
 
     ASSERT (A != NULL) ;
-    ASSERT (!A->p_shallow) ;
-    ASSERT (!A->h_shallow) ;
+    // A->p and A->h can be shallow only if A is from GxB_Matrix_import_mmap
+    ASSERT (!A->p_shallow || A->mmap_base != NULL) ;
+    ASSERT (!A->h_shallow || A->mmap_base != NULL) ;
     ASSERT (A->p != NULL) ;
 
     //--------------------------------------------------------------------------
@@ -38,6 +39,15 @@ GrB_Info GB_hyper_realloc
 
         ASSERT (A->h != NULL) ;
 
+        // A->p and A->h cannot be reallocated if they are shallow
+        GrB_Info info = GB_unshare (A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+        ASSERT (!A->p_shallow && !A->h_shallow) ;
+
         // old size of A->p and A->h
         int64_t plen_old = A->plen ;
 
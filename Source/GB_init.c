@@ -162,10 +162,13 @@ GrB_Info GB_init            // start up GraphBLAS
     // set the global default format
     //--------------------------------------------------------------------------
 
-    // set the default hypersparsity ratio and CSR/CSC format;  any thread
-    // can do this later as well, so there is no race condition danger.
+    // set the default hypersparsity ratio, sparsity control, bitmap switch,
+    // and CSR/CSC format;  any thread can do this later as well, so there is
+    // no race condition danger.
 
     GB_Global_hyper_ratio_set (GB_HYPER_DEFAULT) ;
+    GB_Global_sparsity_set (GB_SPARSITY_DEFAULT) ;
+    GB_Global_bitmap_switch_set (GB_BITMAP_SWITCH_DEFAULT) ;
     GB_Global_is_csc_set (GB_FORMAT_DEFAULT != GxB_BY_ROW) ;
 
     //--------------------------------------------------------------------------
@@ -40,6 +40,13 @@ bool GB_is_diagonal             // true if A is diagonal
         return (false) ;
     }
 
+    if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
+    { 
+        // a full or bitmap matrix is not treated as diagonal, even if it is
+        // 1-by-1
+        return (false) ;
+    }
+
     int64_t anz  = GB_NNZ (A) ;
     int64_t nvec = A->nvec ;
 
@@ -128,11 +128,13 @@
 // GBI_single_iterator: iterate over the vectors of a single matrix
 //------------------------------------------------------------------------------
 
-// The matrix may be sparse, hypersparse, slice, or hyperslice.
+// The matrix may be sparse, hypersparse, slice, hyperslice, or full.  If A is
+// full, A->p is NULL and the vectors are implicitly Ap [k] = k*A->vlen.
 
 typedef struct
 {
-    const int64_t *GB_RESTRICT p ; // vector pointer A->p of A
+    const int64_t *GB_RESTRICT p ; // vector pointer A->p of A (NULL if full)
+    int64_t vlen ;              // A->vlen: length of each vector
     const int64_t *GB_RESTRICT h ; // A->h: hyperlist of vectors in A
     int64_t nvec ;              // A->nvec: number of vectors in A
     int64_t hfirst ;            // A->hfirst: first vector in slice A
@@ -154,6 +156,7 @@ static inline void GBI1_init
     // load the content of A into the iterator
     Iter->is_hyper = A->is_hyper ;
     Iter->p = A->p ;
+    Iter->vlen = A->vlen ;
     Iter->h = A->h ;
     Iter->nvec = A->nvec ;
     Iter->is_slice = A->is_slice ;
@@ -203,8 +206,8 @@ static inline void GBI1_start
     }
 
     // get the start and end of the next vector of A
-    (*pstart) = Iter->p [Iter_k  ] ;
-    (*pend)   = Iter->p [Iter_k+1] ;
+    (*pstart) = GBP (Iter->p, Iter_k  , Iter->vlen) ;
+    (*pend)   = GBP (Iter->p, Iter_k+1, Iter->vlen) ;
 }
 
 // iterate over one matrix A (sparse, hypersparse, slice, or hyperslice)
@@ -51,14 +51,22 @@ GrB_Info GB_ix_free             // free A->i and A->x of a matrix
     A->x = NULL ;
     A->x_shallow = false ;
 
+    // free A->b; it is never shallow
+    GB_FREE (A->b) ;
+    A->nvals = 0 ;
+
     A->nzmax = 0 ;
 
-    // no zombies remain
+    // no zombies remain, and the (empty) matrix is not jumbled
     A->nzombies = 0 ;
+    A->jumbled = false ;
 
     // free the list of pending tuples
     GB_Pending_free (&(A->Pending)) ;
 
+    // free the pending tuples in the slots, but keep the slots themselves
+    GB_Pending_slots_clear (A) ;
+
     if (!GB_queue_remove (A)) return (GrB_PANIC) ;  // TODO in 4.0: delete
 
     return (GrB_SUCCESS) ;
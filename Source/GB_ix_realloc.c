@@ -33,7 +33,9 @@ GrB_Info GB_ix_realloc      // reallocate space in a matrix
     // used here.
     ASSERT (A != NULL && A->p != NULL) ;
     ASSERT (GB_IMPLIES (A->is_hyper, A->h != NULL)) ;
-    ASSERT (!A->i_shallow && !A->x_shallow) ;
+    // A->i and A->x can be shallow only if A is from GxB_Matrix_import_mmap
+    ASSERT (!A->i_shallow || A->mmap_base != NULL) ;
+    ASSERT (!A->x_shallow || A->mmap_base != NULL) ;
 
     // This function tolerates pending tuples and zombies
     ASSERT (GB_PENDING_OK (A)) ; ASSERT (GB_ZOMBIES_OK (A)) ;
@@ -44,6 +46,15 @@ GrB_Info GB_ix_realloc      // reallocate space in a matrix
         return (GB_OUT_OF_MEMORY) ;
     }
 
+    // A->i and A->x cannot be reallocated if they are shallow
+    GrB_Info info = GB_unshare (A, Context) ;
+    if (info != GrB_SUCCESS)
+    { 
+        // out of memory
+        return (info) ;
+    }
+    ASSERT (!A->i_shallow && !A->x_shallow) ;
+
     //--------------------------------------------------------------------------
     // reallocate the space
     //--------------------------------------------------------------------------
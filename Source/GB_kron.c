@@ -15,9 +15,11 @@
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
 
-#define GB_FREE_ALL         \
-    GB_MATRIX_FREE (&AT) ;  \
-    GB_MATRIX_FREE (&BT) ;
+#define GB_FREE_ALL                 \
+    GB_MATRIX_FREE (&AT) ;          \
+    GB_MATRIX_FREE (&BT) ;          \
+    GB_MATRIX_FREE (&A_sparse) ;    \
+    GB_MATRIX_FREE (&B_sparse) ;
 
 GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
 (
@@ -28,9 +30,9 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GrB_BinaryOp op,          // defines '*' for kron(A,B)
-    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix A_in,          // input matrix
     bool A_transpose,               // if true, use A' instead of A
-    const GrB_Matrix B,             // input matrix
+    const GrB_Matrix B_in,          // input matrix
     bool B_transpose,               // if true, use B' instead of B
     GB_Context Context
 )
@@ -45,6 +47,10 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     GrB_Info info ;
     GrB_Matrix AT = NULL ;
     GrB_Matrix BT = NULL ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix B_sparse = NULL ;
+    GrB_Matrix A = A_in ;
+    GrB_Matrix B = B_in ;
 
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_NULL_OR_FAULTY (A) ;
@@ -72,7 +78,6 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     // done after this check.
     GB_MATRIX_WAIT (A) ;
     GB_MATRIX_WAIT (B) ;
-
     // check the dimensions of C
     int64_t anrows = (A_transpose) ? GB_NCOLS (A) : GB_NROWS (A) ;
     int64_t ancols = (A_transpose) ? GB_NROWS (A) : GB_NCOLS (A) ;
@@ -100,6 +105,10 @@ GrB_Info GB_kron                    // C<M> = accum (C, kron(A,B))
     // delete any lingering zombies and assemble any pending tuples
     GB_MATRIX_WAIT (M) ;
 
+    // GB_kroner requires the pattern of A and B
+    GB_SPARSE_INPUT (A, A_sparse) ;
+    GB_SPARSE_INPUT (B, B_sparse) ;
+
     //--------------------------------------------------------------------------
     // transpose A and B if requested
     //--------------------------------------------------------------------------
@@ -12,17 +12,19 @@
 // different.  The type of C is the type of z.  C is hypersparse if either A
 // or B are hypersparse.
 
-// FUTURE: GB_kron would be faster with built-in types and operators.
-
-// FUTURE: at most one thread is used for each vector of C=kron(A,B).  The
-// matrix C is normally very large, but if both A and B are n-by-1, then C is
-// n^2-by-1 and only a single thread is used.  A better method for this case
-// would construct vectors of C in parallel.
-
-// FUTURE: each vector C(:,k) takes O(nnz(C(:,k))) work, but this is not
-// accounted for in the parallel load-balancing.
+// The entries of C are computed in parallel, with each task computing an equal
+// share of the entries of C, even if they all reside in a single vector of C
+// (if A and B are both n-by-1, for example).  Built-in types and operators
+// use the hard-coded workers in Generated/GB_binop__*; all other cases use
+// the generic worker with typecasting and an arbitrary operator.
 
 #include "GB_kron.h"
+#include "GB_binop.h"
+// define the static inline GB_search_for_vector for GB_kroner_template.c:
+#include "GB_search_for_vector_template.c"
+#ifndef GBCOMPACT
+#include "GB_binop__include.h"
+#endif
 
 GrB_Info GB_kroner                  // C = kron (A,B)
 (
@@ -56,8 +58,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     const int64_t *GB_RESTRICT Ap = A->p ;
     const int64_t *GB_RESTRICT Ah = A->h ;
-    const int64_t *GB_RESTRICT Ai = A->i ;
-    const GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
     const int64_t asize = A->type->size ;
     const int64_t avlen = A->vlen ;
     const int64_t avdim = A->vdim ;
@@ -66,8 +66,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     const int64_t *GB_RESTRICT Bp = B->p ;
     const int64_t *GB_RESTRICT Bh = B->h ;
-    const int64_t *GB_RESTRICT Bi = B->i ;
-    const GB_void *GB_RESTRICT Bx = (GB_void *) B->x ;
     const int64_t bsize = B->type->size ;
     const int64_t bvlen = B->vlen ;
     const int64_t bvdim = B->vdim ;
@@ -117,15 +115,6 @@ GrB_Info GB_kroner                  // C = kron (A,B)
 
     int64_t *GB_RESTRICT Cp = C->p ;
     int64_t *GB_RESTRICT Ch = C->h ;
-    int64_t *GB_RESTRICT Ci = C->i ;
-    GB_void *GB_RESTRICT Cx = (GB_void *) C->x ;
-    const int64_t csize = C->type->size ;
-
-    GxB_binary_function fmult = op->function ;
-
-    GB_cast_function
-        cast_A = GB_cast_factory (op->xtype->code, A->type->code),
-        cast_B = GB_cast_factory (op->ytype->code, B->type->code) ;
 
     //--------------------------------------------------------------------------
     // compute the column counts of C, and C->h if C is hypersparse
@@ -137,21 +126,18 @@ GrB_Info GB_kroner                  // C = kron (A,B)
     {
         int64_t kA = kC / bnvec ;
         int64_t kB = kC % bnvec ;
-
-            // get A(:,jA), the (kA)th vector of A
-            int64_t jA = (Ah == NULL) ? kA : Ah [kA] ;
-            int64_t aknz = Ap [kA+1] - Ap [kA] ;
-            // get B(:,jB), the (kB)th vector of B
-            int64_t jB = (Bh == NULL) ? kB : Bh [kB] ;
-            int64_t bknz = Bp [kB+1] - Bp [kB] ;
-            // determine # entries in C(:,jC), the (kC)th vector of C
-            // int64_t kC = kA * bnvec + kB ;
-            Cp [kC] = aknz * bknz ;
-            if (C_is_hyper)
-            { 
-                Ch [kC] = jA * bvdim + jB ;
-            }
-
+        // get A(:,jA), the (kA)th vector of A
+        int64_t jA = (Ah == NULL) ? kA : Ah [kA] ;
+        int64_t aknz = Ap [kA+1] - Ap [kA] ;
+        // get B(:,jB), the (kB)th vector of B
+        int64_t jB = (Bh == NULL) ? kB : Bh [kB] ;
+        int64_t bknz = Bp [kB+1] - Bp [kB] ;
+        // determine # entries in C(:,jC), the (kC)th vector of C
+        Cp [kC] = aknz * bknz ;
+        if (C_is_hyper)
+        { 
+            Ch [kC] = jA * bvdim + jB ;
+        }
     }
 
     //--------------------------------------------------------------------------
@@ -166,46 +152,83 @@ GrB_Info GB_kroner                  // C = kron (A,B)
     // C = kron (A,B)
     //--------------------------------------------------------------------------
 
-    #pragma omp parallel for num_threads(nthreads) schedule(guided)
-    for (kC = 0 ; kC < cnvec ; kC++)
-    {
-        int64_t kA = kC / bnvec ;
-        int64_t kB = kC % bnvec ;
+    // determine the number of tasks to use; each task computes an equal
+    // number of entries of C
+    int64_t cnz = Cp [cnvec] ;
+    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, cnz) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
 
-        // get B(:,jB), the (kB)th vector of B
-        int64_t pB_start = Bp [kB] ;
-        int64_t pB_end   = Bp [kB+1] ;
-        int64_t bknz = pB_start - pB_end ;
-        if (bknz == 0) continue ;
-        GB_void bwork [GB_VLA(bsize)] ;
+    bool done = false ;
 
-        // get C(:,jC), the (kC)th vector of C
-        // int64_t kC = kA * bnvec + kB ;
-        int64_t pC = Cp [kC] ;
+    #ifndef GBCOMPACT
 
-        // get A(:,jA), the (kA)th vector of A
-        int64_t pA_start = Ap [kA] ;
-        int64_t pA_end   = Ap [kA+1] ;
-        GB_void awork [GB_VLA(asize)] ;
-
-        for (int64_t pA = pA_start ; pA < pA_end ; pA++)
-        {
-            // awork = A(iA,jA), typecasted to op->xtype
-            int64_t iA = Ai [pA] ;
-            int64_t iAblock = iA * bvlen ;
-            cast_A (awork, Ax +(pA*asize), asize) ;
-            for (int64_t pB = pB_start ; pB < pB_end ; pB++)
-            { 
-                // bwork = B(iB,jB), typecasted to op->ytype
-                int64_t iB = Bi [pB] ;
-                cast_B (bwork, Bx +(pB*bsize), bsize) ;
-                // C(iC,jC) = A(iA,jA) * B(iB,jB)
-                int64_t iC = iAblock + iB ;
-                Ci [pC] = iC ;
-                fmult (Cx +(pC*csize), awork, bwork) ;
-                pC++ ;
-            }
+        //----------------------------------------------------------------------
+        // define the worker for the switch factory
+        //----------------------------------------------------------------------
+
+        #define GB_AkronB(mult,xname) GB_AkronB_ ## mult ## xname
+
+        #define GB_BINOP_WORKER(mult,xname)                             \
+        {                                                               \
+            info = GB_AkronB(mult,xname) (C, A, B, ntasks, nthreads) ;  \
+            done = (info != GrB_NO_VALUE) ;                             \
+        }                                                               \
+        break ;
+
+        //----------------------------------------------------------------------
+        // launch the switch factory
+        //----------------------------------------------------------------------
+
+        GB_Opcode opcode ;
+        GB_Type_code xcode, ycode, zcode ;
+
+        if (GB_binop_builtin (A->type, false, B->type, false,
+            op, false, &opcode, &xcode, &ycode, &zcode))
+        { 
+            #include "GB_binop_factory.c"
         }
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // generic worker: with typecasting and arbitrary operators
+    //--------------------------------------------------------------------------
+
+    if (!done)
+    { 
+        GB_BURBLE_MATRIX (C, "generic ") ;
+
+        GxB_binary_function fmult = op->function ;
+        const size_t csize = C->type->size ;
+        const size_t xsize = op->xtype->size ;
+        const size_t ysize = op->ytype->size ;
+        GB_cast_function cast_A_to_X, cast_B_to_Y ;
+        cast_A_to_X = GB_cast_factory (op->xtype->code, A->type->code) ;
+        cast_B_to_Y = GB_cast_factory (op->ytype->code, B->type->code) ;
+
+        // aij = (xtype) A(i,j), located in Ax [pA]
+        #define GB_GETA(aij,Ax,pA)                                          \
+            GB_void aij [GB_VLA(xsize)] ;                                   \
+            cast_A_to_X (aij, Ax +((pA)*asize), asize) ;
+
+        // bij = (ytype) B(i,j), located in Bx [pB]
+        #define GB_GETB(bij,Bx,pB)                                          \
+            GB_void bij [GB_VLA(ysize)] ;                                   \
+            cast_B_to_Y (bij, Bx +((pB)*bsize), bsize) ;
+
+        // C(i,j) = A(i,j) * B(i,j)
+        #define GB_BINOP(cij, aij, bij)                                     \
+            fmult (cij, aij, bij) ;
+
+        // address of Cx [p]
+        #define GB_CX(p) Cx +((p)*csize)
+
+        #define GB_ATYPE GB_void
+        #define GB_BTYPE GB_void
+        #define GB_CTYPE GB_void
+
+        #include "GB_kroner_template.c"
     }
 
     //--------------------------------------------------------------------------
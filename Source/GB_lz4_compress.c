@@ -0,0 +1,158 @@
+//------------------------------------------------------------------------------
+// GB_lz4_compress: compress a single block with an LZ4-style method
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A greedy LZ77 compressor with a single-probe hash table of 4-byte
+// sequences, using the LZ4 block format: each sequence is a token byte (the
+// high 4 bits hold the # of literals and the low 4 bits hold the match length
+// minus 4, with 15 meaning more bytes follow), the literals, a 2-byte
+// little-endian match offset, and any extra match-length bytes.  The last
+// sequence holds only literals, and the last 5 bytes of the input are always
+// literals.
+
+// The input block must be no larger than 2^31 bytes (GB_BLOB_BLOCKSIZE is
+// much smaller).  Returns the compressed size, or zero if the block does not
+// compress to fewer than n bytes, in which case the caller stores it as-is.
+
+#include "GB_serialize.h"
+
+#define GB_LZ4_HASHLOG      12
+#define GB_LZ4_MINMATCH     4
+#define GB_LZ4_LASTLITERALS 5
+#define GB_LZ4_MFLIMIT      12
+#define GB_LZ4_MAXOFFSET    65535
+
+// hash a 4-byte sequence
+#define GB_LZ4_HASH(seq) \
+    ((uint32_t) ((seq) * 2654435761U) >> (32 - GB_LZ4_HASHLOG))
+
+// read 4 bytes (unaligned)
+#define GB_LZ4_READ32(p,x) memcpy (&(x), (p), sizeof (uint32_t))
+
+// write a length of 15 or more, in the extra bytes after the token
+#define GB_LZ4_WRITE_LENGTH(len)                                    \
+{                                                                   \
+    int64_t r = (len) - 15 ;                                        \
+    for ( ; r >= 255 ; r -= 255)                                    \
+    {                                                               \
+        if (op >= dst_capacity) return (0) ;                        \
+        dst [op++] = 255 ;                                          \
+    }                                                               \
+    if (op >= dst_capacity) return (0) ;                            \
+    dst [op++] = (GB_void) r ;                                      \
+}
+
+int64_t GB_lz4_compress     // return compressed size, or 0 if not compressible
+(
+    GB_void *GB_RESTRICT dst,       // output, of size dst_capacity
+    int64_t dst_capacity,
+    const GB_void *GB_RESTRICT src, // input, of size n
+    int64_t n
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (dst != NULL && src != NULL) ;
+    ASSERT (n >= 0 && n <= INT32_MAX) ;
+
+    // only a compressed result smaller than the input is useful
+    dst_capacity = GB_IMIN (dst_capacity, n - 1) ;
+    if (n <= GB_LZ4_MFLIMIT || dst_capacity <= 0)
+    {
+        // too small to compress
+        return (0) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress the block
+    //--------------------------------------------------------------------------
+
+    int32_t Table [1 << GB_LZ4_HASHLOG] ;
+    memset (Table, 0xFF, sizeof (Table)) ;     // all entries -1
+
+    int64_t ip = 0 ;            // current position in src
+    int64_t anchor = 0 ;        // start of the pending literals
+    int64_t op = 0 ;            // current position in dst
+    int64_t mflimit = n - GB_LZ4_MFLIMIT ;
+    int64_t matchlimit = n - GB_LZ4_LASTLITERALS ;
+
+    while (ip < mflimit)
+    {
+
+        //----------------------------------------------------------------------
+        // look for a match of the 4 bytes at src [ip]
+        //----------------------------------------------------------------------
+
+        uint32_t seq, ref_seq ;
+        GB_LZ4_READ32 (src + ip, seq) ;
+        uint32_t h = GB_LZ4_HASH (seq) ;
+        int64_t ref = Table [h] ;
+        Table [h] = (int32_t) ip ;
+        if (ref < 0 || ip - ref > GB_LZ4_MAXOFFSET)
+        {
+            ip++ ;
+            continue ;
+        }
+        GB_LZ4_READ32 (src + ref, ref_seq) ;
+        if (ref_seq != seq)
+        {
+            ip++ ;
+            continue ;
+        }
+
+        //----------------------------------------------------------------------
+        // extend the match
+        //----------------------------------------------------------------------
+
+        int64_t mlen = GB_LZ4_MINMATCH ;
+        while (ip + mlen < matchlimit && src [ref + mlen] == src [ip + mlen])
+        {
+            mlen++ ;
+        }
+
+        //----------------------------------------------------------------------
+        // emit the sequence: literals src [anchor:ip-1] and the match
+        //----------------------------------------------------------------------
+
+        int64_t litlen = ip - anchor ;
+        int64_t mcode = mlen - GB_LZ4_MINMATCH ;
+        if (op >= dst_capacity) return (0) ;
+        int64_t ptoken = op++ ;
+        dst [ptoken] = (GB_void)
+            (((litlen < 15) ? litlen : 15) << 4 | ((mcode < 15) ? mcode : 15)) ;
+        if (litlen >= 15) GB_LZ4_WRITE_LENGTH (litlen) ;
+        if (op + litlen + 2 > dst_capacity) return (0) ;
+        memcpy (dst + op, src + anchor, litlen) ;
+        op += litlen ;
+        int64_t offset = ip - ref ;
+        dst [op++] = (GB_void) (offset & 0xFF) ;
+        dst [op++] = (GB_void) (offset >> 8) ;
+        if (mcode >= 15) GB_LZ4_WRITE_LENGTH (mcode) ;
+
+        ip += mlen ;
+        anchor = ip ;
+    }
+
+    //--------------------------------------------------------------------------
+    // emit the last literals
+    //--------------------------------------------------------------------------
+
+    int64_t litlen = n - anchor ;
+    if (op >= dst_capacity) return (0) ;
+    dst [op++] = (GB_void) (((litlen < 15) ? litlen : 15) << 4) ;
+    if (litlen >= 15) GB_LZ4_WRITE_LENGTH (litlen) ;
+    if (op + litlen > dst_capacity) return (0) ;
+    memcpy (dst + op, src + anchor, litlen) ;
+    op += litlen ;
+
+    return (op) ;
+}
+
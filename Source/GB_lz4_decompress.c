@@ -0,0 +1,85 @@
+//------------------------------------------------------------------------------
+// GB_lz4_decompress: decompress a single block compressed by GB_lz4_compress
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The input is untrusted (it may come from a corrupted file), so every read
+// of src and every write to dst is checked.  Returns false if the compressed
+// block is invalid, or if it does not decompress to exactly dst_size bytes.
+
+#include "GB_serialize.h"
+
+// read a length of 15 or more, from the extra bytes after the token
+#define GB_LZ4_READ_LENGTH(len)                                     \
+{                                                                   \
+    GB_void b ;                                                     \
+    do                                                              \
+    {                                                               \
+        if (ip >= src_size) return (false) ;                        \
+        b = src [ip++] ;                                            \
+        len += b ;                                                  \
+    }                                                               \
+    while (b == 255) ;                                              \
+}
+
+bool GB_lz4_decompress      // return true if successful
+(
+    GB_void *GB_RESTRICT dst,       // output, of size exactly dst_size
+    int64_t dst_size,
+    const GB_void *GB_RESTRICT src, // compressed input, of size src_size
+    int64_t src_size
+)
+{
+
+    int64_t ip = 0 ;            // current position in src
+    int64_t op = 0 ;            // current position in dst
+
+    while (true)
+    {
+
+        //----------------------------------------------------------------------
+        // get the token and copy the literals
+        //----------------------------------------------------------------------
+
+        if (ip >= src_size) return (false) ;
+        int token = src [ip++] ;
+        int64_t litlen = token >> 4 ;
+        if (litlen == 15) GB_LZ4_READ_LENGTH (litlen) ;
+        if (litlen > src_size - ip || litlen > dst_size - op) return (false) ;
+        memcpy (dst + op, src + ip, litlen) ;
+        ip += litlen ;
+        op += litlen ;
+
+        if (ip == src_size)
+        {
+            // the last sequence has no match
+            break ;
+        }
+
+        //----------------------------------------------------------------------
+        // copy the match, which may overlap the output
+        //----------------------------------------------------------------------
+
+        if (ip + 2 > src_size) return (false) ;
+        int64_t offset = ((int64_t) src [ip]) | (((int64_t) src [ip+1]) << 8) ;
+        ip += 2 ;
+        if (offset == 0 || offset > op) return (false) ;
+        int64_t mlen = token & 15 ;
+        if (mlen == 15) GB_LZ4_READ_LENGTH (mlen) ;
+        mlen += 4 ;
+        if (mlen > dst_size - op) return (false) ;
+        const GB_void *match = dst + op - offset ;
+        for (int64_t k = 0 ; k < mlen ; k++)
+        {
+            dst [op + k] = match [k] ;
+        }
+        op += mlen ;
+    }
+
+    return (op == dst_size) ;
+}
+
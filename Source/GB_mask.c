@@ -115,6 +115,7 @@
     GB_MATRIX_FREE (Zhandle) ;          \
     GB_MATRIX_FREE (&C_cleared) ;       \
     GB_MATRIX_FREE (&R) ;               \
+    GB_MATRIX_FREE (&M_sparse) ;        \
 }
 
 //------------------------------------------------------------------------------
@@ -122,7 +123,7 @@
 GrB_Info GB_mask                // C<M> = Z
 (
     GrB_Matrix C_result,        // both input C and result matrix
-    const GrB_Matrix M,         // optional mask matrix, can be NULL
+    const GrB_Matrix M_in,      // optional mask matrix, can be NULL
     GrB_Matrix *Zhandle,        // Z = results of computation, perhaps shallow.
                                 // Z is freed when done.
     const bool C_replace,       // true if clear(C) to be done first
@@ -137,6 +138,8 @@ GrB_Info GB_mask                // C<M> = Z
     //--------------------------------------------------------------------------
 
     // C_result may be aliased with M
+    GrB_Matrix M = M_in ;
+    GrB_Matrix M_sparse = NULL ;
     ASSERT_MATRIX_OK (C_result, "C_result for GB_mask", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_mask", GB0) ;
 
@@ -192,9 +195,12 @@ GrB_Info GB_mask                // C<M> = Z
             // C_result = Z, but make sure a deep copy is made as needed.  It is
             // possible that Z is a shallow copy of another matrix.
             // Z is freed by GB_transplant_conform.
-            ASSERT (C_result->p != NULL) ;
-            ASSERT (!C_result->p_shallow) ;
-            ASSERT (!C_result->h_shallow) ;
+            // C_result can only be shallow if it is from
+            // GxB_Matrix_import_mmap; its content is freed by GB_transplant.
+            ASSERT (C_result->p != NULL || GB_IS_FULL (C_result)
+                || GB_IS_BITMAP (C_result)) ;
+            ASSERT (!C_result->p_shallow || C_result->mmap_base != NULL) ;
+            ASSERT (!C_result->h_shallow || C_result->mmap_base != NULL) ;
 
             // transplant Z into C_result and conform to desired hypersparsity
             return (GB_transplant_conform (C_result, C_result->type, Zhandle,
@@ -246,6 +252,16 @@ GrB_Info GB_mask                // C<M> = Z
         // delete any lingering zombies and assemble any pending tuples
         GB_MATRIX_WAIT (M) ;
 
+        // the masker requires the pattern of Z, and of M unless M is bitmap,
+        // since each M(i,j) of a bitmap M is found in O(1) time.  If M is full
+        // and aliased with C_result, M_sparse remains aliased with C_result,
+        // since its values are a shallow copy of M->x.
+        if (!GB_IS_BITMAP (M))
+        { 
+            GB_SPARSE_INPUT (M, M_sparse) ;
+        }
+        GB_ENSURE_SPARSE (Z) ;
+
         // R has the same CSR/CSC format as C_result.  It is hypersparse if
         // both C and Z are hypersparse.
 
@@ -284,6 +300,7 @@ GrB_Info GB_mask                // C<M> = Z
 
             // delete any lingering zombies and assemble any pending tuples
             GB_MATRIX_WAIT (C) ;
+            GB_ENSURE_SPARSE (C) ;
         }
 
         // no more zombies or pending tuples in M or C
@@ -301,11 +318,12 @@ GrB_Info GB_mask                // C<M> = Z
             Context)) ;
 
         //----------------------------------------------------------------------
-        // free temporary matrices Z and C_cleared
+        // free temporary matrices Z, C_cleared, and M_sparse
         //----------------------------------------------------------------------
 
         GB_MATRIX_FREE (Zhandle) ;
         GB_MATRIX_FREE (&C_cleared) ;
+        GB_MATRIX_FREE (&M_sparse) ;
 
         //----------------------------------------------------------------------
         // transplant the result, conform, and free R
@@ -14,7 +14,7 @@
 GrB_Info GB_mask                // C<M> = Z
 (
     GrB_Matrix C_result,        // both input C and result matrix
-    const GrB_Matrix M,         // optional mask matrix, can be NULL
+    const GrB_Matrix M_in,      // optional mask matrix, can be NULL
     GrB_Matrix *Zhandle,        // Z = results of computation, perhaps shallow.
                                 // Z is freed when done.
     const bool C_replace,       // true if clear(C) to be done first
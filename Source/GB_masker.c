@@ -112,13 +112,15 @@ GrB_Info GB_masker          // R = masker (M, C, Z)
     // phase0b: split C into tasks for phase1 and phase2
     //--------------------------------------------------------------------------
 
+    // A bitmap M is not sliced, since each M(i,j) is found in O(1) time.
+
     info = GB_ewise_slice (
         // computed by phase0b
         &TaskList, &max_ntasks, &ntasks, &nthreads,
         // computed by phase0:
         Rnvec, Rh, R_to_M, R_to_C, R_to_Z, false,
         // original input:
-        M, C, Z, Context) ;
+        GB_IS_BITMAP (M) ? NULL : M, C, Z, Context) ;
 
     if (info != GrB_SUCCESS)
     { 
@@ -72,9 +72,11 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     // print the header
     //--------------------------------------------------------------------------
 
-    GBPR0 (", %s", A->is_hyper ?
+    bool A_is_full = GB_IS_FULL (A) ;
+    bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    GBPR0 (", %s", A_is_full ? "full" : A_is_bitmap ? "bitmap" : (A->is_hyper ?
             (A->is_slice ? "hyperslice" : "hypersparse") :
-            (A->is_slice ? "slice" : "sparse")) ;
+            (A->is_slice ? "slice" : "sparse"))) ;
     GBPR0 (" %s:\n", A->is_csc ? "by col" : "by row") ;
 
     #if GB_DEVELOPER
@@ -235,7 +237,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     // check p
     //--------------------------------------------------------------------------
 
-    if (A->p == NULL)
+    if (A->p == NULL && !A_is_full && !A_is_bitmap)
     { 
         GBPR0 ("  ->p is NULL, invalid %s\n", kind) ;
         return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
@@ -331,25 +333,79 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     // check a non-empty matrix
     //--------------------------------------------------------------------------
 
-    if (!A_empty && A->i == NULL)
+    if (!A_empty && A->i == NULL && !A_is_full && !A_is_bitmap)
     { 
         GBPR0 ("  ->i is NULL, invalid %s\n", kind) ;
         return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
             "%s contains a NULL A->i pointer: [%s]", kind, GB_NAME))) ;
     }
 
+    //--------------------------------------------------------------------------
+    // check a full matrix
+    //--------------------------------------------------------------------------
+
+    if (A_is_full && (A->is_hyper || A->is_slice || A->Pending != NULL
+        || A->nzombies != 0 || A->jumbled || A->nzmax < A->vlen * A->vdim))
+    { 
+        GBPR0 ("  invalid full %s\n", kind) ;
+        return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+            "invalid full %s: [%s]", kind, GB_NAME))) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // check a bitmap matrix
+    //--------------------------------------------------------------------------
+
+    if (A_is_bitmap)
+    {
+        if (A->p != NULL || A->h != NULL || A->i != NULL || A->x == NULL
+            || A->is_hyper || A->is_slice || A->Pending != NULL
+            || A->nzombies != 0 || A->jumbled || A->nzmax < A->vlen * A->vdim)
+        { 
+            GBPR0 ("  invalid bitmap %s\n", kind) ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "invalid bitmap %s: [%s]", kind, GB_NAME))) ;
+        }
+        int64_t nvals = 0 ;
+        for (int64_t p = 0 ; p < A->vlen * A->vdim ; p++)
+        {
+            int8_t ab = A->b [p] ;
+            if (ab != 0 && ab != 1)
+            { 
+                GBPR0 ("  ->b [" GBd "] = %d invalid\n", p, (int) ab) ;
+                return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                    "%s A->b [" GBd "] = %d invalid: [%s]",
+                    kind, p, (int) ab, GB_NAME))) ;
+            }
+            nvals += ab ;
+        }
+        if (nvals != A->nvals)
+        { 
+            GBPR0 ("  invalid bitmap count: " GBd " exist but"
+                " A->nvals = " GBd "\n", nvals, A->nvals) ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "%s invalid bitmap count: " GBd " exist but A->nvals = " GBd
+                " [%s]", kind, nvals, A->nvals, GB_NAME))) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // check the content of p
     //--------------------------------------------------------------------------
 
-    if (A->is_slice ? (A->p [0] < 0) : (A->p [0] != 0))
+    if (A_is_full || A_is_bitmap)
+    { 
+        // a full or bitmap matrix has no A->p
+        ;
+    }
+    else if (A->is_slice ? (A->p [0] < 0) : (A->p [0] != 0))
     { 
         GBPR0 ("  ->p [0] = " GBd " invalid\n", A->p [0]) ;
         return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
             "%s A->p [0] = " GBd " invalid: [%s]", kind, A->p [0], GB_NAME))) ;
     }
 
-    for (int64_t j = 0 ; j < A->nvec ; j++)
+    for (int64_t j = 0 ; j < A->nvec && !A_is_full && !A_is_bitmap ; j++)
     {
         if (A->p [j+1] < A->p [j] || A->p [j+1] > A->nzmax)
         { 
@@ -426,6 +482,12 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
             A->nzombies) ;
     }
 
+    if (A->jumbled)
+    { 
+        // the indices in each vector of A may appear in any order
+        GBPR0 ("  jumbled\n") ;
+    }
+
     if (!ignore_zombies && (A->nzombies < 0 || A->nzombies > anz))
     { 
         GBPR0 ("  invalid number of zombies: " GBd " "
@@ -448,6 +510,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
     bool jumbled = false ;
     int64_t nzombies = 0 ;
     int64_t jcount = 0 ;
+    int64_t nz = 0 ;
     bool truncated = false ;
 
     GBI_for_each_vector (A)
@@ -455,6 +518,10 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
         int64_t ilast = -1 ;
         GBI_for_each_entry (j, p, pend)
         {
+            // skip any entry not present in a bitmap matrix
+            if (A_is_bitmap && !A->b [p]) continue ;
+            // pbrief: the position of the entry, if all entries were packed
+            int64_t pbrief = A_is_bitmap ? (nz++) : p ;
             bool prcol = ((pr_short && jcount < GB_NBRIEF) || pr_complete) ;
             if (ilast == -1)
             {
@@ -475,13 +542,13 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
                 }
                 jcount++ ;      // count # of vectors printed so far
             }
-            int64_t i = A->i [p] ;
+            int64_t i = GBI (A->i, p, A->vlen) ;
             bool is_zombie = GB_IS_ZOMBIE (i) ;
             i = GB_UNFLIP (i) ;
             if (is_zombie) nzombies++ ;
             if (prcol)
             { 
-                if ((pr_short && p < GB_NZBRIEF) || pr_complete)
+                if ((pr_short && pbrief < GB_NZBRIEF) || pr_complete)
                 { 
                     #if GB_DEVELOPER
                     GBPR ("    %s " GBd ": ", A->is_csc ? "row":"column", i) ;
@@ -496,7 +563,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
                     }
                     #endif
                 }
-                else if (pr_short && (ilast == -1 || p == GB_NZBRIEF))
+                else if (pr_short && (ilast == -1 || pbrief == GB_NZBRIEF))
                 { 
                     truncated = true ;
                     #if GB_DEVELOPER
@@ -516,7 +583,7 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
 
             // print the value
             bool print_value = prcol &&
-                ((pr_short && p < GB_NZBRIEF) || pr_complete) ;
+                ((pr_short && pbrief < GB_NZBRIEF) || pr_complete) ;
             if (print_value)
             { 
                 if (is_zombie)
@@ -532,9 +599,10 @@ GrB_Info GB_matvec_check    // check a GraphBLAS matrix or vector
                 }
             }
 
-            if (i <= ilast)
+            if (i <= ilast && !(A->jumbled))
             { 
-                // indices unsorted, or duplicates present
+                // indices unsorted, or duplicates present, but A->jumbled
+                // is not set
                 GBPR0 (" index (" GBd "," GBd ") jumbled", row, col) ;
                 jumbled = true ;
                 print_value = (!pr_silent) ;
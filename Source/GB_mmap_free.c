@@ -0,0 +1,39 @@
+//------------------------------------------------------------------------------
+// GB_mmap_free: release the file mapping of a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A matrix created by GxB_Matrix_import_mmap owns a private mapping of its
+// file.  The mapping is released here, once none of the components of A point
+// into it.  Nothing is done if A has no mapping.
+
+#include "GB.h"
+#if !GB_MICROSOFT
+#include <sys/mman.h>
+#endif
+
+void GB_mmap_free               // release the file mapping of a matrix
+(
+    GrB_Matrix A                // matrix with mapping to release
+)
+{
+
+    if (A == NULL || A->mmap_base == NULL)
+    { 
+        return ;
+    }
+
+    ASSERT (!A->p_shallow && !A->h_shallow) ;
+    ASSERT (!A->i_shallow && !A->x_shallow) ;
+
+    #if !GB_MICROSOFT
+    munmap (A->mmap_base, A->mmap_size) ;
+    #endif
+    A->mmap_base = NULL ;
+    A->mmap_size = 0 ;
+}
+
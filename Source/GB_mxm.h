@@ -170,8 +170,12 @@ GrB_Info GB_AxB_dot3_slice
     int *p_max_ntasks,              // size of TaskList
     int *p_ntasks,                  // # of tasks constructed
     int *p_nthreads,                // # of threads to use
+    int *p_nfine,                   // # of ultra-fine tasks constructed
     // input:
     const GrB_Matrix C,             // matrix to slice
+    const GrB_Matrix M,             // mask matrix; C has the same pattern
+    const GrB_Matrix A,             // input matrix, for C<M>=A'*B
+    const GrB_Matrix B,             // input matrix
     GB_Context Context
 ) ;
 
@@ -198,7 +202,17 @@ GrB_Info GB_AxB_saxpy3              // C = A*B using Gustavson+Hash
     const GrB_Semiring semiring,    // semiring that defines C=A*B
     const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     bool *mask_applied,             // if true, then mask was applied
-    const GrB_Desc_Value AxB_method,    // Default, Gustavson, or Hash
+    const GrB_Desc_Value AxB_method,    // Default, Gustavson, Hash, or Heap
+    GB_Context Context
+) ;
+
+GrB_Info GB_AxB_outer               // C = A*B' via outer products
+(
+    GrB_Matrix *Chandle,            // output matrix
+    const GrB_Matrix A,             // input matrix A
+    const GrB_Matrix B,             // input matrix B, not transposed
+    const GrB_Semiring semiring,    // semiring that defines C=A*B'
+    const bool flipxy,              // if true, do z=fmult(b,a) vs fmult(a,b)
     GB_Context Context
 ) ;
 
@@ -115,6 +115,11 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     }
     A->is_hyper = is_hyper ;
 
+    // sparsity control: the matrix is never created in bitmap or full
+    // format, but it may be converted later on, if permitted by A->sparsity
+    A->sparsity = GB_Global_sparsity_get ( ) ;
+    A->bitmap_switch = GB_Global_bitmap_switch_get ( ) ;
+
     // matrix dimensions
     A->vlen = vlen ;
     A->vdim = vdim ;
@@ -144,11 +149,21 @@ GrB_Info GB_new                 // create matrix, except for indices & values
     A->i = NULL ;
     A->x = NULL ;
     A->nzmax = 0 ;              // GB_NNZ(A) checks nzmax==0 before Ap[nvec]
+    A->b = NULL ;
+    A->nvals = 0 ;
     A->i_shallow = false ;
     A->x_shallow = false ;
     A->nzombies = 0 ;
+    A->jumbled = false ;
     A->Pending = NULL ;
 
+    // the slots for concurrent insertion are kept if the header is reused
+    if (allocated_header)
+    { 
+        A->Pending_slots = NULL ;
+        A->Pending_slots_used = false ;
+    }
+
     A->queue_next = NULL ;      // TODO in 4.0: delete
     A->queue_prev = NULL ;      // TODO in 4.0: delete
     A->enqueued = false ;       // TODO in 4.0: delete
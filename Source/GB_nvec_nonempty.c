@@ -36,6 +36,12 @@ int64_t GB_nvec_nonempty        // return # of non-empty vectors
         return (0) ;
     }
 
+    if (GB_IS_FULL (A))
+    { 
+        // all vectors of a full matrix are non-empty
+        return (A->vdim) ;
+    }
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -51,13 +57,36 @@ int64_t GB_nvec_nonempty        // return # of non-empty vectors
 
     int64_t nvec_nonempty = 0 ;
     const int64_t *GB_RESTRICT Ap = A->p ;
+    const int8_t  *GB_RESTRICT Ab = A->b ;
+    const int64_t avlen = A->vlen ;
 
     int64_t k ;
-    #pragma omp parallel for num_threads(nthreads) schedule(static) \
-            reduction(+:nvec_nonempty)
-    for (k = 0 ; k < anvec ; k++)
-    { 
-        if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+    if (Ab != NULL)
+    {
+        // A is bitmap: A(:,k) is non-empty if any entry in it is present
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:nvec_nonempty)
+        for (k = 0 ; k < anvec ; k++)
+        {
+            const int8_t *GB_RESTRICT Abk = Ab + k * avlen ;
+            for (int64_t i = 0 ; i < avlen ; i++)
+            {
+                if (Abk [i])
+                { 
+                    nvec_nonempty++ ;
+                    break ;
+                }
+            }
+        }
+    }
+    else
+    {
+        #pragma omp parallel for num_threads(nthreads) schedule(static) \
+                reduction(+:nvec_nonempty)
+        for (k = 0 ; k < anvec ; k++)
+        { 
+            if (Ap [k] < Ap [k+1]) nvec_nonempty++ ;
+        }
     }
 
     ASSERT (nvec_nonempty >= 0 && nvec_nonempty <= A->vdim) ;
@@ -19,6 +19,11 @@
 
 typedef struct GB_Pending_struct *GB_Pending ;
 
+// A matrix that allows concurrent insertion via GrB_setElement holds a set of
+// additional lists of pending tuples, one per slot, so that user threads can
+// append to them without contending for a single list.
+typedef struct GB_Pending_slot_struct *GB_Pending_slots ;
+
 //------------------------------------------------------------------------------
 // type codes for GrB_Type
 //------------------------------------------------------------------------------
@@ -338,6 +343,7 @@ struct GB_Descriptor_opaque // content of GrB_Descriptor
     double chunk ;          // chunk size for # of threads for small problems
     bool predefined ;       // if true, descriptor is predefined
     bool use_mkl ;          // if true, use the Intel MKL
+    GrB_Desc_Value compression ;    // compression method for serialize
 } ;
 
 #endif
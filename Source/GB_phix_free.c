@@ -22,6 +22,8 @@ GrB_Info GB_phix_free           // free all content of a matrix
 { 
 
     GB_ph_free (A) ;
-    return (GB_ix_free (A)) ;
+    GrB_Info info = GB_ix_free (A) ;
+    GB_mmap_free (A) ;
+    return (info) ;
 }
 
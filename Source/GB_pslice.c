@@ -11,7 +11,9 @@
 // slices Ap so that each chunk has the same number of total values of its
 // entries.  Ap can be A->p for a matrix and then n = A->nvec.  Or it can be
 // the work needed for computing each vector of a matrix (see GB_ewise_slice
-// and GB_subref_slice, for example).
+// and GB_subref_slice, for example).  If Ap is NULL, the matrix is full and
+// every vector has the same number of entries, so the vectors 0:n-1 are
+// partitioned uniformly.
 
 #include "GB.h"
 
@@ -46,7 +48,15 @@ bool GB_pslice          // slice Ap; return true if ok, false if out of memory
     const double work = (Ap == NULL) ? 0 : Ap [n] ;
 
     Slice [0] = 0 ;
-    if (Ap == NULL || n == 0 || ntasks <= 1 || work == 0)
+    if (Ap == NULL && n > 0 && ntasks > 1)
+    {
+        // A is full: slice the vectors uniformly
+        for (int taskid = 1 ; taskid < ntasks ; taskid++)
+        { 
+            Slice [taskid] = GB_PART (taskid, n, ntasks) ;
+        }
+    }
+    else if (Ap == NULL || n == 0 || ntasks <= 1 || work == 0)
     {
         // matrix is empty, or a single thread is used
         for (int taskid = 1 ; taskid < ntasks ; taskid++)
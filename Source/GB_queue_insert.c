@@ -7,11 +7,11 @@ GB_PUBLIC
 bool GB_queue_insert (GrB_Matrix A)
 {
     bool ok = true ;
-    if ((A->Pending != NULL || A->nzombies > 0) && !(A->enqueued))
+    if ((GB_PENDING (A) || A->nzombies > 0) && !(A->enqueued))
     {
         #define GB_CRITICAL_SECTION                                         \
         {                                                                   \
-            if ((A->Pending != NULL || A->nzombies > 0) && !(A->enqueued))  \
+            if ((GB_PENDING (A) || A->nzombies > 0) && !(A->enqueued))      \
             {                                                               \
                 GrB_Matrix Head = (GrB_Matrix) (GB_Global_queue_head_get ( )) ;\
                 A->queue_next = Head ;                                      \
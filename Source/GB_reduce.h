@@ -17,7 +17,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     const GrB_Type ctype,       // the type of scalar, c
     const GrB_BinaryOp accum,   // for c = accum(c,s)
     const GrB_Monoid reduce,    // monoid to do the reduction
-    const GrB_Matrix A,         // matrix to reduce
+    const GrB_Matrix A_in,      // matrix to reduce
     GB_Context Context
 ) ;
 
@@ -28,7 +28,7 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     const GrB_BinaryOp accum,       // optional accum for z=accum(C,T)
     const GrB_BinaryOp reduce,      // reduce operator for T=reduce(A)
     const GB_void *terminal,        // for early exit (NULL if none)
-    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix A_in,          // first input:  matrix A
     const GrB_Descriptor desc,      // descriptor for C, M, and A
     GB_Context Context
 ) ;
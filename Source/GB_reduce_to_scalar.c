@@ -20,7 +20,7 @@
 #include "GB_red__include.h"
 #endif
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_MATRIX_FREE (&A_sparse) ;
 
 GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
 (
@@ -28,7 +28,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     const GrB_Type ctype,       // the type of scalar, c
     const GrB_BinaryOp accum,   // for c = accum(c,s)
     const GrB_Monoid reduce,    // monoid to do the reduction
-    const GrB_Matrix A,         // matrix to reduce
+    const GrB_Matrix A_in,      // matrix to reduce
     GB_Context Context
 )
 {
@@ -38,6 +38,8 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     //--------------------------------------------------------------------------
 
     GrB_Info info ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
     GB_RETURN_IF_NULL_OR_FAULTY (reduce) ;
     GB_RETURN_IF_FAULTY (accum) ;
     GB_RETURN_IF_NULL (c) ;
@@ -65,7 +67,12 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
-    GB_MATRIX_WAIT (A) ;
+    // A can be left jumbled, since the reduction does not depend on the
+    // order of its entries
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+
+    // the values of a bitmap matrix are not contiguous
+    GB_SPARSE_OR_FULL_INPUT (A, A_sparse) ;
 
     //--------------------------------------------------------------------------
     // get A
@@ -111,6 +118,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     if (W == NULL)
     { 
         // out of memory
+        GB_FREE_ALL ;
         return (GB_OUT_OF_MEMORY) ;
     }
 
@@ -323,6 +331,7 @@ GrB_Info GB_reduce_to_scalar    // s = reduce_to_scalar (A)
     //--------------------------------------------------------------------------
 
     GB_FREE (W) ;
+    GB_FREE_ALL ;
     return (GrB_SUCCESS) ;
 }
 
@@ -7,10 +7,14 @@
 
 //------------------------------------------------------------------------------
 
-// CALLS:     GB_build
+// CALLS:     GB_build (only if A is very sparse)
 
 // C<M> = accum (C,reduce(A)) where C is n-by-1.  Reduces a matrix A or A'
-// to a vector.
+// to a vector.  Each vector of A is reduced to a scalar directly, with
+// GB_reduce_each_vector.  Reducing across the vectors of A is done with
+// GB_reduce_each_index, which reduces the entries into a dense workspace with
+// all threads, unless A is so sparse that the qsort method via GB_build is
+// used instead.
 
 #include "GB_reduce.h"
 #include "GB_binop.h"
@@ -32,6 +36,7 @@
 {                               \
     GB_FREE_WORK ;              \
     GB_MATRIX_FREE (&T) ;       \
+    GB_MATRIX_FREE (&A_sparse) ;\
 }
 
 GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
@@ -41,7 +46,7 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     const GrB_BinaryOp accum,       // optional accum for z=accum(C,T)
     const GrB_BinaryOp reduce,      // reduce operator for T=reduce(A)
     const GB_void *terminal,        // for early exit (NULL if none)
-    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix A_in,          // first input:  matrix A
     const GrB_Descriptor desc,      // descriptor for C, M, and A
     GB_Context Context
 )
@@ -56,17 +61,19 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     GB_RETURN_IF_NULL_OR_FAULTY (C) ;
     GB_RETURN_IF_FAULTY (M) ;
     GB_RETURN_IF_FAULTY (accum) ;
-    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A_in) ;
     GB_RETURN_IF_FAULTY (desc) ;
 
     ASSERT_MATRIX_OK (C, "C input for reduce_BinaryOp", GB0) ;
     ASSERT_MATRIX_OK_OR_NULL (M, "M for reduce_BinaryOp", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for reduce_BinaryOp", GB0) ;
     ASSERT_BINARYOP_OK (reduce, "reduce for reduce_BinaryOp", GB0) ;
-    ASSERT_MATRIX_OK (A, "A input for reduce_BinaryOp", GB0) ;
+    ASSERT_MATRIX_OK (A_in, "A input for reduce_BinaryOp", GB0) ;
     ASSERT_DESCRIPTOR_OK_OR_NULL (desc, "desc for reduce_BinaryOp", GB0) ;
 
     GrB_Matrix T = NULL ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
     int ntasks = 0 ;
     size_t zsize = 0 ;
     int64_t *pstart_slice = NULL, *kfirst_slice = NULL, *klast_slice = NULL ;
@@ -136,8 +143,13 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     // delete any lingering zombies and assemble any pending tuples
     //--------------------------------------------------------------------------
 
+    // A can be left jumbled, since the reduction of each vector does not
+    // depend on the order of its entries, and the reduction across vectors
+    // either reduces the entries into a dense workspace, or uses GB_build,
+    // which sorts the tuples
     GB_MATRIX_WAIT (M) ;
-    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+    GB_SPARSE_INPUT (A, A_sparse) ;
 
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format of A
@@ -411,7 +423,8 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
         // non-hypersparse and O(anz) if hypersparse.  This does not depend on
         // A->vlen.  So if the vector length is really huge (when anz << n),
         // the bucket method would fail.  Thus, the qsort method, below, is
-        // used when A is very sparse.
+        // used when A is very sparse.  Otherwise, the entries are reduced
+        // directly into a dense workspace of size n, with no tuple list.
 
         if (GB_CHOOSE_QSORT_INSTEAD_OF_BUCKET (anz, n))
         { 
@@ -455,13 +468,13 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
             //------------------------------------------------------------------
 
             // Determine number of threads to use for constructing the buckets.
-            // Each thread requires O(n) workspace, so this method does not
-            // scale well when there are many threads compared to anz.  Total
-            // workspace is O(n*ntasks), so limit the # of threads used so that
-            // at most anz workspace is used.  Each thread takes a single task.
+            // All threads share a single O(n) workspace, which is split into
+            // panels of indices, each reduced by a single thread, so no
+            // atomics are needed.  Total workspace is O(n+anz), regardless of
+            // the number of threads.  Each thread takes a single slice of the
+            // entries of A.
 
-            ntasks = (n > 0) ? (anz / n) : 1 ;
-            ntasks = GB_IMIN (ntasks, nthreads) ;
+            ntasks = GB_IMIN (nthreads, anz) ;
             ntasks = GB_IMAX (ntasks, 1) ;
             int nth = ntasks ;      // one thread per task
 
@@ -549,7 +562,9 @@ GrB_Info GB_reduce_to_vector        // C<M> = accum (C,reduce(A))
     //--------------------------------------------------------------------------
 
     GB_FREE_WORK ;
-    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
-        Mask_struct, Context)) ;
+    info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context) ;
+    GB_MATRIX_FREE (&A_sparse) ;
+    return (info) ;
 }
 
@@ -69,6 +69,12 @@ GrB_Info GB_resize              // change the size of a matrix
         ASSERT_MATRIX_OK (A, "A to resize, wait", GB0) ;
     }
 
+    // the pattern of a full matrix is about to change
+    GB_ENSURE_SPARSE (A) ;
+
+    // A is resized in place, so it must own all of its content
+    GB_OK (GB_unshare (A, Context)) ;
+
     //--------------------------------------------------------------------------
     // check for early conversion to hypersparse
     //--------------------------------------------------------------------------
@@ -189,6 +195,6 @@ GrB_Info GB_resize              // change the size of a matrix
     // check for conversion to hypersparse or to non-hypersparse
     //--------------------------------------------------------------------------
 
-    return (GB_to_hyper_conform (A, Context)) ;
+    return (GB_conform (A, Context)) ;
 }
 
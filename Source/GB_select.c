@@ -12,6 +12,7 @@
 #define GB_FREE_ALL                         \
 {                                           \
     GB_MATRIX_FREE (&T) ;                   \
+    GB_MATRIX_FREE (&A_sparse) ;            \
 }
 
 #include "GB_select.h"
@@ -26,7 +27,7 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     const bool Mask_struct,         // if true, use the only structure of M
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
     const GxB_SelectOp op,          // operator to select the entries
-    const GrB_Matrix A,             // input matrix
+    const GrB_Matrix A_in,          // input matrix
     const GxB_Scalar Thunk_in,      // optional input for select operator
     const bool A_transpose,         // A matrix descriptor
     GB_Context Context
@@ -47,10 +48,12 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     ASSERT_MATRIX_OK_OR_NULL (M, "M for GB_select", GB0) ;
     ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for GB_select", GB0) ;
     ASSERT_SELECTOP_OK (op, "selectop for GB_select", GB0) ;
-    ASSERT_MATRIX_OK (A, "A input for GB_select", GB0) ;
+    ASSERT_MATRIX_OK (A_in, "A input for GB_select", GB0) ;
     ASSERT_SCALAR_OK_OR_NULL (Thunk_in, "Thunk_in for GB_select", GB0) ;
 
     GrB_Matrix T = NULL ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
 
     // check domains and dimensions for C<M> = accum (C,T)
     GrB_Info info ;
@@ -206,6 +209,9 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     GB_MATRIX_WAIT (M) ;
     GB_MATRIX_WAIT (A) ;
 
+    // GB_selector requires the pattern of A
+    GB_SPARSE_INPUT (A, A_sparse) ;
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format and the transposed case
     //--------------------------------------------------------------------------
@@ -492,7 +498,9 @@ GrB_Info GB_select          // C<M> = accum (C, select(A,k)) or select(A',k)
     // C<M> = accum (C,T): accumulate the results into C via the mask
     //--------------------------------------------------------------------------
 
-    return (GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
-        Mask_struct, Context)) ;
+    info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp,
+        Mask_struct, Context) ;
+    GB_FREE_ALL ;
+    return (info) ;
 }
 
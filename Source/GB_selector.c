@@ -61,6 +61,16 @@ GrB_Info GB_selector
     { 
         (*Chandle) = NULL ;
     }
+    else
+    { 
+        // A is modified in place, so it must own all of its content
+        info = GB_unshare (A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+    }
 
     int64_t *GB_RESTRICT Zp = NULL ;
     int64_t *GB_RESTRICT Wfirst = NULL ;
@@ -415,6 +425,7 @@ GrB_Info GB_selector
         C->nzmax = cnz ;
         C->magic = GB_MAGIC ;
         C->nvec_nonempty = C_nvec_nonempty ;
+        C->jumbled = A->jumbled ;   // C is jumbled if A is jumbled
 
         if (C->nzmax == 0)
         { 
@@ -0,0 +1,125 @@
+//------------------------------------------------------------------------------
+// GB_serialize.h: definitions for GxB_Matrix_serialize and deserialize
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A serialized matrix (the "blob") consists of a header followed by one
+// section for each array of the matrix that is present: Ap and Ah (sparse or
+// hypersparse), Ab (bitmap), Ai (sparse or hypersparse), and Ax (always).
+// Each header entry is 8 bytes in size (int64_t or double).
+
+// Each section holds a single array, split into blocks of GB_BLOB_BLOCKSIZE
+// bytes (the last block may be smaller).  The section starts with the size
+// of the array in bytes, the # of blocks, and the cumulative sizes of the
+// blocks as stored in the blob (Sblock [1..nblocks], with Sblock [0] = 0 not
+// stored).  The stored blocks follow, padded to a multiple of 8 bytes.  A
+// block whose stored size equals its uncompressed size is stored as-is;
+// otherwise it has been compressed with GB_lz4_compress.  Since each block
+// is independent, the blocks are compressed and decompressed in parallel.
+
+#ifndef GB_SERIALIZE_H
+#define GB_SERIALIZE_H
+#include "GB.h"
+
+#define GB_BLOB_MAGIC     0x31424F4C42534721    // "!GSBLOB1"
+#define GB_BLOB_VERSION   1
+#define GB_BLOB_BLOCKSIZE (256 * 1024)          // # of bytes in each block
+#define GB_BLOB_HEADER    (20 * sizeof (int64_t))   // size of the header
+
+// round a size up to a multiple of 8 bytes
+#define GB_BLOB_PAD(s) (((s) + 7) & (~((size_t) 7)))
+
+//------------------------------------------------------------------------------
+// GB_blob_section: one array of a matrix, as it will be stored in the blob
+//------------------------------------------------------------------------------
+
+typedef struct
+{
+    int64_t size ;              // size of the uncompressed array, in bytes
+    int64_t nblocks ;           // # of blocks
+    int64_t *Sblock ;           // size nblocks+1; cumulative stored size
+    GB_void *W ;                // compressed blocks, or NULL if none; block
+                                // b starts at W [b*GB_BLOB_BLOCKSIZE]
+    const GB_void *X ;          // the uncompressed array (not freed)
+}
+GB_blob_section ;
+
+GrB_Info GB_serialize_array         // compress an array into blocks
+(
+    GB_blob_section *S,             // section to construct
+    const GB_void *X,               // array to compress
+    int64_t size,                   // size of X in bytes
+    GrB_Desc_Value method,          // compression method
+    GB_Context Context
+) ;
+
+size_t GB_serialize_array_size      // size of a section in the blob
+(
+    const GB_blob_section *S
+) ;
+
+void GB_serialize_array_write       // write a section into the blob
+(
+    GB_void *blob,                  // blob to write to
+    size_t *s_handle,               // position in the blob; advanced on output
+    const GB_blob_section *S,       // section to write
+    GB_Context Context
+) ;
+
+void GB_serialize_array_free        // free the workspace of a section
+(
+    GB_blob_section *S
+) ;
+
+GrB_Info GB_deserialize_array       // read an array from the blob
+(
+    GB_void **X_handle,             // array to allocate and read
+    bool *X_shallow,                // in: if X may point into the blob;
+                                    // out: true if it does
+    int64_t size,                   // size of X in bytes
+    int64_t size_alloc,             // size to allocate (>= size)
+    const GB_void *blob,            // blob to read from
+    size_t blob_size,               // size of the blob
+    size_t *s_handle,               // position in the blob; advanced on output
+    GB_Context Context
+) ;
+
+GrB_Info GB_deserialize             // create a matrix from a blob
+(
+    GrB_Matrix *Chandle,            // output matrix created from the blob
+    GrB_Type type,                  // type of the matrix, or NULL for built-in
+    const GB_void *blob,            // the blob
+    size_t blob_size,               // size of the blob in bytes
+    bool shallow,                   // if true, C may point into the blob
+    GB_Context Context
+) ;
+
+//------------------------------------------------------------------------------
+// LZ4-style block compression
+//------------------------------------------------------------------------------
+
+// The compressed format is a sequence of (literals, match) pairs, in the same
+// token layout as the LZ4 block format.  The last sequence holds literals only.
+
+int64_t GB_lz4_compress     // return compressed size, or 0 if not compressible
+(
+    GB_void *GB_RESTRICT dst,       // output, of size dst_capacity
+    int64_t dst_capacity,
+    const GB_void *GB_RESTRICT src, // input, of size n
+    int64_t n
+) ;
+
+bool GB_lz4_decompress      // return true if successful
+(
+    GB_void *GB_RESTRICT dst,       // output, of size exactly dst_size
+    int64_t dst_size,
+    const GB_void *GB_RESTRICT src, // compressed input, of size src_size
+    int64_t src_size
+) ;
+
+#endif
+
@@ -0,0 +1,188 @@
+//------------------------------------------------------------------------------
+// GB_serialize_array: split an array into blocks and compress each block
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// GB_serialize_array compresses each block of X in parallel, into a single
+// workspace S->W of the same size as X (a block is only kept compressed if it
+// becomes smaller).  GB_serialize_array_size then gives the size of the
+// section in the blob, and GB_serialize_array_write copies it into the blob.
+// GB_serialize_array_free frees the workspace, but not X itself.
+
+#include "GB_serialize.h"
+
+//------------------------------------------------------------------------------
+// GB_serialize_array
+//------------------------------------------------------------------------------
+
+GrB_Info GB_serialize_array         // compress an array into blocks
+(
+    GB_blob_section *S,             // section to construct
+    const GB_void *X,               // array to compress
+    int64_t size,                   // size of X in bytes
+    GrB_Desc_Value method,          // compression method
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (S != NULL) ;
+    ASSERT (size == 0 || X != NULL) ;
+
+    int64_t nblocks = GB_ICEIL (size, GB_BLOB_BLOCKSIZE) ;
+    S->X = X ;
+    S->size = size ;
+    S->nblocks = nblocks ;
+    S->W = NULL ;
+    S->Sblock = GB_MALLOC (nblocks+1, int64_t) ;
+    if (S->Sblock == NULL)
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    int64_t *GB_RESTRICT Sblock = S->Sblock ;
+    Sblock [0] = 0 ;
+
+    //--------------------------------------------------------------------------
+    // compress each block, if requested
+    //--------------------------------------------------------------------------
+
+    bool compress = (method == GxB_COMPRESSION_LZ4 && size > 0) ;
+    if (compress)
+    {
+        S->W = GB_MALLOC (size, GB_void) ;
+        // if out of memory, the blocks are simply not compressed
+        compress = (S->W != NULL) ;
+    }
+
+    if (compress)
+    {
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        int nthreads = GB_nthreads (size, chunk, nthreads_max) ;
+        nthreads = GB_IMIN (nthreads, nblocks) ;
+        GB_void *GB_RESTRICT W = S->W ;
+        int64_t b ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (b = 0 ; b < nblocks ; b++)
+        {
+            int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+            int64_t bsize = GB_IMIN (GB_BLOB_BLOCKSIZE, size - kstart) ;
+            int64_t csize = GB_lz4_compress (W + kstart, bsize, X + kstart,
+                bsize) ;
+            // the block is stored as-is if it does not compress
+            Sblock [b+1] = (csize > 0) ? csize : bsize ;
+        }
+    }
+    else
+    {
+        // all blocks are stored as-is
+        for (int64_t b = 0 ; b < nblocks ; b++)
+        {
+            int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+            Sblock [b+1] = GB_IMIN (GB_BLOB_BLOCKSIZE, size - kstart) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // cumulative sum of the stored block sizes
+    //--------------------------------------------------------------------------
+
+    for (int64_t b = 0 ; b < nblocks ; b++)
+    {
+        Sblock [b+1] += Sblock [b] ;
+    }
+
+    return (GrB_SUCCESS) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_array_size: size of a section in the blob
+//------------------------------------------------------------------------------
+
+size_t GB_serialize_array_size      // size of a section in the blob
+(
+    const GB_blob_section *S
+)
+{
+    // size, nblocks, Sblock [1..nblocks], and the padded blocks
+    return ((2 + S->nblocks) * sizeof (int64_t)
+        + GB_BLOB_PAD ((size_t) S->Sblock [S->nblocks])) ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_array_write: write a section into the blob
+//------------------------------------------------------------------------------
+
+void GB_serialize_array_write       // write a section into the blob
+(
+    GB_void *blob,                  // blob to write to
+    size_t *s_handle,               // position in the blob; advanced on output
+    const GB_blob_section *S,       // section to write
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // write the section header
+    //--------------------------------------------------------------------------
+
+    size_t s = (*s_handle) ;
+    int64_t nblocks = S->nblocks ;
+    const int64_t *GB_RESTRICT Sblock = S->Sblock ;
+    memcpy (blob + s, &(S->size), sizeof (int64_t)) ;
+    s += sizeof (int64_t) ;
+    memcpy (blob + s, &nblocks, sizeof (int64_t)) ;
+    s += sizeof (int64_t) ;
+    memcpy (blob + s, Sblock + 1, nblocks * sizeof (int64_t)) ;
+    s += nblocks * sizeof (int64_t) ;
+
+    //--------------------------------------------------------------------------
+    // copy each block into the blob
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (S->size, chunk, nthreads_max) ;
+    nthreads = GB_IMIN (nthreads, nblocks) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+
+    GB_void *GB_RESTRICT Data = blob + s ;
+    int64_t b ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (b = 0 ; b < nblocks ; b++)
+    {
+        int64_t kstart = b * GB_BLOB_BLOCKSIZE ;
+        int64_t bsize = GB_IMIN (GB_BLOB_BLOCKSIZE, S->size - kstart) ;
+        int64_t ssize = Sblock [b+1] - Sblock [b] ;
+        // use the compressed block if it is smaller
+        const GB_void *src = (ssize < bsize) ? (S->W + kstart) : (S->X + kstart);
+        memcpy (Data + Sblock [b], src, ssize) ;
+    }
+
+    // clear the padding, so the blob has no uninitialized bytes
+    size_t ssize = (size_t) Sblock [nblocks] ;
+    memset (Data + ssize, 0, GB_BLOB_PAD (ssize) - ssize) ;
+    s += GB_BLOB_PAD (ssize) ;
+    (*s_handle) = s ;
+}
+
+//------------------------------------------------------------------------------
+// GB_serialize_array_free: free the workspace of a section
+//------------------------------------------------------------------------------
+
+void GB_serialize_array_free        // free the workspace of a section
+(
+    GB_blob_section *S
+)
+{
+    GB_FREE (S->Sblock) ;
+    GB_FREE (S->W) ;
+}
+
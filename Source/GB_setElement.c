@@ -103,6 +103,123 @@ GrB_Info GB_setElement              // set a single entry, C(row,col) = scalar
         j = row ;
     }
 
+    //--------------------------------------------------------------------------
+    // C(i,j) = scalar when C is full
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_FULL (C))
+    { 
+        // all entries are present, so C(i,j) is always found at i+j*vlen
+        size_t csize = ctype->size ;
+        int64_t pC = i + j * C->vlen ;
+        GB_cast_array (((GB_void *) C->x) +(pC*csize), ccode,
+            (GB_void *) scalar, scalar_code, csize, 1, 1) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C(i,j) = scalar when C allows concurrent insertion
+    //--------------------------------------------------------------------------
+
+    if (C->Pending_slots != NULL)
+    {
+
+        // Any number of user threads may do this at the same time, on the
+        // same matrix C, since the pattern of C is not modified.  If C(i,j)
+        // is a live entry, it is overwritten in place, while holding the lock
+        // of the slot (pC % GB_PENDING_NSLOTS) so that two threads never
+        // write to the same entry at the same time.  Otherwise, the tuple is
+        // typecast to C->type and appended to one of the slots of C.  A
+        // zombie is not brought back to life, so C->nzombies is unchanged.
+
+        size_t csize = ctype->size ;
+        int64_t pC = -1 ;
+
+        if (GB_IS_BITMAP (C))
+        { 
+            int64_t p = i + j * C->vlen ;
+            if (C->b [p]) pC = p ;
+        }
+        else
+        {
+            int64_t pC_start, pC_end, pleft = 0, pright = C->nvec - 1 ;
+            if (GB_lookup (C->is_hyper, C->h, C->p, &pleft, pright, j,
+                &pC_start, &pC_end))
+            {
+                const int64_t *Ci = C->i ;
+                if (C->jumbled)
+                {
+                    // C cannot be sorted here, so do a linear search
+                    for (int64_t p = pC_start ; p < pC_end ; p++)
+                    {
+                        if (Ci [p] == i)
+                        { 
+                            pC = p ;
+                            break ;
+                        }
+                    }
+                }
+                else
+                {
+                    bool found, is_zombie ;
+                    pleft = pC_start ;
+                    pright = pC_end - 1 ;
+                    GB_BINARY_SEARCH_ZOMBIE (i, Ci, pleft, pright, found,
+                        C->nzombies, is_zombie) ;
+                    if (found && !is_zombie) pC = pleft ;
+                }
+            }
+        }
+
+        if (pC >= 0)
+        { 
+            // C(i,j) is present: overwrite it with the scalar
+            GB_void cwork [GB_VLA(csize)] ;
+            GB_cast_array (cwork, ccode, (GB_void *) scalar, scalar_code,
+                csize, 1, 1) ;
+            int k = (int) (pC % GB_PENDING_NSLOTS) ;
+            GB_Pending_slot_lock (C->Pending_slots, k) ;
+            memcpy (((GB_void *) C->x) +(pC*csize), cwork, csize) ;
+            GB_Pending_slot_unlock (C->Pending_slots, k) ;
+            return (GrB_SUCCESS) ;
+        }
+        else
+        { 
+            // C(i,j) is not present: add it to one of the slots of C
+            GB_void cwork [GB_VLA(csize)] ;
+            GB_cast_array (cwork, ccode, (GB_void *) scalar, scalar_code,
+                csize, 1, 1) ;
+            info = GB_Pending_slots_add (C, cwork, i, j) ;
+            return ((info == GrB_OUT_OF_MEMORY) ? GB_OUT_OF_MEMORY : info) ;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // C(i,j) = scalar when C is bitmap
+    //--------------------------------------------------------------------------
+
+    if (GB_IS_BITMAP (C))
+    { 
+        // C(i,j) is at position i+j*vlen; mark it present if not already so
+        size_t csize = ctype->size ;
+        int64_t pC = i + j * C->vlen ;
+        GB_cast_array (((GB_void *) C->x) +(pC*csize), ccode,
+            (GB_void *) scalar, scalar_code, csize, 1, 1) ;
+        if (C->b [pC] == 0)
+        { 
+            C->b [pC] = 1 ;
+            C->nvals++ ;
+            C->nvec_nonempty = -1 ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort C if it is jumbled; zombies and pending tuples are left in place
+    //--------------------------------------------------------------------------
+
+    GB_MATRIX_WAIT_IF_JUMBLED (C) ;
+
     //--------------------------------------------------------------------------
     // binary search in C->h for vector j, or constant time lookup if not hyper
     //--------------------------------------------------------------------------
@@ -37,6 +37,7 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
     ASSERT_MATRIX_OK (A, "A for shallow cast", GB0) ;
     ASSERT ((A->nzmax == 0) == (A->i == NULL && A->x == NULL)) ;
     ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    ASSERT (!GB_IS_BITMAP (A)) ;
 
     (*Chandle) = NULL ;
 
@@ -61,8 +62,8 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
     //--------------------------------------------------------------------------
 
     ASSERT (C->magic == GB_MAGIC2) ;   // [ be careful; C not yet initialized
-    C->p_shallow = true ;           // C->p not freed when freeing C
-    C->h_shallow = true ;           // C->h not freed when freeing C
+    C->p_shallow = (A->p != NULL) ; // C->p not freed when freeing C
+    C->h_shallow = (A->h != NULL) ; // C->h not freed when freeing C
     C->p = A->p ;                   // C->p is of size A->plen + 1
     C->h = A->h ;                   // C->h is of size A->plen
     C->plen = A->plen ;             // C and A have the same hyperlist sizes
@@ -94,7 +95,8 @@ GrB_Info GB_shallow_copy    // create a purely shallow matrix
     //--------------------------------------------------------------------------
 
     C->i = A->i ;               // of size A->nzmax
-    C->i_shallow = true ;       // C->i will not be freed when freeing C
+    C->i_shallow = (A->i != NULL) ; // C->i not freed when freeing C
+    C->jumbled = A->jumbled ;   // C is jumbled if A is jumbled
 
     //--------------------------------------------------------------------------
     // make a shallow copy of the values
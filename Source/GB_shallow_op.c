@@ -46,6 +46,7 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
 
     ASSERT (Chandle != NULL) ;
     ASSERT_MATRIX_OK (A, "A for shallow_op", GB0) ;
+    ASSERT (!GB_IS_BITMAP (A)) ;
     GrB_Type ztype, op_intype ;
     GB_Opcode opcode ;
     if (op1 != NULL)
@@ -90,8 +91,8 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
     //--------------------------------------------------------------------------
 
     ASSERT (C->magic == GB_MAGIC2) ;   // [ be careful; C not yet initialized
-    C->p_shallow = true ;           // C->p not freed when freeing C
-    C->h_shallow = true ;           // C->h not freed when freeing C
+    C->p_shallow = (A->p != NULL) ; // C->p not freed when freeing C
+    C->h_shallow = (A->h != NULL) ; // C->h not freed when freeing C
     C->p = A->p ;                   // C->p is of size A->plen + 1
     C->h = A->h ;                   // C->h is of size A->plen
     C->plen = A->plen ;             // C and A have the same hyperlist sizes
@@ -123,7 +124,8 @@ GrB_Info GB_shallow_op      // create shallow matrix and apply operator
     //--------------------------------------------------------------------------
 
     C->i = A->i ;               // of size A->nzmax
-    C->i_shallow = true ;       // C->i will not be freed when freeing C
+    C->i_shallow = (A->i != NULL) ; // C->i not freed when freeing C
+    C->jumbled = A->jumbled ;   // C is jumbled if A is jumbled
 
     //--------------------------------------------------------------------------
     // make a shallow copy of the values, if possible
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+// GB_sparse_copy: create a temporary sparse copy of a full or bitmap matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Methods that cannot operate on a full or bitmap input matrix A use S, a
+// sparse copy of A, in its place (see GB_SPARSE_INPUT), and free S when done.
+// A itself is not modified, so it keeps its full or bitmap format.
+
+// If A is full, S->x is a shallow copy of A->x, and only S->p and S->i are
+// allocated.  If A is bitmap, its entries are gathered into S.  S has the
+// same type, dimensions, CSR/CSC format, and sparsity control as A, and it is
+// not hypersparse.  It is never returned to the user.
+
+// If out of memory, S is returned as NULL.
+
+#include "GB_transpose.h"
+
+#define GB_FREE_ALL ;
+
+GrB_Info GB_sparse_copy         // S = sparse copy of a full or bitmap matrix
+(
+    GrB_Matrix *Shandle,        // output matrix S
+    const GrB_Matrix A,         // full or bitmap input matrix, not modified
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info ;
+    ASSERT (Shandle != NULL) ;
+    ASSERT_MATRIX_OK (A, "A for sparse copy", GB0) ;
+    ASSERT (GB_IS_FULL (A) || GB_IS_BITMAP (A)) ;
+    ASSERT (!GB_PENDING (A)) ; ASSERT (!GB_ZOMBIES (A)) ;
+    (*Shandle) = NULL ;
+
+    if (GB_IS_FULL (A))
+    {
+
+        //----------------------------------------------------------------------
+        // S = A, with a shallow copy of A->x and an explicit pattern
+        //----------------------------------------------------------------------
+
+        GB_OK (GB_shallow_copy (Shandle, A->is_csc, A, Context)) ;
+        info = GB_convert_full_to_sparse (*Shandle, Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory
+            GB_MATRIX_FREE (Shandle) ;
+            return (info) ;
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // S = A, with the entries gathered from the bitmap of A
+        //----------------------------------------------------------------------
+
+        GBBURBLE ("(bitmap to sparse copy) ") ;
+        int64_t *GB_RESTRICT Sp = NULL ;
+        int64_t *GB_RESTRICT Si = NULL ;
+        GB_void *GB_RESTRICT Sx = NULL ;
+        GB_OK (GB_convert_bitmap_worker (&Sp, &Si, &Sx, A, Context)) ;
+
+        // allocate the header of S, but not S->p, S->h, S->i, or S->x
+        info = GB_new (Shandle, A->type, A->vlen, A->vdim, GB_Ap_null,
+            A->is_csc, GB_FORCE_NONHYPER, A->hyper_ratio, 0, Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            // out of memory
+            GB_FREE (Sp) ;
+            GB_FREE (Si) ;
+            GB_FREE (Sx) ;
+            return (info) ;
+        }
+
+        GrB_Matrix S = (*Shandle) ;
+        S->p = Sp ;
+        S->i = Si ;
+        S->x = Sx ;
+        S->nzmax = GB_IMAX (A->nvals, 1) ;
+        S->plen = A->vdim ;
+        S->nvec = A->vdim ;
+        S->magic = GB_MAGIC ;
+        S->nvec_nonempty = GB_nvec_nonempty (S, Context) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    (*Shandle)->sparsity = A->sparsity ;
+    (*Shandle)->bitmap_switch = A->bitmap_switch ;
+    ASSERT_MATRIX_OK (*Shandle, "S = sparse copy of A", GB0) ;
+    ASSERT (!GB_IS_FULL (*Shandle) && !GB_IS_BITMAP (*Shandle)) ;
+    return (GrB_SUCCESS) ;
+}
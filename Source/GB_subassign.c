@@ -28,6 +28,8 @@
     GB_MATRIX_FREE (&Z2) ;                          \
     GB_MATRIX_FREE (&AT) ;                          \
     GB_MATRIX_FREE (&MT) ;                          \
+    GB_MATRIX_FREE (&A_sparse) ;                    \
+    GB_MATRIX_FREE (&M_sparse) ;                    \
 }
 
 GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
@@ -65,6 +67,8 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     GrB_Info info ;
     GrB_Matrix M = M_in ;
     GrB_Matrix A = A_in ;
+    GrB_Matrix M_sparse = NULL ;
+    GrB_Matrix A_sparse = NULL ;
 
     if (scalar_expansion)
     { 
@@ -189,6 +193,20 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
         GB_MATRIX_WAIT (A) ;
     }
 
+    // the assignment requires the sorted pattern of C, M, and A
+    GB_MATRIX_WAIT_IF_JUMBLED (C) ;
+    GB_ENSURE_SPARSE (C) ;
+    GB_SPARSE_INPUT (M, M_sparse) ;
+    if (A_in == M_in)
+    { 
+        // A and M are aliased; keep them aliased
+        A = M ;
+    }
+    else
+    { 
+        GB_SPARSE_INPUT (A, A_sparse) ;
+    }
+
     //--------------------------------------------------------------------------
     // handle the CSR/CSC format of C:
     //--------------------------------------------------------------------------
@@ -219,6 +237,23 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     // J is a list of length |J| of vectors in the range 0:C->vdim-1.
     // I is a list of length |I| of indices in the range 0:C->vlen-1.
 
+    //--------------------------------------------------------------------------
+    // C(:,:) += A' where C is dense: accumulate A' into C without transposing A
+    //--------------------------------------------------------------------------
+
+    if (!scalar_expansion && A_transpose && whole_C_matrix
+        && M == NULL && !Mask_comp && accum != NULL)
+    {
+        bool done = false ;
+        GB_OK (GB_subassign_accum_tran (&done, C, accum, A, Context)) ;
+        if (done)
+        { 
+            ASSERT_MATRIX_OK (C, "Final C for subassign, C+=A'", GB0) ;
+            GB_FREE_ALL ;
+            return (GB_block (C, Context)) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // transpose A if requested
     //--------------------------------------------------------------------------
@@ -263,6 +298,26 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
         }
     }
 
+    //--------------------------------------------------------------------------
+    // C(:,:)<C,struct> = x, += x, or = A: modify the values of C in place
+    //--------------------------------------------------------------------------
+
+    // If the mask is the pattern of C itself, no entries are inserted or
+    // deleted, so C_replace has no effect and C need not be copied.
+
+    if (M == C && whole_C_matrix && Mask_struct && !Mask_comp)
+    {
+        bool done = false ;
+        GB_OK (GB_subassign_C_mask_C (&done, C, accum, A, scalar_expansion,
+            scalar, scalar_code, Context)) ;
+        if (done)
+        { 
+            ASSERT_MATRIX_OK (C, "Final C for subassign, C<C,s>", GB0) ;
+            GB_FREE_ALL ;
+            return (GB_block (C, Context)) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // make a copy Z = C if C is aliased to A or M
     //--------------------------------------------------------------------------
@@ -305,15 +360,27 @@ GrB_Info GB_subassign               // C(Rows,Cols)<M> += A or A'
     else
     { 
         // GB_subassigner can safely operate on C in place.
-        // FUTURE:  if C is dense and will remain so,
-        // it would be faster to delay the clearing of C.
         if (whole_C_matrix && C_replace && accum == NULL)
-        { 
-            // C(:,:)<any mask, replace> = A or x, with C not aliased to M or
-            // A.  C is about to be cleared in GB_subassigner anyway, so clear
-            // it now.
-            GB_OK (GB_clear (C, Context)) ;
-            GBBURBLE ("(C(:,:)<any mask>: C_replace early) ") ;
+        {
+            if (M != NULL && Mask_struct && !Mask_comp && GB_is_dense (M)
+                && !GB_PENDING_OR_ZOMBIES (C) && GB_is_dense (C)
+                && (scalar_expansion || GB_is_dense (A)))
+            { 
+                // C(:,:)<M,struct,replace> = A or x, where M, C, and A are
+                // dense.  The mask is all true, so this is the same as C = A
+                // or C = x, and C remains dense.  Do not clear C, but let
+                // Method 21 or 24 overwrite its values in place.
+                GBBURBLE ("(C(:,:)<M dense,s>: C remains dense) ") ;
+                M = NULL ;
+            }
+            else
+            { 
+                // C(:,:)<any mask, replace> = A or x, with C not aliased to M
+                // or A.  C is about to be cleared in GB_subassigner anyway, so
+                // clear it now.
+                GB_OK (GB_clear (C, Context)) ;
+                GBBURBLE ("(C(:,:)<any mask>: C_replace early) ") ;
+            }
             C_replace = false ;
         }
         Z = C ;
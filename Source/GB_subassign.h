@@ -67,5 +67,26 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
     GB_Context Context
 ) ;
 
+GrB_Info GB_subassign_C_mask_C      // C(:,:)<C,struct> = x, += x, or = A
+(
+    bool *done,                     // true if C<C,s> has been computed
+    GrB_Matrix C,                   // input/output matrix, also the mask
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,A)
+    const GrB_Matrix A,             // input matrix (NULL for scalar expansion)
+    const bool scalar_expansion,    // if true, expand scalar to A
+    const void *scalar,             // scalar to be expanded
+    const GB_Type_code scalar_code, // type code of scalar to expand
+    GB_Context Context
+) ;
+
+GrB_Info GB_subassign_accum_tran    // C(:,:) += A' where C is dense
+(
+    bool *done,                     // true if C+=A' has been computed
+    GrB_Matrix C,                   // input/output matrix
+    const GrB_BinaryOp accum,       // accum for Z=accum(C,A')
+    const GrB_Matrix A,             // input matrix, to be transposed
+    GB_Context Context
+) ;
+
 #endif
 
@@ -1,5 +1,5 @@
 //------------------------------------------------------------------------------
-// GB_subassign_05e: C(:,:)<M,struct> = scalar ; no S, C empty, M structural
+// GB_subassign_05e: C(:,:)<M,struct> = scalar ; no S, C empty or C == M
 //------------------------------------------------------------------------------
 
 // SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
@@ -10,6 +10,10 @@
 // Method 05e: C(:,:)<M,struct> = scalar ; no S
 // compare with Methods 21, 25, and 05d
 
+// C is either empty on input, or C and M are the same matrix (C<C,struct> =
+// scalar).  In the latter case, the pattern of C is unchanged and only the
+// values of C are modified.
+
 // M:           present
 // Mask_comp:   false
 // Mask_struct: true
@@ -41,7 +45,7 @@ GrB_Info GB_subassign_05e
     GrB_Info info ;
     ASSERT_MATRIX_OK (C, "C for subassign method_05e", GB0) ;
     ASSERT_MATRIX_OK (M, "M for subassign method_05e", GB0) ;
-    ASSERT (GB_NNZ (C) == 0) ;
+    ASSERT (GB_NNZ (C) == 0 || C == M) ;
     ASSERT (!GB_PENDING (C)) ; ASSERT (!GB_ZOMBIES (C)) ;
     ASSERT (!GB_PENDING (M)) ; ASSERT (!GB_ZOMBIES (M)) ;
     const GB_Type_code ccode = C->type->code ;
@@ -70,12 +74,16 @@ GrB_Info GB_subassign_05e
 
     // clear prior content and then create a copy of the pattern of M.  Keep
     // the same type and CSR/CSC for C.  Allocate the values of C but do not
-    // initialize them.
-
-    bool C_is_csc = C->is_csc ;
-    GB_PHIX_FREE (C) ;
-    GB_OK (GB_dup2 (&C, M, false, C->type, Context)) ;
-    C->is_csc = C_is_csc ;
+    // initialize them.  If C and M are the same matrix, the pattern of C is
+    // already the pattern of M.
+
+    if (C != M)
+    { 
+        bool C_is_csc = C->is_csc ;
+        GB_PHIX_FREE (C) ;
+        GB_OK (GB_dup2 (&C, M, false, C->type, Context)) ;
+        C->is_csc = C_is_csc ;
+    }
     int64_t pC ;
 
     //--------------------------------------------------------------------------
@@ -129,6 +129,10 @@ GrB_Info GB_subassign_08
     // used for both.  Once two entries M(i,j)=1 and A(i,j) are found with the
     // same index i, the entry A(i,j) is accumulated or inserted into C.
 
+    // If A(:,j) or M(:,j) is dense, the other vector is traversed and a direct
+    // lookup is used for the dense one, instead of a binary search or a
+    // linear-time scan.  If both are dense, the shorter one is traversed.
+
     // The algorithm is very much like the eWise multiplication of A.*M, so the
     // parallel scheduling relies on GB_emult_phase0(AA and GB_ewise_slice.
 
@@ -181,6 +185,7 @@ GrB_Info GB_subassign_08
             int64_t iM_first = Mi [pM] ;
             int64_t iM_last  = Mi [pM_end-1] ;
             if (iA_last < iM_first || iM_last < iA_first) continue ;
+            int64_t pA_start = pA ;
             int64_t pM_start = pM ;
 
             //------------------------------------------------------------------
@@ -194,7 +199,61 @@ GrB_Info GB_subassign_08
             // C(I,jC)<M(:,j)> += A(:,j) ; no S
             //------------------------------------------------------------------
 
-            if (ajnz > 32 * mjnz)
+            // A(:,j) or M(:,j) is dense in the range of indices for this task
+            // if its entries are contiguous.  For a coarse task, this range is
+            // the whole vector; for a fine task it is a slice of the vector.
+            // The entry with index i is then at position p_start + i - i_first.
+
+            bool ajdense = (ajnz == iA_last - iA_first + 1) ;
+            bool mjdense = (mjnz == iM_last - iM_first + 1) ;
+
+            if (ajdense && (!mjdense || mjnz <= ajnz))
+            {
+
+                //--------------------------------------------------------------
+                // A(:,j) is dense; M(:,j) is sparse or no denser than A(:,j)
+                //--------------------------------------------------------------
+
+                // Only the entries of M(:,j) in the range iA_first:iA_last
+                // are traversed.  There are at most min (ajnz,mjnz) of them,
+                // so the time is O (min (ajnz,mjnz) + log (mjnz)).
+                int64_t pright = pM_end - 1 ;
+                GB_TRIM_BINARY_SEARCH (iA_first, Mi, pM, pright) ;
+                for ( ; pM < pM_end ; pM++)
+                {
+                    int64_t iA = Mi [pM] ;
+                    if (iA > iA_last) break ;
+                    if (GB_mcast (Mx, pM, msize))
+                    { 
+                        // direct lookup of A(iA,j)
+                        pA = pA_start + (iA - iA_first) ;
+                        GB_PHASE1_ACTION ;
+                    }
+                }
+
+            }
+            else if (mjdense)
+            {
+
+                //--------------------------------------------------------------
+                // M(:,j) is dense
+                //--------------------------------------------------------------
+
+                // Only the entries of A(:,j) in the range iM_first:iM_last
+                // are traversed, in O (min (ajnz,mjnz) + log (ajnz)) time.
+                int64_t pright = pA_end - 1 ;
+                GB_TRIM_BINARY_SEARCH (iM_first, Ai, pA, pright) ;
+                for ( ; pA < pA_end ; pA++)
+                {
+                    int64_t iA = Ai [pA] ;
+                    if (iA > iM_last) break ;
+                    // direct lookup of M(iA,j)
+                    pM = pM_start + (iA - iM_first) ;
+                    if (GB_mcast (Mx, pM, msize)) GB_PHASE1_ACTION ;
+                }
+
+            }
+            else if (ajnz > 32 * mjnz)
             {
 
                 //--------------------------------------------------------------
@@ -209,7 +268,6 @@ GrB_Info GB_subassign_08
                         // find iA in A(:,j)
                         int64_t pright = pA_end - 1 ;
                         bool found ;
-                        // FUTURE::: exploit dense A(:,j)
                         GB_BINARY_SEARCH (iA, Ai, pA, pright, found) ;
                         if (found) GB_PHASE1_ACTION ;
                     }
@@ -223,9 +281,7 @@ GrB_Info GB_subassign_08
                 // M(:,j) is much denser than A(:,j)
                 //--------------------------------------------------------------
 
-                // FUTURE::: exploit dense mask
-                bool mjdense = false ;
-
+                // M(:,j) is not dense, so mjdense is false here
                 for ( ; pA < pA_end ; pA++)
                 { 
                     int64_t iA = Ai [pA] ;
@@ -316,6 +372,7 @@ GrB_Info GB_subassign_08
             int64_t iM_first = Mi [pM] ;
             int64_t iM_last  = Mi [pM_end-1] ;
             if (iA_last < iM_first || iM_last < iA_first) continue ;
+            int64_t pA_start = pA ;
             int64_t pM_start = pM ;
 
             //------------------------------------------------------------------
@@ -330,7 +387,61 @@ GrB_Info GB_subassign_08
             // C(I,jC)<M(:,j)> += A(:,j) ; no S
             //------------------------------------------------------------------
 
-            if (ajnz > 32 * mjnz)
+            // A(:,j) or M(:,j) is dense in the range of indices for this task
+            // if its entries are contiguous.  For a coarse task, this range is
+            // the whole vector; for a fine task it is a slice of the vector.
+            // The entry with index i is then at position p_start + i - i_first.
+
+            bool ajdense = (ajnz == iA_last - iA_first + 1) ;
+            bool mjdense = (mjnz == iM_last - iM_first + 1) ;
+
+            if (ajdense && (!mjdense || mjnz <= ajnz))
+            {
+
+                //--------------------------------------------------------------
+                // A(:,j) is dense; M(:,j) is sparse or no denser than A(:,j)
+                //--------------------------------------------------------------
+
+                // Only the entries of M(:,j) in the range iA_first:iA_last
+                // are traversed.  There are at most min (ajnz,mjnz) of them,
+                // so the time is O (min (ajnz,mjnz) + log (mjnz)).
+                int64_t pright = pM_end - 1 ;
+                GB_TRIM_BINARY_SEARCH (iA_first, Mi, pM, pright) ;
+                for ( ; pM < pM_end ; pM++)
+                {
+                    int64_t iA = Mi [pM] ;
+                    if (iA > iA_last) break ;
+                    if (GB_mcast (Mx, pM, msize))
+                    { 
+                        // direct lookup of A(iA,j)
+                        pA = pA_start + (iA - iA_first) ;
+                        GB_PHASE2_ACTION ;
+                    }
+                }
+
+            }
+            else if (mjdense)
+            {
+
+                //--------------------------------------------------------------
+                // M(:,j) is dense
+                //--------------------------------------------------------------
+
+                // Only the entries of A(:,j) in the range iM_first:iM_last
+                // are traversed, in O (min (ajnz,mjnz) + log (ajnz)) time.
+                int64_t pright = pA_end - 1 ;
+                GB_TRIM_BINARY_SEARCH (iM_first, Ai, pA, pright) ;
+                for ( ; pA < pA_end ; pA++)
+                {
+                    int64_t iA = Ai [pA] ;
+                    if (iA > iM_last) break ;
+                    // direct lookup of M(iA,j)
+                    pM = pM_start + (iA - iM_first) ;
+                    if (GB_mcast (Mx, pM, msize)) GB_PHASE2_ACTION ;
+                }
+
+            }
+            else if (ajnz > 32 * mjnz)
             {
 
                 //--------------------------------------------------------------
@@ -345,7 +456,6 @@ GrB_Info GB_subassign_08
                         // find iA in A(:,j)
                         int64_t pright = pA_end - 1 ;
                         bool found ;
-                        // FUTURE::: exploit dense A(:,j)
                         GB_BINARY_SEARCH (iA, Ai, pA, pright, found) ;
                         if (found) GB_PHASE2_ACTION ;
                     }
@@ -359,9 +469,7 @@ GrB_Info GB_subassign_08
                 // M(:,j) is much denser than A(:,j)
                 //--------------------------------------------------------------
 
-                // FUTURE::: exploit dense mask
-                bool mjdense = false ;
-
+                // M(:,j) is not dense, so mjdense is false here
                 for ( ; pA < pA_end ; pA++)
                 { 
                     int64_t iA = Ai [pA] ;
@@ -0,0 +1,91 @@
+//------------------------------------------------------------------------------
+// GB_subassign_C_mask_C: C(:,:)<C,struct> = x, += x, or = A where A is dense
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The mask is C itself, with a structural, non-complemented mask, and all of
+// C is modified.  The mask is the pattern of C, so no entries are inserted
+// or deleted, and C_replace has no effect.  Only the values of C are
+// modified, in place, with no zombies or pending tuples, and no copy of C is
+// needed even though C and M are aliased.  GB_assign and GB_subassign use
+// this method before making a copy of C when C and M are aliased.
+
+// The following cases are handled, and *done is returned as true:
+
+//  C<C,s> = x      Method 05e, with C == M
+//  C<C,s> += x     Method 22, with no typecasting of C
+//  C<C,s> = A      Method 25, with C == M, where A is dense
+
+// Otherwise, *done is returned as false and C is not modified.
+
+#include "GB_subassign.h"
+#include "GB_subassign_methods.h"
+#include "GB_dense.h"
+
+GrB_Info GB_subassign_C_mask_C      // C(:,:)<C,struct> = x, += x, or = A
+(
+    bool *done,                     // true if C<C,s> has been computed
+    GrB_Matrix C,                   // input/output matrix, also the mask
+    const GrB_BinaryOp accum,       // optional accum for Z=accum(C,A)
+    const GrB_Matrix A,             // input matrix (NULL for scalar expansion)
+    const bool scalar_expansion,    // if true, expand scalar to A
+    const void *scalar,             // scalar to be expanded
+    const GB_Type_code scalar_code, // type code of scalar to expand
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GrB_Info info = GrB_SUCCESS ;
+    ASSERT (done != NULL) ;
+    ASSERT_MATRIX_OK (C, "C for C<C,s>", GB0) ;
+    ASSERT_BINARYOP_OK_OR_NULL (accum, "accum for C<C,s>", GB0) ;
+    (*done) = false ;
+
+    if (GB_PENDING_OR_ZOMBIES (C) || C->jumbled
+        || GB_IS_FULL (C) || GB_IS_BITMAP (C))
+    {
+        // the pattern of C must be finalized, and C must be sparse
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // C<C,s> = x, C<C,s> += x, or C<C,s> = A
+    //--------------------------------------------------------------------------
+
+    if (scalar_expansion)
+    {
+        GrB_Type atype = GB_code_type (scalar_code, C->type) ;
+        if (accum == NULL)
+        {
+            // Method 05e: C(:,:)<C,s> = scalar ; no S
+            GBBURBLE ("Method 05e: C<C,s> = scalar ") ;
+            info = GB_subassign_05e (C, C, scalar, atype, Context) ;
+            (*done) = true ;
+        }
+        else if (C->type == accum->ztype && C->type == accum->xtype)
+        {
+            // Method 22: C(:,:)<C,s> += scalar ; no S
+            GBBURBLE ("Method 22: C<C,s> += scalar ") ;
+            info = GB_dense_subassign_22 (C, scalar, atype, accum, Context) ;
+            (*done) = true ;
+        }
+    }
+    else if (accum == NULL && !GB_aliased (C, A) && GB_is_dense (A))
+    {
+        // Method 25: C(:,:)<C,s> = A ; no S, A dense
+        GBBURBLE ("Method 25: C<C,s> = (Z dense) ") ;
+        info = GB_dense_subassign_25 (C, C, A, Context) ;
+        (*done) = true ;
+    }
+
+    return (info) ;
+}
+
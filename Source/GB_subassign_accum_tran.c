@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GB_subassign_accum_tran: C(:,:) += A' where C is dense
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// All of C is modified with C += A', with no mask.  If C is dense, not
+// typecasted by the accum operator, and not aliased to A, then A' is
+// accumulated directly into C by Method 23, and A is never transposed.
+// GB_assign and GB_subassign use this method before transposing A.
+
+// If C += A' has been computed, *done is returned as true.  Otherwise, *done
+// is returned as false and C is not modified.
+
+#include "GB_subassign.h"
+#include "GB_dense.h"
+
+GrB_Info GB_subassign_accum_tran    // C(:,:) += A' where C is dense
+(
+    bool *done,                     // true if C+=A' has been computed
+    GrB_Matrix C,                   // input/output matrix
+    const GrB_BinaryOp accum,       // accum for Z=accum(C,A')
+    const GrB_Matrix A,             // input matrix, to be transposed
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (done != NULL) ;
+    ASSERT_MATRIX_OK (C, "C for C+=A'", GB0) ;
+    ASSERT_MATRIX_OK (A, "A for C+=A'", GB0) ;
+    ASSERT_BINARYOP_OK (accum, "accum for C+=A'", GB0) ;
+    (*done) = false ;
+
+    if (C->type != accum->ztype || C->type != accum->xtype
+        || GB_aliased (C, A) || GB_PENDING_OR_ZOMBIES (C) || !GB_is_dense (C))
+    { 
+        // C must be dense and not typecasted, and A' must be formed if C and
+        // A are aliased
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // Method 23: C(:,:) += A' where C is dense, with no typecasting of C
+    //--------------------------------------------------------------------------
+
+    GBBURBLE ("Method 23: (C dense) += Z' ") ;
+    GrB_Info info = GB_dense_subassign_23 (C, A, true, accum, Context) ;
+    (*done) = (info == GrB_SUCCESS) ;
+    return (info) ;
+}
+
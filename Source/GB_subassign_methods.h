@@ -1129,7 +1129,7 @@ GrB_Info GB_subassign_05
 ) ;
 
 //------------------------------------------------------------------------------
-// GB_subassign_05e: C(:,:)<M,struct> = scalar ; no S, C empty
+// GB_subassign_05e: C(:,:)<M,struct> = scalar ; no S, C empty or C == M
 //------------------------------------------------------------------------------
 
 GrB_Info GB_subassign_05e
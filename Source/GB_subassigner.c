@@ -54,6 +54,8 @@
     GB_MATRIX_FREE (&S) ;       \
     GB_MATRIX_FREE (&A2) ;      \
     GB_MATRIX_FREE (&M2) ;      \
+    GB_MATRIX_FREE (&A_sparse) ;\
+    GB_MATRIX_FREE (&M_sparse) ;\
     GB_FREE (I2) ;              \
     GB_FREE (I2k) ;             \
     GB_FREE (J2) ;              \
@@ -103,6 +105,8 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
     GrB_Matrix S = NULL ;
     GrB_Matrix A2 = NULL ;
     GrB_Matrix M2 = NULL ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix M_sparse = NULL ;
 
     GrB_Index *GB_RESTRICT I2  = NULL ;
     GrB_Index *GB_RESTRICT I2k = NULL ;
@@ -133,6 +137,23 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
     GB_MATRIX_WAIT (M) ;
     GB_MATRIX_WAIT (A) ;
 
+    // pending tuples from concurrent GrB_setElement precede any new ones
+    GB_OK (GB_Pending_merge (C, Context)) ;
+
+    // the subassign methods require the sorted pattern of C, M, and A
+    GB_MATRIX_WAIT_IF_JUMBLED (C) ;
+    GB_ENSURE_SPARSE (C) ;
+    GB_SPARSE_INPUT (M, M_sparse) ;
+    if (A_input == M_input)
+    { 
+        // A and M are aliased; keep them aliased
+        A = M ;
+    }
+    else
+    { 
+        GB_SPARSE_INPUT (A, A_sparse) ;
+    }
+
     //--------------------------------------------------------------------------
     // check mask conditions
     //--------------------------------------------------------------------------
@@ -156,6 +177,7 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
                 // is handled below in GB_subassign_00.  This "quick" case is
                 // checked again if C_replace becomes effectively false, below.
                 GBBURBLE ("quick ") ;
+                GB_FREE_WORK ;
                 return (GrB_SUCCESS) ;
             }
         }
@@ -640,6 +662,8 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
         // delete any lingering zombies and assemble any pending tuples
         ASSERT_MATRIX_OK (C, "C before wait", GB0) ;
         GB_OK (GB_Matrix_wait (C, Context)) ;
+        // C may now be bitmap or full
+        GB_ENSURE_SPARSE (C) ;
     }
 
     ASSERT_MATRIX_OK (C, "C before subassign", GB0) ;
@@ -673,6 +697,7 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
         // GB_Matrix_wait), then C_replace is now effectively false.  In this
         // case, the "quick" case can be checked again.  No more work to do.
         GBBURBLE ("quick ") ;
+        GB_FREE_WORK ;
         return (GrB_SUCCESS) ;
     }
 
@@ -935,11 +960,14 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
         //  M   c   r   +   -   S       19:  C(I,J)<!M,repl> += x, with S
         //  M   c   r   +   A   S       20:  C(I,J)<!M,repl> += A, with S
 
-        //----------------------------------------------------------------------
-        // FUTURE::: C<C,s> = x    C == M, replace all values, C_replace ignored
-        // FUTURE::: C<C,s> += x   C == M, update all values, C_replace ignored
-        // FUTURE::: C<C,s> = A    C == M, A dense, C_replace ignored
-        //----------------------------------------------------------------------
+        //  C   -   x   -   -   -       05e: C<C,s> = x, no S, C == M
+        //  C   -   x   +   -   -       22:  C<C,s> += x, no S, C == M
+        //  C   -   x   -   A   -       25:  C<C,s> = A, A dense, C == M
+
+    // The three C<C,s> methods (C == M, with a structural mask) are done by
+    // GB_subassign_C_mask_C, in GB_assign and GB_subassign, before the copy of
+    // C is made for the aliased C and M.  Only the values of C are modified,
+    // and C_replace is ignored.
 
     // For the single case C(I,J)<M>=A, two methods can be used: 06n and 06s.
 
@@ -1049,7 +1077,7 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
         {
             // Method 23: C(:,:) += A where C is dense
             GBBURBLE ("Method 23: (C dense) += Z ") ;
-            GB_OK (GB_dense_subassign_23 (C, A, accum, Context)) ;
+            GB_OK (GB_dense_subassign_23 (C, A, false, accum, Context)) ;
         }
 
     }
@@ -1409,6 +1437,13 @@ GrB_Info GB_subassigner             // C(I,J)<#M> = A or accum (C (I,J), A)
 
     GB_FREE_WORK ;
 
+    // If C allows concurrent insertion, its pending tuples must be left in a
+    // state that the tuples from GrB_setElement can be appended to.
+    if (C->Pending_slots != NULL && !GB_PENDING_IS_SECOND (C))
+    { 
+        GB_OK (GB_Matrix_wait (C, Context)) ;
+    }
+
     // TODO in 4.0: delete this:
     if (C->nzombies == 0 && C->Pending == NULL) { if (!GB_queue_remove (C)) GB_PANIC ; } else { if (!GB_queue_insert (C)) GB_PANIC ; }
 
@@ -37,6 +37,12 @@ GrB_Info GB_to_hyper_conform    // conform a matrix to its desired format
 
     GrB_Info info = GrB_SUCCESS ;
 
+    if (GB_IS_FULL (A) || GB_IS_BITMAP (A))
+    { 
+        // a full or bitmap matrix is never hypersparse; see GB_conform
+        return (GrB_SUCCESS) ;
+    }
+
     if (A->nvec_nonempty < 0)
     { 
         A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
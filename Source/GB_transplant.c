@@ -54,6 +54,25 @@ GrB_Info GB_transplant          // transplant one matrix into another
     int64_t avdim = A->vdim ;
     int64_t avlen = A->vlen ;
 
+    //--------------------------------------------------------------------------
+    // convert A from bitmap to sparse
+    //--------------------------------------------------------------------------
+
+    // The caller can conform C to its desired sparsity afterwards, with
+    // GB_conform or GB_transplant_conform.
+
+    if (GB_IS_BITMAP (A))
+    {
+        GrB_Info info = GB_convert_bitmap_to_sparse (A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_PHIX_FREE (C) ;
+            GB_MATRIX_FREE (Ahandle) ;
+            return (info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use
     //--------------------------------------------------------------------------
@@ -85,6 +104,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
             && C->is_csc == A->is_csc   //      A and C have the same format
             && C->p != NULL         
             && C->i != NULL             //      Cp and Ci exist
+            && !GB_IS_FULL (A)          //      A is not full
         ) ;
 
     int64_t *GB_RESTRICT Cp_keep = NULL ;
@@ -128,7 +148,7 @@ GrB_Info GB_transplant          // transplant one matrix into another
             A->nvec_nonempty == GB_nvec_nonempty (A, Context)) ;
     C->nvec_nonempty = A->nvec_nonempty ;
 
-    // C->hyper_ratio is not modified by the transplant
+    // C->hyper_ratio and C->sparsity are not modified by the transplant
 
     // C is not shallow, and has no content
     ASSERT (!C->p_shallow && !C->h_shallow && !C->i_shallow && !C->x_shallow) ;
@@ -403,10 +423,11 @@ GrB_Info GB_transplant          // transplant one matrix into another
         A->i_shallow = false ;
     }
 
-    ASSERT (C->i != NULL) ;
+    ASSERT (C->i != NULL || GB_IS_FULL (C)) ;
     C->i_shallow = false ;
 
     C->nzombies = A->nzombies ;     // zombies may have been transplanted into C
+    C->jumbled = A->jumbled ;       // C is jumbled if A is jumbled
 
     if (!GB_queue_insert (C)) GB_PANIC ;    // TODO in 4.0: delete
 
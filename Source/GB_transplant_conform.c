@@ -51,9 +51,9 @@ GrB_Info GB_transplant_conform      // transplant and conform hypersparsity
     ASSERT_MATRIX_OK (C, "C transplanted", GB0) ;
 
     //--------------------------------------------------------------------------
-    // conform C to its desired hypersparsity
+    // conform C to its desired sparsity structure
     //--------------------------------------------------------------------------
 
-    return (GB_to_hyper_conform (C, Context)) ;
+    return (GB_conform (C, Context)) ;
 }
 
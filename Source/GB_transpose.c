@@ -13,7 +13,9 @@
 // typecast the values.  The transpose may be done in place, in which case C or
 // A are modified in place.  If the matrix to be transposed has more than one
 // vector, it may have jumbled indices in its vectors, which must be sorted.
-// If the input matrix has a single vector, it must be already sorted on input.
+// If the input matrix has a single vector and is jumbled, it is sorted first,
+// since the vector transpose methods below do not sort.  The output matrix is
+// never jumbled.
 // The input matrix may have shallow components (even if in place), and the
 // output may also have shallow components (even in the input matrix is not
 // shallow).
@@ -176,6 +178,55 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     ASSERT (!GB_PENDING (A)) ;
     ASSERT (!GB_ZOMBIES (A)) ;
 
+    //--------------------------------------------------------------------------
+    // convert A from bitmap to sparse
+    //--------------------------------------------------------------------------
+
+    // C is returned as sparse or hypersparse.  Its sparsity control is taken
+    // from A, so the caller can use GB_conform to convert it back to bitmap.
+
+    if (GB_IS_BITMAP (A) && in_place)
+    {
+        // A is modified in place, so it can be converted to sparse
+        GrB_Info info = GB_convert_bitmap_to_sparse (A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_FREE_C ;
+            return (info) ;
+        }
+    }
+    else if (GB_IS_BITMAP (A))
+    { 
+        // A is purely an input matrix and must not be modified.  Instead,
+        // C is a sparse copy of A, which is then transposed in place.  If
+        // out of memory, C is freed and returned as NULL.
+        ASSERT (C == NULL && (*Chandle) == NULL) ;
+        GrB_Info info = GB_sparse_copy (Chandle, A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            return (info) ;
+        }
+        return (GB_transpose (Chandle, ctype, C_is_csc, NULL,
+            op1_in, op2_in, scalar, binop_bind1st, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort A if it is a jumbled vector
+    //--------------------------------------------------------------------------
+
+    if (GB_JUMBLED (A) && (A->vdim == 1 || A->vlen == 1))
+    {
+        GrB_Info info = GB_unjumble (A, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            GB_FREE_C ;
+            return (info) ;
+        }
+    }
+
     //--------------------------------------------------------------------------
     // determine the number of threads to use here
     //--------------------------------------------------------------------------
@@ -202,6 +253,8 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
 
     bool A_is_hyper = A->is_hyper ;
     double A_hyper_ratio = A->hyper_ratio ;
+    int A_sparsity = A->sparsity ;
+    double A_bitmap_switch = A->bitmap_switch ;
 
     int64_t anzmax = A->nzmax ;
 
@@ -325,6 +378,115 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
         }
         ASSERT_MATRIX_OK (*Chandle, "C transpose empty", GB0) ;
 
+    }
+    else if (GB_IS_FULL (A))
+    {
+
+        //======================================================================
+        // transpose a full matrix
+        //======================================================================
+
+        // The pattern of a full matrix is implicit, so only the values are
+        // transposed, and C is also full.  If A is a single vector and no
+        // typecast or operator is needed, the values of A are already in the
+        // right order, and C->x is a shallow copy of A->x.
+
+        bool is_vector = (avdim == 1 || avlen == 1) ;
+        GB_void *GB_RESTRICT Cx = NULL ;
+        GB_void *GB_RESTRICT W = NULL ;
+        if (allocate_new_Cx || !is_vector)
+        { 
+            Cx = GB_MALLOC (anz * csize, GB_void) ;
+        }
+        if (allocate_new_Cx && !is_vector)
+        { 
+            // workspace for op(A) or (ctype) A, before it is transposed
+            W = GB_MALLOC (anz * csize, GB_void) ;
+        }
+        if ((Cx == NULL && (allocate_new_Cx || !is_vector))
+            || (W == NULL && allocate_new_Cx && !is_vector))
+        { 
+            // out of memory
+            GB_FREE (Cx) ;
+            GB_FREE (W) ;
+            GB_FREE_C ;
+            GB_FREE_WORK ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+
+        //----------------------------------------------------------------------
+        // Cx = op ((op->xtype) A'), (ctype) A', or A'
+        //----------------------------------------------------------------------
+
+        // T is the input to the transpose: Ax, or W = op (Ax) or (ctype) Ax
+        GB_void *GB_RESTRICT T = is_vector ? Cx : W ;
+        if (op1 != NULL || op2 != NULL)
+        { 
+            GB_apply_op (T, op1, op2, scalar, binop_bind1st,
+                (const GB_void *) Ax, atype, anz, Context) ;
+        }
+        else if (ctype != atype)
+        { 
+            GB_cast_array (T, ccode, Ax, acode, asize, anz, nthreads) ;
+        }
+        else
+        { 
+            T = Ax ;
+        }
+
+        if (!is_vector)
+        { 
+            GB_transpose_full (Cx, T, csize, avlen, avdim, nthreads) ;
+        }
+        GB_FREE (W) ;
+
+        //----------------------------------------------------------------------
+        // allocate the header of C, or reuse the header of A if in place
+        //----------------------------------------------------------------------
+
+        // if *Chandle == NULL, allocate a new header; otherwise reuse existing
+        info = GB_new (Chandle, ctype, avdim, avlen, GB_Ap_null, C_is_csc,
+            GB_FORCE_NONHYPER, A_hyper_ratio, avlen, Context) ;
+        if (info != GrB_SUCCESS)
+        { 
+            // out of memory
+            ASSERT (!in_place) ;        // cannot fail if in place
+            GB_FREE (Cx) ;
+            GB_FREE_C ;
+            GB_FREE_WORK ;
+            return (info) ;
+        }
+
+        if (!in_place)
+        { 
+            C = (*Chandle) ;
+        }
+        else
+        { 
+            ASSERT (A == C && A == (*Chandle)) ;
+        }
+
+        if (Cx == NULL)
+        { 
+            // no type change; numerical values of C are a shallow copy of A
+            C->x = Ax ; C->x_shallow = (in_place) ? Ax_shallow : true ;
+            Ax = NULL ;  // do not free prior Ax
+        }
+        else
+        { 
+            C->x = Cx ; C->x_shallow = false ;
+        }
+
+        C->nzmax = anz ;
+        C->nvec_nonempty = avlen ;
+        C->magic = GB_MAGIC ;
+
+        //----------------------------------------------------------------------
+        // free prior space
+        //----------------------------------------------------------------------
+
+        GB_FREE_IN_PLACE_A ;
+
     }
     else if (avdim == 1)
     {
@@ -1009,8 +1171,13 @@ GrB_Info GB_transpose           // C=A', C=(ctype)A or C=op(A')
     // get the output matrix
     C = (*Chandle) ;
 
-    // transplant the hyper_ratio from A to C
+    // transplant the hyper_ratio, sparsity control, and bitmap switch from A
     C->hyper_ratio = A_hyper_ratio ;
+    C->sparsity = A_sparsity ;
+    C->bitmap_switch = A_bitmap_switch ;
+
+    // all methods above return C with sorted vectors
+    C->jumbled = false ;
 
     ASSERT_MATRIX_OK (C, "C to conform in GB_transpose", GB0) ;
 
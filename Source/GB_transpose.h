@@ -68,6 +68,16 @@ void GB_transpose_op    // transpose, typecast, and apply operator to a matrix
     int naslice                         // # of slices of A
 ) ;
 
+void GB_transpose_full          // Cx = Ax' for a full matrix
+(
+    GB_void *GB_RESTRICT Cx_output,     // output values, size avlen*avdim
+    const GB_void *GB_RESTRICT Ax_input,// input values, size avlen*avdim
+    const size_t size,                  // size of each entry
+    const int64_t avlen,                // A is avlen-by-avdim
+    const int64_t avdim,
+    int nthreads                        // # of threads to use
+) ;
+
 GB_PUBLIC   // accessed by the MATLAB interface only
 GrB_Info GB_shallow_copy    // create a purely shallow matrix
 (
@@ -0,0 +1,92 @@
+//------------------------------------------------------------------------------
+// GB_transpose_full: transpose the values of a full matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Cx = Ax', where Ax holds the values of an avlen-by-avdim full matrix, and
+// Cx holds the values of its avdim-by-avlen transpose.  No typecasting is
+// done, and no operator is applied; entries are moved as opaque blocks of
+// size bytes.  The pattern of a full matrix is implicit, so only the values
+// need to be transposed.  Cx and Ax must not be aliased.
+
+#include "GB_transpose.h"
+
+// tile size: a 64-by-64 tile of double is 32KB for each of Ax and Cx
+#define GB_TILE 64
+
+void GB_transpose_full          // Cx = Ax' for a full matrix
+(
+    GB_void *GB_RESTRICT Cx_output,     // output values, size avlen*avdim
+    const GB_void *GB_RESTRICT Ax_input,// input values, size avlen*avdim
+    const size_t size,                  // size of each entry
+    const int64_t avlen,                // A is avlen-by-avdim
+    const int64_t avdim,
+    int nthreads                        // # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // determine the tiles
+    //--------------------------------------------------------------------------
+
+    int64_t ntiles_i = (avlen + GB_TILE - 1) / GB_TILE ;
+    int64_t ntiles_j = (avdim + GB_TILE - 1) / GB_TILE ;
+    int64_t ntasks = ntiles_i * ntiles_j ;
+    nthreads = (int) GB_IMIN (nthreads, ntasks) ;
+    nthreads = GB_IMAX (nthreads, 1) ;
+
+    //--------------------------------------------------------------------------
+    // transpose the values
+    //--------------------------------------------------------------------------
+
+    switch (size)
+    {
+        case 1 : 
+            #define GB_CTYPE uint8_t
+            #include "GB_transpose_full_template.c"
+            break ;
+
+        case 2 : 
+            #define GB_CTYPE uint16_t
+            #include "GB_transpose_full_template.c"
+            break ;
+
+        case 4 : 
+            #define GB_CTYPE uint32_t
+            #include "GB_transpose_full_template.c"
+            break ;
+
+        case 8 : 
+            #define GB_CTYPE uint64_t
+            #include "GB_transpose_full_template.c"
+            break ;
+
+        default : 
+        {
+            // user-defined type of arbitrary size
+            int tid ;
+            #pragma omp parallel for num_threads(nthreads) schedule(static)
+            for (tid = 0 ; tid < ntasks ; tid++)
+            {
+                int64_t ti = tid % ntiles_i ;
+                int64_t tj = tid / ntiles_i ;
+                int64_t i1 = ti * GB_TILE, i2 = GB_IMIN (i1 + GB_TILE, avlen) ;
+                int64_t j1 = tj * GB_TILE, j2 = GB_IMIN (j1 + GB_TILE, avdim) ;
+                for (int64_t i = i1 ; i < i2 ; i++)
+                {
+                    for (int64_t j = j1 ; j < j2 ; j++)
+                    { 
+                        // C(j,i) = A(i,j)
+                        memcpy (Cx_output + (j + i*avdim) * size,
+                                Ax_input  + (i + j*avlen) * size, size) ;
+                    }
+                }
+            }
+        }
+        break ;
+    }
+}
@@ -0,0 +1,157 @@
+//------------------------------------------------------------------------------
+// GB_unjumble: sort the vectors of a jumbled matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// A sparse or hypersparse matrix can be left jumbled by GB_AxB_saxpy3, where
+// the row indices within each vector appear in any order.  This function
+// sorts each vector of A in place, along with its values, and clears the
+// A->jumbled flag.  Vectors that are already sorted are left unchanged.
+
+// A may have pending tuples, which are ignored, but it must not have any
+// zombies, since GB_Matrix_wait removes those first.  If A->i or A->x are
+// shallow, private copies are made first, since the shared arrays of another
+// matrix cannot be modified.  Otherwise, the only workspace is the small
+// slice of A->p.
+
+#include "GB_sort.h"
+
+#define GB_FREE_WORK GB_FREE (A_slice)
+
+GrB_Info GB_unjumble            // sort the vectors of A
+(
+    GrB_Matrix A,               // matrix to sort in place
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+    ASSERT (GB_PENDING_OK (A)) ;
+    ASSERT (!GB_ZOMBIES (A)) ;
+
+    if (!A->jumbled)
+    {
+        // nothing to do
+        return (GrB_SUCCESS) ;
+    }
+
+    // only sparse and hypersparse matrices can be jumbled
+    ASSERT (!GB_IS_FULL (A) && !GB_IS_BITMAP (A)) ;
+
+    int64_t anvec = A->nvec ;
+    int64_t anz = GB_NNZ (A) ;
+
+    if (anz == 0)
+    { 
+        // an empty matrix is already sorted
+        A->jumbled = false ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // determine the number of threads to use
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (anz + anvec, chunk, nthreads_max) ;
+    int ntasks = (nthreads == 1) ? 1 : (32 * nthreads) ;
+    ntasks = GB_IMIN (ntasks, anvec) ;
+    ntasks = GB_IMAX (ntasks, 1) ;
+
+    //--------------------------------------------------------------------------
+    // make private copies of A->i and A->x if they are shallow
+    //--------------------------------------------------------------------------
+
+    const size_t asize = A->type->size ;
+    int64_t anzmax = GB_IMAX (A->nzmax, 1) ;
+
+    if (A->i_shallow)
+    {
+        int64_t *GB_RESTRICT Ai_new = GB_MALLOC (anzmax, int64_t) ;
+        if (Ai_new == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ai_new, A->i, anz * sizeof (int64_t), nthreads) ;
+        A->i = Ai_new ;
+        A->i_shallow = false ;
+    }
+
+    if (A->x_shallow)
+    {
+        GB_void *GB_RESTRICT Ax_new = GB_MALLOC (anzmax * asize, GB_void) ;
+        if (Ax_new == NULL)
+        { 
+            // out of memory
+            return (GrB_OUT_OF_MEMORY) ;
+        }
+        GB_memcpy (Ax_new, A->x, anz * asize, nthreads) ;
+        A->x = Ax_new ;
+        A->x_shallow = false ;
+    }
+
+    //--------------------------------------------------------------------------
+    // slice the vectors of A so each task has about the same # of entries
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT A_slice = NULL ;
+    if (!GB_pslice (&A_slice, A->p, anvec, ntasks))
+    {
+        // out of memory
+        return (GrB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // sort each vector of A
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    int64_t *GB_RESTRICT Ai = A->i ;
+    GB_void *GB_RESTRICT Ax = (GB_void *) A->x ;
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        for (int64_t k = A_slice [tid] ; k < A_slice [tid+1] ; k++)
+        {
+            int64_t pA_start = Ap [k] ;
+            int64_t pA_end   = Ap [k+1] ;
+            int64_t aknz = pA_end - pA_start ;
+
+            // check if A(:,k) is already sorted
+            bool sorted = true ;
+            for (int64_t p = pA_start + 1 ; sorted && p < pA_end ; p++)
+            {
+                sorted = (Ai [p-1] < Ai [p]) ;
+            }
+
+            if (!sorted)
+            {
+                // sort A(:,k) along with its values
+                GB_qsort_1b (Ai + pA_start, Ax + pA_start * asize, asize,
+                    aknz) ;
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // free workspace and return result
+    //--------------------------------------------------------------------------
+
+    GB_FREE_WORK ;
+    A->jumbled = false ;
+    ASSERT_MATRIX_OK (A, "A unjumbled", GB_FLIP (GB0)) ;
+    return (GrB_SUCCESS) ;
+}
+
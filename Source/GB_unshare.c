@@ -0,0 +1,132 @@
+//------------------------------------------------------------------------------
+// GB_unshare: give a matrix its own copy of any shallow content
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Any shallow component A->p, A->h, A->i, or A->x is copied into newly
+// allocated space, so that A can be reallocated or freed in part.  This is
+// required for a matrix from GxB_Matrix_import_mmap, when it is modified in
+// any way other than overwriting its entries in place.  Once A owns all of its
+// content, the file mapping (if any) is released.  Pending tuples and zombies
+// are left unchanged.  If A has no shallow content, nothing is done.
+
+#include "GB.h"
+
+#define GB_FREE_ALL     \
+{                       \
+    GB_FREE (Ap) ;      \
+    GB_FREE (Ah) ;      \
+    GB_FREE (Ai) ;      \
+    GB_FREE (Ax) ;      \
+}
+
+GrB_Info GB_unshare             // give a matrix its own copy of its content
+(
+    GrB_Matrix A,               // matrix to modify
+    GB_Context Context
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    ASSERT (A != NULL) ;
+    ASSERT (!A->is_slice) ;
+    ASSERT (GB_PENDING_OK (A)) ; ASSERT (GB_ZOMBIES_OK (A)) ;
+    ASSERT (GB_JUMBLED_OK (A)) ;
+
+    if (!(A->p_shallow || A->h_shallow || A->i_shallow || A->x_shallow))
+    { 
+        // A owns all of its content already
+        GB_mmap_free (A) ;
+        return (GrB_SUCCESS) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // allocate the new content
+    //--------------------------------------------------------------------------
+
+    int64_t *GB_RESTRICT Ap = NULL ;
+    int64_t *GB_RESTRICT Ah = NULL ;
+    int64_t *GB_RESTRICT Ai = NULL ;
+    GB_void *GB_RESTRICT Ax = NULL ;
+
+    int64_t plen = A->plen ;
+    int64_t nzmax = GB_IMAX (A->nzmax, 1) ;
+    size_t asize = A->type->size ;
+    bool ok = true ;
+
+    if (A->p_shallow && A->p != NULL)
+    { 
+        Ap = GB_MALLOC (plen+1, int64_t) ;
+        ok = ok && (Ap != NULL) ;
+    }
+    if (A->h_shallow && A->h != NULL)
+    { 
+        Ah = GB_MALLOC (GB_IMAX (plen, 1), int64_t) ;
+        ok = ok && (Ah != NULL) ;
+    }
+    if (A->i_shallow && A->i != NULL)
+    { 
+        Ai = GB_MALLOC (nzmax, int64_t) ;
+        ok = ok && (Ai != NULL) ;
+    }
+    if (A->x_shallow && A->x != NULL)
+    { 
+        Ax = GB_MALLOC (nzmax * asize, GB_void) ;
+        ok = ok && (Ax != NULL) ;
+    }
+
+    if (!ok)
+    { 
+        // out of memory; A is not modified
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // copy the shallow content into the new space
+    //--------------------------------------------------------------------------
+
+    GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+    int nthreads = GB_nthreads (A->nzmax + plen, chunk, nthreads_max) ;
+
+    if (Ap != NULL)
+    { 
+        GB_memcpy (Ap, A->p, (plen+1) * sizeof (int64_t), nthreads) ;
+        A->p = Ap ; Ap = NULL ;
+    }
+    if (Ah != NULL)
+    { 
+        GB_memcpy (Ah, A->h, plen * sizeof (int64_t), nthreads) ;
+        A->h = Ah ; Ah = NULL ;
+    }
+    if (Ai != NULL)
+    { 
+        GB_memcpy (Ai, A->i, A->nzmax * sizeof (int64_t), nthreads) ;
+        A->i = Ai ; Ai = NULL ;
+    }
+    if (Ax != NULL)
+    { 
+        GB_memcpy (Ax, A->x, A->nzmax * asize, nthreads) ;
+        A->x = Ax ; Ax = NULL ;
+    }
+
+    //--------------------------------------------------------------------------
+    // release the file mapping, if any
+    //--------------------------------------------------------------------------
+
+    // any remaining shallow component is NULL
+    A->p_shallow = false ;
+    A->h_shallow = false ;
+    A->i_shallow = false ;
+    A->x_shallow = false ;
+    GB_mmap_free (A) ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,67 @@
+//------------------------------------------------------------------------------
+// GB_workspace_calloc: allocate workspace set to zero, from the pool if possible
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Like GB_workspace_malloc, except that the first nitems*size_of_item bytes of
+// the workspace are set to zero.  A block taken from the workspace pool is
+// cleared in parallel.  Any space beyond that is not initialized.
+
+#include "GB.h"
+
+void *GB_workspace_calloc   // pointer to workspace, set to zero
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    size_t *size_allocated, // # of bytes in the workspace
+    GB_Context Context
+)
+{
+
+    ASSERT (size_allocated != NULL) ;
+    (*size_allocated) = 0 ;
+
+    // make sure at least one byte is allocated
+    nitems = GB_IMAX (1, nitems) ;
+    size_of_item = GB_IMAX (1, size_of_item) ;
+    size_t size ;
+    if (!GB_size_t_multiply (&size, nitems, size_of_item))
+    { 
+        // overflow
+        return (NULL) ;
+    }
+
+    // get a block from the pool, if possible
+    GB_void *p = NULL ;
+    if (!GB_Global_malloc_tracking_get ( ))
+    { 
+        p = (GB_void *) GB_Global_workspace_get (size, size_allocated) ;
+    }
+
+    if (p == NULL)
+    { 
+        // allocate a new block, already set to zero
+        p = (GB_void *) GB_calloc_memory (nitems, size_of_item) ;
+        (*size_allocated) = (p == NULL) ? 0 : size ;
+    }
+    else
+    {
+        // clear the block taken from the pool
+        GB_GET_NTHREADS_MAX (nthreads_max, chunk, Context) ;
+        int nthreads = GB_nthreads (size, chunk, nthreads_max) ;
+        int tid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(static)
+        for (tid = 0 ; tid < nthreads ; tid++)
+        { 
+            size_t pstart, pend ;
+            GB_PARTITION (pstart, pend, size, tid, nthreads) ;
+            memset (p + pstart, 0, pend - pstart) ;
+        }
+    }
+    return ((void *) p) ;
+}
+
@@ -0,0 +1,32 @@
+//------------------------------------------------------------------------------
+// GB_workspace_free: free workspace, or return it to the workspace pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Workspace from GB_workspace_malloc or GB_workspace_calloc is placed in the
+// workspace pool, if it fits.  Otherwise it is freed, or a smaller block in
+// the pool is evicted and freed instead.  If p is NULL, nothing is done.
+
+#include "GB.h"
+
+void GB_workspace_free
+(
+    void *p,                // workspace to free, or to return to the pool
+    size_t size_allocated   // # of bytes in the workspace
+)
+{
+    if (p != NULL)
+    {
+        if (!GB_Global_malloc_tracking_get ( ) && size_allocated > 0)
+        { 
+            // place p in the pool; free p or the block it evicts, if any
+            p = GB_Global_workspace_put (p, size_allocated) ;
+        }
+        GB_free_memory (p) ;
+    }
+}
+
@@ -0,0 +1,53 @@
+//------------------------------------------------------------------------------
+// GB_workspace_malloc: allocate workspace, from the workspace pool if possible
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The smallest block in the workspace pool that is large enough is returned,
+// or a new block is allocated by GB_malloc_memory if no such block is in the
+// pool.  Space is not initialized.  The pool is not used if malloc tracking
+// is enabled, so that the count of allocated blocks remains accurate.
+
+#include "GB.h"
+
+void *GB_workspace_malloc   // pointer to workspace
+(
+    size_t nitems,          // number of items to allocate
+    size_t size_of_item,    // sizeof each item
+    size_t *size_allocated  // # of bytes in the workspace
+)
+{
+
+    ASSERT (size_allocated != NULL) ;
+    (*size_allocated) = 0 ;
+
+    // make sure at least one byte is allocated
+    nitems = GB_IMAX (1, nitems) ;
+    size_of_item = GB_IMAX (1, size_of_item) ;
+    size_t size ;
+    if (!GB_size_t_multiply (&size, nitems, size_of_item))
+    { 
+        // overflow
+        return (NULL) ;
+    }
+
+    // get a block from the pool, if possible
+    void *p = NULL ;
+    if (!GB_Global_malloc_tracking_get ( ))
+    { 
+        p = GB_Global_workspace_get (size, size_allocated) ;
+    }
+
+    if (p == NULL)
+    { 
+        // allocate a new block
+        p = GB_malloc_memory (nitems, size_of_item) ;
+        (*size_allocated) = (p == NULL) ? 0 : size ;
+    }
+    return (p) ;
+}
+
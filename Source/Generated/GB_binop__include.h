@@ -40,6 +40,17 @@ GrB_Info GB_Cdense_accumB__first_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_bool
 (
     GrB_Matrix C,
@@ -102,6 +113,28 @@ GrB_Info GB_AemultB__first_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_bool
 (
@@ -180,6 +213,17 @@ GrB_Info GB_Cdense_accumB__first_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_int8
 (
     GrB_Matrix C,
@@ -242,6 +286,28 @@ GrB_Info GB_AemultB__first_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_int8
 (
@@ -320,6 +386,17 @@ GrB_Info GB_Cdense_accumB__first_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_int16
 (
     GrB_Matrix C,
@@ -382,6 +459,28 @@ GrB_Info GB_AemultB__first_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_int16
 (
@@ -460,6 +559,17 @@ GrB_Info GB_Cdense_accumB__first_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_int32
 (
     GrB_Matrix C,
@@ -522,6 +632,28 @@ GrB_Info GB_AemultB__first_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_int32
 (
@@ -600,6 +732,17 @@ GrB_Info GB_Cdense_accumB__first_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_int64
 (
     GrB_Matrix C,
@@ -662,6 +805,28 @@ GrB_Info GB_AemultB__first_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_int64
 (
@@ -740,6 +905,17 @@ GrB_Info GB_Cdense_accumB__first_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_uint8
 (
     GrB_Matrix C,
@@ -802,6 +978,28 @@ GrB_Info GB_AemultB__first_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_uint8
 (
@@ -880,6 +1078,17 @@ GrB_Info GB_Cdense_accumB__first_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_uint16
 (
     GrB_Matrix C,
@@ -942,6 +1151,28 @@ GrB_Info GB_AemultB__first_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_uint16
 (
@@ -1020,6 +1251,17 @@ GrB_Info GB_Cdense_accumB__first_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_uint32
 (
     GrB_Matrix C,
@@ -1082,6 +1324,28 @@ GrB_Info GB_AemultB__first_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_uint32
 (
@@ -1160,6 +1424,17 @@ GrB_Info GB_Cdense_accumB__first_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_uint64
 (
     GrB_Matrix C,
@@ -1222,6 +1497,28 @@ GrB_Info GB_AemultB__first_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_uint64
 (
@@ -1300,6 +1597,17 @@ GrB_Info GB_Cdense_accumB__first_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_fp32
 (
     GrB_Matrix C,
@@ -1362,6 +1670,28 @@ GrB_Info GB_AemultB__first_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_fp32
 (
@@ -1440,6 +1770,17 @@ GrB_Info GB_Cdense_accumB__first_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_fp64
 (
     GrB_Matrix C,
@@ -1502,6 +1843,28 @@ GrB_Info GB_AemultB__first_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_fp64
 (
@@ -1580,6 +1943,17 @@ GrB_Info GB_Cdense_accumB__first_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_fc32
 (
     GrB_Matrix C,
@@ -1642,6 +2016,28 @@ GrB_Info GB_AemultB__first_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_fc32
 (
@@ -1720,6 +2116,17 @@ GrB_Info GB_Cdense_accumB__first_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__first_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__first_fc64
 (
     GrB_Matrix C,
@@ -1782,6 +2189,28 @@ GrB_Info GB_AemultB__first_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__first_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__first_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__first_fc64
 (
@@ -1860,6 +2289,17 @@ GrB_Info GB_Cdense_accumB__second_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_bool
 (
     GrB_Matrix C,
@@ -1922,6 +2362,28 @@ GrB_Info GB_AemultB__second_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2000,6 +2462,17 @@ GrB_Info GB_Cdense_accumB__second_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_int8
 (
     GrB_Matrix C,
@@ -2062,6 +2535,28 @@ GrB_Info GB_AemultB__second_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2140,6 +2635,17 @@ GrB_Info GB_Cdense_accumB__second_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_int16
 (
     GrB_Matrix C,
@@ -2202,6 +2708,28 @@ GrB_Info GB_AemultB__second_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2280,6 +2808,17 @@ GrB_Info GB_Cdense_accumB__second_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_int32
 (
     GrB_Matrix C,
@@ -2342,6 +2881,28 @@ GrB_Info GB_AemultB__second_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2420,6 +2981,17 @@ GrB_Info GB_Cdense_accumB__second_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_int64
 (
     GrB_Matrix C,
@@ -2482,6 +3054,28 @@ GrB_Info GB_AemultB__second_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2560,6 +3154,17 @@ GrB_Info GB_Cdense_accumB__second_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_uint8
 (
     GrB_Matrix C,
@@ -2622,6 +3227,28 @@ GrB_Info GB_AemultB__second_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2700,6 +3327,17 @@ GrB_Info GB_Cdense_accumB__second_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_uint16
 (
     GrB_Matrix C,
@@ -2762,6 +3400,28 @@ GrB_Info GB_AemultB__second_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2840,6 +3500,17 @@ GrB_Info GB_Cdense_accumB__second_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_uint32
 (
     GrB_Matrix C,
@@ -2902,6 +3573,28 @@ GrB_Info GB_AemultB__second_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -2980,6 +3673,17 @@ GrB_Info GB_Cdense_accumB__second_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_uint64
 (
     GrB_Matrix C,
@@ -3042,6 +3746,28 @@ GrB_Info GB_AemultB__second_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3120,6 +3846,17 @@ GrB_Info GB_Cdense_accumB__second_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_fp32
 (
     GrB_Matrix C,
@@ -3182,6 +3919,28 @@ GrB_Info GB_AemultB__second_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3260,6 +4019,17 @@ GrB_Info GB_Cdense_accumB__second_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_fp64
 (
     GrB_Matrix C,
@@ -3322,6 +4092,28 @@ GrB_Info GB_AemultB__second_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3400,6 +4192,17 @@ GrB_Info GB_Cdense_accumB__second_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_fc32
 (
     GrB_Matrix C,
@@ -3462,6 +4265,28 @@ GrB_Info GB_AemultB__second_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3540,6 +4365,17 @@ GrB_Info GB_Cdense_accumB__second_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__second_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__second_fc64
 (
     GrB_Matrix C,
@@ -3602,6 +4438,28 @@ GrB_Info GB_AemultB__second_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__second_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__second_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3680,6 +4538,17 @@ GrB_Info GB_Cdense_accumB__pair_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_bool
 (
     GrB_Matrix C,
@@ -3742,6 +4611,28 @@ GrB_Info GB_AemultB__pair_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3820,6 +4711,17 @@ GrB_Info GB_Cdense_accumB__pair_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_int8
 (
     GrB_Matrix C,
@@ -3882,6 +4784,28 @@ GrB_Info GB_AemultB__pair_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -3960,6 +4884,17 @@ GrB_Info GB_Cdense_accumB__pair_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_int16
 (
     GrB_Matrix C,
@@ -4022,6 +4957,28 @@ GrB_Info GB_AemultB__pair_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4100,6 +5057,17 @@ GrB_Info GB_Cdense_accumB__pair_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_int32
 (
     GrB_Matrix C,
@@ -4162,6 +5130,28 @@ GrB_Info GB_AemultB__pair_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4240,6 +5230,17 @@ GrB_Info GB_Cdense_accumB__pair_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_int64
 (
     GrB_Matrix C,
@@ -4302,6 +5303,28 @@ GrB_Info GB_AemultB__pair_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4380,6 +5403,17 @@ GrB_Info GB_Cdense_accumB__pair_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_uint8
 (
     GrB_Matrix C,
@@ -4442,6 +5476,28 @@ GrB_Info GB_AemultB__pair_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4520,6 +5576,17 @@ GrB_Info GB_Cdense_accumB__pair_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_uint16
 (
     GrB_Matrix C,
@@ -4582,6 +5649,28 @@ GrB_Info GB_AemultB__pair_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4660,6 +5749,17 @@ GrB_Info GB_Cdense_accumB__pair_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_uint32
 (
     GrB_Matrix C,
@@ -4722,6 +5822,28 @@ GrB_Info GB_AemultB__pair_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4800,6 +5922,17 @@ GrB_Info GB_Cdense_accumB__pair_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_uint64
 (
     GrB_Matrix C,
@@ -4862,6 +5995,28 @@ GrB_Info GB_AemultB__pair_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -4940,6 +6095,17 @@ GrB_Info GB_Cdense_accumB__pair_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_fp32
 (
     GrB_Matrix C,
@@ -5002,6 +6168,28 @@ GrB_Info GB_AemultB__pair_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -5080,6 +6268,17 @@ GrB_Info GB_Cdense_accumB__pair_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_fp64
 (
     GrB_Matrix C,
@@ -5142,6 +6341,28 @@ GrB_Info GB_AemultB__pair_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -5220,6 +6441,17 @@ GrB_Info GB_Cdense_accumB__pair_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_fc32
 (
     GrB_Matrix C,
@@ -5282,6 +6514,28 @@ GrB_Info GB_AemultB__pair_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -5360,6 +6614,17 @@ GrB_Info GB_Cdense_accumB__pair_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pair_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pair_fc64
 (
     GrB_Matrix C,
@@ -5422,6 +6687,28 @@ GrB_Info GB_AemultB__pair_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pair_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pair_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 #if 0
 GrB_Info (none)
 (
@@ -5500,6 +6787,17 @@ GrB_Info GB_Cdense_accumB__min_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_int8
 (
     GrB_Matrix C,
@@ -5562,6 +6860,28 @@ GrB_Info GB_AemultB__min_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_int8
 (
@@ -5640,6 +6960,17 @@ GrB_Info GB_Cdense_accumB__min_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_int16
 (
     GrB_Matrix C,
@@ -5702,6 +7033,28 @@ GrB_Info GB_AemultB__min_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_int16
 (
@@ -5780,6 +7133,17 @@ GrB_Info GB_Cdense_accumB__min_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_int32
 (
     GrB_Matrix C,
@@ -5842,6 +7206,28 @@ GrB_Info GB_AemultB__min_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_int32
 (
@@ -5920,6 +7306,17 @@ GrB_Info GB_Cdense_accumB__min_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_int64
 (
     GrB_Matrix C,
@@ -5982,6 +7379,28 @@ GrB_Info GB_AemultB__min_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_int64
 (
@@ -6060,6 +7479,17 @@ GrB_Info GB_Cdense_accumB__min_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_uint8
 (
     GrB_Matrix C,
@@ -6122,6 +7552,28 @@ GrB_Info GB_AemultB__min_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_uint8
 (
@@ -6200,6 +7652,17 @@ GrB_Info GB_Cdense_accumB__min_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_uint16
 (
     GrB_Matrix C,
@@ -6262,6 +7725,28 @@ GrB_Info GB_AemultB__min_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_uint16
 (
@@ -6340,6 +7825,17 @@ GrB_Info GB_Cdense_accumB__min_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_uint32
 (
     GrB_Matrix C,
@@ -6402,6 +7898,28 @@ GrB_Info GB_AemultB__min_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_uint32
 (
@@ -6480,6 +7998,17 @@ GrB_Info GB_Cdense_accumB__min_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_uint64
 (
     GrB_Matrix C,
@@ -6542,6 +8071,28 @@ GrB_Info GB_AemultB__min_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_uint64
 (
@@ -6620,6 +8171,17 @@ GrB_Info GB_Cdense_accumB__min_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_fp32
 (
     GrB_Matrix C,
@@ -6682,6 +8244,28 @@ GrB_Info GB_AemultB__min_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_fp32
 (
@@ -6760,6 +8344,17 @@ GrB_Info GB_Cdense_accumB__min_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__min_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__min_fp64
 (
     GrB_Matrix C,
@@ -6822,6 +8417,28 @@ GrB_Info GB_AemultB__min_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__min_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__min_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__min_fp64
 (
@@ -6900,6 +8517,17 @@ GrB_Info GB_Cdense_accumB__max_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_int8
 (
     GrB_Matrix C,
@@ -6962,6 +8590,28 @@ GrB_Info GB_AemultB__max_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_int8
 (
@@ -7040,6 +8690,17 @@ GrB_Info GB_Cdense_accumB__max_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_int16
 (
     GrB_Matrix C,
@@ -7102,6 +8763,28 @@ GrB_Info GB_AemultB__max_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_int16
 (
@@ -7180,6 +8863,17 @@ GrB_Info GB_Cdense_accumB__max_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_int32
 (
     GrB_Matrix C,
@@ -7242,6 +8936,28 @@ GrB_Info GB_AemultB__max_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_int32
 (
@@ -7320,6 +9036,17 @@ GrB_Info GB_Cdense_accumB__max_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_int64
 (
     GrB_Matrix C,
@@ -7382,6 +9109,28 @@ GrB_Info GB_AemultB__max_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_int64
 (
@@ -7460,6 +9209,17 @@ GrB_Info GB_Cdense_accumB__max_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_uint8
 (
     GrB_Matrix C,
@@ -7522,6 +9282,28 @@ GrB_Info GB_AemultB__max_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_uint8
 (
@@ -7600,6 +9382,17 @@ GrB_Info GB_Cdense_accumB__max_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_uint16
 (
     GrB_Matrix C,
@@ -7662,6 +9455,28 @@ GrB_Info GB_AemultB__max_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_uint16
 (
@@ -7740,6 +9555,17 @@ GrB_Info GB_Cdense_accumB__max_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_uint32
 (
     GrB_Matrix C,
@@ -7802,6 +9628,28 @@ GrB_Info GB_AemultB__max_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_uint32
 (
@@ -7880,6 +9728,17 @@ GrB_Info GB_Cdense_accumB__max_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_uint64
 (
     GrB_Matrix C,
@@ -7942,6 +9801,28 @@ GrB_Info GB_AemultB__max_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_uint64
 (
@@ -8020,6 +9901,17 @@ GrB_Info GB_Cdense_accumB__max_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_fp32
 (
     GrB_Matrix C,
@@ -8082,6 +9974,28 @@ GrB_Info GB_AemultB__max_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_fp32
 (
@@ -8160,6 +10074,17 @@ GrB_Info GB_Cdense_accumB__max_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__max_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__max_fp64
 (
     GrB_Matrix C,
@@ -8222,6 +10147,28 @@ GrB_Info GB_AemultB__max_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__max_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__max_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__max_fp64
 (
@@ -8300,6 +10247,17 @@ GrB_Info GB_Cdense_accumB__plus_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_int8
 (
     GrB_Matrix C,
@@ -8362,6 +10320,28 @@ GrB_Info GB_AemultB__plus_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_int8
 (
@@ -8440,6 +10420,17 @@ GrB_Info GB_Cdense_accumB__plus_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_int16
 (
     GrB_Matrix C,
@@ -8502,6 +10493,28 @@ GrB_Info GB_AemultB__plus_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_int16
 (
@@ -8580,6 +10593,17 @@ GrB_Info GB_Cdense_accumB__plus_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_int32
 (
     GrB_Matrix C,
@@ -8642,6 +10666,28 @@ GrB_Info GB_AemultB__plus_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_int32
 (
@@ -8720,6 +10766,17 @@ GrB_Info GB_Cdense_accumB__plus_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_int64
 (
     GrB_Matrix C,
@@ -8782,6 +10839,28 @@ GrB_Info GB_AemultB__plus_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_int64
 (
@@ -8860,6 +10939,17 @@ GrB_Info GB_Cdense_accumB__plus_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_uint8
 (
     GrB_Matrix C,
@@ -8922,6 +11012,28 @@ GrB_Info GB_AemultB__plus_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_uint8
 (
@@ -9000,6 +11112,17 @@ GrB_Info GB_Cdense_accumB__plus_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_uint16
 (
     GrB_Matrix C,
@@ -9062,6 +11185,28 @@ GrB_Info GB_AemultB__plus_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_uint16
 (
@@ -9140,6 +11285,17 @@ GrB_Info GB_Cdense_accumB__plus_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_uint32
 (
     GrB_Matrix C,
@@ -9202,6 +11358,28 @@ GrB_Info GB_AemultB__plus_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_uint32
 (
@@ -9280,6 +11458,17 @@ GrB_Info GB_Cdense_accumB__plus_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_uint64
 (
     GrB_Matrix C,
@@ -9342,6 +11531,28 @@ GrB_Info GB_AemultB__plus_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_uint64
 (
@@ -9420,6 +11631,17 @@ GrB_Info GB_Cdense_accumB__plus_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_fp32
 (
     GrB_Matrix C,
@@ -9482,6 +11704,28 @@ GrB_Info GB_AemultB__plus_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_fp32
 (
@@ -9560,6 +11804,17 @@ GrB_Info GB_Cdense_accumB__plus_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_fp64
 (
     GrB_Matrix C,
@@ -9622,6 +11877,28 @@ GrB_Info GB_AemultB__plus_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_fp64
 (
@@ -9700,6 +11977,17 @@ GrB_Info GB_Cdense_accumB__plus_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_fc32
 (
     GrB_Matrix C,
@@ -9762,6 +12050,28 @@ GrB_Info GB_AemultB__plus_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_fc32
 (
@@ -9840,6 +12150,17 @@ GrB_Info GB_Cdense_accumB__plus_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__plus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__plus_fc64
 (
     GrB_Matrix C,
@@ -9902,6 +12223,28 @@ GrB_Info GB_AemultB__plus_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__plus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__plus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__plus_fc64
 (
@@ -9980,6 +12323,17 @@ GrB_Info GB_Cdense_accumB__minus_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_int8
 (
     GrB_Matrix C,
@@ -10042,6 +12396,28 @@ GrB_Info GB_AemultB__minus_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_int8
 (
@@ -10120,6 +12496,17 @@ GrB_Info GB_Cdense_accumB__minus_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_int16
 (
     GrB_Matrix C,
@@ -10182,6 +12569,28 @@ GrB_Info GB_AemultB__minus_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_int16
 (
@@ -10260,6 +12669,17 @@ GrB_Info GB_Cdense_accumB__minus_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_int32
 (
     GrB_Matrix C,
@@ -10322,6 +12742,28 @@ GrB_Info GB_AemultB__minus_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_int32
 (
@@ -10400,6 +12842,17 @@ GrB_Info GB_Cdense_accumB__minus_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_int64
 (
     GrB_Matrix C,
@@ -10462,6 +12915,28 @@ GrB_Info GB_AemultB__minus_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_int64
 (
@@ -10540,6 +13015,17 @@ GrB_Info GB_Cdense_accumB__minus_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_uint8
 (
     GrB_Matrix C,
@@ -10602,6 +13088,28 @@ GrB_Info GB_AemultB__minus_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_uint8
 (
@@ -10680,6 +13188,17 @@ GrB_Info GB_Cdense_accumB__minus_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_uint16
 (
     GrB_Matrix C,
@@ -10742,6 +13261,28 @@ GrB_Info GB_AemultB__minus_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_uint16
 (
@@ -10820,6 +13361,17 @@ GrB_Info GB_Cdense_accumB__minus_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_uint32
 (
     GrB_Matrix C,
@@ -10882,6 +13434,28 @@ GrB_Info GB_AemultB__minus_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_uint32
 (
@@ -10960,6 +13534,17 @@ GrB_Info GB_Cdense_accumB__minus_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_uint64
 (
     GrB_Matrix C,
@@ -11022,6 +13607,28 @@ GrB_Info GB_AemultB__minus_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_uint64
 (
@@ -11100,6 +13707,17 @@ GrB_Info GB_Cdense_accumB__minus_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_fp32
 (
     GrB_Matrix C,
@@ -11162,6 +13780,28 @@ GrB_Info GB_AemultB__minus_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_fp32
 (
@@ -11240,6 +13880,17 @@ GrB_Info GB_Cdense_accumB__minus_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_fp64
 (
     GrB_Matrix C,
@@ -11302,6 +13953,28 @@ GrB_Info GB_AemultB__minus_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_fp64
 (
@@ -11380,6 +14053,17 @@ GrB_Info GB_Cdense_accumB__minus_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_fc32
 (
     GrB_Matrix C,
@@ -11442,6 +14126,28 @@ GrB_Info GB_AemultB__minus_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_fc32
 (
@@ -11520,6 +14226,17 @@ GrB_Info GB_Cdense_accumB__minus_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__minus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__minus_fc64
 (
     GrB_Matrix C,
@@ -11582,6 +14299,28 @@ GrB_Info GB_AemultB__minus_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__minus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__minus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__minus_fc64
 (
@@ -11660,6 +14399,17 @@ GrB_Info GB_Cdense_accumB__rminus_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_int8
 (
     GrB_Matrix C,
@@ -11722,6 +14472,28 @@ GrB_Info GB_AemultB__rminus_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_int8
 (
@@ -11800,6 +14572,17 @@ GrB_Info GB_Cdense_accumB__rminus_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_int16
 (
     GrB_Matrix C,
@@ -11862,6 +14645,28 @@ GrB_Info GB_AemultB__rminus_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_int16
 (
@@ -11940,6 +14745,17 @@ GrB_Info GB_Cdense_accumB__rminus_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_int32
 (
     GrB_Matrix C,
@@ -12002,6 +14818,28 @@ GrB_Info GB_AemultB__rminus_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_int32
 (
@@ -12080,6 +14918,17 @@ GrB_Info GB_Cdense_accumB__rminus_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_int64
 (
     GrB_Matrix C,
@@ -12142,6 +14991,28 @@ GrB_Info GB_AemultB__rminus_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_int64
 (
@@ -12220,6 +15091,17 @@ GrB_Info GB_Cdense_accumB__rminus_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_uint8
 (
     GrB_Matrix C,
@@ -12282,6 +15164,28 @@ GrB_Info GB_AemultB__rminus_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_uint8
 (
@@ -12360,6 +15264,17 @@ GrB_Info GB_Cdense_accumB__rminus_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_uint16
 (
     GrB_Matrix C,
@@ -12422,6 +15337,28 @@ GrB_Info GB_AemultB__rminus_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_uint16
 (
@@ -12500,6 +15437,17 @@ GrB_Info GB_Cdense_accumB__rminus_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_uint32
 (
     GrB_Matrix C,
@@ -12562,6 +15510,28 @@ GrB_Info GB_AemultB__rminus_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_uint32
 (
@@ -12640,6 +15610,17 @@ GrB_Info GB_Cdense_accumB__rminus_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_uint64
 (
     GrB_Matrix C,
@@ -12702,6 +15683,28 @@ GrB_Info GB_AemultB__rminus_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_uint64
 (
@@ -12780,6 +15783,17 @@ GrB_Info GB_Cdense_accumB__rminus_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_fp32
 (
     GrB_Matrix C,
@@ -12842,6 +15856,28 @@ GrB_Info GB_AemultB__rminus_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_fp32
 (
@@ -12920,6 +15956,17 @@ GrB_Info GB_Cdense_accumB__rminus_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_fp64
 (
     GrB_Matrix C,
@@ -12982,6 +16029,28 @@ GrB_Info GB_AemultB__rminus_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_fp64
 (
@@ -13060,6 +16129,17 @@ GrB_Info GB_Cdense_accumB__rminus_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_fc32
 (
     GrB_Matrix C,
@@ -13122,6 +16202,28 @@ GrB_Info GB_AemultB__rminus_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_fc32
 (
@@ -13200,6 +16302,17 @@ GrB_Info GB_Cdense_accumB__rminus_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rminus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rminus_fc64
 (
     GrB_Matrix C,
@@ -13262,6 +16375,28 @@ GrB_Info GB_AemultB__rminus_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rminus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rminus_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rminus_fc64
 (
@@ -13340,6 +16475,17 @@ GrB_Info GB_Cdense_accumB__times_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_int8
 (
     GrB_Matrix C,
@@ -13402,6 +16548,28 @@ GrB_Info GB_AemultB__times_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_int8
 (
@@ -13480,6 +16648,17 @@ GrB_Info GB_Cdense_accumB__times_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_int16
 (
     GrB_Matrix C,
@@ -13542,6 +16721,28 @@ GrB_Info GB_AemultB__times_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_int16
 (
@@ -13620,6 +16821,17 @@ GrB_Info GB_Cdense_accumB__times_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_int32
 (
     GrB_Matrix C,
@@ -13682,6 +16894,28 @@ GrB_Info GB_AemultB__times_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_int32
 (
@@ -13760,6 +16994,17 @@ GrB_Info GB_Cdense_accumB__times_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_int64
 (
     GrB_Matrix C,
@@ -13822,6 +17067,28 @@ GrB_Info GB_AemultB__times_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_int64
 (
@@ -13900,6 +17167,17 @@ GrB_Info GB_Cdense_accumB__times_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_uint8
 (
     GrB_Matrix C,
@@ -13962,6 +17240,28 @@ GrB_Info GB_AemultB__times_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_uint8
 (
@@ -14040,6 +17340,17 @@ GrB_Info GB_Cdense_accumB__times_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_uint16
 (
     GrB_Matrix C,
@@ -14102,6 +17413,28 @@ GrB_Info GB_AemultB__times_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_uint16
 (
@@ -14180,6 +17513,17 @@ GrB_Info GB_Cdense_accumB__times_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_uint32
 (
     GrB_Matrix C,
@@ -14242,6 +17586,28 @@ GrB_Info GB_AemultB__times_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_uint32
 (
@@ -14320,6 +17686,17 @@ GrB_Info GB_Cdense_accumB__times_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_uint64
 (
     GrB_Matrix C,
@@ -14382,6 +17759,28 @@ GrB_Info GB_AemultB__times_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_uint64
 (
@@ -14460,6 +17859,17 @@ GrB_Info GB_Cdense_accumB__times_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_fp32
 (
     GrB_Matrix C,
@@ -14522,6 +17932,28 @@ GrB_Info GB_AemultB__times_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_fp32
 (
@@ -14600,6 +18032,17 @@ GrB_Info GB_Cdense_accumB__times_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_fp64
 (
     GrB_Matrix C,
@@ -14662,6 +18105,28 @@ GrB_Info GB_AemultB__times_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_fp64
 (
@@ -14740,6 +18205,17 @@ GrB_Info GB_Cdense_accumB__times_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_fc32
 (
     GrB_Matrix C,
@@ -14802,6 +18278,28 @@ GrB_Info GB_AemultB__times_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_fc32
 (
@@ -14880,6 +18378,17 @@ GrB_Info GB_Cdense_accumB__times_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__times_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__times_fc64
 (
     GrB_Matrix C,
@@ -14942,6 +18451,28 @@ GrB_Info GB_AemultB__times_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__times_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__times_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__times_fc64
 (
@@ -15020,6 +18551,17 @@ GrB_Info GB_Cdense_accumB__div_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_int8
 (
     GrB_Matrix C,
@@ -15082,6 +18624,28 @@ GrB_Info GB_AemultB__div_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_int8
 (
@@ -15160,6 +18724,17 @@ GrB_Info GB_Cdense_accumB__div_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_int16
 (
     GrB_Matrix C,
@@ -15222,6 +18797,28 @@ GrB_Info GB_AemultB__div_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_int16
 (
@@ -15300,6 +18897,17 @@ GrB_Info GB_Cdense_accumB__div_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_int32
 (
     GrB_Matrix C,
@@ -15362,6 +18970,28 @@ GrB_Info GB_AemultB__div_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_int32
 (
@@ -15440,6 +19070,17 @@ GrB_Info GB_Cdense_accumB__div_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_int64
 (
     GrB_Matrix C,
@@ -15502,6 +19143,28 @@ GrB_Info GB_AemultB__div_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_int64
 (
@@ -15580,6 +19243,17 @@ GrB_Info GB_Cdense_accumB__div_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_uint8
 (
     GrB_Matrix C,
@@ -15642,6 +19316,28 @@ GrB_Info GB_AemultB__div_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_uint8
 (
@@ -15720,6 +19416,17 @@ GrB_Info GB_Cdense_accumB__div_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_uint16
 (
     GrB_Matrix C,
@@ -15782,6 +19489,28 @@ GrB_Info GB_AemultB__div_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_uint16
 (
@@ -15860,6 +19589,17 @@ GrB_Info GB_Cdense_accumB__div_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_uint32
 (
     GrB_Matrix C,
@@ -15922,6 +19662,28 @@ GrB_Info GB_AemultB__div_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_uint32
 (
@@ -16000,6 +19762,17 @@ GrB_Info GB_Cdense_accumB__div_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_uint64
 (
     GrB_Matrix C,
@@ -16062,6 +19835,28 @@ GrB_Info GB_AemultB__div_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_uint64
 (
@@ -16140,6 +19935,17 @@ GrB_Info GB_Cdense_accumB__div_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_fp32
 (
     GrB_Matrix C,
@@ -16202,6 +20008,28 @@ GrB_Info GB_AemultB__div_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_fp32
 (
@@ -16280,6 +20108,17 @@ GrB_Info GB_Cdense_accumB__div_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_fp64
 (
     GrB_Matrix C,
@@ -16342,6 +20181,28 @@ GrB_Info GB_AemultB__div_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_fp64
 (
@@ -16420,6 +20281,17 @@ GrB_Info GB_Cdense_accumB__div_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_fc32
 (
     GrB_Matrix C,
@@ -16482,6 +20354,28 @@ GrB_Info GB_AemultB__div_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_fc32
 (
@@ -16560,6 +20454,17 @@ GrB_Info GB_Cdense_accumB__div_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__div_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__div_fc64
 (
     GrB_Matrix C,
@@ -16622,6 +20527,28 @@ GrB_Info GB_AemultB__div_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__div_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__div_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__div_fc64
 (
@@ -16700,6 +20627,17 @@ GrB_Info GB_Cdense_accumB__rdiv_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_int8
 (
     GrB_Matrix C,
@@ -16762,6 +20700,28 @@ GrB_Info GB_AemultB__rdiv_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_int8
 (
@@ -16840,6 +20800,17 @@ GrB_Info GB_Cdense_accumB__rdiv_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_int16
 (
     GrB_Matrix C,
@@ -16902,6 +20873,28 @@ GrB_Info GB_AemultB__rdiv_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_int16
 (
@@ -16980,6 +20973,17 @@ GrB_Info GB_Cdense_accumB__rdiv_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_int32
 (
     GrB_Matrix C,
@@ -17042,6 +21046,28 @@ GrB_Info GB_AemultB__rdiv_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_int32
 (
@@ -17120,6 +21146,17 @@ GrB_Info GB_Cdense_accumB__rdiv_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_int64
 (
     GrB_Matrix C,
@@ -17182,6 +21219,28 @@ GrB_Info GB_AemultB__rdiv_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_int64
 (
@@ -17260,6 +21319,17 @@ GrB_Info GB_Cdense_accumB__rdiv_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_uint8
 (
     GrB_Matrix C,
@@ -17322,6 +21392,28 @@ GrB_Info GB_AemultB__rdiv_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_uint8
 (
@@ -17400,6 +21492,17 @@ GrB_Info GB_Cdense_accumB__rdiv_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_uint16
 (
     GrB_Matrix C,
@@ -17462,6 +21565,28 @@ GrB_Info GB_AemultB__rdiv_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_uint16
 (
@@ -17540,6 +21665,17 @@ GrB_Info GB_Cdense_accumB__rdiv_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_uint32
 (
     GrB_Matrix C,
@@ -17602,6 +21738,28 @@ GrB_Info GB_AemultB__rdiv_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_uint32
 (
@@ -17680,6 +21838,17 @@ GrB_Info GB_Cdense_accumB__rdiv_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_uint64
 (
     GrB_Matrix C,
@@ -17742,6 +21911,28 @@ GrB_Info GB_AemultB__rdiv_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_uint64
 (
@@ -17820,6 +22011,17 @@ GrB_Info GB_Cdense_accumB__rdiv_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_fp32
 (
     GrB_Matrix C,
@@ -17882,6 +22084,28 @@ GrB_Info GB_AemultB__rdiv_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_fp32
 (
@@ -17960,6 +22184,17 @@ GrB_Info GB_Cdense_accumB__rdiv_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_fp64
 (
     GrB_Matrix C,
@@ -18022,6 +22257,28 @@ GrB_Info GB_AemultB__rdiv_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_fp64
 (
@@ -18100,6 +22357,17 @@ GrB_Info GB_Cdense_accumB__rdiv_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_fc32
 (
     GrB_Matrix C,
@@ -18162,6 +22430,28 @@ GrB_Info GB_AemultB__rdiv_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__rdiv_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__rdiv_fc32
 (
@@ -18240,6 +22530,17 @@ GrB_Info GB_Cdense_accumB__rdiv_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__rdiv_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__rdiv_fc64
 (
     GrB_Matrix C,
@@ -18302,98 +22603,21 @@ GrB_Info GB_AemultB__rdiv_fc64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__rdiv_fc64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__rdiv_fc64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__rdiv_fc64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__rdiv_fc64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__rdiv_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__iseq_int8
+GrB_Info GB_AaddB_sparse_dense__rdiv_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__iseq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__iseq_int8
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__iseq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -18401,49 +22625,8 @@ GrB_Info GB_AxD__iseq_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__iseq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__iseq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__iseq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__iseq_int8
+GrB_Info GB_bind1st__rdiv_fc64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -18454,7 +22637,7 @@ GrB_Info GB_bind1st__iseq_int8
 
 
 
-GrB_Info GB_bind2nd__iseq_int8
+GrB_Info GB_bind2nd__rdiv_fc64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -18465,7 +22648,7 @@ GrB_Info GB_bind2nd__iseq_int8
 
 
 
-GrB_Info GB_bind1st_tran__iseq_int8
+GrB_Info GB_bind1st_tran__rdiv_fc64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -18478,7 +22661,180 @@ GrB_Info GB_bind1st_tran__iseq_int8
 
 
 
-GrB_Info GB_bind2nd_tran__iseq_int8
+GrB_Info GB_bind2nd_tran__rdiv_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__iseq_int8
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__iseq_int8
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__iseq_int8
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__iseq_int8
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__iseq_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -18520,6 +22876,17 @@ GrB_Info GB_Cdense_accumB__iseq_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_int16
 (
     GrB_Matrix C,
@@ -18582,6 +22949,28 @@ GrB_Info GB_AemultB__iseq_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_int16
 (
@@ -18660,6 +23049,17 @@ GrB_Info GB_Cdense_accumB__iseq_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_int32
 (
     GrB_Matrix C,
@@ -18722,6 +23122,28 @@ GrB_Info GB_AemultB__iseq_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_int32
 (
@@ -18800,6 +23222,17 @@ GrB_Info GB_Cdense_accumB__iseq_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_int64
 (
     GrB_Matrix C,
@@ -18862,6 +23295,28 @@ GrB_Info GB_AemultB__iseq_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_int64
 (
@@ -18940,6 +23395,17 @@ GrB_Info GB_Cdense_accumB__iseq_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_uint8
 (
     GrB_Matrix C,
@@ -19002,6 +23468,28 @@ GrB_Info GB_AemultB__iseq_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_uint8
 (
@@ -19080,6 +23568,17 @@ GrB_Info GB_Cdense_accumB__iseq_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_uint16
 (
     GrB_Matrix C,
@@ -19142,6 +23641,28 @@ GrB_Info GB_AemultB__iseq_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_uint16
 (
@@ -19220,6 +23741,17 @@ GrB_Info GB_Cdense_accumB__iseq_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_uint32
 (
     GrB_Matrix C,
@@ -19282,6 +23814,28 @@ GrB_Info GB_AemultB__iseq_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_uint32
 (
@@ -19360,6 +23914,17 @@ GrB_Info GB_Cdense_accumB__iseq_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_uint64
 (
     GrB_Matrix C,
@@ -19422,6 +23987,28 @@ GrB_Info GB_AemultB__iseq_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_uint64
 (
@@ -19500,6 +24087,17 @@ GrB_Info GB_Cdense_accumB__iseq_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_fp32
 (
     GrB_Matrix C,
@@ -19562,6 +24160,28 @@ GrB_Info GB_AemultB__iseq_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_fp32
 (
@@ -19640,6 +24260,17 @@ GrB_Info GB_Cdense_accumB__iseq_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_fp64
 (
     GrB_Matrix C,
@@ -19702,98 +24333,21 @@ GrB_Info GB_AemultB__iseq_fp64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__iseq_fp64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__iseq_fp64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__iseq_fp64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__iseq_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__iseq_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__iseq_fc32
+GrB_Info GB_AaddB_sparse_dense__iseq_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__iseq_fc32
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__iseq_fc32
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -19801,49 +24355,8 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__iseq_fc32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__iseq_fc32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__iseq_fc32
+GrB_Info GB_bind1st__iseq_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -19854,7 +24367,7 @@ GrB_Info GB_bind1st__iseq_fc32
 
 
 
-GrB_Info GB_bind2nd__iseq_fc32
+GrB_Info GB_bind2nd__iseq_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -19865,7 +24378,7 @@ GrB_Info GB_bind2nd__iseq_fc32
 
 
 
-GrB_Info GB_bind1st_tran__iseq_fc32
+GrB_Info GB_bind1st_tran__iseq_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -19878,7 +24391,180 @@ GrB_Info GB_bind1st_tran__iseq_fc32
 
 
 
-GrB_Info GB_bind2nd_tran__iseq_fc32
+GrB_Info GB_bind2nd_tran__iseq_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__iseq_fc32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__iseq_fc32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__iseq_fc32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__iseq_fc32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__iseq_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -19920,6 +24606,17 @@ GrB_Info GB_Cdense_accumB__iseq_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__iseq_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__iseq_fc64
 (
     GrB_Matrix C,
@@ -19982,6 +24679,28 @@ GrB_Info GB_AemultB__iseq_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__iseq_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__iseq_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__iseq_fc64
 (
@@ -20060,6 +24779,17 @@ GrB_Info GB_Cdense_accumB__isne_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_int8
 (
     GrB_Matrix C,
@@ -20122,6 +24852,28 @@ GrB_Info GB_AemultB__isne_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_int8
 (
@@ -20200,6 +24952,17 @@ GrB_Info GB_Cdense_accumB__isne_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_int16
 (
     GrB_Matrix C,
@@ -20262,6 +25025,28 @@ GrB_Info GB_AemultB__isne_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_int16
 (
@@ -20340,6 +25125,17 @@ GrB_Info GB_Cdense_accumB__isne_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_int32
 (
     GrB_Matrix C,
@@ -20402,6 +25198,28 @@ GrB_Info GB_AemultB__isne_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_int32
 (
@@ -20480,6 +25298,17 @@ GrB_Info GB_Cdense_accumB__isne_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_int64
 (
     GrB_Matrix C,
@@ -20542,6 +25371,28 @@ GrB_Info GB_AemultB__isne_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_int64
 (
@@ -20620,6 +25471,17 @@ GrB_Info GB_Cdense_accumB__isne_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_uint8
 (
     GrB_Matrix C,
@@ -20682,6 +25544,28 @@ GrB_Info GB_AemultB__isne_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_uint8
 (
@@ -20760,6 +25644,17 @@ GrB_Info GB_Cdense_accumB__isne_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_uint16
 (
     GrB_Matrix C,
@@ -20822,6 +25717,28 @@ GrB_Info GB_AemultB__isne_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_uint16
 (
@@ -20900,6 +25817,17 @@ GrB_Info GB_Cdense_accumB__isne_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_uint32
 (
     GrB_Matrix C,
@@ -20962,6 +25890,28 @@ GrB_Info GB_AemultB__isne_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isne_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isne_uint32
 (
@@ -21040,6 +25990,17 @@ GrB_Info GB_Cdense_accumB__isne_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isne_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isne_uint64
 (
     GrB_Matrix C,
@@ -21102,98 +26063,21 @@ GrB_Info GB_AemultB__isne_uint64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__isne_uint64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__isne_uint64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__isne_uint64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__isne_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__isne_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isne_fp32
+GrB_Info GB_AaddB_sparse_dense__isne_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__isne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__isne_fp32
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__isne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -21201,49 +26085,8 @@ GrB_Info GB_AxD__isne_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__isne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__isne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__isne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__isne_fp32
+GrB_Info GB_bind1st__isne_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -21254,7 +26097,7 @@ GrB_Info GB_bind1st__isne_fp32
 
 
 
-GrB_Info GB_bind2nd__isne_fp32
+GrB_Info GB_bind2nd__isne_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -21265,7 +26108,7 @@ GrB_Info GB_bind2nd__isne_fp32
 
 
 
-GrB_Info GB_bind1st_tran__isne_fp32
+GrB_Info GB_bind1st_tran__isne_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -21278,7 +26121,7 @@ GrB_Info GB_bind1st_tran__isne_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__isne_fp32
+GrB_Info GB_bind2nd_tran__isne_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21301,7 +26144,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isne_fp64
+GrB_Info GB_Cdense_ewise3_noaccum__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21309,7 +26152,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__isne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__isne_fp64
+GrB_Info GB_Cdense_accumB__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -21320,7 +26163,18 @@ GrB_Info GB_Cdense_accumB__isne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__isne_fp64
+GrB_Info GB_Cdense_accumB_tran__isne_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isne_fp32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -21329,7 +26183,7 @@ GrB_Info GB_Cdense_accumb__isne_fp64
 
 
 
-GrB_Info GB_AxD__isne_fp64
+GrB_Info GB_AxD__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -21341,7 +26195,7 @@ GrB_Info GB_AxD__isne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__isne_fp64
+GrB_Info GB_DxB__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -21351,7 +26205,7 @@ GrB_Info GB_DxB__isne_fp64
 
 
 
-GrB_Info GB_AaddB__isne_fp64
+GrB_Info GB_AaddB__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21367,7 +26221,7 @@ GrB_Info GB_AaddB__isne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__isne_fp64
+GrB_Info GB_AemultB__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21382,8 +26236,30 @@ GrB_Info GB_AemultB__isne_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__isne_fp64
+GrB_Info GB_AaddB_sparse_dense__isne_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isne_fp32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -21394,7 +26270,7 @@ GrB_Info GB_bind1st__isne_fp64
 
 
 
-GrB_Info GB_bind2nd__isne_fp64
+GrB_Info GB_bind2nd__isne_fp32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -21405,7 +26281,7 @@ GrB_Info GB_bind2nd__isne_fp64
 
 
 
-GrB_Info GB_bind1st_tran__isne_fp64
+GrB_Info GB_bind1st_tran__isne_fp32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -21418,7 +26294,7 @@ GrB_Info GB_bind1st_tran__isne_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__isne_fp64
+GrB_Info GB_bind2nd_tran__isne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21441,7 +26317,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isne_fc32
+GrB_Info GB_Cdense_ewise3_noaccum__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21449,7 +26325,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__isne_fc32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__isne_fc32
+GrB_Info GB_Cdense_accumB__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -21460,16 +26336,27 @@ GrB_Info GB_Cdense_accumB__isne_fc32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__isne_fc32
+GrB_Info GB_Cdense_accumB_tran__isne_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isne_fp64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -21481,7 +26368,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -21489,9 +26376,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__isne_fc32
+
+GrB_Info GB_AaddB__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21507,7 +26394,7 @@ GrB_Info GB_AaddB__isne_fc32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__isne_fc32
+GrB_Info GB_AemultB__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21522,8 +26409,30 @@ GrB_Info GB_AemultB__isne_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__isne_fc32
+GrB_Info GB_AaddB_sparse_dense__isne_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isne_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -21534,7 +26443,7 @@ GrB_Info GB_bind1st__isne_fc32
 
 
 
-GrB_Info GB_bind2nd__isne_fc32
+GrB_Info GB_bind2nd__isne_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -21545,7 +26454,7 @@ GrB_Info GB_bind2nd__isne_fc32
 
 
 
-GrB_Info GB_bind1st_tran__isne_fc32
+GrB_Info GB_bind1st_tran__isne_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -21558,7 +26467,7 @@ GrB_Info GB_bind1st_tran__isne_fc32
 
 
 
-GrB_Info GB_bind2nd_tran__isne_fc32
+GrB_Info GB_bind2nd_tran__isne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21581,7 +26490,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isne_fc64
+GrB_Info GB_Cdense_ewise3_noaccum__isne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21589,7 +26498,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__isne_fc64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__isne_fc64
+GrB_Info GB_Cdense_accumB__isne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -21600,7 +26509,18 @@ GrB_Info GB_Cdense_accumB__isne_fc64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__isne_fc64
+GrB_Info GB_Cdense_accumB_tran__isne_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isne_fc32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -21631,7 +26551,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__isne_fc64
+GrB_Info GB_AaddB__isne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21647,7 +26567,7 @@ GrB_Info GB_AaddB__isne_fc64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__isne_fc64
+GrB_Info GB_AemultB__isne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21662,8 +26582,30 @@ GrB_Info GB_AemultB__isne_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__isne_fc64
+GrB_Info GB_AaddB_sparse_dense__isne_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isne_fc32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -21674,7 +26616,7 @@ GrB_Info GB_bind1st__isne_fc64
 
 
 
-GrB_Info GB_bind2nd__isne_fc64
+GrB_Info GB_bind2nd__isne_fc32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -21685,7 +26627,7 @@ GrB_Info GB_bind2nd__isne_fc64
 
 
 
-GrB_Info GB_bind1st_tran__isne_fc64
+GrB_Info GB_bind1st_tran__isne_fc32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -21698,7 +26640,7 @@ GrB_Info GB_bind1st_tran__isne_fc64
 
 
 
-GrB_Info GB_bind2nd_tran__isne_fc64
+GrB_Info GB_bind2nd_tran__isne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21721,7 +26663,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isgt_int8
+GrB_Info GB_Cdense_ewise3_noaccum__isne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21729,7 +26671,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__isgt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__isgt_int8
+GrB_Info GB_Cdense_accumB__isne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -21740,16 +26682,27 @@ GrB_Info GB_Cdense_accumB__isgt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__isgt_int8
+GrB_Info GB_Cdense_accumB_tran__isne_fc64
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__isne_fc64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__isgt_int8
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -21761,7 +26714,7 @@ GrB_Info GB_AxD__isgt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__isgt_int8
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -21769,9 +26722,9 @@ GrB_Info GB_DxB__isgt_int8
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__isgt_int8
+GrB_Info GB_AaddB__isne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21787,7 +26740,7 @@ GrB_Info GB_AaddB__isgt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__isgt_int8
+GrB_Info GB_AemultB__isne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21802,8 +26755,30 @@ GrB_Info GB_AemultB__isgt_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isne_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__isgt_int8
+GrB_Info GB_AaddB_sparse_dense__isne_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isne_fc64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -21814,7 +26789,7 @@ GrB_Info GB_bind1st__isgt_int8
 
 
 
-GrB_Info GB_bind2nd__isgt_int8
+GrB_Info GB_bind2nd__isne_fc64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -21825,7 +26800,7 @@ GrB_Info GB_bind2nd__isgt_int8
 
 
 
-GrB_Info GB_bind1st_tran__isgt_int8
+GrB_Info GB_bind1st_tran__isne_fc64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -21838,7 +26813,7 @@ GrB_Info GB_bind1st_tran__isgt_int8
 
 
 
-GrB_Info GB_bind2nd_tran__isgt_int8
+GrB_Info GB_bind2nd_tran__isne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21861,7 +26836,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isgt_int16
+GrB_Info GB_Cdense_ewise3_noaccum__isgt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -21869,7 +26844,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__isgt_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__isgt_int16
+GrB_Info GB_Cdense_accumB__isgt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -21880,7 +26855,18 @@ GrB_Info GB_Cdense_accumB__isgt_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__isgt_int16
+GrB_Info GB_Cdense_accumB_tran__isgt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isgt_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -21889,7 +26875,7 @@ GrB_Info GB_Cdense_accumb__isgt_int16
 
 
 
-GrB_Info GB_AxD__isgt_int16
+GrB_Info GB_AxD__isgt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -21901,7 +26887,7 @@ GrB_Info GB_AxD__isgt_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__isgt_int16
+GrB_Info GB_DxB__isgt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -21911,7 +26897,7 @@ GrB_Info GB_DxB__isgt_int16
 
 
 
-GrB_Info GB_AaddB__isgt_int16
+GrB_Info GB_AaddB__isgt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21927,7 +26913,7 @@ GrB_Info GB_AaddB__isgt_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__isgt_int16
+GrB_Info GB_AemultB__isgt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -21942,8 +26928,30 @@ GrB_Info GB_AemultB__isgt_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__isgt_int16
+GrB_Info GB_AaddB_sparse_dense__isgt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isgt_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -21954,7 +26962,7 @@ GrB_Info GB_bind1st__isgt_int16
 
 
 
-GrB_Info GB_bind2nd__isgt_int16
+GrB_Info GB_bind2nd__isgt_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -21965,7 +26973,7 @@ GrB_Info GB_bind2nd__isgt_int16
 
 
 
-GrB_Info GB_bind1st_tran__isgt_int16
+GrB_Info GB_bind1st_tran__isgt_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -21978,7 +26986,180 @@ GrB_Info GB_bind1st_tran__isgt_int16
 
 
 
-GrB_Info GB_bind2nd_tran__isgt_int16
+GrB_Info GB_bind2nd_tran__isgt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isgt_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isgt_int16
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__isgt_int16
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__isgt_int16
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__isgt_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -22020,6 +27201,17 @@ GrB_Info GB_Cdense_accumB__isgt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_int32
 (
     GrB_Matrix C,
@@ -22082,6 +27274,28 @@ GrB_Info GB_AemultB__isgt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_int32
 (
@@ -22160,6 +27374,17 @@ GrB_Info GB_Cdense_accumB__isgt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_int64
 (
     GrB_Matrix C,
@@ -22222,6 +27447,28 @@ GrB_Info GB_AemultB__isgt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_int64
 (
@@ -22300,6 +27547,17 @@ GrB_Info GB_Cdense_accumB__isgt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_uint8
 (
     GrB_Matrix C,
@@ -22362,6 +27620,28 @@ GrB_Info GB_AemultB__isgt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_uint8
 (
@@ -22440,6 +27720,17 @@ GrB_Info GB_Cdense_accumB__isgt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_uint16
 (
     GrB_Matrix C,
@@ -22502,6 +27793,28 @@ GrB_Info GB_AemultB__isgt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_uint16
 (
@@ -22580,6 +27893,17 @@ GrB_Info GB_Cdense_accumB__isgt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_uint32
 (
     GrB_Matrix C,
@@ -22642,6 +27966,28 @@ GrB_Info GB_AemultB__isgt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_uint32
 (
@@ -22720,6 +28066,17 @@ GrB_Info GB_Cdense_accumB__isgt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_uint64
 (
     GrB_Matrix C,
@@ -22782,6 +28139,28 @@ GrB_Info GB_AemultB__isgt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_uint64
 (
@@ -22860,6 +28239,17 @@ GrB_Info GB_Cdense_accumB__isgt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_fp32
 (
     GrB_Matrix C,
@@ -22922,6 +28312,28 @@ GrB_Info GB_AemultB__isgt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_fp32
 (
@@ -23000,6 +28412,17 @@ GrB_Info GB_Cdense_accumB__isgt_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isgt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isgt_fp64
 (
     GrB_Matrix C,
@@ -23062,6 +28485,28 @@ GrB_Info GB_AemultB__isgt_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isgt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isgt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isgt_fp64
 (
@@ -23140,6 +28585,17 @@ GrB_Info GB_Cdense_accumB__islt_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_int8
 (
     GrB_Matrix C,
@@ -23202,98 +28658,21 @@ GrB_Info GB_AemultB__islt_int8
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__islt_int8
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__islt_int8
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__islt_int8
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__islt_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__islt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__islt_int16
+GrB_Info GB_AaddB_sparse_dense__islt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__islt_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__islt_int16
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__islt_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -23301,49 +28680,8 @@ GrB_Info GB_AxD__islt_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__islt_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__islt_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__islt_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__islt_int16
+GrB_Info GB_bind1st__islt_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -23354,7 +28692,7 @@ GrB_Info GB_bind1st__islt_int16
 
 
 
-GrB_Info GB_bind2nd__islt_int16
+GrB_Info GB_bind2nd__islt_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -23365,7 +28703,7 @@ GrB_Info GB_bind2nd__islt_int16
 
 
 
-GrB_Info GB_bind1st_tran__islt_int16
+GrB_Info GB_bind1st_tran__islt_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -23378,7 +28716,180 @@ GrB_Info GB_bind1st_tran__islt_int16
 
 
 
-GrB_Info GB_bind2nd_tran__islt_int16
+GrB_Info GB_bind2nd_tran__islt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__islt_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__islt_int16
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__islt_int16
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__islt_int16
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__islt_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -23420,6 +28931,17 @@ GrB_Info GB_Cdense_accumB__islt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_int32
 (
     GrB_Matrix C,
@@ -23482,6 +29004,28 @@ GrB_Info GB_AemultB__islt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_int32
 (
@@ -23560,6 +29104,17 @@ GrB_Info GB_Cdense_accumB__islt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_int64
 (
     GrB_Matrix C,
@@ -23622,6 +29177,28 @@ GrB_Info GB_AemultB__islt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_int64
 (
@@ -23700,6 +29277,17 @@ GrB_Info GB_Cdense_accumB__islt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_uint8
 (
     GrB_Matrix C,
@@ -23762,6 +29350,28 @@ GrB_Info GB_AemultB__islt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_uint8
 (
@@ -23840,6 +29450,17 @@ GrB_Info GB_Cdense_accumB__islt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_uint16
 (
     GrB_Matrix C,
@@ -23902,6 +29523,28 @@ GrB_Info GB_AemultB__islt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_uint16
 (
@@ -23980,6 +29623,17 @@ GrB_Info GB_Cdense_accumB__islt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_uint32
 (
     GrB_Matrix C,
@@ -24042,6 +29696,28 @@ GrB_Info GB_AemultB__islt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_uint32
 (
@@ -24120,6 +29796,17 @@ GrB_Info GB_Cdense_accumB__islt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_uint64
 (
     GrB_Matrix C,
@@ -24182,6 +29869,28 @@ GrB_Info GB_AemultB__islt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_uint64
 (
@@ -24260,6 +29969,17 @@ GrB_Info GB_Cdense_accumB__islt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_fp32
 (
     GrB_Matrix C,
@@ -24322,6 +30042,28 @@ GrB_Info GB_AemultB__islt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_fp32
 (
@@ -24400,6 +30142,17 @@ GrB_Info GB_Cdense_accumB__islt_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__islt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__islt_fp64
 (
     GrB_Matrix C,
@@ -24462,6 +30215,28 @@ GrB_Info GB_AemultB__islt_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__islt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__islt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__islt_fp64
 (
@@ -24540,6 +30315,17 @@ GrB_Info GB_Cdense_accumB__isge_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_int8
 (
     GrB_Matrix C,
@@ -24602,98 +30388,21 @@ GrB_Info GB_AemultB__isge_int8
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__isge_int8
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__isge_int8
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__isge_int8
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__isge_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__isge_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isge_int16
+GrB_Info GB_AaddB_sparse_dense__isge_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__isge_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__isge_int16
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__isge_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -24701,49 +30410,8 @@ GrB_Info GB_AxD__isge_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__isge_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__isge_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__isge_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__isge_int16
+GrB_Info GB_bind1st__isge_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -24754,7 +30422,7 @@ GrB_Info GB_bind1st__isge_int16
 
 
 
-GrB_Info GB_bind2nd__isge_int16
+GrB_Info GB_bind2nd__isge_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -24765,7 +30433,7 @@ GrB_Info GB_bind2nd__isge_int16
 
 
 
-GrB_Info GB_bind1st_tran__isge_int16
+GrB_Info GB_bind1st_tran__isge_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -24778,7 +30446,180 @@ GrB_Info GB_bind1st_tran__isge_int16
 
 
 
-GrB_Info GB_bind2nd_tran__isge_int16
+GrB_Info GB_bind2nd_tran__isge_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isge_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isge_int16
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__isge_int16
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__isge_int16
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__isge_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -24820,6 +30661,17 @@ GrB_Info GB_Cdense_accumB__isge_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_int32
 (
     GrB_Matrix C,
@@ -24882,6 +30734,28 @@ GrB_Info GB_AemultB__isge_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_int32
 (
@@ -24960,6 +30834,17 @@ GrB_Info GB_Cdense_accumB__isge_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_int64
 (
     GrB_Matrix C,
@@ -25022,6 +30907,28 @@ GrB_Info GB_AemultB__isge_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_int64
 (
@@ -25100,6 +31007,17 @@ GrB_Info GB_Cdense_accumB__isge_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_uint8
 (
     GrB_Matrix C,
@@ -25162,6 +31080,28 @@ GrB_Info GB_AemultB__isge_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_uint8
 (
@@ -25240,6 +31180,17 @@ GrB_Info GB_Cdense_accumB__isge_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_uint16
 (
     GrB_Matrix C,
@@ -25302,6 +31253,28 @@ GrB_Info GB_AemultB__isge_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_uint16
 (
@@ -25380,6 +31353,17 @@ GrB_Info GB_Cdense_accumB__isge_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_uint32
 (
     GrB_Matrix C,
@@ -25442,6 +31426,28 @@ GrB_Info GB_AemultB__isge_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_uint32
 (
@@ -25520,6 +31526,17 @@ GrB_Info GB_Cdense_accumB__isge_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_uint64
 (
     GrB_Matrix C,
@@ -25582,6 +31599,28 @@ GrB_Info GB_AemultB__isge_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_uint64
 (
@@ -25660,6 +31699,17 @@ GrB_Info GB_Cdense_accumB__isge_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_fp32
 (
     GrB_Matrix C,
@@ -25722,6 +31772,28 @@ GrB_Info GB_AemultB__isge_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_fp32
 (
@@ -25800,6 +31872,17 @@ GrB_Info GB_Cdense_accumB__isge_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isge_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isge_fp64
 (
     GrB_Matrix C,
@@ -25862,6 +31945,28 @@ GrB_Info GB_AemultB__isge_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isge_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isge_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isge_fp64
 (
@@ -25940,6 +32045,17 @@ GrB_Info GB_Cdense_accumB__isle_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_int8
 (
     GrB_Matrix C,
@@ -26002,98 +32118,21 @@ GrB_Info GB_AemultB__isle_int8
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__isle_int8
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__isle_int8
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__isle_int8
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__isle_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__isle_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__isle_int16
+GrB_Info GB_AaddB_sparse_dense__isle_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__isle_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__isle_int16
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__isle_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -26101,49 +32140,8 @@ GrB_Info GB_AxD__isle_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__isle_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__isle_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__isle_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__isle_int16
+GrB_Info GB_bind1st__isle_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -26154,7 +32152,7 @@ GrB_Info GB_bind1st__isle_int16
 
 
 
-GrB_Info GB_bind2nd__isle_int16
+GrB_Info GB_bind2nd__isle_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -26165,7 +32163,7 @@ GrB_Info GB_bind2nd__isle_int16
 
 
 
-GrB_Info GB_bind1st_tran__isle_int16
+GrB_Info GB_bind1st_tran__isle_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -26178,7 +32176,180 @@ GrB_Info GB_bind1st_tran__isle_int16
 
 
 
-GrB_Info GB_bind2nd_tran__isle_int16
+GrB_Info GB_bind2nd_tran__isle_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__isle_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__isle_int16
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__isle_int16
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__isle_int16
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__isle_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -26220,6 +32391,17 @@ GrB_Info GB_Cdense_accumB__isle_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_int32
 (
     GrB_Matrix C,
@@ -26282,6 +32464,28 @@ GrB_Info GB_AemultB__isle_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_int32
 (
@@ -26360,6 +32564,17 @@ GrB_Info GB_Cdense_accumB__isle_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_int64
 (
     GrB_Matrix C,
@@ -26422,6 +32637,28 @@ GrB_Info GB_AemultB__isle_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_int64
 (
@@ -26500,6 +32737,17 @@ GrB_Info GB_Cdense_accumB__isle_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_uint8
 (
     GrB_Matrix C,
@@ -26562,6 +32810,28 @@ GrB_Info GB_AemultB__isle_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_uint8
 (
@@ -26640,6 +32910,17 @@ GrB_Info GB_Cdense_accumB__isle_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_uint16
 (
     GrB_Matrix C,
@@ -26702,6 +32983,28 @@ GrB_Info GB_AemultB__isle_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_uint16
 (
@@ -26780,6 +33083,17 @@ GrB_Info GB_Cdense_accumB__isle_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_uint32
 (
     GrB_Matrix C,
@@ -26842,6 +33156,28 @@ GrB_Info GB_AemultB__isle_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_uint32
 (
@@ -26920,6 +33256,17 @@ GrB_Info GB_Cdense_accumB__isle_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_uint64
 (
     GrB_Matrix C,
@@ -26982,6 +33329,28 @@ GrB_Info GB_AemultB__isle_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_uint64
 (
@@ -27060,6 +33429,17 @@ GrB_Info GB_Cdense_accumB__isle_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_fp32
 (
     GrB_Matrix C,
@@ -27122,6 +33502,28 @@ GrB_Info GB_AemultB__isle_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_fp32
 (
@@ -27200,6 +33602,17 @@ GrB_Info GB_Cdense_accumB__isle_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__isle_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__isle_fp64
 (
     GrB_Matrix C,
@@ -27262,6 +33675,28 @@ GrB_Info GB_AemultB__isle_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__isle_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__isle_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__isle_fp64
 (
@@ -27340,6 +33775,17 @@ GrB_Info GB_Cdense_accumB__eq_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_bool
 (
     GrB_Matrix C,
@@ -27402,98 +33848,21 @@ GrB_Info GB_AemultB__eq_bool
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__eq_bool
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__eq_bool
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__eq_bool
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__eq_bool
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__eq_bool
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__eq_int8
+GrB_Info GB_AaddB_sparse_dense__eq_bool
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__eq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__eq_int8
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__eq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -27501,49 +33870,8 @@ GrB_Info GB_AxD__eq_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__eq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__eq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__eq_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__eq_int8
+GrB_Info GB_bind1st__eq_bool
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -27554,7 +33882,7 @@ GrB_Info GB_bind1st__eq_int8
 
 
 
-GrB_Info GB_bind2nd__eq_int8
+GrB_Info GB_bind2nd__eq_bool
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -27565,7 +33893,7 @@ GrB_Info GB_bind2nd__eq_int8
 
 
 
-GrB_Info GB_bind1st_tran__eq_int8
+GrB_Info GB_bind1st_tran__eq_bool
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -27578,7 +33906,180 @@ GrB_Info GB_bind1st_tran__eq_int8
 
 
 
-GrB_Info GB_bind2nd_tran__eq_int8
+GrB_Info GB_bind2nd_tran__eq_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__eq_int8
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__eq_int8
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__eq_int8
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__eq_int8
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__eq_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -27620,6 +34121,17 @@ GrB_Info GB_Cdense_accumB__eq_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_int16
 (
     GrB_Matrix C,
@@ -27682,6 +34194,28 @@ GrB_Info GB_AemultB__eq_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_int16
 (
@@ -27760,6 +34294,17 @@ GrB_Info GB_Cdense_accumB__eq_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_int32
 (
     GrB_Matrix C,
@@ -27822,6 +34367,28 @@ GrB_Info GB_AemultB__eq_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_int32
 (
@@ -27900,6 +34467,17 @@ GrB_Info GB_Cdense_accumB__eq_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_int64
 (
     GrB_Matrix C,
@@ -27962,6 +34540,28 @@ GrB_Info GB_AemultB__eq_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_int64
 (
@@ -28040,6 +34640,17 @@ GrB_Info GB_Cdense_accumB__eq_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_uint8
 (
     GrB_Matrix C,
@@ -28102,6 +34713,28 @@ GrB_Info GB_AemultB__eq_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_uint8
 (
@@ -28180,6 +34813,17 @@ GrB_Info GB_Cdense_accumB__eq_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_uint16
 (
     GrB_Matrix C,
@@ -28242,6 +34886,28 @@ GrB_Info GB_AemultB__eq_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_uint16
 (
@@ -28320,6 +34986,17 @@ GrB_Info GB_Cdense_accumB__eq_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_uint32
 (
     GrB_Matrix C,
@@ -28382,6 +35059,28 @@ GrB_Info GB_AemultB__eq_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_uint32
 (
@@ -28460,6 +35159,17 @@ GrB_Info GB_Cdense_accumB__eq_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_uint64
 (
     GrB_Matrix C,
@@ -28522,6 +35232,28 @@ GrB_Info GB_AemultB__eq_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_uint64
 (
@@ -28600,6 +35332,17 @@ GrB_Info GB_Cdense_accumB__eq_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_fp32
 (
     GrB_Matrix C,
@@ -28662,6 +35405,28 @@ GrB_Info GB_AemultB__eq_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_fp32
 (
@@ -28740,6 +35505,17 @@ GrB_Info GB_Cdense_accumB__eq_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_fp64
 (
     GrB_Matrix C,
@@ -28802,98 +35578,21 @@ GrB_Info GB_AemultB__eq_fp64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__eq_fp64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__eq_fp64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__eq_fp64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__eq_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__eq_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__eq_fc32
+GrB_Info GB_AaddB_sparse_dense__eq_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__eq_fc32
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__eq_fc32
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -28901,49 +35600,8 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__eq_fc32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__eq_fc32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__eq_fc32
+GrB_Info GB_bind1st__eq_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -28954,7 +35612,7 @@ GrB_Info GB_bind1st__eq_fc32
 
 
 
-GrB_Info GB_bind2nd__eq_fc32
+GrB_Info GB_bind2nd__eq_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -28965,7 +35623,7 @@ GrB_Info GB_bind2nd__eq_fc32
 
 
 
-GrB_Info GB_bind1st_tran__eq_fc32
+GrB_Info GB_bind1st_tran__eq_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -28978,7 +35636,180 @@ GrB_Info GB_bind1st_tran__eq_fc32
 
 
 
-GrB_Info GB_bind2nd_tran__eq_fc32
+GrB_Info GB_bind2nd_tran__eq_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__eq_fc32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__eq_fc32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__eq_fc32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__eq_fc32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__eq_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -29020,6 +35851,17 @@ GrB_Info GB_Cdense_accumB__eq_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__eq_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__eq_fc64
 (
     GrB_Matrix C,
@@ -29082,6 +35924,28 @@ GrB_Info GB_AemultB__eq_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__eq_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__eq_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__eq_fc64
 (
@@ -29160,6 +36024,17 @@ GrB_Info GB_Cdense_accumB__ne_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_int8
 (
     GrB_Matrix C,
@@ -29222,6 +36097,28 @@ GrB_Info GB_AemultB__ne_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_int8
 (
@@ -29300,6 +36197,17 @@ GrB_Info GB_Cdense_accumB__ne_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_int16
 (
     GrB_Matrix C,
@@ -29362,6 +36270,28 @@ GrB_Info GB_AemultB__ne_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_int16
 (
@@ -29440,6 +36370,17 @@ GrB_Info GB_Cdense_accumB__ne_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_int32
 (
     GrB_Matrix C,
@@ -29502,6 +36443,28 @@ GrB_Info GB_AemultB__ne_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_int32
 (
@@ -29580,6 +36543,17 @@ GrB_Info GB_Cdense_accumB__ne_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_int64
 (
     GrB_Matrix C,
@@ -29642,6 +36616,28 @@ GrB_Info GB_AemultB__ne_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_int64
 (
@@ -29720,6 +36716,17 @@ GrB_Info GB_Cdense_accumB__ne_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_uint8
 (
     GrB_Matrix C,
@@ -29782,6 +36789,28 @@ GrB_Info GB_AemultB__ne_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_uint8
 (
@@ -29860,6 +36889,17 @@ GrB_Info GB_Cdense_accumB__ne_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_uint16
 (
     GrB_Matrix C,
@@ -29922,6 +36962,28 @@ GrB_Info GB_AemultB__ne_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_uint16
 (
@@ -30000,6 +37062,17 @@ GrB_Info GB_Cdense_accumB__ne_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_uint32
 (
     GrB_Matrix C,
@@ -30062,6 +37135,28 @@ GrB_Info GB_AemultB__ne_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ne_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ne_uint32
 (
@@ -30140,6 +37235,17 @@ GrB_Info GB_Cdense_accumB__ne_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ne_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ne_uint64
 (
     GrB_Matrix C,
@@ -30202,98 +37308,21 @@ GrB_Info GB_AemultB__ne_uint64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__ne_uint64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__ne_uint64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__ne_uint64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__ne_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__ne_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ne_fp32
+GrB_Info GB_AaddB_sparse_dense__ne_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__ne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__ne_fp32
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__ne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -30301,49 +37330,8 @@ GrB_Info GB_AxD__ne_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__ne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__ne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__ne_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__ne_fp32
+GrB_Info GB_bind1st__ne_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30354,7 +37342,7 @@ GrB_Info GB_bind1st__ne_fp32
 
 
 
-GrB_Info GB_bind2nd__ne_fp32
+GrB_Info GB_bind2nd__ne_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30365,7 +37353,7 @@ GrB_Info GB_bind2nd__ne_fp32
 
 
 
-GrB_Info GB_bind1st_tran__ne_fp32
+GrB_Info GB_bind1st_tran__ne_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30378,7 +37366,7 @@ GrB_Info GB_bind1st_tran__ne_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__ne_fp32
+GrB_Info GB_bind2nd_tran__ne_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30401,7 +37389,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ne_fp64
+GrB_Info GB_Cdense_ewise3_noaccum__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30409,7 +37397,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__ne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__ne_fp64
+GrB_Info GB_Cdense_accumB__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -30420,7 +37408,18 @@ GrB_Info GB_Cdense_accumB__ne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__ne_fp64
+GrB_Info GB_Cdense_accumB_tran__ne_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__ne_fp32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30429,7 +37428,7 @@ GrB_Info GB_Cdense_accumb__ne_fp64
 
 
 
-GrB_Info GB_AxD__ne_fp64
+GrB_Info GB_AxD__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -30441,7 +37440,7 @@ GrB_Info GB_AxD__ne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__ne_fp64
+GrB_Info GB_DxB__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -30451,7 +37450,7 @@ GrB_Info GB_DxB__ne_fp64
 
 
 
-GrB_Info GB_AaddB__ne_fp64
+GrB_Info GB_AaddB__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30467,7 +37466,7 @@ GrB_Info GB_AaddB__ne_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__ne_fp64
+GrB_Info GB_AemultB__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30482,8 +37481,30 @@ GrB_Info GB_AemultB__ne_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__ne_fp64
+GrB_Info GB_AaddB_sparse_dense__ne_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__ne_fp32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30494,7 +37515,7 @@ GrB_Info GB_bind1st__ne_fp64
 
 
 
-GrB_Info GB_bind2nd__ne_fp64
+GrB_Info GB_bind2nd__ne_fp32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30505,7 +37526,7 @@ GrB_Info GB_bind2nd__ne_fp64
 
 
 
-GrB_Info GB_bind1st_tran__ne_fp64
+GrB_Info GB_bind1st_tran__ne_fp32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30518,7 +37539,7 @@ GrB_Info GB_bind1st_tran__ne_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__ne_fp64
+GrB_Info GB_bind2nd_tran__ne_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30541,7 +37562,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ne_fc32
+GrB_Info GB_Cdense_ewise3_noaccum__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30549,7 +37570,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__ne_fc32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__ne_fc32
+GrB_Info GB_Cdense_accumB__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -30560,16 +37581,27 @@ GrB_Info GB_Cdense_accumB__ne_fc32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__ne_fc32
+GrB_Info GB_Cdense_accumB_tran__ne_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__ne_fp64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -30581,7 +37613,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -30589,9 +37621,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__ne_fc32
+
+GrB_Info GB_AaddB__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30607,7 +37639,7 @@ GrB_Info GB_AaddB__ne_fc32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__ne_fc32
+GrB_Info GB_AemultB__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30622,8 +37654,30 @@ GrB_Info GB_AemultB__ne_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__ne_fc32
+GrB_Info GB_AaddB_sparse_dense__ne_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__ne_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30634,7 +37688,7 @@ GrB_Info GB_bind1st__ne_fc32
 
 
 
-GrB_Info GB_bind2nd__ne_fc32
+GrB_Info GB_bind2nd__ne_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30645,7 +37699,7 @@ GrB_Info GB_bind2nd__ne_fc32
 
 
 
-GrB_Info GB_bind1st_tran__ne_fc32
+GrB_Info GB_bind1st_tran__ne_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30658,7 +37712,7 @@ GrB_Info GB_bind1st_tran__ne_fc32
 
 
 
-GrB_Info GB_bind2nd_tran__ne_fc32
+GrB_Info GB_bind2nd_tran__ne_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30681,7 +37735,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ne_fc64
+GrB_Info GB_Cdense_ewise3_noaccum__ne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30689,7 +37743,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__ne_fc64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__ne_fc64
+GrB_Info GB_Cdense_accumB__ne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -30700,7 +37754,18 @@ GrB_Info GB_Cdense_accumB__ne_fc64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__ne_fc64
+GrB_Info GB_Cdense_accumB_tran__ne_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__ne_fc32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30731,7 +37796,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__ne_fc64
+GrB_Info GB_AaddB__ne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30747,7 +37812,7 @@ GrB_Info GB_AaddB__ne_fc64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__ne_fc64
+GrB_Info GB_AemultB__ne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30762,8 +37827,30 @@ GrB_Info GB_AemultB__ne_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__ne_fc64
+GrB_Info GB_AaddB_sparse_dense__ne_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__ne_fc32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30774,7 +37861,7 @@ GrB_Info GB_bind1st__ne_fc64
 
 
 
-GrB_Info GB_bind2nd__ne_fc64
+GrB_Info GB_bind2nd__ne_fc32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30785,7 +37872,7 @@ GrB_Info GB_bind2nd__ne_fc64
 
 
 
-GrB_Info GB_bind1st_tran__ne_fc64
+GrB_Info GB_bind1st_tran__ne_fc32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30798,7 +37885,7 @@ GrB_Info GB_bind1st_tran__ne_fc64
 
 
 
-GrB_Info GB_bind2nd_tran__ne_fc64
+GrB_Info GB_bind2nd_tran__ne_fc32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30821,7 +37908,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__gt_bool
+GrB_Info GB_Cdense_ewise3_noaccum__ne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30829,7 +37916,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__gt_bool
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__gt_bool
+GrB_Info GB_Cdense_accumB__ne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -30840,16 +37927,27 @@ GrB_Info GB_Cdense_accumB__gt_bool
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__gt_bool
+GrB_Info GB_Cdense_accumB_tran__ne_fc64
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__ne_fc64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__gt_bool
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -30861,7 +37959,7 @@ GrB_Info GB_AxD__gt_bool
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__gt_bool
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -30869,9 +37967,9 @@ GrB_Info GB_DxB__gt_bool
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__gt_bool
+GrB_Info GB_AaddB__ne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30887,7 +37985,7 @@ GrB_Info GB_AaddB__gt_bool
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__gt_bool
+GrB_Info GB_AemultB__ne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -30902,8 +38000,30 @@ GrB_Info GB_AemultB__gt_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ne_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__gt_bool
+GrB_Info GB_AaddB_sparse_dense__ne_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__ne_fc64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -30914,7 +38034,7 @@ GrB_Info GB_bind1st__gt_bool
 
 
 
-GrB_Info GB_bind2nd__gt_bool
+GrB_Info GB_bind2nd__ne_fc64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -30925,7 +38045,7 @@ GrB_Info GB_bind2nd__gt_bool
 
 
 
-GrB_Info GB_bind1st_tran__gt_bool
+GrB_Info GB_bind1st_tran__ne_fc64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -30938,7 +38058,7 @@ GrB_Info GB_bind1st_tran__gt_bool
 
 
 
-GrB_Info GB_bind2nd_tran__gt_bool
+GrB_Info GB_bind2nd_tran__ne_fc64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30961,7 +38081,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__gt_int8
+GrB_Info GB_Cdense_ewise3_noaccum__gt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -30969,7 +38089,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__gt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__gt_int8
+GrB_Info GB_Cdense_accumB__gt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -30980,7 +38100,18 @@ GrB_Info GB_Cdense_accumB__gt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__gt_int8
+GrB_Info GB_Cdense_accumB_tran__gt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__gt_bool
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -30989,7 +38120,7 @@ GrB_Info GB_Cdense_accumb__gt_int8
 
 
 
-GrB_Info GB_AxD__gt_int8
+GrB_Info GB_AxD__gt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -31001,7 +38132,7 @@ GrB_Info GB_AxD__gt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__gt_int8
+GrB_Info GB_DxB__gt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -31011,7 +38142,7 @@ GrB_Info GB_DxB__gt_int8
 
 
 
-GrB_Info GB_AaddB__gt_int8
+GrB_Info GB_AaddB__gt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31027,7 +38158,7 @@ GrB_Info GB_AaddB__gt_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__gt_int8
+GrB_Info GB_AemultB__gt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -31042,8 +38173,30 @@ GrB_Info GB_AemultB__gt_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__gt_int8
+GrB_Info GB_AaddB_sparse_dense__gt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__gt_bool
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -31054,7 +38207,7 @@ GrB_Info GB_bind1st__gt_int8
 
 
 
-GrB_Info GB_bind2nd__gt_int8
+GrB_Info GB_bind2nd__gt_bool
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -31065,7 +38218,7 @@ GrB_Info GB_bind2nd__gt_int8
 
 
 
-GrB_Info GB_bind1st_tran__gt_int8
+GrB_Info GB_bind1st_tran__gt_bool
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -31078,7 +38231,180 @@ GrB_Info GB_bind1st_tran__gt_int8
 
 
 
-GrB_Info GB_bind2nd_tran__gt_int8
+GrB_Info GB_bind2nd_tran__gt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__gt_int8
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__gt_int8
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__gt_int8
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__gt_int8
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__gt_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -31120,6 +38446,17 @@ GrB_Info GB_Cdense_accumB__gt_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_int16
 (
     GrB_Matrix C,
@@ -31182,6 +38519,28 @@ GrB_Info GB_AemultB__gt_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_int16
 (
@@ -31260,6 +38619,17 @@ GrB_Info GB_Cdense_accumB__gt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_int32
 (
     GrB_Matrix C,
@@ -31322,6 +38692,28 @@ GrB_Info GB_AemultB__gt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_int32
 (
@@ -31400,6 +38792,17 @@ GrB_Info GB_Cdense_accumB__gt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_int64
 (
     GrB_Matrix C,
@@ -31462,6 +38865,28 @@ GrB_Info GB_AemultB__gt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_int64
 (
@@ -31540,6 +38965,17 @@ GrB_Info GB_Cdense_accumB__gt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_uint8
 (
     GrB_Matrix C,
@@ -31602,6 +39038,28 @@ GrB_Info GB_AemultB__gt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_uint8
 (
@@ -31680,6 +39138,17 @@ GrB_Info GB_Cdense_accumB__gt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_uint16
 (
     GrB_Matrix C,
@@ -31742,6 +39211,28 @@ GrB_Info GB_AemultB__gt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_uint16
 (
@@ -31820,6 +39311,17 @@ GrB_Info GB_Cdense_accumB__gt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_uint32
 (
     GrB_Matrix C,
@@ -31882,6 +39384,28 @@ GrB_Info GB_AemultB__gt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_uint32
 (
@@ -31960,6 +39484,17 @@ GrB_Info GB_Cdense_accumB__gt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_uint64
 (
     GrB_Matrix C,
@@ -32022,6 +39557,28 @@ GrB_Info GB_AemultB__gt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_uint64
 (
@@ -32100,6 +39657,17 @@ GrB_Info GB_Cdense_accumB__gt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_fp32
 (
     GrB_Matrix C,
@@ -32162,6 +39730,28 @@ GrB_Info GB_AemultB__gt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__gt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__gt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__gt_fp32
 (
@@ -32240,6 +39830,17 @@ GrB_Info GB_Cdense_accumB__gt_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__gt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__gt_fp64
 (
     GrB_Matrix C,
@@ -32302,98 +39903,21 @@ GrB_Info GB_AemultB__gt_fp64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__gt_fp64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__gt_fp64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__gt_fp64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__gt_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__gt_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__lt_bool
+GrB_Info GB_AaddB_sparse_dense__gt_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__lt_bool
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__lt_bool
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__lt_bool
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -32401,49 +39925,8 @@ GrB_Info GB_AxD__lt_bool
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__lt_bool
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__lt_bool
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__lt_bool
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__lt_bool
+GrB_Info GB_bind1st__gt_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -32454,7 +39937,7 @@ GrB_Info GB_bind1st__lt_bool
 
 
 
-GrB_Info GB_bind2nd__lt_bool
+GrB_Info GB_bind2nd__gt_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -32465,7 +39948,7 @@ GrB_Info GB_bind2nd__lt_bool
 
 
 
-GrB_Info GB_bind1st_tran__lt_bool
+GrB_Info GB_bind1st_tran__gt_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -32478,7 +39961,180 @@ GrB_Info GB_bind1st_tran__lt_bool
 
 
 
-GrB_Info GB_bind2nd_tran__lt_bool
+GrB_Info GB_bind2nd_tran__gt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__lt_bool
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__lt_bool
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__lt_bool
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__lt_bool
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__lt_bool
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -32520,6 +40176,17 @@ GrB_Info GB_Cdense_accumB__lt_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_int8
 (
     GrB_Matrix C,
@@ -32582,6 +40249,28 @@ GrB_Info GB_AemultB__lt_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_int8
 (
@@ -32660,6 +40349,17 @@ GrB_Info GB_Cdense_accumB__lt_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_int16
 (
     GrB_Matrix C,
@@ -32722,6 +40422,28 @@ GrB_Info GB_AemultB__lt_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_int16
 (
@@ -32800,6 +40522,17 @@ GrB_Info GB_Cdense_accumB__lt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_int32
 (
     GrB_Matrix C,
@@ -32862,6 +40595,28 @@ GrB_Info GB_AemultB__lt_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_int32
 (
@@ -32940,6 +40695,17 @@ GrB_Info GB_Cdense_accumB__lt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_int64
 (
     GrB_Matrix C,
@@ -33002,6 +40768,28 @@ GrB_Info GB_AemultB__lt_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_int64
 (
@@ -33080,6 +40868,17 @@ GrB_Info GB_Cdense_accumB__lt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_uint8
 (
     GrB_Matrix C,
@@ -33142,6 +40941,28 @@ GrB_Info GB_AemultB__lt_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_uint8
 (
@@ -33220,6 +41041,17 @@ GrB_Info GB_Cdense_accumB__lt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_uint16
 (
     GrB_Matrix C,
@@ -33282,6 +41114,28 @@ GrB_Info GB_AemultB__lt_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_uint16
 (
@@ -33360,6 +41214,17 @@ GrB_Info GB_Cdense_accumB__lt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_uint32
 (
     GrB_Matrix C,
@@ -33422,6 +41287,28 @@ GrB_Info GB_AemultB__lt_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_uint32
 (
@@ -33500,6 +41387,17 @@ GrB_Info GB_Cdense_accumB__lt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_uint64
 (
     GrB_Matrix C,
@@ -33562,6 +41460,28 @@ GrB_Info GB_AemultB__lt_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lt_uint64
 (
@@ -33640,6 +41560,17 @@ GrB_Info GB_Cdense_accumB__lt_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lt_fp32
 (
     GrB_Matrix C,
@@ -33702,98 +41633,21 @@ GrB_Info GB_AemultB__lt_fp32
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__lt_fp32
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__lt_fp32
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__lt_fp32
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__lt_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__lt_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__lt_fp64
+GrB_Info GB_AaddB_sparse_dense__lt_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__lt_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__lt_fp64
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__lt_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -33801,49 +41655,8 @@ GrB_Info GB_AxD__lt_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__lt_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__lt_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__lt_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__lt_fp64
+GrB_Info GB_bind1st__lt_fp32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -33854,7 +41667,7 @@ GrB_Info GB_bind1st__lt_fp64
 
 
 
-GrB_Info GB_bind2nd__lt_fp64
+GrB_Info GB_bind2nd__lt_fp32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -33865,7 +41678,7 @@ GrB_Info GB_bind2nd__lt_fp64
 
 
 
-GrB_Info GB_bind1st_tran__lt_fp64
+GrB_Info GB_bind1st_tran__lt_fp32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -33878,7 +41691,180 @@ GrB_Info GB_bind1st_tran__lt_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__lt_fp64
+GrB_Info GB_bind2nd_tran__lt_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__lt_fp64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lt_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__lt_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__lt_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__lt_fp64
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__lt_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -33920,6 +41906,17 @@ GrB_Info GB_Cdense_accumB__ge_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_bool
 (
     GrB_Matrix C,
@@ -33982,6 +41979,28 @@ GrB_Info GB_AemultB__ge_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_bool
 (
@@ -34060,6 +42079,17 @@ GrB_Info GB_Cdense_accumB__ge_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_int8
 (
     GrB_Matrix C,
@@ -34122,6 +42152,28 @@ GrB_Info GB_AemultB__ge_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_int8
 (
@@ -34200,6 +42252,17 @@ GrB_Info GB_Cdense_accumB__ge_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_int16
 (
     GrB_Matrix C,
@@ -34262,6 +42325,28 @@ GrB_Info GB_AemultB__ge_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_int16
 (
@@ -34340,6 +42425,17 @@ GrB_Info GB_Cdense_accumB__ge_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_int32
 (
     GrB_Matrix C,
@@ -34402,6 +42498,28 @@ GrB_Info GB_AemultB__ge_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_int32
 (
@@ -34480,6 +42598,17 @@ GrB_Info GB_Cdense_accumB__ge_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_int64
 (
     GrB_Matrix C,
@@ -34542,6 +42671,28 @@ GrB_Info GB_AemultB__ge_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_int64
 (
@@ -34620,6 +42771,17 @@ GrB_Info GB_Cdense_accumB__ge_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_uint8
 (
     GrB_Matrix C,
@@ -34682,6 +42844,28 @@ GrB_Info GB_AemultB__ge_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_uint8
 (
@@ -34760,6 +42944,17 @@ GrB_Info GB_Cdense_accumB__ge_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_uint16
 (
     GrB_Matrix C,
@@ -34822,6 +43017,28 @@ GrB_Info GB_AemultB__ge_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_uint16
 (
@@ -34900,6 +43117,17 @@ GrB_Info GB_Cdense_accumB__ge_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_uint32
 (
     GrB_Matrix C,
@@ -34962,6 +43190,28 @@ GrB_Info GB_AemultB__ge_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_uint32
 (
@@ -35040,6 +43290,17 @@ GrB_Info GB_Cdense_accumB__ge_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_uint64
 (
     GrB_Matrix C,
@@ -35102,98 +43363,21 @@ GrB_Info GB_AemultB__ge_uint64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__ge_uint64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__ge_uint64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__ge_uint64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__ge_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__ge_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ge_fp32
+GrB_Info GB_AaddB_sparse_dense__ge_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__ge_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__ge_fp32
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__ge_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -35201,49 +43385,8 @@ GrB_Info GB_AxD__ge_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__ge_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__ge_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__ge_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__ge_fp32
+GrB_Info GB_bind1st__ge_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -35254,7 +43397,7 @@ GrB_Info GB_bind1st__ge_fp32
 
 
 
-GrB_Info GB_bind2nd__ge_fp32
+GrB_Info GB_bind2nd__ge_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -35265,7 +43408,7 @@ GrB_Info GB_bind2nd__ge_fp32
 
 
 
-GrB_Info GB_bind1st_tran__ge_fp32
+GrB_Info GB_bind1st_tran__ge_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -35278,7 +43421,180 @@ GrB_Info GB_bind1st_tran__ge_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__ge_fp32
+GrB_Info GB_bind2nd_tran__ge_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__ge_fp32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__ge_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__ge_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__ge_fp32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__ge_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -35320,6 +43636,17 @@ GrB_Info GB_Cdense_accumB__ge_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__ge_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__ge_fp64
 (
     GrB_Matrix C,
@@ -35382,6 +43709,28 @@ GrB_Info GB_AemultB__ge_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ge_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__ge_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__ge_fp64
 (
@@ -35460,6 +43809,17 @@ GrB_Info GB_Cdense_accumB__le_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_bool
 (
     GrB_Matrix C,
@@ -35522,6 +43882,28 @@ GrB_Info GB_AemultB__le_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_bool
 (
@@ -35600,6 +43982,17 @@ GrB_Info GB_Cdense_accumB__le_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_int8
 (
     GrB_Matrix C,
@@ -35662,6 +44055,28 @@ GrB_Info GB_AemultB__le_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_int8
 (
@@ -35740,6 +44155,17 @@ GrB_Info GB_Cdense_accumB__le_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_int16
 (
     GrB_Matrix C,
@@ -35802,6 +44228,28 @@ GrB_Info GB_AemultB__le_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_int16
 (
@@ -35880,6 +44328,17 @@ GrB_Info GB_Cdense_accumB__le_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_int32
 (
     GrB_Matrix C,
@@ -35942,6 +44401,28 @@ GrB_Info GB_AemultB__le_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_int32
 (
@@ -36020,6 +44501,17 @@ GrB_Info GB_Cdense_accumB__le_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_int64
 (
     GrB_Matrix C,
@@ -36082,6 +44574,28 @@ GrB_Info GB_AemultB__le_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_int64
 (
@@ -36160,6 +44674,17 @@ GrB_Info GB_Cdense_accumB__le_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_uint8
 (
     GrB_Matrix C,
@@ -36222,6 +44747,28 @@ GrB_Info GB_AemultB__le_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_uint8
 (
@@ -36300,6 +44847,17 @@ GrB_Info GB_Cdense_accumB__le_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_uint16
 (
     GrB_Matrix C,
@@ -36362,6 +44920,28 @@ GrB_Info GB_AemultB__le_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_uint16
 (
@@ -36440,6 +45020,17 @@ GrB_Info GB_Cdense_accumB__le_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_uint32
 (
     GrB_Matrix C,
@@ -36502,98 +45093,21 @@ GrB_Info GB_AemultB__le_uint32
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__le_uint32
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__le_uint32
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__le_uint32
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__le_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__le_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__le_uint64
+GrB_Info GB_AaddB_sparse_dense__le_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__le_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__le_uint64
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__le_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -36601,49 +45115,8 @@ GrB_Info GB_AxD__le_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__le_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__le_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__le_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__le_uint64
+GrB_Info GB_bind1st__le_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -36654,7 +45127,7 @@ GrB_Info GB_bind1st__le_uint64
 
 
 
-GrB_Info GB_bind2nd__le_uint64
+GrB_Info GB_bind2nd__le_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -36665,7 +45138,7 @@ GrB_Info GB_bind2nd__le_uint64
 
 
 
-GrB_Info GB_bind1st_tran__le_uint64
+GrB_Info GB_bind1st_tran__le_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -36678,7 +45151,180 @@ GrB_Info GB_bind1st_tran__le_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__le_uint64
+GrB_Info GB_bind2nd_tran__le_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__le_uint64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__le_uint64
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__le_uint64
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__le_uint64
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__le_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -36720,6 +45366,17 @@ GrB_Info GB_Cdense_accumB__le_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_fp32
 (
     GrB_Matrix C,
@@ -36782,6 +45439,28 @@ GrB_Info GB_AemultB__le_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_fp32
 (
@@ -36860,6 +45539,17 @@ GrB_Info GB_Cdense_accumB__le_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__le_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__le_fp64
 (
     GrB_Matrix C,
@@ -36922,6 +45612,28 @@ GrB_Info GB_AemultB__le_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__le_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__le_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__le_fp64
 (
@@ -37000,6 +45712,17 @@ GrB_Info GB_Cdense_accumB__lor_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_bool
 (
     GrB_Matrix C,
@@ -37062,6 +45785,28 @@ GrB_Info GB_AemultB__lor_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_bool
 (
@@ -37140,6 +45885,17 @@ GrB_Info GB_Cdense_accumB__lor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_int8
 (
     GrB_Matrix C,
@@ -37202,6 +45958,28 @@ GrB_Info GB_AemultB__lor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_int8
 (
@@ -37280,6 +46058,17 @@ GrB_Info GB_Cdense_accumB__lor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_int16
 (
     GrB_Matrix C,
@@ -37342,6 +46131,28 @@ GrB_Info GB_AemultB__lor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_int16
 (
@@ -37420,6 +46231,17 @@ GrB_Info GB_Cdense_accumB__lor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_int32
 (
     GrB_Matrix C,
@@ -37482,6 +46304,28 @@ GrB_Info GB_AemultB__lor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_int32
 (
@@ -37560,6 +46404,17 @@ GrB_Info GB_Cdense_accumB__lor_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_int64
 (
     GrB_Matrix C,
@@ -37622,6 +46477,28 @@ GrB_Info GB_AemultB__lor_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_int64
 (
@@ -37700,6 +46577,17 @@ GrB_Info GB_Cdense_accumB__lor_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_uint8
 (
     GrB_Matrix C,
@@ -37762,6 +46650,28 @@ GrB_Info GB_AemultB__lor_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_uint8
 (
@@ -37840,6 +46750,17 @@ GrB_Info GB_Cdense_accumB__lor_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_uint16
 (
     GrB_Matrix C,
@@ -37902,98 +46823,21 @@ GrB_Info GB_AemultB__lor_uint16
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__lor_uint16
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__lor_uint16
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__lor_uint16
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__lor_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__lor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__lor_uint32
+GrB_Info GB_AaddB_sparse_dense__lor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__lor_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__lor_uint32
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__lor_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -38001,49 +46845,8 @@ GrB_Info GB_AxD__lor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__lor_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__lor_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__lor_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__lor_uint32
+GrB_Info GB_bind1st__lor_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -38054,7 +46857,7 @@ GrB_Info GB_bind1st__lor_uint32
 
 
 
-GrB_Info GB_bind2nd__lor_uint32
+GrB_Info GB_bind2nd__lor_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -38065,7 +46868,7 @@ GrB_Info GB_bind2nd__lor_uint32
 
 
 
-GrB_Info GB_bind1st_tran__lor_uint32
+GrB_Info GB_bind1st_tran__lor_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -38078,7 +46881,180 @@ GrB_Info GB_bind1st_tran__lor_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__lor_uint32
+GrB_Info GB_bind2nd_tran__lor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__lor_uint32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__lor_uint32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__lor_uint32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__lor_uint32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__lor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -38120,6 +47096,17 @@ GrB_Info GB_Cdense_accumB__lor_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_uint64
 (
     GrB_Matrix C,
@@ -38182,6 +47169,28 @@ GrB_Info GB_AemultB__lor_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_uint64
 (
@@ -38260,6 +47269,17 @@ GrB_Info GB_Cdense_accumB__lor_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_fp32
 (
     GrB_Matrix C,
@@ -38322,6 +47342,28 @@ GrB_Info GB_AemultB__lor_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_fp32
 (
@@ -38400,6 +47442,17 @@ GrB_Info GB_Cdense_accumB__lor_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lor_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lor_fp64
 (
     GrB_Matrix C,
@@ -38462,6 +47515,28 @@ GrB_Info GB_AemultB__lor_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lor_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lor_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lor_fp64
 (
@@ -38540,6 +47615,17 @@ GrB_Info GB_Cdense_accumB__land_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_bool
 (
     GrB_Matrix C,
@@ -38602,6 +47688,28 @@ GrB_Info GB_AemultB__land_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_bool
 (
@@ -38680,6 +47788,17 @@ GrB_Info GB_Cdense_accumB__land_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_int8
 (
     GrB_Matrix C,
@@ -38742,6 +47861,28 @@ GrB_Info GB_AemultB__land_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_int8
 (
@@ -38820,6 +47961,17 @@ GrB_Info GB_Cdense_accumB__land_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_int16
 (
     GrB_Matrix C,
@@ -38882,6 +48034,28 @@ GrB_Info GB_AemultB__land_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_int16
 (
@@ -38960,6 +48134,17 @@ GrB_Info GB_Cdense_accumB__land_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_int32
 (
     GrB_Matrix C,
@@ -39022,6 +48207,28 @@ GrB_Info GB_AemultB__land_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_int32
 (
@@ -39100,6 +48307,17 @@ GrB_Info GB_Cdense_accumB__land_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_int64
 (
     GrB_Matrix C,
@@ -39162,6 +48380,28 @@ GrB_Info GB_AemultB__land_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_int64
 (
@@ -39240,6 +48480,17 @@ GrB_Info GB_Cdense_accumB__land_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_uint8
 (
     GrB_Matrix C,
@@ -39302,98 +48553,21 @@ GrB_Info GB_AemultB__land_uint8
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__land_uint8
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__land_uint8
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__land_uint8
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__land_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__land_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__land_uint16
+GrB_Info GB_AaddB_sparse_dense__land_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__land_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__land_uint16
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__land_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -39401,49 +48575,8 @@ GrB_Info GB_AxD__land_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__land_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__land_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__land_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__land_uint16
+GrB_Info GB_bind1st__land_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -39454,7 +48587,7 @@ GrB_Info GB_bind1st__land_uint16
 
 
 
-GrB_Info GB_bind2nd__land_uint16
+GrB_Info GB_bind2nd__land_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -39465,7 +48598,7 @@ GrB_Info GB_bind2nd__land_uint16
 
 
 
-GrB_Info GB_bind1st_tran__land_uint16
+GrB_Info GB_bind1st_tran__land_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -39478,7 +48611,180 @@ GrB_Info GB_bind1st_tran__land_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__land_uint16
+GrB_Info GB_bind2nd_tran__land_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__land_uint16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__land_uint16
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__land_uint16
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__land_uint16
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__land_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -39520,6 +48826,17 @@ GrB_Info GB_Cdense_accumB__land_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_uint32
 (
     GrB_Matrix C,
@@ -39582,6 +48899,28 @@ GrB_Info GB_AemultB__land_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_uint32
 (
@@ -39660,6 +48999,17 @@ GrB_Info GB_Cdense_accumB__land_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_uint64
 (
     GrB_Matrix C,
@@ -39722,6 +49072,28 @@ GrB_Info GB_AemultB__land_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_uint64
 (
@@ -39800,6 +49172,17 @@ GrB_Info GB_Cdense_accumB__land_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_fp32
 (
     GrB_Matrix C,
@@ -39862,6 +49245,28 @@ GrB_Info GB_AemultB__land_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_fp32
 (
@@ -39940,6 +49345,17 @@ GrB_Info GB_Cdense_accumB__land_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__land_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__land_fp64
 (
     GrB_Matrix C,
@@ -40002,6 +49418,28 @@ GrB_Info GB_AemultB__land_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__land_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__land_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__land_fp64
 (
@@ -40080,6 +49518,17 @@ GrB_Info GB_Cdense_accumB__lxor_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_bool
 (
     GrB_Matrix C,
@@ -40142,6 +49591,28 @@ GrB_Info GB_AemultB__lxor_bool
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_bool
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_bool
 (
@@ -40220,6 +49691,17 @@ GrB_Info GB_Cdense_accumB__lxor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_int8
 (
     GrB_Matrix C,
@@ -40282,6 +49764,28 @@ GrB_Info GB_AemultB__lxor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_int8
 (
@@ -40360,6 +49864,17 @@ GrB_Info GB_Cdense_accumB__lxor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_int16
 (
     GrB_Matrix C,
@@ -40422,6 +49937,28 @@ GrB_Info GB_AemultB__lxor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_int16
 (
@@ -40500,6 +50037,17 @@ GrB_Info GB_Cdense_accumB__lxor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_int32
 (
     GrB_Matrix C,
@@ -40562,6 +50110,28 @@ GrB_Info GB_AemultB__lxor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_int32
 (
@@ -40640,6 +50210,17 @@ GrB_Info GB_Cdense_accumB__lxor_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_int64
 (
     GrB_Matrix C,
@@ -40702,98 +50283,21 @@ GrB_Info GB_AemultB__lxor_int64
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__lxor_int64
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__lxor_int64
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__lxor_int64
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__lxor_int64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__lxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__lxor_uint8
+GrB_Info GB_AaddB_sparse_dense__lxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__lxor_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumb__lxor_uint8
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__lxor_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -40801,49 +50305,8 @@ GrB_Info GB_AxD__lxor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__lxor_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__lxor_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__lxor_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
-GrB_Info GB_bind1st__lxor_uint8
+GrB_Info GB_bind1st__lxor_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -40854,7 +50317,7 @@ GrB_Info GB_bind1st__lxor_uint8
 
 
 
-GrB_Info GB_bind2nd__lxor_uint8
+GrB_Info GB_bind2nd__lxor_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -40865,7 +50328,7 @@ GrB_Info GB_bind2nd__lxor_uint8
 
 
 
-GrB_Info GB_bind1st_tran__lxor_uint8
+GrB_Info GB_bind1st_tran__lxor_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -40878,7 +50341,180 @@ GrB_Info GB_bind1st_tran__lxor_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__lxor_uint8
+GrB_Info GB_bind2nd_tran__lxor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__lxor_uint8
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+
+
+GrB_Info GB_AxD__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_DxB__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_AaddB__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__lxor_uint8
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__lxor_uint8
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__lxor_uint8
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__lxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -40920,6 +50556,17 @@ GrB_Info GB_Cdense_accumB__lxor_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_uint16
 (
     GrB_Matrix C,
@@ -40982,6 +50629,28 @@ GrB_Info GB_AemultB__lxor_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_uint16
 (
@@ -41060,6 +50729,17 @@ GrB_Info GB_Cdense_accumB__lxor_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_uint32
 (
     GrB_Matrix C,
@@ -41122,6 +50802,28 @@ GrB_Info GB_AemultB__lxor_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_uint32
 (
@@ -41200,6 +50902,17 @@ GrB_Info GB_Cdense_accumB__lxor_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_uint64
 (
     GrB_Matrix C,
@@ -41262,6 +50975,28 @@ GrB_Info GB_AemultB__lxor_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_uint64
 (
@@ -41340,6 +51075,17 @@ GrB_Info GB_Cdense_accumB__lxor_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_fp32
 (
     GrB_Matrix C,
@@ -41402,6 +51148,28 @@ GrB_Info GB_AemultB__lxor_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_fp32
 (
@@ -41480,6 +51248,17 @@ GrB_Info GB_Cdense_accumB__lxor_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__lxor_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__lxor_fp64
 (
     GrB_Matrix C,
@@ -41542,6 +51321,28 @@ GrB_Info GB_AemultB__lxor_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__lxor_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__lxor_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__lxor_fp64
 (
@@ -41620,6 +51421,17 @@ GrB_Info GB_Cdense_accumB__atan2_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__atan2_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__atan2_fp32
 (
     GrB_Matrix C,
@@ -41682,6 +51494,28 @@ GrB_Info GB_AemultB__atan2_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__atan2_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__atan2_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__atan2_fp32
 (
@@ -41760,6 +51594,17 @@ GrB_Info GB_Cdense_accumB__atan2_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__atan2_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__atan2_fp64
 (
     GrB_Matrix C,
@@ -41822,6 +51667,28 @@ GrB_Info GB_AemultB__atan2_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__atan2_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__atan2_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__atan2_fp64
 (
@@ -41900,6 +51767,17 @@ GrB_Info GB_Cdense_accumB__hypot_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__hypot_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__hypot_fp32
 (
     GrB_Matrix C,
@@ -41962,6 +51840,28 @@ GrB_Info GB_AemultB__hypot_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__hypot_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__hypot_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__hypot_fp32
 (
@@ -42040,6 +51940,17 @@ GrB_Info GB_Cdense_accumB__hypot_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__hypot_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__hypot_fp64
 (
     GrB_Matrix C,
@@ -42102,6 +52013,28 @@ GrB_Info GB_AemultB__hypot_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__hypot_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__hypot_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__hypot_fp64
 (
@@ -42161,7 +52094,1045 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__fmod_fp32
+GrB_Info GB_Cdense_ewise3_noaccum__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__fmod_fp32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__fmod_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__fmod_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__fmod_fp32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__fmod_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__fmod_fp64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__fmod_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__fmod_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__fmod_fp64
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__fmod_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__remainder_fp32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__remainder_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__remainder_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__remainder_fp32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__remainder_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__remainder_fp64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__remainder_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__remainder_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__remainder_fp64
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__remainder_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__copysign_fp32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__copysign_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__copysign_fp32
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__copysign_fp32
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__copysign_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumB_tran__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__copysign_fp64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
+
+#if 0
+
+GrB_Info (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A, bool A_is_pattern,
+    const GrB_Matrix D, bool D_is_pattern,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info (node)
+(
+    GrB_Matrix C,
+    const GrB_Matrix D, bool D_is_pattern,
+    const GrB_Matrix B, bool B_is_pattern,
+    int nthreads
+) ;
+
+#endif
+
+GrB_Info GB_AaddB__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool Ch_is_Mh,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AemultB__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix M,
+    const bool Mask_struct,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT C_to_M,
+    const int64_t *GB_RESTRICT C_to_A,
+    const int64_t *GB_RESTRICT C_to_B,
+    const GB_task_struct *GB_RESTRICT TaskList,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AkronB__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__copysign_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *x_input,
+    const GB_void *Bx_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind2nd__copysign_fp64
+(
+    GB_void *Cx_output,
+    const GB_void *Ax_input,
+    const GB_void *y_input,
+    int64_t anz,
+    int nthreads
+) ;
+
+
+
+GrB_Info GB_bind1st_tran__copysign_fp64
+(
+    GrB_Matrix C,
+    const GB_void *x_input,
+    const GrB_Matrix A,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+GrB_Info GB_bind2nd_tran__copysign_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GB_void *y_input,
+    int64_t *GB_RESTRICT *Rowcounts,
+    GBI_single_iterator Iter,
+    const int64_t *GB_RESTRICT A_slice,
+    int naslice
+) ;
+
+
+
+#if 0
+void (none)
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int nthreads
+) ;
+#endif
+
+GrB_Info GB_Cdense_ewise3_noaccum__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42169,7 +53140,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__fmod_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__fmod_fp32
+GrB_Info GB_Cdense_accumB__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -42180,7 +53151,18 @@ GrB_Info GB_Cdense_accumB__fmod_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__fmod_fp32
+GrB_Info GB_Cdense_accumB_tran__ldexp_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__ldexp_fp32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42211,7 +53193,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__fmod_fp32
+GrB_Info GB_AaddB__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42227,7 +53209,7 @@ GrB_Info GB_AaddB__fmod_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__fmod_fp32
+GrB_Info GB_AemultB__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42242,77 +53224,21 @@ GrB_Info GB_AemultB__fmod_fp32
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__fmod_fp32
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__fmod_fp32
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__fmod_fp32
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__fmod_fp32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__fmod_fp64
+GrB_Info GB_AaddB_sparse_dense__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__fmod_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -42320,70 +53246,8 @@ GrB_Info GB_Cdense_accumB__fmod_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__fmod_fp64
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__fmod_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__fmod_fp64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-
-GrB_Info GB_bind1st__fmod_fp64
+GrB_Info GB_bind1st__ldexp_fp32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42394,7 +53258,7 @@ GrB_Info GB_bind1st__fmod_fp64
 
 
 
-GrB_Info GB_bind2nd__fmod_fp64
+GrB_Info GB_bind2nd__ldexp_fp32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42405,7 +53269,7 @@ GrB_Info GB_bind2nd__fmod_fp64
 
 
 
-GrB_Info GB_bind1st_tran__fmod_fp64
+GrB_Info GB_bind1st_tran__ldexp_fp32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42418,7 +53282,7 @@ GrB_Info GB_bind1st_tran__fmod_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__fmod_fp64
+GrB_Info GB_bind2nd_tran__ldexp_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42441,7 +53305,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__remainder_fp32
+GrB_Info GB_Cdense_ewise3_noaccum__ldexp_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42449,7 +53313,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__remainder_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__remainder_fp32
+GrB_Info GB_Cdense_accumB__ldexp_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -42460,7 +53324,18 @@ GrB_Info GB_Cdense_accumB__remainder_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__remainder_fp32
+GrB_Info GB_Cdense_accumB_tran__ldexp_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__ldexp_fp64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42491,7 +53366,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__remainder_fp32
+GrB_Info GB_AaddB__ldexp_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42507,7 +53382,7 @@ GrB_Info GB_AaddB__remainder_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__remainder_fp32
+GrB_Info GB_AemultB__ldexp_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42522,8 +53397,30 @@ GrB_Info GB_AemultB__remainder_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__ldexp_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__remainder_fp32
+GrB_Info GB_AaddB_sparse_dense__ldexp_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__ldexp_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42534,7 +53431,7 @@ GrB_Info GB_bind1st__remainder_fp32
 
 
 
-GrB_Info GB_bind2nd__remainder_fp32
+GrB_Info GB_bind2nd__ldexp_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42545,7 +53442,7 @@ GrB_Info GB_bind2nd__remainder_fp32
 
 
 
-GrB_Info GB_bind1st_tran__remainder_fp32
+GrB_Info GB_bind1st_tran__ldexp_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42558,7 +53455,7 @@ GrB_Info GB_bind1st_tran__remainder_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__remainder_fp32
+GrB_Info GB_bind2nd_tran__ldexp_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42581,7 +53478,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__remainder_fp64
+GrB_Info GB_Cdense_ewise3_noaccum__cmplx_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42589,7 +53486,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__remainder_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__remainder_fp64
+GrB_Info GB_Cdense_accumB__cmplx_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -42600,7 +53497,18 @@ GrB_Info GB_Cdense_accumB__remainder_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__remainder_fp64
+GrB_Info GB_Cdense_accumB_tran__cmplx_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__cmplx_fp32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42631,7 +53539,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__remainder_fp64
+GrB_Info GB_AaddB__cmplx_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42647,7 +53555,7 @@ GrB_Info GB_AaddB__remainder_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__remainder_fp64
+GrB_Info GB_AemultB__cmplx_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42662,8 +53570,30 @@ GrB_Info GB_AemultB__remainder_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__cmplx_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__remainder_fp64
+GrB_Info GB_AaddB_sparse_dense__cmplx_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__cmplx_fp32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42674,7 +53604,7 @@ GrB_Info GB_bind1st__remainder_fp64
 
 
 
-GrB_Info GB_bind2nd__remainder_fp64
+GrB_Info GB_bind2nd__cmplx_fp32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42685,7 +53615,7 @@ GrB_Info GB_bind2nd__remainder_fp64
 
 
 
-GrB_Info GB_bind1st_tran__remainder_fp64
+GrB_Info GB_bind1st_tran__cmplx_fp32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42698,7 +53628,7 @@ GrB_Info GB_bind1st_tran__remainder_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__remainder_fp64
+GrB_Info GB_bind2nd_tran__cmplx_fp32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42721,7 +53651,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__copysign_fp32
+GrB_Info GB_Cdense_ewise3_noaccum__cmplx_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42729,7 +53659,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__copysign_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__copysign_fp32
+GrB_Info GB_Cdense_accumB__cmplx_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -42740,7 +53670,18 @@ GrB_Info GB_Cdense_accumB__copysign_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__copysign_fp32
+GrB_Info GB_Cdense_accumB_tran__cmplx_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__cmplx_fp64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42771,7 +53712,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__copysign_fp32
+GrB_Info GB_AaddB__cmplx_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42787,7 +53728,7 @@ GrB_Info GB_AaddB__copysign_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__copysign_fp32
+GrB_Info GB_AemultB__cmplx_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42802,8 +53743,30 @@ GrB_Info GB_AemultB__copysign_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__cmplx_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__copysign_fp32
+GrB_Info GB_AaddB_sparse_dense__cmplx_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__cmplx_fp64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42814,7 +53777,7 @@ GrB_Info GB_bind1st__copysign_fp32
 
 
 
-GrB_Info GB_bind2nd__copysign_fp32
+GrB_Info GB_bind2nd__cmplx_fp64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42825,7 +53788,7 @@ GrB_Info GB_bind2nd__copysign_fp32
 
 
 
-GrB_Info GB_bind1st_tran__copysign_fp32
+GrB_Info GB_bind1st_tran__cmplx_fp64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42838,7 +53801,7 @@ GrB_Info GB_bind1st_tran__copysign_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__copysign_fp32
+GrB_Info GB_bind2nd_tran__cmplx_fp64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42861,7 +53824,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__copysign_fp64
+GrB_Info GB_Cdense_ewise3_noaccum__bor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -42869,7 +53832,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__copysign_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__copysign_fp64
+GrB_Info GB_Cdense_accumB__bor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -42880,7 +53843,18 @@ GrB_Info GB_Cdense_accumB__copysign_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__copysign_fp64
+GrB_Info GB_Cdense_accumB_tran__bor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -42911,7 +53885,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__copysign_fp64
+GrB_Info GB_AaddB__bor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42927,7 +53901,7 @@ GrB_Info GB_AaddB__copysign_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__copysign_fp64
+GrB_Info GB_AemultB__bor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -42942,8 +53916,30 @@ GrB_Info GB_AemultB__copysign_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__copysign_fp64
+GrB_Info GB_AaddB_sparse_dense__bor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -42954,7 +53950,7 @@ GrB_Info GB_bind1st__copysign_fp64
 
 
 
-GrB_Info GB_bind2nd__copysign_fp64
+GrB_Info GB_bind2nd__bor_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -42965,7 +53961,7 @@ GrB_Info GB_bind2nd__copysign_fp64
 
 
 
-GrB_Info GB_bind1st_tran__copysign_fp64
+GrB_Info GB_bind1st_tran__bor_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -42978,7 +53974,7 @@ GrB_Info GB_bind1st_tran__copysign_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__copysign_fp64
+GrB_Info GB_bind2nd_tran__bor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43001,7 +53997,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ldexp_fp32
+GrB_Info GB_Cdense_ewise3_noaccum__bor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43009,7 +54005,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__ldexp_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__ldexp_fp32
+GrB_Info GB_Cdense_accumB__bor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43020,7 +54016,18 @@ GrB_Info GB_Cdense_accumB__ldexp_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__ldexp_fp32
+GrB_Info GB_Cdense_accumB_tran__bor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_int16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43051,7 +54058,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__ldexp_fp32
+GrB_Info GB_AaddB__bor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43067,7 +54074,7 @@ GrB_Info GB_AaddB__ldexp_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__ldexp_fp32
+GrB_Info GB_AemultB__bor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43082,8 +54089,30 @@ GrB_Info GB_AemultB__ldexp_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__ldexp_fp32
+
+GrB_Info GB_bind1st__bor_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43094,7 +54123,7 @@ GrB_Info GB_bind1st__ldexp_fp32
 
 
 
-GrB_Info GB_bind2nd__ldexp_fp32
+GrB_Info GB_bind2nd__bor_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43105,7 +54134,7 @@ GrB_Info GB_bind2nd__ldexp_fp32
 
 
 
-GrB_Info GB_bind1st_tran__ldexp_fp32
+GrB_Info GB_bind1st_tran__bor_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43118,7 +54147,7 @@ GrB_Info GB_bind1st_tran__ldexp_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__ldexp_fp32
+GrB_Info GB_bind2nd_tran__bor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43141,7 +54170,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__ldexp_fp64
+GrB_Info GB_Cdense_ewise3_noaccum__bor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43149,7 +54178,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__ldexp_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__ldexp_fp64
+GrB_Info GB_Cdense_accumB__bor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43160,7 +54189,18 @@ GrB_Info GB_Cdense_accumB__ldexp_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__ldexp_fp64
+GrB_Info GB_Cdense_accumB_tran__bor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_int32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43191,7 +54231,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__ldexp_fp64
+GrB_Info GB_AaddB__bor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43207,7 +54247,7 @@ GrB_Info GB_AaddB__ldexp_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__ldexp_fp64
+GrB_Info GB_AemultB__bor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43222,8 +54262,30 @@ GrB_Info GB_AemultB__ldexp_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__ldexp_fp64
+GrB_Info GB_AaddB_sparse_dense__bor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43234,7 +54296,7 @@ GrB_Info GB_bind1st__ldexp_fp64
 
 
 
-GrB_Info GB_bind2nd__ldexp_fp64
+GrB_Info GB_bind2nd__bor_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43245,7 +54307,7 @@ GrB_Info GB_bind2nd__ldexp_fp64
 
 
 
-GrB_Info GB_bind1st_tran__ldexp_fp64
+GrB_Info GB_bind1st_tran__bor_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43258,7 +54320,7 @@ GrB_Info GB_bind1st_tran__ldexp_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__ldexp_fp64
+GrB_Info GB_bind2nd_tran__bor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43281,7 +54343,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__cmplx_fp32
+GrB_Info GB_Cdense_ewise3_noaccum__bor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43289,7 +54351,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__cmplx_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__cmplx_fp32
+GrB_Info GB_Cdense_accumB__bor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43300,7 +54362,18 @@ GrB_Info GB_Cdense_accumB__cmplx_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__cmplx_fp32
+GrB_Info GB_Cdense_accumB_tran__bor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_int64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -43331,7 +54404,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__cmplx_fp32
+GrB_Info GB_AaddB__bor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43347,7 +54420,7 @@ GrB_Info GB_AaddB__cmplx_fp32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__cmplx_fp32
+GrB_Info GB_AemultB__bor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43362,8 +54435,30 @@ GrB_Info GB_AemultB__cmplx_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__cmplx_fp32
+GrB_Info GB_AaddB_sparse_dense__bor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43374,7 +54469,7 @@ GrB_Info GB_bind1st__cmplx_fp32
 
 
 
-GrB_Info GB_bind2nd__cmplx_fp32
+GrB_Info GB_bind2nd__bor_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43385,7 +54480,7 @@ GrB_Info GB_bind2nd__cmplx_fp32
 
 
 
-GrB_Info GB_bind1st_tran__cmplx_fp32
+GrB_Info GB_bind1st_tran__bor_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43398,7 +54493,7 @@ GrB_Info GB_bind1st_tran__cmplx_fp32
 
 
 
-GrB_Info GB_bind2nd_tran__cmplx_fp32
+GrB_Info GB_bind2nd_tran__bor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43421,7 +54516,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__cmplx_fp64
+GrB_Info GB_Cdense_ewise3_noaccum__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43429,7 +54524,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__cmplx_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__cmplx_fp64
+GrB_Info GB_Cdense_accumB__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43440,16 +54535,27 @@ GrB_Info GB_Cdense_accumB__cmplx_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__cmplx_fp64
+GrB_Info GB_Cdense_accumB_tran__bor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -43461,7 +54567,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -43469,9 +54575,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__cmplx_fp64
+
+GrB_Info GB_AaddB__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43487,7 +54593,7 @@ GrB_Info GB_AaddB__cmplx_fp64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__cmplx_fp64
+GrB_Info GB_AemultB__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43502,8 +54608,30 @@ GrB_Info GB_AemultB__cmplx_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__cmplx_fp64
+GrB_Info GB_AaddB_sparse_dense__bor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43514,7 +54642,7 @@ GrB_Info GB_bind1st__cmplx_fp64
 
 
 
-GrB_Info GB_bind2nd__cmplx_fp64
+GrB_Info GB_bind2nd__bor_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43525,7 +54653,7 @@ GrB_Info GB_bind2nd__cmplx_fp64
 
 
 
-GrB_Info GB_bind1st_tran__cmplx_fp64
+GrB_Info GB_bind1st_tran__bor_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43538,7 +54666,7 @@ GrB_Info GB_bind1st_tran__cmplx_fp64
 
 
 
-GrB_Info GB_bind2nd_tran__cmplx_fp64
+GrB_Info GB_bind2nd_tran__bor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43561,7 +54689,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43569,7 +54697,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_int8
+GrB_Info GB_Cdense_accumB__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43580,16 +54708,27 @@ GrB_Info GB_Cdense_accumB__bor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_int8
+GrB_Info GB_Cdense_accumB_tran__bor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -43601,7 +54740,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -43609,9 +54748,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bor_int8
+
+GrB_Info GB_AaddB__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43627,7 +54766,7 @@ GrB_Info GB_AaddB__bor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_int8
+GrB_Info GB_AemultB__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43642,8 +54781,30 @@ GrB_Info GB_AemultB__bor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_int8
+GrB_Info GB_AaddB_sparse_dense__bor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43654,7 +54815,7 @@ GrB_Info GB_bind1st__bor_int8
 
 
 
-GrB_Info GB_bind2nd__bor_int8
+GrB_Info GB_bind2nd__bor_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43665,7 +54826,7 @@ GrB_Info GB_bind2nd__bor_int8
 
 
 
-GrB_Info GB_bind1st_tran__bor_int8
+GrB_Info GB_bind1st_tran__bor_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43678,7 +54839,7 @@ GrB_Info GB_bind1st_tran__bor_int8
 
 
 
-GrB_Info GB_bind2nd_tran__bor_int8
+GrB_Info GB_bind2nd_tran__bor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43701,7 +54862,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_int16
+GrB_Info GB_Cdense_ewise3_noaccum__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43709,7 +54870,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_int16
+GrB_Info GB_Cdense_accumB__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43720,16 +54881,27 @@ GrB_Info GB_Cdense_accumB__bor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_int16
+GrB_Info GB_Cdense_accumB_tran__bor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -43741,7 +54913,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -43749,9 +54921,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bor_int16
+
+GrB_Info GB_AaddB__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43767,7 +54939,7 @@ GrB_Info GB_AaddB__bor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_int16
+GrB_Info GB_AemultB__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43782,8 +54954,30 @@ GrB_Info GB_AemultB__bor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_int16
+GrB_Info GB_AaddB_sparse_dense__bor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43794,7 +54988,7 @@ GrB_Info GB_bind1st__bor_int16
 
 
 
-GrB_Info GB_bind2nd__bor_int16
+GrB_Info GB_bind2nd__bor_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43805,7 +54999,7 @@ GrB_Info GB_bind2nd__bor_int16
 
 
 
-GrB_Info GB_bind1st_tran__bor_int16
+GrB_Info GB_bind1st_tran__bor_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43818,7 +55012,7 @@ GrB_Info GB_bind1st_tran__bor_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bor_int16
+GrB_Info GB_bind2nd_tran__bor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43841,7 +55035,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43849,7 +55043,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_int32
+GrB_Info GB_Cdense_accumB__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -43860,16 +55054,27 @@ GrB_Info GB_Cdense_accumB__bor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_int32
+GrB_Info GB_Cdense_accumB_tran__bor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bor_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -43881,7 +55086,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -43889,9 +55094,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bor_int32
+
+GrB_Info GB_AaddB__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43907,7 +55112,7 @@ GrB_Info GB_AaddB__bor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_int32
+GrB_Info GB_AemultB__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -43922,8 +55127,30 @@ GrB_Info GB_AemultB__bor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_int32
+GrB_Info GB_AaddB_sparse_dense__bor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bor_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -43934,7 +55161,7 @@ GrB_Info GB_bind1st__bor_int32
 
 
 
-GrB_Info GB_bind2nd__bor_int32
+GrB_Info GB_bind2nd__bor_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -43945,7 +55172,7 @@ GrB_Info GB_bind2nd__bor_int32
 
 
 
-GrB_Info GB_bind1st_tran__bor_int32
+GrB_Info GB_bind1st_tran__bor_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -43958,7 +55185,7 @@ GrB_Info GB_bind1st_tran__bor_int32
 
 
 
-GrB_Info GB_bind2nd_tran__bor_int32
+GrB_Info GB_bind2nd_tran__bor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43981,7 +55208,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_int64
+GrB_Info GB_Cdense_ewise3_noaccum__band_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -43989,7 +55216,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_int64
+GrB_Info GB_Cdense_accumB__band_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44000,7 +55227,18 @@ GrB_Info GB_Cdense_accumB__bor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_int64
+GrB_Info GB_Cdense_accumB_tran__band_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__band_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -44031,7 +55269,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bor_int64
+GrB_Info GB_AaddB__band_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44047,7 +55285,7 @@ GrB_Info GB_AaddB__bor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_int64
+GrB_Info GB_AemultB__band_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44062,8 +55300,30 @@ GrB_Info GB_AemultB__bor_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_int64
+GrB_Info GB_AaddB_sparse_dense__band_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__band_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44074,7 +55334,7 @@ GrB_Info GB_bind1st__bor_int64
 
 
 
-GrB_Info GB_bind2nd__bor_int64
+GrB_Info GB_bind2nd__band_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44085,7 +55345,7 @@ GrB_Info GB_bind2nd__bor_int64
 
 
 
-GrB_Info GB_bind1st_tran__bor_int64
+GrB_Info GB_bind1st_tran__band_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44098,7 +55358,7 @@ GrB_Info GB_bind1st_tran__bor_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bor_int64
+GrB_Info GB_bind2nd_tran__band_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44121,7 +55381,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__band_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44129,7 +55389,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_uint8
+GrB_Info GB_Cdense_accumB__band_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44140,16 +55400,27 @@ GrB_Info GB_Cdense_accumB__bor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_uint8
+GrB_Info GB_Cdense_accumB_tran__band_int16
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__band_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bor_uint8
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -44161,7 +55432,7 @@ GrB_Info GB_AxD__bor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bor_uint8
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -44169,9 +55440,9 @@ GrB_Info GB_DxB__bor_uint8
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bor_uint8
+GrB_Info GB_AaddB__band_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44187,7 +55458,7 @@ GrB_Info GB_AaddB__bor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_uint8
+GrB_Info GB_AemultB__band_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44202,8 +55473,30 @@ GrB_Info GB_AemultB__bor_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_uint8
+GrB_Info GB_AaddB_sparse_dense__band_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__band_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44214,7 +55507,7 @@ GrB_Info GB_bind1st__bor_uint8
 
 
 
-GrB_Info GB_bind2nd__bor_uint8
+GrB_Info GB_bind2nd__band_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44225,7 +55518,7 @@ GrB_Info GB_bind2nd__bor_uint8
 
 
 
-GrB_Info GB_bind1st_tran__bor_uint8
+GrB_Info GB_bind1st_tran__band_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44238,7 +55531,7 @@ GrB_Info GB_bind1st_tran__bor_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__bor_uint8
+GrB_Info GB_bind2nd_tran__band_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44261,7 +55554,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__band_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44269,7 +55562,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_uint16
+GrB_Info GB_Cdense_accumB__band_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44280,16 +55573,27 @@ GrB_Info GB_Cdense_accumB__bor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_uint16
+GrB_Info GB_Cdense_accumB_tran__band_int32
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__band_int32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bor_uint16
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -44301,7 +55605,7 @@ GrB_Info GB_AxD__bor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bor_uint16
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -44309,9 +55613,9 @@ GrB_Info GB_DxB__bor_uint16
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bor_uint16
+GrB_Info GB_AaddB__band_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44327,7 +55631,7 @@ GrB_Info GB_AaddB__bor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_uint16
+GrB_Info GB_AemultB__band_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44342,8 +55646,30 @@ GrB_Info GB_AemultB__bor_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__band_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_uint16
+
+GrB_Info GB_bind1st__band_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44354,7 +55680,7 @@ GrB_Info GB_bind1st__bor_uint16
 
 
 
-GrB_Info GB_bind2nd__bor_uint16
+GrB_Info GB_bind2nd__band_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44365,7 +55691,7 @@ GrB_Info GB_bind2nd__bor_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bor_uint16
+GrB_Info GB_bind1st_tran__band_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44378,7 +55704,7 @@ GrB_Info GB_bind1st_tran__bor_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bor_uint16
+GrB_Info GB_bind2nd_tran__band_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44401,7 +55727,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__band_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44409,7 +55735,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_uint32
+GrB_Info GB_Cdense_accumB__band_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44420,16 +55746,27 @@ GrB_Info GB_Cdense_accumB__bor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_uint32
+GrB_Info GB_Cdense_accumB_tran__band_int64
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__band_int64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bor_uint32
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -44441,7 +55778,7 @@ GrB_Info GB_AxD__bor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bor_uint32
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -44449,9 +55786,9 @@ GrB_Info GB_DxB__bor_uint32
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bor_uint32
+GrB_Info GB_AaddB__band_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44467,7 +55804,7 @@ GrB_Info GB_AaddB__bor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_uint32
+GrB_Info GB_AemultB__band_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44482,8 +55819,30 @@ GrB_Info GB_AemultB__bor_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__band_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_uint32
+
+GrB_Info GB_bind1st__band_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44494,7 +55853,7 @@ GrB_Info GB_bind1st__bor_uint32
 
 
 
-GrB_Info GB_bind2nd__bor_uint32
+GrB_Info GB_bind2nd__band_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44505,7 +55864,7 @@ GrB_Info GB_bind2nd__bor_uint32
 
 
 
-GrB_Info GB_bind1st_tran__bor_uint32
+GrB_Info GB_bind1st_tran__band_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44518,7 +55877,7 @@ GrB_Info GB_bind1st_tran__bor_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__bor_uint32
+GrB_Info GB_bind2nd_tran__band_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44541,7 +55900,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bor_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44549,7 +55908,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bor_uint64
+GrB_Info GB_Cdense_accumB__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44560,7 +55919,18 @@ GrB_Info GB_Cdense_accumB__bor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bor_uint64
+GrB_Info GB_Cdense_accumB_tran__band_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__band_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -44569,7 +55939,7 @@ GrB_Info GB_Cdense_accumb__bor_uint64
 
 
 
-GrB_Info GB_AxD__bor_uint64
+GrB_Info GB_AxD__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -44581,7 +55951,7 @@ GrB_Info GB_AxD__bor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bor_uint64
+GrB_Info GB_DxB__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -44591,7 +55961,7 @@ GrB_Info GB_DxB__bor_uint64
 
 
 
-GrB_Info GB_AaddB__bor_uint64
+GrB_Info GB_AaddB__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44607,7 +55977,7 @@ GrB_Info GB_AaddB__bor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bor_uint64
+GrB_Info GB_AemultB__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44622,8 +55992,30 @@ GrB_Info GB_AemultB__bor_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bor_uint64
+GrB_Info GB_AaddB_sparse_dense__band_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__band_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44634,7 +56026,7 @@ GrB_Info GB_bind1st__bor_uint64
 
 
 
-GrB_Info GB_bind2nd__bor_uint64
+GrB_Info GB_bind2nd__band_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44645,7 +56037,7 @@ GrB_Info GB_bind2nd__bor_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bor_uint64
+GrB_Info GB_bind1st_tran__band_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44658,7 +56050,7 @@ GrB_Info GB_bind1st_tran__bor_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bor_uint64
+GrB_Info GB_bind2nd_tran__band_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44681,7 +56073,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_int8
+GrB_Info GB_Cdense_ewise3_noaccum__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44689,7 +56081,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_int8
+GrB_Info GB_Cdense_accumB__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44700,16 +56092,27 @@ GrB_Info GB_Cdense_accumB__band_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_int8
+GrB_Info GB_Cdense_accumB_tran__band_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__band_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -44721,7 +56124,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -44729,9 +56132,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__band_int8
+
+GrB_Info GB_AaddB__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44747,7 +56150,7 @@ GrB_Info GB_AaddB__band_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_int8
+GrB_Info GB_AemultB__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44762,8 +56165,30 @@ GrB_Info GB_AemultB__band_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_int8
+GrB_Info GB_AaddB_sparse_dense__band_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__band_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44774,7 +56199,7 @@ GrB_Info GB_bind1st__band_int8
 
 
 
-GrB_Info GB_bind2nd__band_int8
+GrB_Info GB_bind2nd__band_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44785,7 +56210,7 @@ GrB_Info GB_bind2nd__band_int8
 
 
 
-GrB_Info GB_bind1st_tran__band_int8
+GrB_Info GB_bind1st_tran__band_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44798,7 +56223,7 @@ GrB_Info GB_bind1st_tran__band_int8
 
 
 
-GrB_Info GB_bind2nd_tran__band_int8
+GrB_Info GB_bind2nd_tran__band_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44821,7 +56246,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_int16
+GrB_Info GB_Cdense_ewise3_noaccum__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44829,7 +56254,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_int16
+GrB_Info GB_Cdense_accumB__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44840,16 +56265,27 @@ GrB_Info GB_Cdense_accumB__band_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_int16
+GrB_Info GB_Cdense_accumB_tran__band_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__band_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -44861,7 +56297,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -44869,9 +56305,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__band_int16
+
+GrB_Info GB_AaddB__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44887,7 +56323,7 @@ GrB_Info GB_AaddB__band_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_int16
+GrB_Info GB_AemultB__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -44902,8 +56338,30 @@ GrB_Info GB_AemultB__band_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_int16
+GrB_Info GB_AaddB_sparse_dense__band_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__band_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -44914,7 +56372,7 @@ GrB_Info GB_bind1st__band_int16
 
 
 
-GrB_Info GB_bind2nd__band_int16
+GrB_Info GB_bind2nd__band_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -44925,7 +56383,7 @@ GrB_Info GB_bind2nd__band_int16
 
 
 
-GrB_Info GB_bind1st_tran__band_int16
+GrB_Info GB_bind1st_tran__band_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -44938,7 +56396,7 @@ GrB_Info GB_bind1st_tran__band_int16
 
 
 
-GrB_Info GB_bind2nd_tran__band_int16
+GrB_Info GB_bind2nd_tran__band_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44961,7 +56419,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_int32
+GrB_Info GB_Cdense_ewise3_noaccum__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -44969,7 +56427,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_int32
+GrB_Info GB_Cdense_accumB__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -44980,16 +56438,27 @@ GrB_Info GB_Cdense_accumB__band_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_int32
+GrB_Info GB_Cdense_accumB_tran__band_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__band_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45001,7 +56470,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45009,9 +56478,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__band_int32
+
+GrB_Info GB_AaddB__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45027,7 +56496,7 @@ GrB_Info GB_AaddB__band_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_int32
+GrB_Info GB_AemultB__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45042,8 +56511,30 @@ GrB_Info GB_AemultB__band_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__band_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_int32
+GrB_Info GB_AaddB_sparse_dense__band_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__band_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45054,7 +56545,7 @@ GrB_Info GB_bind1st__band_int32
 
 
 
-GrB_Info GB_bind2nd__band_int32
+GrB_Info GB_bind2nd__band_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45065,7 +56556,7 @@ GrB_Info GB_bind2nd__band_int32
 
 
 
-GrB_Info GB_bind1st_tran__band_int32
+GrB_Info GB_bind1st_tran__band_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45078,7 +56569,7 @@ GrB_Info GB_bind1st_tran__band_int32
 
 
 
-GrB_Info GB_bind2nd_tran__band_int32
+GrB_Info GB_bind2nd_tran__band_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45101,7 +56592,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_int64
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45109,7 +56600,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_int64
+GrB_Info GB_Cdense_accumB__bxor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45120,7 +56611,18 @@ GrB_Info GB_Cdense_accumB__band_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_int64
+GrB_Info GB_Cdense_accumB_tran__bxor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxor_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -45151,7 +56653,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__band_int64
+GrB_Info GB_AaddB__bxor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45167,7 +56669,7 @@ GrB_Info GB_AaddB__band_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_int64
+GrB_Info GB_AemultB__bxor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45182,8 +56684,30 @@ GrB_Info GB_AemultB__band_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_int64
+GrB_Info GB_AaddB_sparse_dense__bxor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45194,7 +56718,7 @@ GrB_Info GB_bind1st__band_int64
 
 
 
-GrB_Info GB_bind2nd__band_int64
+GrB_Info GB_bind2nd__bxor_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45205,7 +56729,7 @@ GrB_Info GB_bind2nd__band_int64
 
 
 
-GrB_Info GB_bind1st_tran__band_int64
+GrB_Info GB_bind1st_tran__bxor_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45218,7 +56742,7 @@ GrB_Info GB_bind1st_tran__band_int64
 
 
 
-GrB_Info GB_bind2nd_tran__band_int64
+GrB_Info GB_bind2nd_tran__bxor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45241,7 +56765,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45249,7 +56773,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_uint8
+GrB_Info GB_Cdense_accumB__bxor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45260,16 +56784,27 @@ GrB_Info GB_Cdense_accumB__band_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_uint8
+GrB_Info GB_Cdense_accumB_tran__bxor_int16
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bxor_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__band_uint8
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45281,7 +56816,7 @@ GrB_Info GB_AxD__band_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__band_uint8
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45289,9 +56824,9 @@ GrB_Info GB_DxB__band_uint8
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__band_uint8
+GrB_Info GB_AaddB__bxor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45307,7 +56842,7 @@ GrB_Info GB_AaddB__band_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_uint8
+GrB_Info GB_AemultB__bxor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45322,8 +56857,30 @@ GrB_Info GB_AemultB__band_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_uint8
+GrB_Info GB_AaddB_sparse_dense__bxor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45334,7 +56891,7 @@ GrB_Info GB_bind1st__band_uint8
 
 
 
-GrB_Info GB_bind2nd__band_uint8
+GrB_Info GB_bind2nd__bxor_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45345,7 +56902,7 @@ GrB_Info GB_bind2nd__band_uint8
 
 
 
-GrB_Info GB_bind1st_tran__band_uint8
+GrB_Info GB_bind1st_tran__bxor_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45358,7 +56915,7 @@ GrB_Info GB_bind1st_tran__band_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__band_uint8
+GrB_Info GB_bind2nd_tran__bxor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45381,7 +56938,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45389,7 +56946,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_uint16
+GrB_Info GB_Cdense_accumB__bxor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45400,16 +56957,27 @@ GrB_Info GB_Cdense_accumB__band_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_uint16
+GrB_Info GB_Cdense_accumB_tran__bxor_int32
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bxor_int32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__band_uint16
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45421,7 +56989,7 @@ GrB_Info GB_AxD__band_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__band_uint16
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45429,9 +56997,9 @@ GrB_Info GB_DxB__band_uint16
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__band_uint16
+GrB_Info GB_AaddB__bxor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45447,7 +57015,7 @@ GrB_Info GB_AaddB__band_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_uint16
+GrB_Info GB_AemultB__bxor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45462,8 +57030,30 @@ GrB_Info GB_AemultB__band_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_uint16
+GrB_Info GB_AaddB_sparse_dense__bxor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45474,7 +57064,7 @@ GrB_Info GB_bind1st__band_uint16
 
 
 
-GrB_Info GB_bind2nd__band_uint16
+GrB_Info GB_bind2nd__bxor_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45485,7 +57075,7 @@ GrB_Info GB_bind2nd__band_uint16
 
 
 
-GrB_Info GB_bind1st_tran__band_uint16
+GrB_Info GB_bind1st_tran__bxor_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45498,7 +57088,7 @@ GrB_Info GB_bind1st_tran__band_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__band_uint16
+GrB_Info GB_bind2nd_tran__bxor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45521,7 +57111,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45529,7 +57119,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_uint32
+GrB_Info GB_Cdense_accumB__bxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45540,16 +57130,27 @@ GrB_Info GB_Cdense_accumB__band_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_uint32
+GrB_Info GB_Cdense_accumB_tran__bxor_int64
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bxor_int64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__band_uint32
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45561,7 +57162,7 @@ GrB_Info GB_AxD__band_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__band_uint32
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45569,9 +57170,9 @@ GrB_Info GB_DxB__band_uint32
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__band_uint32
+GrB_Info GB_AaddB__bxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45587,7 +57188,7 @@ GrB_Info GB_AaddB__band_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_uint32
+GrB_Info GB_AemultB__bxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45602,8 +57203,30 @@ GrB_Info GB_AemultB__band_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_uint32
+GrB_Info GB_AaddB_sparse_dense__bxor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45614,7 +57237,7 @@ GrB_Info GB_bind1st__band_uint32
 
 
 
-GrB_Info GB_bind2nd__band_uint32
+GrB_Info GB_bind2nd__bxor_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45625,7 +57248,7 @@ GrB_Info GB_bind2nd__band_uint32
 
 
 
-GrB_Info GB_bind1st_tran__band_uint32
+GrB_Info GB_bind1st_tran__bxor_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45638,7 +57261,7 @@ GrB_Info GB_bind1st_tran__band_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__band_uint32
+GrB_Info GB_bind2nd_tran__bxor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45661,7 +57284,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__band_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45669,7 +57292,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__band_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__band_uint64
+GrB_Info GB_Cdense_accumB__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45680,7 +57303,18 @@ GrB_Info GB_Cdense_accumB__band_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__band_uint64
+GrB_Info GB_Cdense_accumB_tran__bxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxor_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -45689,7 +57323,7 @@ GrB_Info GB_Cdense_accumb__band_uint64
 
 
 
-GrB_Info GB_AxD__band_uint64
+GrB_Info GB_AxD__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45701,7 +57335,7 @@ GrB_Info GB_AxD__band_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__band_uint64
+GrB_Info GB_DxB__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45711,7 +57345,7 @@ GrB_Info GB_DxB__band_uint64
 
 
 
-GrB_Info GB_AaddB__band_uint64
+GrB_Info GB_AaddB__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45727,7 +57361,7 @@ GrB_Info GB_AaddB__band_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__band_uint64
+GrB_Info GB_AemultB__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45742,8 +57376,30 @@ GrB_Info GB_AemultB__band_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__band_uint64
+GrB_Info GB_AaddB_sparse_dense__bxor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45754,7 +57410,7 @@ GrB_Info GB_bind1st__band_uint64
 
 
 
-GrB_Info GB_bind2nd__band_uint64
+GrB_Info GB_bind2nd__bxor_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45765,7 +57421,7 @@ GrB_Info GB_bind2nd__band_uint64
 
 
 
-GrB_Info GB_bind1st_tran__band_uint64
+GrB_Info GB_bind1st_tran__bxor_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45778,7 +57434,7 @@ GrB_Info GB_bind1st_tran__band_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__band_uint64
+GrB_Info GB_bind2nd_tran__bxor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45801,7 +57457,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45809,7 +57465,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_int8
+GrB_Info GB_Cdense_accumB__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45820,16 +57476,27 @@ GrB_Info GB_Cdense_accumB__bxor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_int8
+GrB_Info GB_Cdense_accumB_tran__bxor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxor_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45841,7 +57508,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45849,9 +57516,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bxor_int8
+
+GrB_Info GB_AaddB__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45867,7 +57534,7 @@ GrB_Info GB_AaddB__bxor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_int8
+GrB_Info GB_AemultB__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -45882,8 +57549,30 @@ GrB_Info GB_AemultB__bxor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_int8
+GrB_Info GB_AaddB_sparse_dense__bxor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -45894,7 +57583,7 @@ GrB_Info GB_bind1st__bxor_int8
 
 
 
-GrB_Info GB_bind2nd__bxor_int8
+GrB_Info GB_bind2nd__bxor_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -45905,7 +57594,7 @@ GrB_Info GB_bind2nd__bxor_int8
 
 
 
-GrB_Info GB_bind1st_tran__bxor_int8
+GrB_Info GB_bind1st_tran__bxor_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -45918,7 +57607,7 @@ GrB_Info GB_bind1st_tran__bxor_int8
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_int8
+GrB_Info GB_bind2nd_tran__bxor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45941,7 +57630,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_int16
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -45949,7 +57638,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_int16
+GrB_Info GB_Cdense_accumB__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -45960,16 +57649,27 @@ GrB_Info GB_Cdense_accumB__bxor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_int16
+GrB_Info GB_Cdense_accumB_tran__bxor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxor_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -45981,7 +57681,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -45989,9 +57689,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bxor_int16
+
+GrB_Info GB_AaddB__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46007,7 +57707,7 @@ GrB_Info GB_AaddB__bxor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_int16
+GrB_Info GB_AemultB__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46022,8 +57722,30 @@ GrB_Info GB_AemultB__bxor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_int16
+GrB_Info GB_AaddB_sparse_dense__bxor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46034,7 +57756,7 @@ GrB_Info GB_bind1st__bxor_int16
 
 
 
-GrB_Info GB_bind2nd__bxor_int16
+GrB_Info GB_bind2nd__bxor_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46045,7 +57767,7 @@ GrB_Info GB_bind2nd__bxor_int16
 
 
 
-GrB_Info GB_bind1st_tran__bxor_int16
+GrB_Info GB_bind1st_tran__bxor_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46058,7 +57780,7 @@ GrB_Info GB_bind1st_tran__bxor_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_int16
+GrB_Info GB_bind2nd_tran__bxor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46081,7 +57803,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46089,7 +57811,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_int32
+GrB_Info GB_Cdense_accumB__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46100,16 +57822,27 @@ GrB_Info GB_Cdense_accumB__bxor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_int32
+GrB_Info GB_Cdense_accumB_tran__bxor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxor_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -46121,7 +57854,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -46129,9 +57862,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bxor_int32
+
+GrB_Info GB_AaddB__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46147,7 +57880,7 @@ GrB_Info GB_AaddB__bxor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_int32
+GrB_Info GB_AemultB__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46162,8 +57895,30 @@ GrB_Info GB_AemultB__bxor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_int32
+GrB_Info GB_AaddB_sparse_dense__bxor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxor_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46174,7 +57929,7 @@ GrB_Info GB_bind1st__bxor_int32
 
 
 
-GrB_Info GB_bind2nd__bxor_int32
+GrB_Info GB_bind2nd__bxor_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46185,7 +57940,7 @@ GrB_Info GB_bind2nd__bxor_int32
 
 
 
-GrB_Info GB_bind1st_tran__bxor_int32
+GrB_Info GB_bind1st_tran__bxor_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46198,7 +57953,7 @@ GrB_Info GB_bind1st_tran__bxor_int32
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_int32
+GrB_Info GB_bind2nd_tran__bxor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46221,7 +57976,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_int64
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46229,7 +57984,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_int64
+GrB_Info GB_Cdense_accumB__bxnor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46240,7 +57995,18 @@ GrB_Info GB_Cdense_accumB__bxor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_int64
+GrB_Info GB_Cdense_accumB_tran__bxnor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxnor_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -46271,7 +58037,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bxor_int64
+GrB_Info GB_AaddB__bxnor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46287,7 +58053,7 @@ GrB_Info GB_AaddB__bxor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_int64
+GrB_Info GB_AemultB__bxnor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46302,8 +58068,30 @@ GrB_Info GB_AemultB__bxor_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_int64
+GrB_Info GB_AaddB_sparse_dense__bxnor_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxnor_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46314,7 +58102,7 @@ GrB_Info GB_bind1st__bxor_int64
 
 
 
-GrB_Info GB_bind2nd__bxor_int64
+GrB_Info GB_bind2nd__bxnor_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46325,7 +58113,7 @@ GrB_Info GB_bind2nd__bxor_int64
 
 
 
-GrB_Info GB_bind1st_tran__bxor_int64
+GrB_Info GB_bind1st_tran__bxnor_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46338,7 +58126,7 @@ GrB_Info GB_bind1st_tran__bxor_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_int64
+GrB_Info GB_bind2nd_tran__bxnor_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46361,7 +58149,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46369,7 +58157,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_uint8
+GrB_Info GB_Cdense_accumB__bxnor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46380,16 +58168,27 @@ GrB_Info GB_Cdense_accumB__bxor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_uint8
+GrB_Info GB_Cdense_accumB_tran__bxnor_int16
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bxnor_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bxor_uint8
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -46401,7 +58200,7 @@ GrB_Info GB_AxD__bxor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxor_uint8
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -46409,9 +58208,9 @@ GrB_Info GB_DxB__bxor_uint8
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bxor_uint8
+GrB_Info GB_AaddB__bxnor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46427,7 +58226,7 @@ GrB_Info GB_AaddB__bxor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_uint8
+GrB_Info GB_AemultB__bxnor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46442,8 +58241,30 @@ GrB_Info GB_AemultB__bxor_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bxnor_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_uint8
+
+GrB_Info GB_bind1st__bxnor_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46454,7 +58275,7 @@ GrB_Info GB_bind1st__bxor_uint8
 
 
 
-GrB_Info GB_bind2nd__bxor_uint8
+GrB_Info GB_bind2nd__bxnor_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46465,7 +58286,7 @@ GrB_Info GB_bind2nd__bxor_uint8
 
 
 
-GrB_Info GB_bind1st_tran__bxor_uint8
+GrB_Info GB_bind1st_tran__bxnor_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46478,7 +58299,7 @@ GrB_Info GB_bind1st_tran__bxor_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_uint8
+GrB_Info GB_bind2nd_tran__bxnor_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46501,7 +58322,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46509,7 +58330,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_uint16
+GrB_Info GB_Cdense_accumB__bxnor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46520,16 +58341,27 @@ GrB_Info GB_Cdense_accumB__bxor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_uint16
+GrB_Info GB_Cdense_accumB_tran__bxnor_int32
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bxnor_int32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bxor_uint16
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -46541,7 +58373,7 @@ GrB_Info GB_AxD__bxor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxor_uint16
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -46549,9 +58381,9 @@ GrB_Info GB_DxB__bxor_uint16
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bxor_uint16
+GrB_Info GB_AaddB__bxnor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46567,7 +58399,7 @@ GrB_Info GB_AaddB__bxor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_uint16
+GrB_Info GB_AemultB__bxnor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46582,8 +58414,30 @@ GrB_Info GB_AemultB__bxor_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bxnor_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_uint16
+
+GrB_Info GB_bind1st__bxnor_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46594,7 +58448,7 @@ GrB_Info GB_bind1st__bxor_uint16
 
 
 
-GrB_Info GB_bind2nd__bxor_uint16
+GrB_Info GB_bind2nd__bxnor_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46605,7 +58459,7 @@ GrB_Info GB_bind2nd__bxor_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bxor_uint16
+GrB_Info GB_bind1st_tran__bxnor_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46618,7 +58472,7 @@ GrB_Info GB_bind1st_tran__bxor_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_uint16
+GrB_Info GB_bind2nd_tran__bxnor_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46641,7 +58495,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46649,7 +58503,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_uint32
+GrB_Info GB_Cdense_accumB__bxnor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46660,16 +58514,27 @@ GrB_Info GB_Cdense_accumB__bxor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_uint32
+GrB_Info GB_Cdense_accumB_tran__bxnor_int64
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bxnor_int64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bxor_uint32
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -46681,7 +58546,7 @@ GrB_Info GB_AxD__bxor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxor_uint32
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -46689,9 +58554,9 @@ GrB_Info GB_DxB__bxor_uint32
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bxor_uint32
+GrB_Info GB_AaddB__bxnor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46707,7 +58572,7 @@ GrB_Info GB_AaddB__bxor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_uint32
+GrB_Info GB_AemultB__bxnor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46722,8 +58587,30 @@ GrB_Info GB_AemultB__bxor_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_uint32
+GrB_Info GB_AaddB_sparse_dense__bxnor_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxnor_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46734,7 +58621,7 @@ GrB_Info GB_bind1st__bxor_uint32
 
 
 
-GrB_Info GB_bind2nd__bxor_uint32
+GrB_Info GB_bind2nd__bxnor_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46745,7 +58632,7 @@ GrB_Info GB_bind2nd__bxor_uint32
 
 
 
-GrB_Info GB_bind1st_tran__bxor_uint32
+GrB_Info GB_bind1st_tran__bxnor_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46758,7 +58645,7 @@ GrB_Info GB_bind1st_tran__bxor_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_uint32
+GrB_Info GB_bind2nd_tran__bxnor_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46781,7 +58668,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46789,7 +58676,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxor_uint64
+GrB_Info GB_Cdense_accumB__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46800,7 +58687,18 @@ GrB_Info GB_Cdense_accumB__bxor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxor_uint64
+GrB_Info GB_Cdense_accumB_tran__bxnor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxnor_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -46809,7 +58707,7 @@ GrB_Info GB_Cdense_accumb__bxor_uint64
 
 
 
-GrB_Info GB_AxD__bxor_uint64
+GrB_Info GB_AxD__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -46821,7 +58719,7 @@ GrB_Info GB_AxD__bxor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxor_uint64
+GrB_Info GB_DxB__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -46831,7 +58729,7 @@ GrB_Info GB_DxB__bxor_uint64
 
 
 
-GrB_Info GB_AaddB__bxor_uint64
+GrB_Info GB_AaddB__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46847,7 +58745,7 @@ GrB_Info GB_AaddB__bxor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxor_uint64
+GrB_Info GB_AemultB__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46862,8 +58760,30 @@ GrB_Info GB_AemultB__bxor_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxor_uint64
+GrB_Info GB_AaddB_sparse_dense__bxnor_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxnor_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -46874,7 +58794,7 @@ GrB_Info GB_bind1st__bxor_uint64
 
 
 
-GrB_Info GB_bind2nd__bxor_uint64
+GrB_Info GB_bind2nd__bxnor_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -46885,7 +58805,7 @@ GrB_Info GB_bind2nd__bxor_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bxor_uint64
+GrB_Info GB_bind1st_tran__bxnor_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -46898,7 +58818,7 @@ GrB_Info GB_bind1st_tran__bxor_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bxor_uint64
+GrB_Info GB_bind2nd_tran__bxnor_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46921,7 +58841,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -46929,7 +58849,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_int8
+GrB_Info GB_Cdense_accumB__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -46940,16 +58860,27 @@ GrB_Info GB_Cdense_accumB__bxnor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_int8
+GrB_Info GB_Cdense_accumB_tran__bxnor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxnor_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -46961,7 +58892,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -46969,9 +58900,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bxnor_int8
+
+GrB_Info GB_AaddB__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -46987,7 +58918,7 @@ GrB_Info GB_AaddB__bxnor_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_int8
+GrB_Info GB_AemultB__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47002,8 +58933,30 @@ GrB_Info GB_AemultB__bxnor_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxnor_int8
+GrB_Info GB_AaddB_sparse_dense__bxnor_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxnor_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47014,7 +58967,7 @@ GrB_Info GB_bind1st__bxnor_int8
 
 
 
-GrB_Info GB_bind2nd__bxnor_int8
+GrB_Info GB_bind2nd__bxnor_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -47025,7 +58978,7 @@ GrB_Info GB_bind2nd__bxnor_int8
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_int8
+GrB_Info GB_bind1st_tran__bxnor_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -47038,7 +58991,7 @@ GrB_Info GB_bind1st_tran__bxnor_int8
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_int8
+GrB_Info GB_bind2nd_tran__bxnor_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47061,7 +59014,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int16
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47069,7 +59022,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_int16
+GrB_Info GB_Cdense_accumB__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -47080,16 +59033,27 @@ GrB_Info GB_Cdense_accumB__bxnor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_int16
+GrB_Info GB_Cdense_accumB_tran__bxnor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxnor_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -47101,7 +59065,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -47109,9 +59073,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bxnor_int16
+
+GrB_Info GB_AaddB__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47127,7 +59091,7 @@ GrB_Info GB_AaddB__bxnor_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_int16
+GrB_Info GB_AemultB__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47142,8 +59106,30 @@ GrB_Info GB_AemultB__bxnor_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxnor_int16
+GrB_Info GB_AaddB_sparse_dense__bxnor_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxnor_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47154,7 +59140,7 @@ GrB_Info GB_bind1st__bxnor_int16
 
 
 
-GrB_Info GB_bind2nd__bxnor_int16
+GrB_Info GB_bind2nd__bxnor_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -47165,7 +59151,7 @@ GrB_Info GB_bind2nd__bxnor_int16
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_int16
+GrB_Info GB_bind1st_tran__bxnor_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -47178,7 +59164,7 @@ GrB_Info GB_bind1st_tran__bxnor_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_int16
+GrB_Info GB_bind2nd_tran__bxnor_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47201,7 +59187,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47209,7 +59195,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_int32
+GrB_Info GB_Cdense_accumB__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -47220,16 +59206,27 @@ GrB_Info GB_Cdense_accumB__bxnor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_int32
+GrB_Info GB_Cdense_accumB_tran__bxnor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bxnor_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
     const int nthreads
 ) ;
 
-#if 0
 
-GrB_Info (none)
+
+GrB_Info GB_AxD__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -47241,7 +59238,7 @@ GrB_Info (none)
     const int nthreads
 ) ;
 
-GrB_Info (node)
+GrB_Info GB_DxB__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -47249,9 +59246,9 @@ GrB_Info (node)
     int nthreads
 ) ;
 
-#endif
 
-GrB_Info GB_AaddB__bxnor_int32
+
+GrB_Info GB_AaddB__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47267,7 +59264,7 @@ GrB_Info GB_AaddB__bxnor_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_int32
+GrB_Info GB_AemultB__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47282,8 +59279,30 @@ GrB_Info GB_AemultB__bxnor_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bxnor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxnor_int32
+GrB_Info GB_AaddB_sparse_dense__bxnor_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bxnor_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47294,7 +59313,7 @@ GrB_Info GB_bind1st__bxnor_int32
 
 
 
-GrB_Info GB_bind2nd__bxnor_int32
+GrB_Info GB_bind2nd__bxnor_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -47305,7 +59324,7 @@ GrB_Info GB_bind2nd__bxnor_int32
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_int32
+GrB_Info GB_bind1st_tran__bxnor_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -47318,7 +59337,7 @@ GrB_Info GB_bind1st_tran__bxnor_int32
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_int32
+GrB_Info GB_bind2nd_tran__bxnor_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47341,7 +59360,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int64
+GrB_Info GB_Cdense_ewise3_noaccum__bget_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47349,7 +59368,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_int64
+GrB_Info GB_Cdense_accumB__bget_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -47360,7 +59379,18 @@ GrB_Info GB_Cdense_accumB__bxnor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_int64
+GrB_Info GB_Cdense_accumB_tran__bget_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bget_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -47391,7 +59421,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bxnor_int64
+GrB_Info GB_AaddB__bget_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47407,7 +59437,7 @@ GrB_Info GB_AaddB__bxnor_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_int64
+GrB_Info GB_AemultB__bget_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47422,8 +59452,30 @@ GrB_Info GB_AemultB__bxnor_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxnor_int64
+GrB_Info GB_AaddB_sparse_dense__bget_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47434,7 +59486,7 @@ GrB_Info GB_bind1st__bxnor_int64
 
 
 
-GrB_Info GB_bind2nd__bxnor_int64
+GrB_Info GB_bind2nd__bget_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -47445,7 +59497,7 @@ GrB_Info GB_bind2nd__bxnor_int64
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_int64
+GrB_Info GB_bind1st_tran__bget_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -47458,7 +59510,7 @@ GrB_Info GB_bind1st_tran__bxnor_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_int64
+GrB_Info GB_bind2nd_tran__bget_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47481,7 +59533,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bget_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47489,7 +59541,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_uint8
+GrB_Info GB_Cdense_accumB__bget_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -47500,16 +59552,27 @@ GrB_Info GB_Cdense_accumB__bxnor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_uint8
+GrB_Info GB_Cdense_accumB_tran__bget_int16
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bget_int16
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bxnor_uint8
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -47521,7 +59584,7 @@ GrB_Info GB_AxD__bxnor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxnor_uint8
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -47529,9 +59592,9 @@ GrB_Info GB_DxB__bxnor_uint8
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bxnor_uint8
+GrB_Info GB_AaddB__bget_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47547,7 +59610,7 @@ GrB_Info GB_AaddB__bxnor_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_uint8
+GrB_Info GB_AemultB__bget_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47562,8 +59625,30 @@ GrB_Info GB_AemultB__bxnor_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxnor_uint8
+GrB_Info GB_AaddB_sparse_dense__bget_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47574,7 +59659,7 @@ GrB_Info GB_bind1st__bxnor_uint8
 
 
 
-GrB_Info GB_bind2nd__bxnor_uint8
+GrB_Info GB_bind2nd__bget_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -47585,7 +59670,7 @@ GrB_Info GB_bind2nd__bxnor_uint8
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_uint8
+GrB_Info GB_bind1st_tran__bget_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -47598,7 +59683,7 @@ GrB_Info GB_bind1st_tran__bxnor_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_uint8
+GrB_Info GB_bind2nd_tran__bget_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47621,7 +59706,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__bget_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47629,7 +59714,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_uint16
+GrB_Info GB_Cdense_accumB__bget_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -47640,16 +59725,27 @@ GrB_Info GB_Cdense_accumB__bxnor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_uint16
+GrB_Info GB_Cdense_accumB_tran__bget_int32
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bget_int32
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bxnor_uint16
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -47661,7 +59757,7 @@ GrB_Info GB_AxD__bxnor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxnor_uint16
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -47669,9 +59765,9 @@ GrB_Info GB_DxB__bxnor_uint16
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bxnor_uint16
+GrB_Info GB_AaddB__bget_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47687,7 +59783,7 @@ GrB_Info GB_AaddB__bxnor_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_uint16
+GrB_Info GB_AemultB__bget_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47702,8 +59798,30 @@ GrB_Info GB_AemultB__bxnor_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bxnor_uint16
+GrB_Info GB_AaddB_sparse_dense__bget_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47714,7 +59832,7 @@ GrB_Info GB_bind1st__bxnor_uint16
 
 
 
-GrB_Info GB_bind2nd__bxnor_uint16
+GrB_Info GB_bind2nd__bget_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -47725,7 +59843,7 @@ GrB_Info GB_bind2nd__bxnor_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_uint16
+GrB_Info GB_bind1st_tran__bget_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -47738,7 +59856,7 @@ GrB_Info GB_bind1st_tran__bxnor_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_uint16
+GrB_Info GB_bind2nd_tran__bget_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47761,7 +59879,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -47769,7 +59887,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bxnor_uint32
+GrB_Info GB_Cdense_accumB__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -47780,16 +59898,27 @@ GrB_Info GB_Cdense_accumB__bxnor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_uint32
+GrB_Info GB_Cdense_accumB_tran__bget_int64
 (
     GrB_Matrix C,
-    const GB_void *p_bwork,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumb__bget_int64
+(
+    GrB_Matrix C,
+    const GB_void *p_bwork,
+    const int nthreads
+) ;
 
+#if 0
 
-GrB_Info GB_AxD__bxnor_uint32
+GrB_Info (none)
 (
     GrB_Matrix C,
     const GrB_Matrix A, bool A_is_pattern,
@@ -47801,7 +59930,7 @@ GrB_Info GB_AxD__bxnor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_DxB__bxnor_uint32
+GrB_Info (node)
 (
     GrB_Matrix C,
     const GrB_Matrix D, bool D_is_pattern,
@@ -47809,9 +59938,9 @@ GrB_Info GB_DxB__bxnor_uint32
     int nthreads
 ) ;
 
+#endif
 
-
-GrB_Info GB_AaddB__bxnor_uint32
+GrB_Info GB_AaddB__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47827,7 +59956,7 @@ GrB_Info GB_AaddB__bxnor_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bxnor_uint32
+GrB_Info GB_AemultB__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -47842,77 +59971,21 @@ GrB_Info GB_AemultB__bxnor_uint32
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__bxnor_uint32
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__bxnor_uint32
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__bxnor_uint32
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__bxnor_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bxnor_uint64
+GrB_Info GB_AaddB_sparse_dense__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__bxnor_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -47920,70 +59993,8 @@ GrB_Info GB_Cdense_accumB__bxnor_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bxnor_uint64
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-
-
-GrB_Info GB_AxD__bxnor_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_DxB__bxnor_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_AaddB__bxnor_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
 
-GrB_Info GB_AemultB__bxnor_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-
-GrB_Info GB_bind1st__bxnor_uint64
+GrB_Info GB_bind1st__bget_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -47994,7 +60005,7 @@ GrB_Info GB_bind1st__bxnor_uint64
 
 
 
-GrB_Info GB_bind2nd__bxnor_uint64
+GrB_Info GB_bind2nd__bget_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48005,7 +60016,7 @@ GrB_Info GB_bind2nd__bxnor_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bxnor_uint64
+GrB_Info GB_bind1st_tran__bget_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48018,7 +60029,7 @@ GrB_Info GB_bind1st_tran__bxnor_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bxnor_uint64
+GrB_Info GB_bind2nd_tran__bget_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48041,7 +60052,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bget_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48049,7 +60060,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_int8
+GrB_Info GB_Cdense_accumB__bget_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48060,7 +60071,18 @@ GrB_Info GB_Cdense_accumB__bget_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_int8
+GrB_Info GB_Cdense_accumB_tran__bget_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bget_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48091,7 +60113,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_int8
+GrB_Info GB_AaddB__bget_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48107,7 +60129,7 @@ GrB_Info GB_AaddB__bget_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_int8
+GrB_Info GB_AemultB__bget_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48122,8 +60144,30 @@ GrB_Info GB_AemultB__bget_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_int8
+GrB_Info GB_AaddB_sparse_dense__bget_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48134,7 +60178,7 @@ GrB_Info GB_bind1st__bget_int8
 
 
 
-GrB_Info GB_bind2nd__bget_int8
+GrB_Info GB_bind2nd__bget_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48145,7 +60189,7 @@ GrB_Info GB_bind2nd__bget_int8
 
 
 
-GrB_Info GB_bind1st_tran__bget_int8
+GrB_Info GB_bind1st_tran__bget_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48158,7 +60202,7 @@ GrB_Info GB_bind1st_tran__bget_int8
 
 
 
-GrB_Info GB_bind2nd_tran__bget_int8
+GrB_Info GB_bind2nd_tran__bget_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48181,7 +60225,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_int16
+GrB_Info GB_Cdense_ewise3_noaccum__bget_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48189,7 +60233,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_int16
+GrB_Info GB_Cdense_accumB__bget_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48200,7 +60244,18 @@ GrB_Info GB_Cdense_accumB__bget_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_int16
+GrB_Info GB_Cdense_accumB_tran__bget_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bget_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48231,7 +60286,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_int16
+GrB_Info GB_AaddB__bget_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48247,7 +60302,7 @@ GrB_Info GB_AaddB__bget_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_int16
+GrB_Info GB_AemultB__bget_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48262,8 +60317,30 @@ GrB_Info GB_AemultB__bget_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_int16
+GrB_Info GB_AaddB_sparse_dense__bget_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48274,7 +60351,7 @@ GrB_Info GB_bind1st__bget_int16
 
 
 
-GrB_Info GB_bind2nd__bget_int16
+GrB_Info GB_bind2nd__bget_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48285,7 +60362,7 @@ GrB_Info GB_bind2nd__bget_int16
 
 
 
-GrB_Info GB_bind1st_tran__bget_int16
+GrB_Info GB_bind1st_tran__bget_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48298,7 +60375,7 @@ GrB_Info GB_bind1st_tran__bget_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bget_int16
+GrB_Info GB_bind2nd_tran__bget_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48321,7 +60398,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bget_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48329,7 +60406,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_int32
+GrB_Info GB_Cdense_accumB__bget_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48340,7 +60417,18 @@ GrB_Info GB_Cdense_accumB__bget_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_int32
+GrB_Info GB_Cdense_accumB_tran__bget_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bget_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48371,7 +60459,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_int32
+GrB_Info GB_AaddB__bget_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48387,7 +60475,7 @@ GrB_Info GB_AaddB__bget_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_int32
+GrB_Info GB_AemultB__bget_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48402,8 +60490,30 @@ GrB_Info GB_AemultB__bget_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_int32
+GrB_Info GB_AaddB_sparse_dense__bget_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48414,7 +60524,7 @@ GrB_Info GB_bind1st__bget_int32
 
 
 
-GrB_Info GB_bind2nd__bget_int32
+GrB_Info GB_bind2nd__bget_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48425,7 +60535,7 @@ GrB_Info GB_bind2nd__bget_int32
 
 
 
-GrB_Info GB_bind1st_tran__bget_int32
+GrB_Info GB_bind1st_tran__bget_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48438,7 +60548,7 @@ GrB_Info GB_bind1st_tran__bget_int32
 
 
 
-GrB_Info GB_bind2nd_tran__bget_int32
+GrB_Info GB_bind2nd_tran__bget_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48461,7 +60571,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_int64
+GrB_Info GB_Cdense_ewise3_noaccum__bget_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48469,7 +60579,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_int64
+GrB_Info GB_Cdense_accumB__bget_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48480,7 +60590,18 @@ GrB_Info GB_Cdense_accumB__bget_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_int64
+GrB_Info GB_Cdense_accumB_tran__bget_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bget_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48511,7 +60632,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_int64
+GrB_Info GB_AaddB__bget_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48527,7 +60648,7 @@ GrB_Info GB_AaddB__bget_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_int64
+GrB_Info GB_AemultB__bget_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48542,8 +60663,30 @@ GrB_Info GB_AemultB__bget_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bget_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_int64
+GrB_Info GB_AaddB_sparse_dense__bget_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bget_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48554,7 +60697,7 @@ GrB_Info GB_bind1st__bget_int64
 
 
 
-GrB_Info GB_bind2nd__bget_int64
+GrB_Info GB_bind2nd__bget_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48565,7 +60708,7 @@ GrB_Info GB_bind2nd__bget_int64
 
 
 
-GrB_Info GB_bind1st_tran__bget_int64
+GrB_Info GB_bind1st_tran__bget_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48578,7 +60721,7 @@ GrB_Info GB_bind1st_tran__bget_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bget_int64
+GrB_Info GB_bind2nd_tran__bget_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48601,7 +60744,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bset_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48609,7 +60752,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_uint8
+GrB_Info GB_Cdense_accumB__bset_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48620,7 +60763,18 @@ GrB_Info GB_Cdense_accumB__bget_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_uint8
+GrB_Info GB_Cdense_accumB_tran__bset_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48651,7 +60805,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_uint8
+GrB_Info GB_AaddB__bset_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48667,7 +60821,7 @@ GrB_Info GB_AaddB__bget_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_uint8
+GrB_Info GB_AemultB__bset_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48682,8 +60836,30 @@ GrB_Info GB_AemultB__bget_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bset_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_uint8
+
+GrB_Info GB_bind1st__bset_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48694,7 +60870,7 @@ GrB_Info GB_bind1st__bget_uint8
 
 
 
-GrB_Info GB_bind2nd__bget_uint8
+GrB_Info GB_bind2nd__bset_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48705,7 +60881,7 @@ GrB_Info GB_bind2nd__bget_uint8
 
 
 
-GrB_Info GB_bind1st_tran__bget_uint8
+GrB_Info GB_bind1st_tran__bset_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48718,7 +60894,7 @@ GrB_Info GB_bind1st_tran__bget_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__bget_uint8
+GrB_Info GB_bind2nd_tran__bset_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48741,7 +60917,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__bset_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48749,7 +60925,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_uint16
+GrB_Info GB_Cdense_accumB__bset_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48760,7 +60936,18 @@ GrB_Info GB_Cdense_accumB__bget_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_uint16
+GrB_Info GB_Cdense_accumB_tran__bset_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_int16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48791,7 +60978,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_uint16
+GrB_Info GB_AaddB__bset_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48807,7 +60994,7 @@ GrB_Info GB_AaddB__bget_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_uint16
+GrB_Info GB_AemultB__bset_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48822,8 +61009,30 @@ GrB_Info GB_AemultB__bget_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bset_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_uint16
+
+GrB_Info GB_bind1st__bset_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48834,7 +61043,7 @@ GrB_Info GB_bind1st__bget_uint16
 
 
 
-GrB_Info GB_bind2nd__bget_uint16
+GrB_Info GB_bind2nd__bset_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48845,7 +61054,7 @@ GrB_Info GB_bind2nd__bget_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bget_uint16
+GrB_Info GB_bind1st_tran__bset_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48858,7 +61067,7 @@ GrB_Info GB_bind1st_tran__bget_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bget_uint16
+GrB_Info GB_bind2nd_tran__bset_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48881,7 +61090,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bset_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -48889,7 +61098,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_uint32
+GrB_Info GB_Cdense_accumB__bset_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -48900,7 +61109,18 @@ GrB_Info GB_Cdense_accumB__bget_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_uint32
+GrB_Info GB_Cdense_accumB_tran__bset_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_int32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -48931,7 +61151,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_uint32
+GrB_Info GB_AaddB__bset_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48947,7 +61167,7 @@ GrB_Info GB_AaddB__bget_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_uint32
+GrB_Info GB_AemultB__bset_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -48962,8 +61182,30 @@ GrB_Info GB_AemultB__bget_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_uint32
+GrB_Info GB_AaddB_sparse_dense__bset_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bset_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -48974,7 +61216,7 @@ GrB_Info GB_bind1st__bget_uint32
 
 
 
-GrB_Info GB_bind2nd__bget_uint32
+GrB_Info GB_bind2nd__bset_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -48985,7 +61227,7 @@ GrB_Info GB_bind2nd__bget_uint32
 
 
 
-GrB_Info GB_bind1st_tran__bget_uint32
+GrB_Info GB_bind1st_tran__bset_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -48998,7 +61240,7 @@ GrB_Info GB_bind1st_tran__bget_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__bget_uint32
+GrB_Info GB_bind2nd_tran__bset_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49021,7 +61263,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bget_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__bset_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49029,7 +61271,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bget_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bget_uint64
+GrB_Info GB_Cdense_accumB__bset_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -49040,7 +61282,18 @@ GrB_Info GB_Cdense_accumB__bget_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bget_uint64
+GrB_Info GB_Cdense_accumB_tran__bset_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_int64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -49071,7 +61324,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bget_uint64
+GrB_Info GB_AaddB__bset_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49087,7 +61340,7 @@ GrB_Info GB_AaddB__bget_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bget_uint64
+GrB_Info GB_AemultB__bset_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49102,8 +61355,30 @@ GrB_Info GB_AemultB__bget_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bget_uint64
+GrB_Info GB_AaddB_sparse_dense__bset_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bset_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -49114,7 +61389,7 @@ GrB_Info GB_bind1st__bget_uint64
 
 
 
-GrB_Info GB_bind2nd__bget_uint64
+GrB_Info GB_bind2nd__bset_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -49125,7 +61400,7 @@ GrB_Info GB_bind2nd__bget_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bget_uint64
+GrB_Info GB_bind1st_tran__bset_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -49138,7 +61413,7 @@ GrB_Info GB_bind1st_tran__bget_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bget_uint64
+GrB_Info GB_bind2nd_tran__bset_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49161,7 +61436,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49169,7 +61444,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_int8
+GrB_Info GB_Cdense_accumB__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -49180,7 +61455,18 @@ GrB_Info GB_Cdense_accumB__bset_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_int8
+GrB_Info GB_Cdense_accumB_tran__bset_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -49211,7 +61497,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_int8
+GrB_Info GB_AaddB__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49227,7 +61513,7 @@ GrB_Info GB_AaddB__bset_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_int8
+GrB_Info GB_AemultB__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49242,77 +61528,21 @@ GrB_Info GB_AemultB__bset_int8
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__bset_int8
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__bset_int8
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__bset_int8
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__bset_int8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_int16
+GrB_Info GB_AaddB_sparse_dense__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__bset_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -49320,70 +61550,8 @@ GrB_Info GB_Cdense_accumB__bset_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_int16
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__bset_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__bset_int16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-
-GrB_Info GB_bind1st__bset_int16
+GrB_Info GB_bind1st__bset_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -49394,7 +61562,7 @@ GrB_Info GB_bind1st__bset_int16
 
 
 
-GrB_Info GB_bind2nd__bset_int16
+GrB_Info GB_bind2nd__bset_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -49405,7 +61573,7 @@ GrB_Info GB_bind2nd__bset_int16
 
 
 
-GrB_Info GB_bind1st_tran__bset_int16
+GrB_Info GB_bind1st_tran__bset_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -49418,7 +61586,7 @@ GrB_Info GB_bind1st_tran__bset_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bset_int16
+GrB_Info GB_bind2nd_tran__bset_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49441,7 +61609,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bset_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49449,7 +61617,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_int32
+GrB_Info GB_Cdense_accumB__bset_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -49460,7 +61628,18 @@ GrB_Info GB_Cdense_accumB__bset_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_int32
+GrB_Info GB_Cdense_accumB_tran__bset_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -49491,7 +61670,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_int32
+GrB_Info GB_AaddB__bset_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49507,7 +61686,7 @@ GrB_Info GB_AaddB__bset_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_int32
+GrB_Info GB_AemultB__bset_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49522,8 +61701,30 @@ GrB_Info GB_AemultB__bset_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bset_int32
+GrB_Info GB_AaddB_sparse_dense__bset_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bset_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -49534,7 +61735,7 @@ GrB_Info GB_bind1st__bset_int32
 
 
 
-GrB_Info GB_bind2nd__bset_int32
+GrB_Info GB_bind2nd__bset_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -49545,7 +61746,7 @@ GrB_Info GB_bind2nd__bset_int32
 
 
 
-GrB_Info GB_bind1st_tran__bset_int32
+GrB_Info GB_bind1st_tran__bset_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -49558,7 +61759,7 @@ GrB_Info GB_bind1st_tran__bset_int32
 
 
 
-GrB_Info GB_bind2nd_tran__bset_int32
+GrB_Info GB_bind2nd_tran__bset_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49581,7 +61782,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_int64
+GrB_Info GB_Cdense_ewise3_noaccum__bset_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49589,7 +61790,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_int64
+GrB_Info GB_Cdense_accumB__bset_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -49600,7 +61801,18 @@ GrB_Info GB_Cdense_accumB__bset_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_int64
+GrB_Info GB_Cdense_accumB_tran__bset_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -49631,7 +61843,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_int64
+GrB_Info GB_AaddB__bset_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49647,7 +61859,7 @@ GrB_Info GB_AaddB__bset_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_int64
+GrB_Info GB_AemultB__bset_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49662,8 +61874,30 @@ GrB_Info GB_AemultB__bset_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bset_int64
+GrB_Info GB_AaddB_sparse_dense__bset_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bset_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -49674,7 +61908,7 @@ GrB_Info GB_bind1st__bset_int64
 
 
 
-GrB_Info GB_bind2nd__bset_int64
+GrB_Info GB_bind2nd__bset_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -49685,7 +61919,7 @@ GrB_Info GB_bind2nd__bset_int64
 
 
 
-GrB_Info GB_bind1st_tran__bset_int64
+GrB_Info GB_bind1st_tran__bset_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -49698,7 +61932,7 @@ GrB_Info GB_bind1st_tran__bset_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bset_int64
+GrB_Info GB_bind2nd_tran__bset_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49721,7 +61955,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bset_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49729,7 +61963,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_uint8
+GrB_Info GB_Cdense_accumB__bset_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -49740,7 +61974,18 @@ GrB_Info GB_Cdense_accumB__bset_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_uint8
+GrB_Info GB_Cdense_accumB_tran__bset_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bset_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -49771,7 +62016,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_uint8
+GrB_Info GB_AaddB__bset_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49787,7 +62032,7 @@ GrB_Info GB_AaddB__bset_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_uint8
+GrB_Info GB_AemultB__bset_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49802,8 +62047,30 @@ GrB_Info GB_AemultB__bset_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bset_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bset_uint8
+GrB_Info GB_AaddB_sparse_dense__bset_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bset_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -49814,7 +62081,7 @@ GrB_Info GB_bind1st__bset_uint8
 
 
 
-GrB_Info GB_bind2nd__bset_uint8
+GrB_Info GB_bind2nd__bset_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -49825,7 +62092,7 @@ GrB_Info GB_bind2nd__bset_uint8
 
 
 
-GrB_Info GB_bind1st_tran__bset_uint8
+GrB_Info GB_bind1st_tran__bset_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -49838,7 +62105,7 @@ GrB_Info GB_bind1st_tran__bset_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__bset_uint8
+GrB_Info GB_bind2nd_tran__bset_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49861,7 +62128,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -49869,7 +62136,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_uint16
+GrB_Info GB_Cdense_accumB__bclr_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -49880,7 +62147,18 @@ GrB_Info GB_Cdense_accumB__bset_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_uint16
+GrB_Info GB_Cdense_accumB_tran__bclr_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -49911,7 +62189,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_uint16
+GrB_Info GB_AaddB__bclr_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49927,7 +62205,7 @@ GrB_Info GB_AaddB__bset_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_uint16
+GrB_Info GB_AemultB__bclr_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -49942,8 +62220,30 @@ GrB_Info GB_AemultB__bset_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bset_uint16
+GrB_Info GB_AaddB_sparse_dense__bclr_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bclr_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -49954,7 +62254,7 @@ GrB_Info GB_bind1st__bset_uint16
 
 
 
-GrB_Info GB_bind2nd__bset_uint16
+GrB_Info GB_bind2nd__bclr_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -49965,7 +62265,7 @@ GrB_Info GB_bind2nd__bset_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bset_uint16
+GrB_Info GB_bind1st_tran__bclr_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -49978,7 +62278,7 @@ GrB_Info GB_bind1st_tran__bset_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bset_uint16
+GrB_Info GB_bind2nd_tran__bclr_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50001,7 +62301,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50009,7 +62309,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_uint32
+GrB_Info GB_Cdense_accumB__bclr_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -50020,7 +62320,18 @@ GrB_Info GB_Cdense_accumB__bset_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_uint32
+GrB_Info GB_Cdense_accumB_tran__bclr_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_int16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -50051,7 +62362,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_uint32
+GrB_Info GB_AaddB__bclr_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50067,7 +62378,7 @@ GrB_Info GB_AaddB__bset_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_uint32
+GrB_Info GB_AemultB__bclr_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50082,8 +62393,30 @@ GrB_Info GB_AemultB__bset_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bclr_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bset_uint32
+
+GrB_Info GB_bind1st__bclr_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -50094,7 +62427,7 @@ GrB_Info GB_bind1st__bset_uint32
 
 
 
-GrB_Info GB_bind2nd__bset_uint32
+GrB_Info GB_bind2nd__bclr_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -50105,7 +62438,7 @@ GrB_Info GB_bind2nd__bset_uint32
 
 
 
-GrB_Info GB_bind1st_tran__bset_uint32
+GrB_Info GB_bind1st_tran__bclr_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -50118,7 +62451,7 @@ GrB_Info GB_bind1st_tran__bset_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__bset_uint32
+GrB_Info GB_bind2nd_tran__bclr_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50141,7 +62474,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bset_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50149,7 +62482,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bset_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bset_uint64
+GrB_Info GB_Cdense_accumB__bclr_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -50160,7 +62493,18 @@ GrB_Info GB_Cdense_accumB__bset_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bset_uint64
+GrB_Info GB_Cdense_accumB_tran__bclr_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_int32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -50191,7 +62535,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bset_uint64
+GrB_Info GB_AaddB__bclr_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50207,7 +62551,7 @@ GrB_Info GB_AaddB__bset_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bset_uint64
+GrB_Info GB_AemultB__bclr_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50222,8 +62566,30 @@ GrB_Info GB_AemultB__bset_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bclr_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bset_uint64
+
+GrB_Info GB_bind1st__bclr_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -50234,7 +62600,7 @@ GrB_Info GB_bind1st__bset_uint64
 
 
 
-GrB_Info GB_bind2nd__bset_uint64
+GrB_Info GB_bind2nd__bclr_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -50245,7 +62611,7 @@ GrB_Info GB_bind2nd__bset_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bset_uint64
+GrB_Info GB_bind1st_tran__bclr_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -50258,7 +62624,7 @@ GrB_Info GB_bind1st_tran__bset_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bset_uint64
+GrB_Info GB_bind2nd_tran__bclr_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50281,7 +62647,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50289,7 +62655,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_int8
+GrB_Info GB_Cdense_accumB__bclr_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -50300,7 +62666,18 @@ GrB_Info GB_Cdense_accumB__bclr_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_int8
+GrB_Info GB_Cdense_accumB_tran__bclr_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_int64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -50331,7 +62708,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_int8
+GrB_Info GB_AaddB__bclr_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50347,7 +62724,7 @@ GrB_Info GB_AaddB__bclr_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_int8
+GrB_Info GB_AemultB__bclr_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50362,8 +62739,30 @@ GrB_Info GB_AemultB__bclr_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bclr_int8
+GrB_Info GB_AaddB_sparse_dense__bclr_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bclr_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -50374,7 +62773,7 @@ GrB_Info GB_bind1st__bclr_int8
 
 
 
-GrB_Info GB_bind2nd__bclr_int8
+GrB_Info GB_bind2nd__bclr_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -50385,7 +62784,7 @@ GrB_Info GB_bind2nd__bclr_int8
 
 
 
-GrB_Info GB_bind1st_tran__bclr_int8
+GrB_Info GB_bind1st_tran__bclr_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -50398,7 +62797,7 @@ GrB_Info GB_bind1st_tran__bclr_int8
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_int8
+GrB_Info GB_bind2nd_tran__bclr_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50421,7 +62820,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_int16
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50429,7 +62828,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_int16
+GrB_Info GB_Cdense_accumB__bclr_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -50440,7 +62839,18 @@ GrB_Info GB_Cdense_accumB__bclr_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_int16
+GrB_Info GB_Cdense_accumB_tran__bclr_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -50471,7 +62881,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_int16
+GrB_Info GB_AaddB__bclr_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50487,7 +62897,7 @@ GrB_Info GB_AaddB__bclr_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_int16
+GrB_Info GB_AemultB__bclr_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50502,8 +62912,30 @@ GrB_Info GB_AemultB__bclr_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bclr_int16
+GrB_Info GB_AaddB_sparse_dense__bclr_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bclr_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -50514,7 +62946,7 @@ GrB_Info GB_bind1st__bclr_int16
 
 
 
-GrB_Info GB_bind2nd__bclr_int16
+GrB_Info GB_bind2nd__bclr_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -50525,7 +62957,7 @@ GrB_Info GB_bind2nd__bclr_int16
 
 
 
-GrB_Info GB_bind1st_tran__bclr_int16
+GrB_Info GB_bind1st_tran__bclr_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -50538,7 +62970,7 @@ GrB_Info GB_bind1st_tran__bclr_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_int16
+GrB_Info GB_bind2nd_tran__bclr_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50561,7 +62993,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50569,7 +63001,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_int32
+GrB_Info GB_Cdense_accumB__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -50580,7 +63012,18 @@ GrB_Info GB_Cdense_accumB__bclr_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_int32
+GrB_Info GB_Cdense_accumB_tran__bclr_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -50611,7 +63054,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_int32
+GrB_Info GB_AaddB__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50627,7 +63070,7 @@ GrB_Info GB_AaddB__bclr_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_int32
+GrB_Info GB_AemultB__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50642,77 +63085,21 @@ GrB_Info GB_AemultB__bclr_int32
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__bclr_int32
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__bclr_int32
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__bclr_int32
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__bclr_int32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_int64
+GrB_Info GB_AaddB_sparse_dense__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__bclr_int64
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -50720,70 +63107,8 @@ GrB_Info GB_Cdense_accumB__bclr_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_int64
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__bclr_int64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__bclr_int64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-
-GrB_Info GB_bind1st__bclr_int64
+GrB_Info GB_bind1st__bclr_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -50794,7 +63119,7 @@ GrB_Info GB_bind1st__bclr_int64
 
 
 
-GrB_Info GB_bind2nd__bclr_int64
+GrB_Info GB_bind2nd__bclr_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -50805,7 +63130,7 @@ GrB_Info GB_bind2nd__bclr_int64
 
 
 
-GrB_Info GB_bind1st_tran__bclr_int64
+GrB_Info GB_bind1st_tran__bclr_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -50818,7 +63143,7 @@ GrB_Info GB_bind1st_tran__bclr_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_int64
+GrB_Info GB_bind2nd_tran__bclr_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50841,7 +63166,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50849,7 +63174,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_uint8
+GrB_Info GB_Cdense_accumB__bclr_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -50860,7 +63185,18 @@ GrB_Info GB_Cdense_accumB__bclr_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_uint8
+GrB_Info GB_Cdense_accumB_tran__bclr_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -50891,7 +63227,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_uint8
+GrB_Info GB_AaddB__bclr_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50907,7 +63243,7 @@ GrB_Info GB_AaddB__bclr_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_uint8
+GrB_Info GB_AemultB__bclr_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -50922,8 +63258,30 @@ GrB_Info GB_AemultB__bclr_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bclr_uint8
+GrB_Info GB_AaddB_sparse_dense__bclr_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bclr_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -50934,7 +63292,7 @@ GrB_Info GB_bind1st__bclr_uint8
 
 
 
-GrB_Info GB_bind2nd__bclr_uint8
+GrB_Info GB_bind2nd__bclr_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -50945,7 +63303,7 @@ GrB_Info GB_bind2nd__bclr_uint8
 
 
 
-GrB_Info GB_bind1st_tran__bclr_uint8
+GrB_Info GB_bind1st_tran__bclr_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -50958,7 +63316,7 @@ GrB_Info GB_bind1st_tran__bclr_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_uint8
+GrB_Info GB_bind2nd_tran__bclr_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50981,7 +63339,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -50989,7 +63347,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_uint16
+GrB_Info GB_Cdense_accumB__bclr_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51000,7 +63358,18 @@ GrB_Info GB_Cdense_accumB__bclr_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_uint16
+GrB_Info GB_Cdense_accumB_tran__bclr_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bclr_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51031,7 +63400,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_uint16
+GrB_Info GB_AaddB__bclr_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51047,7 +63416,7 @@ GrB_Info GB_AaddB__bclr_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_uint16
+GrB_Info GB_AemultB__bclr_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51062,8 +63431,30 @@ GrB_Info GB_AemultB__bclr_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bclr_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bclr_uint16
+GrB_Info GB_AaddB_sparse_dense__bclr_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bclr_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51074,7 +63465,7 @@ GrB_Info GB_bind1st__bclr_uint16
 
 
 
-GrB_Info GB_bind2nd__bclr_uint16
+GrB_Info GB_bind2nd__bclr_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51085,7 +63476,7 @@ GrB_Info GB_bind2nd__bclr_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bclr_uint16
+GrB_Info GB_bind1st_tran__bclr_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51098,7 +63489,7 @@ GrB_Info GB_bind1st_tran__bclr_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_uint16
+GrB_Info GB_bind2nd_tran__bclr_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51121,7 +63512,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51129,7 +63520,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_uint32
+GrB_Info GB_Cdense_accumB__bshift_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51140,7 +63531,18 @@ GrB_Info GB_Cdense_accumB__bclr_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_uint32
+GrB_Info GB_Cdense_accumB_tran__bshift_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51171,7 +63573,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_uint32
+GrB_Info GB_AaddB__bshift_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51187,7 +63589,7 @@ GrB_Info GB_AaddB__bclr_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_uint32
+GrB_Info GB_AemultB__bshift_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51202,8 +63604,30 @@ GrB_Info GB_AemultB__bclr_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bclr_uint32
+GrB_Info GB_AaddB_sparse_dense__bshift_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bshift_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51214,7 +63638,7 @@ GrB_Info GB_bind1st__bclr_uint32
 
 
 
-GrB_Info GB_bind2nd__bclr_uint32
+GrB_Info GB_bind2nd__bshift_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51225,7 +63649,7 @@ GrB_Info GB_bind2nd__bclr_uint32
 
 
 
-GrB_Info GB_bind1st_tran__bclr_uint32
+GrB_Info GB_bind1st_tran__bshift_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51238,7 +63662,7 @@ GrB_Info GB_bind1st_tran__bclr_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_uint32
+GrB_Info GB_bind2nd_tran__bshift_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51261,7 +63685,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51269,7 +63693,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bclr_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bclr_uint64
+GrB_Info GB_Cdense_accumB__bshift_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51280,7 +63704,18 @@ GrB_Info GB_Cdense_accumB__bclr_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bclr_uint64
+GrB_Info GB_Cdense_accumB_tran__bshift_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_int16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51311,7 +63746,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bclr_uint64
+GrB_Info GB_AaddB__bshift_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51327,7 +63762,7 @@ GrB_Info GB_AaddB__bclr_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bclr_uint64
+GrB_Info GB_AemultB__bshift_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51342,8 +63777,30 @@ GrB_Info GB_AemultB__bclr_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bclr_uint64
+GrB_Info GB_AaddB_sparse_dense__bshift_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bshift_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51354,7 +63811,7 @@ GrB_Info GB_bind1st__bclr_uint64
 
 
 
-GrB_Info GB_bind2nd__bclr_uint64
+GrB_Info GB_bind2nd__bshift_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51365,7 +63822,7 @@ GrB_Info GB_bind2nd__bclr_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bclr_uint64
+GrB_Info GB_bind1st_tran__bshift_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51378,7 +63835,7 @@ GrB_Info GB_bind1st_tran__bclr_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bclr_uint64
+GrB_Info GB_bind2nd_tran__bshift_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51401,7 +63858,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_int8
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51409,7 +63866,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_int8
+GrB_Info GB_Cdense_accumB__bshift_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51420,7 +63877,18 @@ GrB_Info GB_Cdense_accumB__bshift_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_int8
+GrB_Info GB_Cdense_accumB_tran__bshift_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_int32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51451,7 +63919,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_int8
+GrB_Info GB_AaddB__bshift_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51467,7 +63935,7 @@ GrB_Info GB_AaddB__bshift_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_int8
+GrB_Info GB_AemultB__bshift_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51482,8 +63950,30 @@ GrB_Info GB_AemultB__bshift_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bshift_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bshift_int8
+
+GrB_Info GB_bind1st__bshift_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51494,7 +63984,7 @@ GrB_Info GB_bind1st__bshift_int8
 
 
 
-GrB_Info GB_bind2nd__bshift_int8
+GrB_Info GB_bind2nd__bshift_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51505,7 +63995,7 @@ GrB_Info GB_bind2nd__bshift_int8
 
 
 
-GrB_Info GB_bind1st_tran__bshift_int8
+GrB_Info GB_bind1st_tran__bshift_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51518,7 +64008,7 @@ GrB_Info GB_bind1st_tran__bshift_int8
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_int8
+GrB_Info GB_bind2nd_tran__bshift_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51541,7 +64031,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_int16
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51549,7 +64039,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_int16
+GrB_Info GB_Cdense_accumB__bshift_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51560,7 +64050,18 @@ GrB_Info GB_Cdense_accumB__bshift_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_int16
+GrB_Info GB_Cdense_accumB_tran__bshift_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_int64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51591,7 +64092,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_int16
+GrB_Info GB_AaddB__bshift_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51607,7 +64108,7 @@ GrB_Info GB_AaddB__bshift_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_int16
+GrB_Info GB_AemultB__bshift_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51622,8 +64123,30 @@ GrB_Info GB_AemultB__bshift_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__bshift_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bshift_int16
+
+GrB_Info GB_bind1st__bshift_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51634,7 +64157,7 @@ GrB_Info GB_bind1st__bshift_int16
 
 
 
-GrB_Info GB_bind2nd__bshift_int16
+GrB_Info GB_bind2nd__bshift_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51645,7 +64168,7 @@ GrB_Info GB_bind2nd__bshift_int16
 
 
 
-GrB_Info GB_bind1st_tran__bshift_int16
+GrB_Info GB_bind1st_tran__bshift_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51658,7 +64181,7 @@ GrB_Info GB_bind1st_tran__bshift_int16
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_int16
+GrB_Info GB_bind2nd_tran__bshift_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51681,7 +64204,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_int32
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51689,7 +64212,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_int32
+GrB_Info GB_Cdense_accumB__bshift_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51700,7 +64223,18 @@ GrB_Info GB_Cdense_accumB__bshift_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_int32
+GrB_Info GB_Cdense_accumB_tran__bshift_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51731,7 +64265,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_int32
+GrB_Info GB_AaddB__bshift_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51747,7 +64281,7 @@ GrB_Info GB_AaddB__bshift_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_int32
+GrB_Info GB_AemultB__bshift_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51762,8 +64296,30 @@ GrB_Info GB_AemultB__bshift_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bshift_int32
+GrB_Info GB_AaddB_sparse_dense__bshift_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bshift_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51774,7 +64330,7 @@ GrB_Info GB_bind1st__bshift_int32
 
 
 
-GrB_Info GB_bind2nd__bshift_int32
+GrB_Info GB_bind2nd__bshift_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51785,7 +64341,7 @@ GrB_Info GB_bind2nd__bshift_int32
 
 
 
-GrB_Info GB_bind1st_tran__bshift_int32
+GrB_Info GB_bind1st_tran__bshift_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51798,7 +64354,7 @@ GrB_Info GB_bind1st_tran__bshift_int32
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_int32
+GrB_Info GB_bind2nd_tran__bshift_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51821,7 +64377,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_int64
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51829,7 +64385,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_int64
+GrB_Info GB_Cdense_accumB__bshift_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51840,7 +64396,18 @@ GrB_Info GB_Cdense_accumB__bshift_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_int64
+GrB_Info GB_Cdense_accumB_tran__bshift_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -51871,7 +64438,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_int64
+GrB_Info GB_AaddB__bshift_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51887,7 +64454,7 @@ GrB_Info GB_AaddB__bshift_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_int64
+GrB_Info GB_AemultB__bshift_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -51902,8 +64469,30 @@ GrB_Info GB_AemultB__bshift_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bshift_int64
+GrB_Info GB_AaddB_sparse_dense__bshift_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bshift_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -51914,7 +64503,7 @@ GrB_Info GB_bind1st__bshift_int64
 
 
 
-GrB_Info GB_bind2nd__bshift_int64
+GrB_Info GB_bind2nd__bshift_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -51925,7 +64514,7 @@ GrB_Info GB_bind2nd__bshift_int64
 
 
 
-GrB_Info GB_bind1st_tran__bshift_int64
+GrB_Info GB_bind1st_tran__bshift_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -51938,7 +64527,7 @@ GrB_Info GB_bind1st_tran__bshift_int64
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_int64
+GrB_Info GB_bind2nd_tran__bshift_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51961,7 +64550,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -51969,7 +64558,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_uint8
+GrB_Info GB_Cdense_accumB__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -51980,7 +64569,18 @@ GrB_Info GB_Cdense_accumB__bshift_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_uint8
+GrB_Info GB_Cdense_accumB_tran__bshift_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52011,7 +64611,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_uint8
+GrB_Info GB_AaddB__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52027,7 +64627,7 @@ GrB_Info GB_AaddB__bshift_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_uint8
+GrB_Info GB_AemultB__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52042,77 +64642,21 @@ GrB_Info GB_AemultB__bshift_uint8
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__bshift_uint8
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__bshift_uint8
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__bshift_uint8
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__bshift_uint8
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint16
+GrB_Info GB_AaddB_sparse_dense__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__bshift_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -52120,70 +64664,8 @@ GrB_Info GB_Cdense_accumB__bshift_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_uint16
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
 
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__bshift_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__bshift_uint16
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-
-GrB_Info GB_bind1st__bshift_uint16
+GrB_Info GB_bind1st__bshift_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -52194,7 +64676,7 @@ GrB_Info GB_bind1st__bshift_uint16
 
 
 
-GrB_Info GB_bind2nd__bshift_uint16
+GrB_Info GB_bind2nd__bshift_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -52205,7 +64687,7 @@ GrB_Info GB_bind2nd__bshift_uint16
 
 
 
-GrB_Info GB_bind1st_tran__bshift_uint16
+GrB_Info GB_bind1st_tran__bshift_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -52218,7 +64700,7 @@ GrB_Info GB_bind1st_tran__bshift_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_uint16
+GrB_Info GB_bind2nd_tran__bshift_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52241,7 +64723,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52249,7 +64731,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_uint32
+GrB_Info GB_Cdense_accumB__bshift_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -52260,7 +64742,18 @@ GrB_Info GB_Cdense_accumB__bshift_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_uint32
+GrB_Info GB_Cdense_accumB_tran__bshift_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__bshift_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52291,7 +64784,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_uint32
+GrB_Info GB_AaddB__bshift_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52307,7 +64800,7 @@ GrB_Info GB_AaddB__bshift_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_uint32
+GrB_Info GB_AemultB__bshift_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52322,8 +64815,30 @@ GrB_Info GB_AemultB__bshift_uint32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__bshift_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bshift_uint32
+GrB_Info GB_AaddB_sparse_dense__bshift_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__bshift_uint64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -52334,7 +64849,7 @@ GrB_Info GB_bind1st__bshift_uint32
 
 
 
-GrB_Info GB_bind2nd__bshift_uint32
+GrB_Info GB_bind2nd__bshift_uint64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -52345,7 +64860,7 @@ GrB_Info GB_bind2nd__bshift_uint32
 
 
 
-GrB_Info GB_bind1st_tran__bshift_uint32
+GrB_Info GB_bind1st_tran__bshift_uint64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -52358,7 +64873,7 @@ GrB_Info GB_bind1st_tran__bshift_uint32
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_uint32
+GrB_Info GB_bind2nd_tran__bshift_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52381,7 +64896,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint64
+GrB_Info GB_Cdense_ewise3_noaccum__pow_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52389,7 +64904,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__bshift_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__bshift_uint64
+GrB_Info GB_Cdense_accumB__pow_int8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -52400,7 +64915,18 @@ GrB_Info GB_Cdense_accumB__bshift_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__bshift_uint64
+GrB_Info GB_Cdense_accumB_tran__pow_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_int8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52431,7 +64957,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__bshift_uint64
+GrB_Info GB_AaddB__pow_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52447,7 +64973,7 @@ GrB_Info GB_AaddB__bshift_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__bshift_uint64
+GrB_Info GB_AemultB__pow_int8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52462,8 +64988,30 @@ GrB_Info GB_AemultB__bshift_uint64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__bshift_uint64
+GrB_Info GB_AaddB_sparse_dense__pow_int8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__pow_int8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -52474,7 +65022,7 @@ GrB_Info GB_bind1st__bshift_uint64
 
 
 
-GrB_Info GB_bind2nd__bshift_uint64
+GrB_Info GB_bind2nd__pow_int8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -52485,7 +65033,7 @@ GrB_Info GB_bind2nd__bshift_uint64
 
 
 
-GrB_Info GB_bind1st_tran__bshift_uint64
+GrB_Info GB_bind1st_tran__pow_int8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -52498,7 +65046,7 @@ GrB_Info GB_bind1st_tran__bshift_uint64
 
 
 
-GrB_Info GB_bind2nd_tran__bshift_uint64
+GrB_Info GB_bind2nd_tran__pow_int8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52521,7 +65069,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_int8
+GrB_Info GB_Cdense_ewise3_noaccum__pow_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52529,7 +65077,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_int8
+GrB_Info GB_Cdense_accumB__pow_int16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -52540,7 +65088,18 @@ GrB_Info GB_Cdense_accumB__pow_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_int8
+GrB_Info GB_Cdense_accumB_tran__pow_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_int16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52571,7 +65130,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_int8
+GrB_Info GB_AaddB__pow_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52587,7 +65146,7 @@ GrB_Info GB_AaddB__pow_int8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_int8
+GrB_Info GB_AemultB__pow_int16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52602,8 +65161,30 @@ GrB_Info GB_AemultB__pow_int8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__pow_int8
+GrB_Info GB_AaddB_sparse_dense__pow_int16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__pow_int16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -52614,7 +65195,7 @@ GrB_Info GB_bind1st__pow_int8
 
 
 
-GrB_Info GB_bind2nd__pow_int8
+GrB_Info GB_bind2nd__pow_int16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -52625,7 +65206,7 @@ GrB_Info GB_bind2nd__pow_int8
 
 
 
-GrB_Info GB_bind1st_tran__pow_int8
+GrB_Info GB_bind1st_tran__pow_int16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -52638,7 +65219,7 @@ GrB_Info GB_bind1st_tran__pow_int8
 
 
 
-GrB_Info GB_bind2nd_tran__pow_int8
+GrB_Info GB_bind2nd_tran__pow_int16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52661,7 +65242,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_int16
+GrB_Info GB_Cdense_ewise3_noaccum__pow_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52669,7 +65250,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_int16
+GrB_Info GB_Cdense_accumB__pow_int32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -52680,7 +65261,18 @@ GrB_Info GB_Cdense_accumB__pow_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_int16
+GrB_Info GB_Cdense_accumB_tran__pow_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_int32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52711,7 +65303,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_int16
+GrB_Info GB_AaddB__pow_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52727,7 +65319,7 @@ GrB_Info GB_AaddB__pow_int16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_int16
+GrB_Info GB_AemultB__pow_int32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52742,8 +65334,30 @@ GrB_Info GB_AemultB__pow_int16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__pow_int16
+GrB_Info GB_AaddB_sparse_dense__pow_int32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__pow_int32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -52754,7 +65368,7 @@ GrB_Info GB_bind1st__pow_int16
 
 
 
-GrB_Info GB_bind2nd__pow_int16
+GrB_Info GB_bind2nd__pow_int32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -52765,7 +65379,7 @@ GrB_Info GB_bind2nd__pow_int16
 
 
 
-GrB_Info GB_bind1st_tran__pow_int16
+GrB_Info GB_bind1st_tran__pow_int32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -52778,7 +65392,7 @@ GrB_Info GB_bind1st_tran__pow_int16
 
 
 
-GrB_Info GB_bind2nd_tran__pow_int16
+GrB_Info GB_bind2nd_tran__pow_int32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52801,7 +65415,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_int32
+GrB_Info GB_Cdense_ewise3_noaccum__pow_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52809,7 +65423,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_int32
+GrB_Info GB_Cdense_accumB__pow_int64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -52820,7 +65434,18 @@ GrB_Info GB_Cdense_accumB__pow_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_int32
+GrB_Info GB_Cdense_accumB_tran__pow_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_int64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52851,7 +65476,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_int32
+GrB_Info GB_AaddB__pow_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52867,7 +65492,7 @@ GrB_Info GB_AaddB__pow_int32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_int32
+GrB_Info GB_AemultB__pow_int64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -52882,8 +65507,30 @@ GrB_Info GB_AemultB__pow_int32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pow_int64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__pow_int32
+
+GrB_Info GB_bind1st__pow_int64
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -52894,7 +65541,7 @@ GrB_Info GB_bind1st__pow_int32
 
 
 
-GrB_Info GB_bind2nd__pow_int32
+GrB_Info GB_bind2nd__pow_int64
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -52905,7 +65552,7 @@ GrB_Info GB_bind2nd__pow_int32
 
 
 
-GrB_Info GB_bind1st_tran__pow_int32
+GrB_Info GB_bind1st_tran__pow_int64
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -52918,7 +65565,7 @@ GrB_Info GB_bind1st_tran__pow_int32
 
 
 
-GrB_Info GB_bind2nd_tran__pow_int32
+GrB_Info GB_bind2nd_tran__pow_int64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52941,7 +65588,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_int64
+GrB_Info GB_Cdense_ewise3_noaccum__pow_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -52949,7 +65596,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_int64
+GrB_Info GB_Cdense_accumB__pow_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -52960,7 +65607,18 @@ GrB_Info GB_Cdense_accumB__pow_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_int64
+GrB_Info GB_Cdense_accumB_tran__pow_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_uint8
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -52991,7 +65649,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_int64
+GrB_Info GB_AaddB__pow_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53007,7 +65665,7 @@ GrB_Info GB_AaddB__pow_int64
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_int64
+GrB_Info GB_AemultB__pow_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53022,8 +65680,30 @@ GrB_Info GB_AemultB__pow_int64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pow_uint8
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__pow_int64
+
+GrB_Info GB_bind1st__pow_uint8
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -53034,7 +65714,7 @@ GrB_Info GB_bind1st__pow_int64
 
 
 
-GrB_Info GB_bind2nd__pow_int64
+GrB_Info GB_bind2nd__pow_uint8
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -53045,7 +65725,7 @@ GrB_Info GB_bind2nd__pow_int64
 
 
 
-GrB_Info GB_bind1st_tran__pow_int64
+GrB_Info GB_bind1st_tran__pow_uint8
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -53058,7 +65738,7 @@ GrB_Info GB_bind1st_tran__pow_int64
 
 
 
-GrB_Info GB_bind2nd_tran__pow_int64
+GrB_Info GB_bind2nd_tran__pow_uint8
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -53081,7 +65761,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_uint8
+GrB_Info GB_Cdense_ewise3_noaccum__pow_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -53089,7 +65769,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_uint8
+GrB_Info GB_Cdense_accumB__pow_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -53100,7 +65780,18 @@ GrB_Info GB_Cdense_accumB__pow_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_uint8
+GrB_Info GB_Cdense_accumB_tran__pow_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_uint16
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -53131,7 +65822,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_uint8
+GrB_Info GB_AaddB__pow_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53147,7 +65838,7 @@ GrB_Info GB_AaddB__pow_uint8
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_uint8
+GrB_Info GB_AemultB__pow_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53162,8 +65853,30 @@ GrB_Info GB_AemultB__pow_uint8
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__pow_uint8
+GrB_Info GB_AaddB_sparse_dense__pow_uint16
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__pow_uint16
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -53174,7 +65887,7 @@ GrB_Info GB_bind1st__pow_uint8
 
 
 
-GrB_Info GB_bind2nd__pow_uint8
+GrB_Info GB_bind2nd__pow_uint16
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -53185,7 +65898,7 @@ GrB_Info GB_bind2nd__pow_uint8
 
 
 
-GrB_Info GB_bind1st_tran__pow_uint8
+GrB_Info GB_bind1st_tran__pow_uint16
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -53198,7 +65911,7 @@ GrB_Info GB_bind1st_tran__pow_uint8
 
 
 
-GrB_Info GB_bind2nd_tran__pow_uint8
+GrB_Info GB_bind2nd_tran__pow_uint16
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -53221,7 +65934,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_uint16
+GrB_Info GB_Cdense_ewise3_noaccum__pow_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -53229,7 +65942,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_uint16
+GrB_Info GB_Cdense_accumB__pow_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -53240,7 +65953,18 @@ GrB_Info GB_Cdense_accumB__pow_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_uint16
+GrB_Info GB_Cdense_accumB_tran__pow_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_uint32
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -53271,7 +65995,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_uint16
+GrB_Info GB_AaddB__pow_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53287,7 +66011,7 @@ GrB_Info GB_AaddB__pow_uint16
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_uint16
+GrB_Info GB_AemultB__pow_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53302,8 +66026,30 @@ GrB_Info GB_AemultB__pow_uint16
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
 
-GrB_Info GB_bind1st__pow_uint16
+GrB_Info GB_AaddB_sparse_dense__pow_uint32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+
+GrB_Info GB_bind1st__pow_uint32
 (
     GB_void *Cx_output,
     const GB_void *x_input,
@@ -53314,7 +66060,7 @@ GrB_Info GB_bind1st__pow_uint16
 
 
 
-GrB_Info GB_bind2nd__pow_uint16
+GrB_Info GB_bind2nd__pow_uint32
 (
     GB_void *Cx_output,
     const GB_void *Ax_input,
@@ -53325,7 +66071,7 @@ GrB_Info GB_bind2nd__pow_uint16
 
 
 
-GrB_Info GB_bind1st_tran__pow_uint16
+GrB_Info GB_bind1st_tran__pow_uint32
 (
     GrB_Matrix C,
     const GB_void *x_input,
@@ -53338,7 +66084,7 @@ GrB_Info GB_bind1st_tran__pow_uint16
 
 
 
-GrB_Info GB_bind2nd_tran__pow_uint16
+GrB_Info GB_bind2nd_tran__pow_uint32
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -53361,7 +66107,7 @@ void (none)
 ) ;
 #endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_uint32
+GrB_Info GB_Cdense_ewise3_noaccum__pow_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
@@ -53369,7 +66115,7 @@ GrB_Info GB_Cdense_ewise3_noaccum__pow_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumB__pow_uint32
+GrB_Info GB_Cdense_accumB__pow_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix B,
@@ -53380,7 +66126,18 @@ GrB_Info GB_Cdense_accumB__pow_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_uint32
+GrB_Info GB_Cdense_accumB_tran__pow_uint64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_Cdense_accumb__pow_uint64
 (
     GrB_Matrix C,
     const GB_void *p_bwork,
@@ -53411,7 +66168,7 @@ GrB_Info (node)
 
 #endif
 
-GrB_Info GB_AaddB__pow_uint32
+GrB_Info GB_AaddB__pow_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53427,7 +66184,7 @@ GrB_Info GB_AaddB__pow_uint32
     const int nthreads
 ) ;
 
-GrB_Info GB_AemultB__pow_uint32
+GrB_Info GB_AemultB__pow_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix M,
@@ -53442,77 +66199,21 @@ GrB_Info GB_AemultB__pow_uint32
     const int nthreads
 ) ;
 
-
-GrB_Info GB_bind1st__pow_uint32
-(
-    GB_void *Cx_output,
-    const GB_void *x_input,
-    const GB_void *Bx_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind2nd__pow_uint32
-(
-    GB_void *Cx_output,
-    const GB_void *Ax_input,
-    const GB_void *y_input,
-    int64_t anz,
-    int nthreads
-) ;
-
-
-
-GrB_Info GB_bind1st_tran__pow_uint32
-(
-    GrB_Matrix C,
-    const GB_void *x_input,
-    const GrB_Matrix A,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-GrB_Info GB_bind2nd_tran__pow_uint32
-(
-    GrB_Matrix C,
-    const GrB_Matrix A,
-    const GB_void *y_input,
-    int64_t *GB_RESTRICT *Rowcounts,
-    GBI_single_iterator Iter,
-    const int64_t *GB_RESTRICT A_slice,
-    int naslice
-) ;
-
-
-
-#if 0
-void (none)
+GrB_Info GB_AkronB__pow_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
+    const int ntasks,
     const int nthreads
 ) ;
-#endif
 
-GrB_Info GB_Cdense_ewise3_noaccum__pow_uint64
+GrB_Info GB_AaddB_sparse_dense__pow_uint64
 (
     GrB_Matrix C,
     const GrB_Matrix A,
     const GrB_Matrix B,
-    const int nthreads
-) ;
-
-GrB_Info GB_Cdense_accumB__pow_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix B,
+    const bool A_is_sparse,
     const int64_t *GB_RESTRICT kfirst_slice,
     const int64_t *GB_RESTRICT klast_slice,
     const int64_t *GB_RESTRICT pstart_slice,
@@ -53520,68 +66221,6 @@ GrB_Info GB_Cdense_accumB__pow_uint64
     const int nthreads
 ) ;
 
-GrB_Info GB_Cdense_accumb__pow_uint64
-(
-    GrB_Matrix C,
-    const GB_void *p_bwork,
-    const int nthreads
-) ;
-
-#if 0
-
-GrB_Info (none)
-(
-    GrB_Matrix C,
-    const GrB_Matrix A, bool A_is_pattern,
-    const GrB_Matrix D, bool D_is_pattern,
-    const int64_t *GB_RESTRICT kfirst_slice,
-    const int64_t *GB_RESTRICT klast_slice,
-    const int64_t *GB_RESTRICT pstart_slice,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info (node)
-(
-    GrB_Matrix C,
-    const GrB_Matrix D, bool D_is_pattern,
-    const GrB_Matrix B, bool B_is_pattern,
-    int nthreads
-) ;
-
-#endif
-
-GrB_Info GB_AaddB__pow_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const bool Ch_is_Mh,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
-GrB_Info GB_AemultB__pow_uint64
-(
-    GrB_Matrix C,
-    const GrB_Matrix M,
-    const bool Mask_struct,
-    const GrB_Matrix A,
-    const GrB_Matrix B,
-    const int64_t *GB_RESTRICT C_to_M,
-    const int64_t *GB_RESTRICT C_to_A,
-    const int64_t *GB_RESTRICT C_to_B,
-    const GB_task_struct *GB_RESTRICT TaskList,
-    const int ntasks,
-    const int nthreads
-) ;
-
 
 GrB_Info GB_bind1st__pow_uint64
 (
@@ -53660,6 +66299,17 @@ GrB_Info GB_Cdense_accumB__pow_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pow_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pow_fp32
 (
     GrB_Matrix C,
@@ -53722,6 +66372,28 @@ GrB_Info GB_AemultB__pow_fp32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pow_fp32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__pow_fp32
 (
@@ -53800,6 +66472,17 @@ GrB_Info GB_Cdense_accumB__pow_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pow_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pow_fp64
 (
     GrB_Matrix C,
@@ -53862,6 +66545,28 @@ GrB_Info GB_AemultB__pow_fp64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pow_fp64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__pow_fp64
 (
@@ -53940,6 +66645,17 @@ GrB_Info GB_Cdense_accumB__pow_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pow_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pow_fc32
 (
     GrB_Matrix C,
@@ -54002,6 +66718,28 @@ GrB_Info GB_AemultB__pow_fc32
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pow_fc32
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__pow_fc32
 (
@@ -54080,6 +66818,17 @@ GrB_Info GB_Cdense_accumB__pow_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran__pow_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb__pow_fc64
 (
     GrB_Matrix C,
@@ -54142,6 +66891,28 @@ GrB_Info GB_AemultB__pow_fc64
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB__pow_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense__pow_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 
 GrB_Info GB_bind1st__pow_fc64
 (
@@ -21,9 +21,12 @@
 
 // A+B function (eWiseAdd):         GB_AaddB__rdiv_fc64
 // A.*B function (eWiseMult):       GB_AemultB__rdiv_fc64
+// kron(A,B) function (kron):       GB_AkronB__rdiv_fc64
+// A+B function (sparse+dense):     GB_AaddB_sparse_dense__rdiv_fc64
 // A*D function (colscale):         GB_AxD__rdiv_fc64
 // D*A function (rowscale):         GB_DxB__rdiv_fc64
 // C+=B function (dense accum):     GB_Cdense_accumB__rdiv_fc64
+// C+=B' function (dense accum):    GB_Cdense_accumB_tran__rdiv_fc64
 // C+=b function (dense accum):     GB_Cdense_accumb__rdiv_fc64
 // C+=A+B function (dense ewise3):  GB_Cdense_ewise3_accum__rdiv_fc64
 // C=A+B function (dense ewise3):   GB_Cdense_ewise3_noaccum__rdiv_fc64
@@ -178,6 +181,33 @@ GrB_Info GB_Cdense_accumB__rdiv_fc64
     #endif
 }
 
+//------------------------------------------------------------------------------
+// C += B', accumulate the transpose of a sparse matrix into a dense matrix
+//------------------------------------------------------------------------------
+
+GrB_Info GB_Cdense_accumB_tran__rdiv_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+)
+{
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    
+    { 
+        #include "GB_dense_subassign_23_tran_template.c"
+    }
+    
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // C += b, accumulate a scalar into a dense matrix
 //------------------------------------------------------------------------------
@@ -313,6 +343,52 @@ GrB_Info GB_AemultB__rdiv_fc64
     #endif
 }
 
+//------------------------------------------------------------------------------
+// Kronecker product: C = kron (A,B)
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AkronB__rdiv_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_kroner_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
+//------------------------------------------------------------------------------
+// eWiseAdd: C<S>=A+B where S is A or B, and the other matrix is dense
+//------------------------------------------------------------------------------
+
+GrB_Info GB_AaddB_sparse_dense__rdiv_fc64
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+)
+{ 
+    #if GB_DISABLE
+    return (GrB_NO_VALUE) ;
+    #else
+    #include "GB_add_sparse_dense_template.c"
+    return (GrB_SUCCESS) ;
+    #endif
+}
+
 //------------------------------------------------------------------------------
 // Cx = op (x,Bx):  apply a binary operator to a matrix with scalar bind1st
 //------------------------------------------------------------------------------
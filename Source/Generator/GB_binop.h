@@ -28,6 +28,17 @@ GrB_Info GB_Cdense_accumB
     const int nthreads
 ) ;
 
+GrB_Info GB_Cdense_accumB_tran
+(
+    GrB_Matrix C,
+    const GrB_Matrix B,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 GrB_Info GB_Cdense_accumb
 (
     GrB_Matrix C,
@@ -90,6 +101,28 @@ GrB_Info GB_AemultB
     const int nthreads
 ) ;
 
+GrB_Info GB_AkronB
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const int ntasks,
+    const int nthreads
+) ;
+
+GrB_Info GB_AaddB_sparse_dense
+(
+    GrB_Matrix C,
+    const GrB_Matrix A,
+    const GrB_Matrix B,
+    const bool A_is_sparse,
+    const int64_t *GB_RESTRICT kfirst_slice,
+    const int64_t *GB_RESTRICT klast_slice,
+    const int64_t *GB_RESTRICT pstart_slice,
+    const int ntasks,
+    const int nthreads
+) ;
+
 if_binop_bind1st_is_enabled
 GrB_Info GB_bind1st
 (
@@ -48,6 +48,7 @@ GrB_Info GrB_Descriptor_new     // create a new descriptor
     desc->nthreads_max = GxB_DEFAULT ;  // max # of threads to use
     desc->chunk = GxB_DEFAULT ;         // chunk for auto-tuning of # threads
     desc->use_mkl = false ;        // control usage of Intel MKL
+    desc->compression = GxB_DEFAULT ;   // compression for serialize
     desc->predefined = false ;     // user-defined
     return (GrB_SUCCESS) ;
 }
@@ -119,14 +119,29 @@ GrB_Info GrB_Descriptor_set     // set a parameter in a descriptor
             desc->axb = value ;
             break ;
 
+        case GxB_COMPRESSION : 
+
+            if (! (value == GxB_DEFAULT || value == GxB_COMPRESSION_NONE
+                || value == GxB_COMPRESSION_LZ4))
+            { 
+                return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                    "invalid descriptor value [%d] for GxB_COMPRESSION field;\n"
+                    "must be GxB_DEFAULT [%d], GxB_COMPRESSION_NONE [%d]\n"
+                    "or GxB_COMPRESSION_LZ4 [%d]",
+                    (int) value, (int) GxB_DEFAULT, (int) GxB_COMPRESSION_NONE,
+                    (int) GxB_COMPRESSION_LZ4))) ;
+            }
+            desc->compression = value ;
+            break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d]"
-                "or GxB_AxB_METHOD [%d]", (int) field, (int) GrB_OUTP,
-                (int) GrB_MASK, (int) GrB_INP0, (int) GrB_INP1,
-                (int) GxB_AxB_METHOD))) ;
+                "GxB_AxB_METHOD [%d] or GxB_COMPRESSION [%d]", (int) field,
+                (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0, (int) GrB_INP1,
+                (int) GxB_AxB_METHOD, (int) GxB_COMPRESSION))) ;
     }
 
     return (GrB_SUCCESS) ;
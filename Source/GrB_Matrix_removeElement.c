@@ -142,6 +142,39 @@ GrB_Info GrB_Matrix_removeElement
         return (GrB_SUCCESS) ;
     }
 
+    // a bitmap entry is deleted in O(1) time, by clearing its bit
+    if (GB_IS_BITMAP (C))
+    {
+        int64_t p = i + j * C->vlen ;
+        if (C->b [p])
+        { 
+            C->b [p] = 0 ;
+            C->nvals-- ;
+            C->nvec_nonempty = -1 ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    // the entry is found by binary search, so C must be sorted first
+    if (GB_JUMBLED (C))
+    { 
+        GrB_Info info ;
+        GB_WHERE (GB_WHERE_STRING) ;
+        GB_BURBLE_START ("GrB_Matrix_removeElement") ;
+        GB_OK (GB_unjumble ((GrB_Matrix) C, Context)) ;
+        GB_BURBLE_END ;
+    }
+
+    // a full matrix has no zombies; convert it to sparse first
+    if (GB_IS_FULL (C))
+    { 
+        GrB_Info info ;
+        GB_WHERE (GB_WHERE_STRING) ;
+        GB_BURBLE_START ("GrB_Matrix_removeElement") ;
+        GB_OK (GB_convert_full_to_sparse ((GrB_Matrix) C, Context)) ;
+        GB_BURBLE_END ;
+    }
+
     // remove the entry
     if (GB_removeElement (C, i, j))
     { 
@@ -158,6 +191,8 @@ GrB_Info GrB_Matrix_removeElement
         GB_OK (GB_Matrix_wait (C, Context)) ;
         ASSERT (!GB_ZOMBIES (C)) ;
         ASSERT (!GB_PENDING (C)) ;
+        // C may now be bitmap or full
+        GB_ENSURE_SPARSE (C) ;
         GB_BURBLE_END ;
     }
 
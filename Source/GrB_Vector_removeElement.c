@@ -96,6 +96,38 @@ GrB_Info GrB_Vector_removeElement
         return (GrB_SUCCESS) ;
     }
 
+    // a bitmap entry is deleted in O(1) time, by clearing its bit
+    if (GB_IS_BITMAP (V))
+    {
+        if (V->b [i])
+        { 
+            V->b [i] = 0 ;
+            V->nvals-- ;
+            V->nvec_nonempty = -1 ;
+        }
+        return (GrB_SUCCESS) ;
+    }
+
+    // the entry is found by binary search, so V must be sorted first
+    if (GB_JUMBLED (V))
+    { 
+        GrB_Info info ;
+        GB_WHERE (GB_WHERE_STRING) ;
+        GB_BURBLE_START ("GrB_Vector_removeElement") ;
+        GB_OK (GB_unjumble ((GrB_Matrix) V, Context)) ;
+        GB_BURBLE_END ;
+    }
+
+    // a full matrix has no zombies; convert it to sparse first
+    if (GB_IS_FULL (V))
+    { 
+        GrB_Info info ;
+        GB_WHERE (GB_WHERE_STRING) ;
+        GB_BURBLE_START ("GrB_Vector_removeElement") ;
+        GB_OK (GB_convert_full_to_sparse ((GrB_Matrix) V, Context)) ;
+        GB_BURBLE_END ;
+    }
+
     // remove the entry
     if (GB_removeElement (V, i))
     { 
@@ -112,6 +144,8 @@ GrB_Info GrB_Vector_removeElement
         GB_OK (GB_Matrix_wait ((GrB_Matrix) V, Context)) ;
         ASSERT (!GB_ZOMBIES (V)) ;
         ASSERT (!GB_PENDING (V)) ;
+        // V may now be bitmap or full
+        GB_ENSURE_SPARSE (V) ;
         GB_BURBLE_END ;
     }
 
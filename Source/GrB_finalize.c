@@ -23,6 +23,9 @@ GrB_Info GrB_finalize ( )
 
     GB_WHERE ("GrB_finalize") ;
 
+    // free all workspace in the workspace pool
+    GxB_Workspace_release ( ) ;
+
     #if defined (USER_POSIX_THREADS)
     { pthread_mutex_destroy (&GB_sync) ; }  // TODO in 4.0: delete
     #endif
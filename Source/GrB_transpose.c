@@ -11,15 +11,16 @@
 
 #include "GB_transpose.h"
 #include "GB_accum_mask.h"
+#include "GB_dense.h"
 
-#define GB_FREE_ALL ;
+#define GB_FREE_ALL GB_MATRIX_FREE (&A_sparse) ;
 
 GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
 (
     GrB_Matrix C,                   // input/output matrix for results
     const GrB_Matrix M,             // optional mask for C, unused if NULL
     const GrB_BinaryOp accum,       // optional accum for Z=accum(C,T)
-    const GrB_Matrix A,             // first input:  matrix A
+    const GrB_Matrix A_in,          // first input:  matrix A
     const GrB_Descriptor desc       // descriptor for C, M, and A
 )
 {
@@ -29,6 +30,8 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     //--------------------------------------------------------------------------
 
     GrB_Matrix T = NULL ;
+    GrB_Matrix A_sparse = NULL ;
+    GrB_Matrix A = A_in ;
 
     // C may be aliased with M and/or A
 
@@ -67,12 +70,17 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     // quick return if an empty mask is complemented
     GB_RETURN_IF_QUICK_MASK (C, C_replace, M, Mask_comp) ;
 
-    // delete any lingering zombies and assemble any pending tuples
+    // delete any lingering zombies and assemble any pending tuples.  A can
+    // be left jumbled, since GB_transpose sorts its result.
     GB_MATRIX_WAIT (M) ;
-    GB_MATRIX_WAIT (A) ;
+    GB_MATRIX_WAIT_IF_PENDING_OR_ZOMBIES (A) ;
+
+    // the shallow T=A below cannot share the bitmap of A, so a bitmap A is
+    // replaced with a temporary sparse copy
+    GB_SPARSE_OR_FULL_INPUT (A, A_sparse) ;
 
     //--------------------------------------------------------------------------
-    // T = A or A', where T can have the type of C or the type of A
+    // handle the CSR/CSC formats of C and A
     //--------------------------------------------------------------------------
 
     bool C_is_csc = C->is_csc ;
@@ -82,6 +90,29 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
         A_transpose = !A_transpose ;
     }
 
+    //--------------------------------------------------------------------------
+    // C += A' where C is dense: accumulate A' into C without constructing T
+    //--------------------------------------------------------------------------
+
+    if (!A_transpose && M == NULL && accum != NULL
+        && C->type == accum->ztype && C->type == accum->xtype
+        && !GB_aliased (C, A) && !GB_JUMBLED (A)
+        && !GB_PENDING_OR_ZOMBIES (C) && GB_is_dense (C))
+    { 
+        // C += A' with no mask, where C is dense and not typecasted.  The
+        // entries of A are scattered directly into C, so T = A' is not needed.
+        GBBURBLE ("(C dense) += A' ") ;
+        GB_OK (GB_dense_subassign_23 (C, A, true, accum, Context)) ;
+        ASSERT_MATRIX_OK (C, "C output for GrB_transpose, C+=A'", GB0) ;
+        GB_FREE_ALL ;
+        GB_BURBLE_END ;
+        return (GB_block (C, Context)) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // T = A or A', where T can have the type of C or the type of A
+    //--------------------------------------------------------------------------
+
     if (!A_transpose)
     {
 
@@ -138,6 +169,7 @@ GrB_Info GrB_transpose              // C<M> = accum(C,A') or accum(C,A)
     info = GB_accum_mask (C, M, NULL, accum, &T, C_replace, Mask_comp, 
         Mask_struct, Context) ;
     ASSERT (T == NULL) ;
+    GB_FREE_ALL ;
 
     GB_BURBLE_END ;
     return (info) ;
@@ -121,15 +121,27 @@ GrB_Info GxB_Desc_get           // get a parameter from a descriptor
             }
             break ;
 
+        case GxB_COMPRESSION : 
+
+            {
+                va_start (ap, field) ;
+                GrB_Desc_Value *value = va_arg (ap, GrB_Desc_Value *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (value) ;
+                (*value) = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+            }
+            break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d],\n"
-                "GxB_NTHREADS [%d], GxB_CHUNK [%d] or GxB_AxB_METHOD [%d]",
+                "GxB_NTHREADS [%d], GxB_CHUNK [%d], GxB_AxB_METHOD [%d]\n"
+                "or GxB_COMPRESSION [%d]",
                 (int) field, (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0,
                 (int) GrB_INP1, (int) GxB_NTHREADS, (int) GxB_CHUNK, 
-                (int) GxB_AxB_METHOD))) ;
+                (int) GxB_AxB_METHOD, (int) GxB_COMPRESSION))) ;
     }
 
     return (GrB_SUCCESS) ;
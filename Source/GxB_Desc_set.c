@@ -176,16 +176,38 @@ GrB_Info GxB_Desc_set           // set a parameter in a descriptor
             }
             break ;
 
+        case GxB_COMPRESSION : 
+
+            {
+                va_start (ap, field) ;
+                int value = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (! (value == GxB_DEFAULT || value == GxB_COMPRESSION_NONE
+                    || value == GxB_COMPRESSION_LZ4))
+                { 
+                    return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                        "invalid descriptor value [%d] for GxB_COMPRESSION"
+                        " field;\nmust be GxB_DEFAULT [%d],"
+                        " GxB_COMPRESSION_NONE [%d]\n"
+                        " or GxB_COMPRESSION_LZ4 [%d]",
+                        value, (int) GxB_DEFAULT, (int) GxB_COMPRESSION_NONE,
+                        (int) GxB_COMPRESSION_LZ4))) ;
+                }
+                desc->compression = (GrB_Desc_Value) value ;
+            }
+            break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                 "invalid descriptor field [%d], must be one of:\n"
                 "GrB_OUTP [%d], GrB_MASK [%d], GrB_INP0 [%d], GrB_INP1 [%d]\n"
                 "GxB_NTHREADS [%d], GxB_CHUNK [%d], GxB_AxB_METHOD [%d], "
-                "or GxB_MKL [%d]\n",
+                "GxB_MKL [%d], or GxB_COMPRESSION [%d]\n",
                 (int) field, (int) GrB_OUTP, (int) GrB_MASK, (int) GrB_INP0,
                 (int) GrB_INP1, (int) GxB_NTHREADS, (int) GxB_CHUNK,
-                (int) GxB_AxB_METHOD, (int) GxB_MKL))) ;
+                (int) GxB_AxB_METHOD, (int) GxB_MKL,
+                (int) GxB_COMPRESSION))) ;
     }
 
     return (GrB_SUCCESS) ;
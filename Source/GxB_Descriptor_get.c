@@ -53,6 +53,10 @@ GrB_Info GxB_Descriptor_get     // get a parameter from a descriptor
 
             (*val) = (desc == NULL) ? GxB_DEFAULT : desc->axb  ; break;
 
+        case GxB_COMPRESSION : 
+
+            (*val) = (desc == NULL) ? GxB_DEFAULT : desc->compression ; break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
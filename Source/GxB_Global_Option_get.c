@@ -46,6 +46,36 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // sparsity control
+        //----------------------------------------------------------------------
+
+        case GxB_SPARSITY_CONTROL :
+
+            { 
+                va_start (ap, field) ;
+                int *sparsity = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (sparsity) ;
+                (*sparsity) = GB_Global_sparsity_get ( ) ;
+            }
+            break ;
+
+        //----------------------------------------------------------------------
+        // bitmap switch
+        //----------------------------------------------------------------------
+
+        case GxB_BITMAP_SWITCH :
+
+            { 
+                va_start (ap, field) ;
+                double *bitmap_switch = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bitmap_switch) ;
+                (*bitmap_switch) = GB_Global_bitmap_switch_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // matrix format (CSR or CSC)
         //----------------------------------------------------------------------
@@ -148,6 +178,21 @@ GrB_Info GxB_Global_Option_get      // gets the current global option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // workspace pool
+        //----------------------------------------------------------------------
+
+        case GxB_WORKSPACE_MAX : 
+
+            { 
+                va_start (ap, field) ;
+                int64_t *workspace_max = va_arg (ap, int64_t *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (workspace_max) ;
+                (*workspace_max) = (int64_t) GB_Global_workspace_max_get ( ) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // SuiteSparse:GraphBLAS version, etc
         //----------------------------------------------------------------------
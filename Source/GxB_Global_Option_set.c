@@ -62,6 +62,34 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        case GxB_SPARSITY_CONTROL : 
+
+            { 
+                va_start (ap, field) ;
+                int sparsity = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (sparsity <= 0 || (sparsity & ~GxB_AUTO_SPARSITY) != 0)
+                { 
+                    return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                            "unsupported sparsity control [%d], must be:\n"
+                            "GxB_SPARSE [%d], GxB_BITMAP [%d], GxB_FULL [%d],"
+                            " or any sum of them", sparsity, GxB_SPARSE,
+                            GxB_BITMAP, GxB_FULL))) ;
+                }
+                GB_Global_sparsity_set (sparsity) ;
+            }
+            break ;
+
+        case GxB_BITMAP_SWITCH : 
+
+            { 
+                va_start (ap, field) ;
+                double bitmap_switch = va_arg (ap, double) ;
+                va_end (ap) ;
+                GB_Global_bitmap_switch_set (bitmap_switch) ;
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // OpenMP control
         //----------------------------------------------------------------------
@@ -88,6 +116,26 @@ GrB_Info GxB_Global_Option_set      // set a global default option
             }
             break ;
 
+        //----------------------------------------------------------------------
+        // workspace pool
+        //----------------------------------------------------------------------
+
+        case GxB_WORKSPACE_MAX : 
+
+            {
+                va_start (ap, field) ;
+                int64_t workspace_max = va_arg (ap, int64_t) ;
+                va_end (ap) ;
+                workspace_max = GB_IMAX (workspace_max, 0) ;
+                GB_Global_workspace_max_set ((size_t) workspace_max) ;
+                if (GB_Global_workspace_total_get ( ) > (size_t) workspace_max)
+                { 
+                    // empty the pool, since it is now too large
+                    GxB_Workspace_release ( ) ;
+                }
+            }
+            break ;
+
         //----------------------------------------------------------------------
         // diagnostics
         //----------------------------------------------------------------------
@@ -150,11 +198,13 @@ GrB_Info GxB_Global_Option_set      // set a global default option
                     "invalid option field [%d], must be one of:\n"
                     "GxB_HYPER [%d], GxB_FORMAT [%d], GxB_NTHREADS [%d]\n"
                     "GxB_CHUNK [%d], GxB_BURBLE [%d], GxB_GPU_CONTROL [%d]\n"
-                    "GxB_GPU_CHUNK [%d], or GxB_MKL [%d]\n",
+                    "GxB_GPU_CHUNK [%d], GxB_MKL [%d],\n"
+                    "GxB_SPARSITY_CONTROL [%d], or GxB_BITMAP_SWITCH [%d]\n",
                     (int) field, (int) GxB_HYPER, (int) GxB_FORMAT,
                     (int) GxB_NTHREADS, (int) GxB_CHUNK, (int) GxB_BURBLE,
                     (int) GxB_GPU_CONTROL, (int) GxB_GPU_CHUNK, (int)
-                    GxB_MKL))) ;
+                    GxB_MKL, (int) GxB_SPARSITY_CONTROL,
+                    (int) GxB_BITMAP_SWITCH))) ;
 
     }
 
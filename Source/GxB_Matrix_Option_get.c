@@ -67,13 +67,62 @@ GrB_Info GxB_Matrix_Option_get      // gets the current option of a matrix
             }
             break ;
 
+        case GxB_BITMAP_SWITCH : 
+
+            {
+                va_start (ap, field) ;
+                double *bitmap_switch = va_arg (ap, double *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (bitmap_switch) ;
+                (*bitmap_switch) = A->bitmap_switch ;
+            }
+            break ;
+
+        case GxB_SPARSITY_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int *sparsity = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (sparsity) ;
+                (*sparsity) = A->sparsity ;
+            }
+            break ;
+
+        case GxB_SPARSITY_STATUS : 
+
+            {
+                va_start (ap, field) ;
+                int *sparsity = va_arg (ap, int *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (sparsity) ;
+                (*sparsity) = GB_IS_FULL (A) ? GxB_FULL :
+                    (GB_IS_BITMAP (A) ? GxB_BITMAP : GxB_SPARSE) ;
+            }
+            break ;
+
+        case GxB_CONCURRENT_INSERT : 
+
+            {
+                va_start (ap, field) ;
+                bool *concurrent = va_arg (ap, bool *) ;
+                va_end (ap) ;
+                GB_RETURN_IF_NULL (concurrent) ;
+                (*concurrent) = (A->Pending_slots != NULL) ;
+            }
+            break ;
+
         default : 
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                     "invalid option field [%d], must be one of:\n"
-                    "GxB_HYPER [%d], GxB_FORMAT [%d], or GxB_IS_HYPER [%d]",
+                    "GxB_HYPER [%d], GxB_FORMAT [%d], GxB_IS_HYPER [%d],\n"
+                    "GxB_SPARSITY_CONTROL [%d], GxB_SPARSITY_STATUS [%d],\n"
+                    "GxB_BITMAP_SWITCH [%d], or GxB_CONCURRENT_INSERT [%d]",
                     (int) field, (int) GxB_HYPER, (int) GxB_FORMAT,
-                    (int) GxB_IS_HYPER))) ;
+                    (int) GxB_IS_HYPER, (int) GxB_SPARSITY_CONTROL,
+                    (int) GxB_SPARSITY_STATUS, (int) GxB_BITMAP_SWITCH,
+                    (int) GxB_CONCURRENT_INSERT))) ;
 
     }
     return (GrB_SUCCESS) ;
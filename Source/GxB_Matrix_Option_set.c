@@ -8,6 +8,7 @@
 //------------------------------------------------------------------------------
 
 #include "GB_transpose.h"
+#include "GB_Pending.h"
 
 #define GB_FREE_ALL ;
 
@@ -48,7 +49,39 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
                 va_end (ap) ;
                 A->hyper_ratio = hyper_ratio ;
                 // conform the matrix to its new desired hypersparsity
-                info = GB_to_hyper_conform (A, Context) ;
+                info = GB_conform (A, Context) ;
+            }
+            break ;
+
+        case GxB_BITMAP_SWITCH : 
+
+            {
+                va_start (ap, field) ;
+                double bitmap_switch = va_arg (ap, double) ;
+                va_end (ap) ;
+                A->bitmap_switch = bitmap_switch ;
+                // conform the matrix to its new desired sparsity
+                info = GB_conform (A, Context) ;
+            }
+            break ;
+
+        case GxB_SPARSITY_CONTROL : 
+
+            {
+                va_start (ap, field) ;
+                int sparsity = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (sparsity <= 0 || (sparsity & ~GxB_AUTO_SPARSITY) != 0)
+                { 
+                    return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                            "unsupported sparsity control [%d], must be:\n"
+                            "GxB_SPARSE [%d], GxB_BITMAP [%d], GxB_FULL [%d],"
+                            " or any sum of them", sparsity, GxB_SPARSE,
+                            GxB_BITMAP, GxB_FULL))) ;
+                }
+                A->sparsity = sparsity ;
+                // conform the matrix to its new desired sparsity
+                info = GB_conform (A, Context) ;
             }
             break ;
 
@@ -78,6 +111,40 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
                         NULL, NULL, NULL, false, Context);
                     ASSERT (GB_IMPLIES (info == GrB_SUCCESS,
                         A->is_csc == new_csc)) ;
+                    if (info == GrB_SUCCESS)
+                    { 
+                        // a bitmap A is transposed as sparse; convert it back
+                        info = GB_conform (A, Context) ;
+                    }
+                }
+            }
+            break ;
+
+        case GxB_CONCURRENT_INSERT : 
+
+            {
+                va_start (ap, field) ;
+                int concurrent = va_arg (ap, int) ;
+                va_end (ap) ;
+                if (!concurrent)
+                { 
+                    // A has no pending tuples, so none are lost
+                    GB_Pending_slots_free (A) ;
+                }
+                else if (A->Pending_slots == NULL)
+                { 
+                    #if !defined ( _OPENMP )
+                    return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                        "concurrent insertion requires OpenMP"))) ;
+                    #endif
+                    A->Pending_slots = GB_CALLOC (GB_PENDING_NSLOTS,
+                        struct GB_Pending_slot_struct) ;
+                    if (A->Pending_slots == NULL)
+                    { 
+                        // out of memory
+                        return (GB_OUT_OF_MEMORY) ;
+                    }
+                    A->Pending_slots_used = false ;
                 }
             }
             break ;
@@ -86,8 +153,12 @@ GrB_Info GxB_Matrix_Option_set      // set an option in a matrix
 
             return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
                     "invalid option field [%d], must be one of:\n"
-                    "GxB_HYPER [%d], GxB_FORMAT [%d]",
-                    (int) field, (int) GxB_HYPER, (int) GxB_FORMAT))) ;
+                    "GxB_HYPER [%d], GxB_FORMAT [%d], "
+                    "GxB_SPARSITY_CONTROL [%d], GxB_BITMAP_SWITCH [%d],\n"
+                    "or GxB_CONCURRENT_INSERT [%d]",
+                    (int) field, (int) GxB_HYPER, (int) GxB_FORMAT,
+                    (int) GxB_SPARSITY_CONTROL, (int) GxB_BITMAP_SWITCH,
+                    (int) GxB_CONCURRENT_INSERT))) ;
 
     }
 
@@ -0,0 +1,52 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_deserialize: create a matrix from a serialized blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The blob is created by GxB_Matrix_serialize, and is not modified.  It may
+// come from a file or another process, so it is not trusted.  The new matrix
+// C owns all of its content, and the blob may be freed as soon as this
+// method returns.
+
+#include "GB_serialize.h"
+
+GrB_Info GxB_Matrix_deserialize     // deserialize a blob into a GrB_Matrix
+(
+    // output:
+    GrB_Matrix *C,                  // output matrix created from the blob
+    // input:
+    GrB_Type type,                  // type of the matrix, or NULL for built-in
+    const void *blob,               // the blob, not modified
+    GrB_Index blob_size,            // size of the blob in bytes
+    const GrB_Descriptor desc       // descriptor for # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_deserialize (&C, type, blob, blob_size, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_deserialize") ;
+    GB_RETURN_IF_NULL (C) ;
+    (*C) = NULL ;
+    GB_RETURN_IF_NULL (blob) ;
+    GB_RETURN_IF_FAULTY (type) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6) ;
+
+    //--------------------------------------------------------------------------
+    // deserialize the blob into a new matrix
+    //--------------------------------------------------------------------------
+
+    info = GB_deserialize (C, type, (const GB_void *) blob, (size_t) blob_size,
+        false, Context) ;
+    GB_BURBLE_END ;
+    return (info) ;
+}
+
@@ -0,0 +1,58 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_extractElements: extract a list of entries from a matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Extracts a list of n entries from a matrix, X(k) = A(I(k),J(k)) for
+// k = 0:n-1.  If A(I(k),J(k)) is present, Xb [k] is set to 1 and X(k) is set
+// to its value, typecasted to the type of X.  Otherwise, Xb [k] is set to 0
+// and X(k) is not modified.  If X and/or Xb are NULL, that component is not
+// extracted.
+
+#include "GB.h"
+
+#define GB_EXTRACT(prefix,type,T)                                             \
+GrB_Info prefix ## Matrix_extractElements_ ## T  /* X(k) = A(I(k),J(k)) */    \
+(                                                                             \
+    type *X,                /* array for returning values of entries     */   \
+    int8_t *Xb,             /* Xb [k] = 1 if A(I(k),J(k)) is present     */   \
+    const GrB_Index *I,     /* row indices of the entries to extract     */   \
+    const GrB_Index *J,     /* column indices of the entries to extract  */   \
+    GrB_Index n,            /* number of entries to extract              */   \
+    const GrB_Matrix A      /* matrix to extract entries from            */   \
+)                                                                             \
+{                                                                             \
+    GB_WHERE ("GxB_Matrix_extractElements_" GB_STR(T)                         \
+        " (X, Xb, I, J, n, A)") ;                                             \
+    GB_BURBLE_START ("GxB_Matrix_extractElements") ;                          \
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;                                         \
+    if (n > 0)                                                                \
+    {                                                                         \
+        GB_RETURN_IF_NULL (I) ;                                               \
+        GB_RETURN_IF_NULL (J) ;                                               \
+    }                                                                         \
+    GrB_Info info = GB_extractElements (X, Xb, I, J, n, GB_ ## T ## _code,    \
+        A, Context) ;                                                         \
+    GB_BURBLE_END ;                                                           \
+    return (info) ;                                                           \
+}
+
+GB_EXTRACT (GxB_, bool      , BOOL   )
+GB_EXTRACT (GxB_, int8_t    , INT8   )
+GB_EXTRACT (GxB_, uint8_t   , UINT8  )
+GB_EXTRACT (GxB_, int16_t   , INT16  )
+GB_EXTRACT (GxB_, uint16_t  , UINT16 )
+GB_EXTRACT (GxB_, int32_t   , INT32  )
+GB_EXTRACT (GxB_, uint32_t  , UINT32 )
+GB_EXTRACT (GxB_, int64_t   , INT64  )
+GB_EXTRACT (GxB_, uint64_t  , UINT64 )
+GB_EXTRACT (GxB_, float     , FP32   )
+GB_EXTRACT (GxB_, double    , FP64   )
+GB_EXTRACT (GxB_, GxB_FC32_t, FC32   )
+GB_EXTRACT (GxB_, GxB_FC64_t, FC64   )
+GB_EXTRACT (GxB_, void      , UDT    )
+
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_import_mmap: import a serialized matrix from a file, via mmap
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The file holds a blob created by GxB_Matrix_serialize.  It is mapped
+// privately into memory, and the uncompressed arrays of the new matrix A
+// become shallow pointers into the mapping, which is then owned by A (see
+// GB_mmap_free and GB_unshare).  The mapping is copy-on-write, so A can be
+// modified like any other matrix without changing the file.
+
+// If mmap is not available, the file is read into memory and deserialized.
+
+#include "GB_serialize.h"
+#if !GB_MICROSOFT
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+GrB_Info GxB_Matrix_import_mmap     // import a matrix from a file, via mmap
+(
+    // output:
+    GrB_Matrix *A,                  // handle of matrix to create
+    // input:
+    GrB_Type type,                  // type of A; may be NULL if built-in
+    const char *filename,           // file holding a serialized matrix
+    const GrB_Descriptor desc       // descriptor for # of threads to use
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_import_mmap (&A, type, filename, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_import_mmap") ;
+    GB_RETURN_IF_NULL (A) ;
+    (*A) = NULL ;
+    GB_RETURN_IF_NULL (filename) ;
+    GB_RETURN_IF_FAULTY (type) ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6) ;
+
+    #if !GB_MICROSOFT
+
+        //----------------------------------------------------------------------
+        // map the file into memory
+        //----------------------------------------------------------------------
+
+        int fd = open (filename, O_RDONLY) ;
+        if (fd < 0)
+        {
+            return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                "unable to open file [%s]", filename))) ;
+        }
+
+        struct stat st ;
+        if (fstat (fd, &st) != 0 || st.st_size < (off_t) GB_BLOB_HEADER)
+        {
+            close (fd) ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "file [%s] does not hold a serialized matrix", filename))) ;
+        }
+
+        // the mapping remains valid after the file is closed
+        size_t size = (size_t) st.st_size ;
+        void *base = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+            fd, 0) ;
+        close (fd) ;
+        if (base == MAP_FAILED)
+        {
+            return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                "unable to map file [%s]", filename))) ;
+        }
+
+        //----------------------------------------------------------------------
+        // create the matrix, with shallow components in the mapping
+        //----------------------------------------------------------------------
+
+        info = GB_deserialize (A, type, (const GB_void *) base, size, true,
+            Context) ;
+        if (info != GrB_SUCCESS)
+        {
+            // the file is invalid
+            munmap (base, size) ;
+            return (info) ;
+        }
+
+        GrB_Matrix C = (*A) ;
+        if (C->p_shallow || C->h_shallow || C->i_shallow || C->x_shallow)
+        {
+            // A refers to the file, and now owns the mapping
+            C->mmap_base = base ;
+            C->mmap_size = size ;
+            GBBURBLE ("(mapped " GBd " bytes) ", (int64_t) size) ;
+        }
+        else
+        {
+            // all of A has been copied from the file
+            munmap (base, size) ;
+        }
+
+    #else
+
+        //----------------------------------------------------------------------
+        // read the file into memory, and deserialize it
+        //----------------------------------------------------------------------
+
+        FILE *f = fopen (filename, "rb") ;
+        if (f == NULL)
+        {
+            return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                "unable to open file [%s]", filename))) ;
+        }
+
+        int64_t size = -1 ;
+        if (_fseeki64 (f, 0, SEEK_END) == 0)
+        {
+            size = _ftelli64 (f) ;
+        }
+        if (size < (int64_t) GB_BLOB_HEADER || _fseeki64 (f, 0, SEEK_SET) != 0)
+        {
+            fclose (f) ;
+            return (GB_ERROR (GrB_INVALID_OBJECT, (GB_LOG,
+                "file [%s] does not hold a serialized matrix", filename))) ;
+        }
+
+        GB_void *blob = GB_MALLOC (size, GB_void) ;
+        if (blob == NULL)
+        {
+            // out of memory
+            fclose (f) ;
+            return (GB_OUT_OF_MEMORY) ;
+        }
+
+        bool ok = (fread (blob, 1, size, f) == (size_t) size) ;
+        fclose (f) ;
+        if (!ok)
+        {
+            GB_FREE (blob) ;
+            return (GB_ERROR (GrB_INVALID_VALUE, (GB_LOG,
+                "unable to read file [%s]", filename))) ;
+        }
+
+        info = GB_deserialize (A, type, blob, (size_t) size, false, Context) ;
+        GB_FREE (blob) ;
+        if (info != GrB_SUCCESS)
+        {
+            // the file is invalid
+            return (info) ;
+        }
+
+    #endif
+
+    //--------------------------------------------------------------------------
+    // return result
+    //--------------------------------------------------------------------------
+
+    ASSERT_MATRIX_OK (*A, "A imported via mmap", GB0) ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+// GxB_Matrix_serialize: copy a matrix into a serialized blob
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The matrix A is serialized in its current format (sparse, hypersparse,
+// bitmap, or full), so no conversion is needed when it is deserialized.  Any
+// pending work is finished first.  See GB_serialize.h for the layout of the
+// blob.  A is not otherwise modified.
+
+#include "GB_serialize.h"
+
+#define GB_FREE_ALL                                 \
+{                                                   \
+    GB_FREE (blob) ;                                \
+    for (int k = 0 ; k < 5 ; k++)                   \
+    {                                               \
+        GB_serialize_array_free (&(Section [k])) ;  \
+    }                                               \
+}
+
+GrB_Info GxB_Matrix_serialize       // serialize a GrB_Matrix to a blob
+(
+    // output:
+    void **blob_handle,             // the blob, allocated on output
+    GrB_Index *blob_size_handle,    // size of the blob in bytes
+    // input:
+    GrB_Matrix A,                   // matrix to serialize
+    const GrB_Descriptor desc       // descriptor for compression and threads
+)
+{
+
+    //--------------------------------------------------------------------------
+    // check inputs
+    //--------------------------------------------------------------------------
+
+    GB_WHERE ("GxB_Matrix_serialize (&blob, &blob_size, A, desc)") ;
+    GB_BURBLE_START ("GxB_Matrix_serialize") ;
+    GB_RETURN_IF_NULL (blob_handle) ;
+    GB_RETURN_IF_NULL (blob_size_handle) ;
+    GB_RETURN_IF_NULL_OR_FAULTY (A) ;
+    ASSERT_MATRIX_OK (A, "A to serialize", GB0) ;
+    (*blob_handle) = NULL ;
+    (*blob_size_handle) = 0 ;
+
+    GB_blob_section Section [5] ;
+    memset (Section, 0, 5 * sizeof (GB_blob_section)) ;
+    GB_void *blob = NULL ;
+
+    // get the descriptor
+    GB_GET_DESCRIPTOR (info, desc, xx1, xx2, xx3, xx4, xx5, xx6) ;
+    GrB_Desc_Value method = (desc == NULL) ? GxB_DEFAULT : desc->compression ;
+
+    // finish any pending work
+    GB_MATRIX_WAIT (A) ;
+
+    //--------------------------------------------------------------------------
+    // get the content of A
+    //--------------------------------------------------------------------------
+
+    bool A_is_full = GB_IS_FULL (A) ;
+    bool A_is_bitmap = GB_IS_BITMAP (A) ;
+    bool A_is_sparse = !(A_is_full || A_is_bitmap) ;
+    bool A_is_hyper = A_is_sparse && A->is_hyper ;
+    int64_t avlen = A->vlen ;
+    int64_t avdim = A->vdim ;
+    int64_t anvec = A->nvec ;
+    size_t asize = A->type->size ;
+
+    // # of entries held in A->x
+    int64_t anz = A_is_sparse ? GB_NNZ (A) : (avlen * avdim) ;
+
+    if (A->nvec_nonempty < 0)
+    {
+        A->nvec_nonempty = GB_nvec_nonempty (A, Context) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // compress each array of A
+    //--------------------------------------------------------------------------
+
+    int nsections = 0 ;
+    if (A_is_sparse)
+    {
+        GB_OK (GB_serialize_array (&(Section [nsections++]),
+            (GB_void *) A->p, (anvec+1) * sizeof (int64_t), method, Context)) ;
+    }
+    if (A_is_hyper)
+    {
+        GB_OK (GB_serialize_array (&(Section [nsections++]),
+            (GB_void *) A->h, anvec * sizeof (int64_t), method, Context)) ;
+    }
+    if (A_is_bitmap)
+    {
+        GB_OK (GB_serialize_array (&(Section [nsections++]),
+            (GB_void *) A->b, anz * sizeof (int8_t), method, Context)) ;
+    }
+    if (A_is_sparse)
+    {
+        GB_OK (GB_serialize_array (&(Section [nsections++]),
+            (GB_void *) A->i, anz * sizeof (int64_t), method, Context)) ;
+    }
+    GB_OK (GB_serialize_array (&(Section [nsections++]),
+        (GB_void *) A->x, anz * asize, method, Context)) ;
+
+    //--------------------------------------------------------------------------
+    // allocate the blob
+    //--------------------------------------------------------------------------
+
+    size_t blob_size = GB_BLOB_HEADER ;
+    for (int k = 0 ; k < nsections ; k++)
+    {
+        blob_size += GB_serialize_array_size (&(Section [k])) ;
+    }
+
+    blob = GB_MALLOC (blob_size, GB_void) ;
+    if (blob == NULL)
+    {
+        // out of memory
+        GB_FREE_ALL ;
+        return (GB_OUT_OF_MEMORY) ;
+    }
+
+    //--------------------------------------------------------------------------
+    // write the header
+    //--------------------------------------------------------------------------
+
+    int64_t Header [20] ;
+    memset (Header, 0, 20 * sizeof (int64_t)) ;
+    Header [ 0] = GB_BLOB_MAGIC ;
+    Header [ 1] = GB_BLOB_VERSION ;
+    Header [ 2] = (int64_t) blob_size ;
+    Header [ 3] = avlen ;
+    Header [ 4] = avdim ;
+    Header [ 5] = anvec ;
+    Header [ 6] = A->nvec_nonempty ;
+    Header [ 7] = A_is_bitmap ? A->nvals : anz ;
+    Header [ 8] = A->type->code ;
+    Header [ 9] = (int64_t) asize ;
+    Header [10] = A_is_full ? GxB_FULL : (A_is_bitmap ? GxB_BITMAP : GxB_SPARSE);
+    Header [11] = A_is_hyper ;
+    Header [12] = A->is_csc ;
+    Header [13] = A->sparsity ;
+    Header [14] = (method == GxB_COMPRESSION_LZ4) ? GxB_COMPRESSION_LZ4
+                                                  : GxB_COMPRESSION_NONE ;
+    memcpy (&(Header [15]), &(A->hyper_ratio), sizeof (double)) ;
+    memcpy (&(Header [16]), &(A->bitmap_switch), sizeof (double)) ;
+    // Header [17..19] are reserved for future use
+
+    memcpy (blob, Header, GB_BLOB_HEADER) ;
+    size_t s = GB_BLOB_HEADER ;
+
+    //--------------------------------------------------------------------------
+    // write each section and free its workspace
+    //--------------------------------------------------------------------------
+
+    for (int k = 0 ; k < nsections ; k++)
+    {
+        GB_serialize_array_write (blob, &s, &(Section [k]), Context) ;
+        GB_serialize_array_free (&(Section [k])) ;
+    }
+    ASSERT (s == blob_size) ;
+
+    //--------------------------------------------------------------------------
+    // return the blob
+    //--------------------------------------------------------------------------
+
+    GBBURBLE ("(blob: " GBd " bytes) ", (int64_t) blob_size) ;
+    (*blob_handle) = (void *) blob ;
+    (*blob_size_handle) = (GrB_Index) blob_size ;
+    GB_BURBLE_END ;
+    return (GrB_SUCCESS) ;
+}
+
@@ -36,9 +36,10 @@ GrB_Info GxB_Vector_export  // export and free a vector
     GB_RETURN_IF_NULL_OR_FAULTY (*v) ;
     ASSERT_VECTOR_OK (*v, "v to export", GB0) ;
 
-    // finish any pending work
+    // finish any pending work, and convert a full vector to sparse
     GrB_Info info ;
     GB_VECTOR_WAIT (*v) ;
+    GB_ENSURE_SPARSE (*v) ;
 
     // check these after forcing completion
     GB_RETURN_IF_NULL (type) ;
@@ -0,0 +1,25 @@
+//------------------------------------------------------------------------------
+// GxB_Workspace_release: free all workspace in the workspace pool
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The workspace pool is emptied, but its maximum size (GxB_WORKSPACE_MAX) is
+// not changed, so workspace is again kept in the pool by later calls to
+// GraphBLAS.
+
+#include "GB.h"
+
+GrB_Info GxB_Workspace_release (void)   // free all workspace in the pool
+{ 
+    void *p ;
+    while ((p = GB_Global_workspace_pop ( )) != NULL)
+    { 
+        GB_free_memory (p) ;
+    }
+    return (GrB_SUCCESS) ;
+}
+
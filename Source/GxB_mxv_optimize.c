@@ -44,6 +44,7 @@ GrB_Info GxB_mxv_optimize           // analyze A for subsequent use in mxv
 
     // delete any lingering zombies and assemble any pending tuples
     GB_MATRIX_WAIT (A) ;
+    GB_ENSURE_SPARSE (A) ;
 
     //--------------------------------------------------------------------------
     // optimize the matrix for mkl_graph_mxv in MKL
@@ -71,18 +71,32 @@
             // get M(:,j)
             //------------------------------------------------------------------
 
-            // find vector j in M
-            int64_t pM, pM_end ;
-            int64_t mpleft = 0 ;
-            GB_lookup (M_is_hyper, Mh, Mp, &mpleft, mnvec-1, j, &pM, &pM_end) ;
+            // find vector j in M, unless M is bitmap or full
+            int64_t pM = 0, pM_end = 0 ;
+            bool M_j_is_dense = M_is_dense ;
+            if (M_is_dense)
+            { 
+                // M(:,j) is held in Mx [j*mvlen ... (j+1)*mvlen-1]
+                pM = j * mvlen ;
+            }
+            else
+            { 
+                int64_t mpleft = 0 ;
+                GB_lookup (M_is_hyper, Mh, Mp, &mpleft, mnvec-1, j,
+                    &pM, &pM_end) ;
+                // M is sparse or hypersparse, but if M(:,j) has all mvlen
+                // entries, then M(i,j) is held in Mi,Mx [pM+i]
+                M_j_is_dense = (pM_end - pM == mvlen) ;
+            }
 
             //------------------------------------------------------------------
             // C(:,j)<!M(:,j)> = A'*B(:,j)
             //------------------------------------------------------------------
 
-            // get the first and last index in B(:,j)
-            int64_t ib_first = Bi [pB_start] ;
-            int64_t ib_last  = Bi [pB_end-1] ;
+            // get the first and last index in B(:,j); if B is bitmap, its
+            // first and last entries are not known without a search
+            int64_t ib_first = (Bi != NULL) ? Bi [pB_start] : 0 ;
+            int64_t ib_last  = (Bi != NULL) ? Bi [pB_end-1] : (bvlen-1) ;
 
             // for each vector A(:,i):
             GBI_for_each_vector_with_iter (Iter_A, A)
@@ -90,14 +104,24 @@
                 GBI_jth_iteration_with_iter (Iter_A, i, pA, pA_end) ;
 
                 // A(:,i) and B(:,j) are both present.  Check M(i,j).
-                // FUTURE:: skip binary search if mask is dense.
                 bool mij = false ;
-                bool found ;
-                int64_t pright = pM_end - 1 ;
-                GB_BINARY_SEARCH (i, Mi, pM, pright, found) ;
-                if (found)
+                if (M_j_is_dense)
+                { 
+                    // M is bitmap or full, or M(:,j) is dense: M(i,j) is at
+                    // position pM + i, with no binary search
+                    int64_t pMij = pM + i ;
+                    mij = (Mb == NULL || Mb [pMij])
+                        && GB_mcast (Mx, pMij, msize) ;
+                }
+                else
                 {
-                    mij = GB_mcast (Mx, pM, msize) ;
+                    bool found ;
+                    int64_t pright = pM_end - 1 ;
+                    GB_BINARY_SEARCH (i, Mi, pM, pright, found) ;
+                    if (found)
+                    { 
+                        mij = GB_mcast (Mx, pM, msize) ;
+                    }
                 }
                 if (!mij)
                 { 
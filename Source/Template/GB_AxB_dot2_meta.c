@@ -21,6 +21,7 @@
     #endif
 
     const int64_t *GB_RESTRICT Bi = B->i ;
+    const int8_t  *GB_RESTRICT Bb = B->b ;
     int64_t bvlen = B->vlen ;
 
     // create the iterator for B.  Since the iterator is a read-only object
@@ -49,11 +50,15 @@
         const int64_t *GB_RESTRICT Mp = M->p ;
         const int64_t *GB_RESTRICT Mh = M->h ;
         const int64_t *GB_RESTRICT Mi = M->i ;
+        const int8_t  *GB_RESTRICT Mb = M->b ;
         const GB_void *GB_RESTRICT Mx ;
         Mx = (GB_void *) (Mask_struct ? NULL : (M->x)) ;
         size_t msize = M->type->size ;
         const int64_t mnvec = M->nvec ;
+        const int64_t mvlen = M->vlen ;
         bool M_is_hyper = GB_IS_HYPER (M) ;
+        // if M is bitmap or full, M(i,j) is found in O(1) time
+        bool M_is_dense = (Mp == NULL) ;
 
         // C<!M> = A'*B via dot products
         #include "GB_AxB_dot2_compmask.c"
@@ -58,7 +58,7 @@
             //------------------------------------------------------------------
 
             #if defined ( GB_PHASE_1_OF_2 )
-            if (bjnz == bvlen)
+            if (bjnz == bvlen && Bb == NULL)
             { 
                 // C(i,j) is if A(:i) not empty
                 C_count [Iter_k] = A->nvec_nonempty ;
@@ -84,9 +84,10 @@
             // C(:,j) = A'*B(:,j)
             //------------------------------------------------------------------
 
-            // get the first and last index in B(:,j)
-            int64_t ib_first = Bi [pB_start] ;
-            int64_t ib_last  = Bi [pB_end-1] ;
+            // get the first and last index in B(:,j); if B is bitmap, its
+            // first and last entries are not known without a search
+            int64_t ib_first = (Bi != NULL) ? Bi [pB_start] : 0 ;
+            int64_t ib_last  = (Bi != NULL) ? Bi [pB_end-1] : (bvlen-1) ;
 
             // for each vector A(:,i):
             GBI_for_each_vector_with_iter (Iter_A, A)
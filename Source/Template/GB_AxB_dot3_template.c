@@ -19,6 +19,7 @@
 
     const int64_t *GB_RESTRICT Cp = C->p ;
     const int64_t *GB_RESTRICT Ch = C->h ;
+    const int64_t cvlen = C->vlen ;
     int64_t  *GB_RESTRICT Ci = C->i ;
     GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
 
@@ -66,6 +67,42 @@
         int64_t task_nzombies = 0 ;
         int64_t bpleft = 0 ;
 
+        if (klast == -1)
+        {
+
+            //------------------------------------------------------------------
+            // ultra-fine task: compute a partial dot product for C(i,j)
+            //------------------------------------------------------------------
+
+            // This task computes A(k1:k2,i)'*B(k1:k2,j) for a single entry
+            // C(i,j), held in Ci,Cx [pM].  The partial result is held in the
+            // workspace Ci,Cx [pC], and is summed by GB_AxB_dot3 when all
+            // tasks are done.  If the partial result does not exist, Ci [pC]
+            // is flipped, but this is not a zombie in C.
+
+            int64_t pC = pC_first ;
+            int64_t pM = TaskList [taskid].pM ;
+            int64_t i = Mi [pM] ;
+            int64_t pA     = TaskList [taskid].pA ;
+            int64_t pA_end = TaskList [taskid].pA_end ;
+            int64_t pB_start = TaskList [taskid].pB ;
+            int64_t pB_end   = TaskList [taskid].pB_end ;
+            int64_t bjnz = pB_end - pB_start ;
+            if (bjnz == 0 || !GB_mcast (Mx, pM, msize))
+            { 
+                // the partial result does not exist
+                Ci [pC] = GB_FLIP (i) ;
+            }
+            else
+            { 
+                // cij = A(k1:k2,i)'*B(k1:k2,j)
+                int64_t ib_first = Bi [pB_start] ;
+                int64_t ib_last  = Bi [pB_end-1] ;
+                #include "GB_AxB_dot_cij.c"
+            }
+            continue ;
+        }
+
         //----------------------------------------------------------------------
         // compute all vectors in this task
         //----------------------------------------------------------------------
@@ -136,6 +173,17 @@
                 int64_t ib_last  = Bi [pB_end-1] ;
                 int64_t apleft = 0 ;
 
+                // If M(:,j) is dense, the indices i in this task are
+                // contiguous, so if A is hypersparse, each A(:,i) is found by
+                // stepping through Ah, instead of a binary search for each i.
+                bool M_j_is_dense = (Cp [k+1] - Cp [k] == cvlen) ;
+                if (A_is_hyper && M_j_is_dense && pC_start < pC_end)
+                { 
+                    // start the scan of Ah at the first row in this task
+                    int64_t apright = anvec - 1 ;
+                    GB_TRIM_BINARY_SEARCH (Mi [pC_start], Ah, apleft, apright) ;
+                }
+
                 for (int64_t pC = pC_start ; pC < pC_end ; pC++)
                 {
 
@@ -154,8 +202,22 @@
 
                         // get A(:,i), if it exists
                         int64_t pA, pA_end ;
-                        GB_lookup (A_is_hyper, Ah, Ap, &apleft, anvec-1, i,
-                            &pA, &pA_end) ;
+                        if (A_is_hyper && M_j_is_dense)
+                        {
+                            // step through Ah to find A(:,i)
+                            while (apleft < anvec && Ah [apleft] < i)
+                            { 
+                                apleft++ ;
+                            }
+                            bool found = (apleft < anvec && Ah [apleft] == i) ;
+                            pA     = found ? Ap [apleft  ] : -1 ;
+                            pA_end = found ? Ap [apleft+1] : -1 ;
+                        }
+                        else
+                        { 
+                            GB_lookup (A_is_hyper, Ah, Ap, &apleft, anvec-1, i,
+                                &pA, &pA_end) ;
+                        }
 
                         // C(i,j) = A(:,i)'*B(:,j)
                         #include "GB_AxB_dot_cij.c"
@@ -9,7 +9,8 @@
 
 // C+=A'*B where C is a dense matrix and computed in-place.  The monoid of the
 // semiring matches the accum operator, and the type of C matches the ztype of
-// accum.  That is, no typecasting can be done with C.
+// accum.  That is, no typecasting can be done with C.  A and B may be sparse,
+// hypersparse, or full.
 
 // The PAIR operator as the multiplier provides important special cases.
 // See Template/GB_AxB_dot_cij.c for details.
@@ -50,6 +51,7 @@
     const int64_t  *GB_RESTRICT Ah = A->h ;
     const int64_t  *GB_RESTRICT Ai = A->i ;
     const GB_ATYPE *GB_RESTRICT Ax = (GB_ATYPE *) (A_is_pattern ? NULL : A->x) ;
+    const int64_t avlen = A->vlen ;
     ASSERT (A->vlen == B->vlen) ;
 
     int ntasks = naslice * nbslice ;
@@ -91,8 +93,8 @@
             //------------------------------------------------------------------
 
             int64_t j = (Bh == NULL) ? bk : Bh [bk] ;
-            int64_t pB_start = Bp [bk] ;
-            int64_t pB_end   = Bp [bk+1] ;
+            int64_t pB_start = GBP (Bp, bk, bvlen) ;
+            int64_t pB_end   = GBP (Bp, bk+1, bvlen) ;
             int64_t pC_start = j * cvlen ;
             int64_t bjnz = pB_end - pB_start ;
             if (bjnz == 0) continue ;
@@ -112,8 +114,8 @@
                     //----------------------------------------------------------
 
                     int64_t i = (Ah == NULL) ? ak : Ah [ak] ;
-                    int64_t pA     = Ap [ak] ;
-                    int64_t pA_end = Ap [ak+1] ;
+                    int64_t pA     = GBP (Ap, ak, avlen) ;
+                    int64_t pA_end = GBP (Ap, ak+1, avlen) ;
                     int64_t ainz = pA_end - pA ;
                     if (ainz == 0) continue ;
 
@@ -223,12 +225,13 @@
                     //----------------------------------------------------------
 
                     int64_t i = (Ah == NULL) ? ak : Ah [ak] ;
-                    int64_t pA     = Ap [ak] ;
-                    int64_t pA_end = Ap [ak+1] ;
+                    int64_t pA     = GBP (Ap, ak, avlen) ;
+                    int64_t pA_end = GBP (Ap, ak+1, avlen) ;
                     int64_t ainz = pA_end - pA ;
                     if (ainz == 0) continue ;
                     // get the first and last index in A(:,i)
-                    if (Ai [pA_end-1] < ib_first || ib_last < Ai [pA]) continue;
+                    if (GBI (Ai, pA_end-1, avlen) < ib_first ||
+                        ib_last < GBI (Ai, pA, avlen)) continue ;
 
                     //----------------------------------------------------------
                     // C(i,j) += A(:,i)'*B(:,j)
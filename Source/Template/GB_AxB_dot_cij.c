@@ -36,6 +36,11 @@
 // found, so these optimizations can be used only if A(:,i) and/or B(:,j) are
 // fully populated.
 
+// For dot2 only, B can be bitmap (Bb is not NULL).  In this case, B(:,j) is
+// held in the range pB_start to pB_end-1 of length bvlen, with B(k,j) present
+// if Bb [pB_start+k] is nonzero.  Each entry A(k,i) is then checked against
+// B(k,j) in O(1) time.
+
 // For built-in, pre-generated semirings, the PAIR operator is only coupled
 // with either the ANY, PLUS, EQ, or XOR monoids, since the other monoids are
 // equivalent to the ANY monoid.  With no accumulator, EQ_PAIR is the same as
@@ -154,6 +159,27 @@
         ;
 
     }
+    #if !defined ( GB_DOT3 )
+    else if (Bb != NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // B(:,j) is bitmap: look up B(k,j) for each entry A(k,i)
+        //----------------------------------------------------------------------
+
+        for ( ; pA < pA_end ; pA++)
+        {
+            int64_t k = Ai [pA] ;
+            pB = pB_start + k ;
+            if (Bb [pB])
+            { 
+                // A(k,i) and B(k,j) are both present
+                GB_DOT (0,0) ;
+            }
+        }
+
+    }
+    #endif
     else if (Ai [pA_end-1] < ib_first || ib_last < Ai [pA])
     { 
 
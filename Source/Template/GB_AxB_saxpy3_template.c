@@ -48,6 +48,7 @@
     const int64_t *GB_RESTRICT Ai = A->i ;
     const int64_t anvec = A->nvec ;
     const bool A_is_hyper = GB_IS_HYPER (A) ;
+    const bool A_jumbled = A->jumbled ;
     const GB_ATYPE *GB_RESTRICT Ax = (GB_ATYPE *) (A_is_pattern ? NULL : A->x) ;
 
     const int64_t *GB_RESTRICT Mp = NULL ;
@@ -98,6 +99,11 @@
         int64_t pB     = TaskList [taskid].start ;
         int64_t pB_end = TaskList [taskid].end + 1 ;
         int64_t pleft = 0, pright = anvec-1 ;
+        // the first and last B(k,j) may be shared with other fine tasks
+        const int64_t pB_first = pB ;
+        const int64_t pB_last  = pB_end - 1 ;
+        const int64_t afirst = TaskList [taskid].afirst ;
+        const int64_t alast  = TaskList [taskid].alast ;
 
         #if !GB_IS_ANY_PAIR_SEMIRING
         GB_CTYPE *GB_RESTRICT Hx = (GB_CTYPE *) TaskList [taskid].Hx ;
@@ -153,7 +159,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     int64_t k = Bi [pB] ;       // get B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -227,7 +233,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 { 
                     int64_t k = Bi [pB] ;       // get B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     GB_SKIP_IF_A_k_DISJOINT_WITH_M_j ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
 
@@ -302,7 +308,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     int64_t k = Bi [pB] ;       // get B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -413,7 +419,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     int64_t k = Bi [pB] ;       // get B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -499,7 +505,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 { 
                     int64_t k = Bi [pB] ;       // get B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     GB_SKIP_IF_A_k_DISJOINT_WITH_M_j ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     #define GB_IKJ                                             \
@@ -575,7 +581,7 @@
                 for ( ; pB < pB_end ; pB++)     // scan B(:,j)
                 {
                     int64_t k = Bi [pB] ;       // get B(k,j)
-                    GB_GET_A_k ;                // get A(:,k)
+                    GB_GET_A_k_FINE ;           // get A(:,k)
                     if (aknz == 0) continue ;
                     GB_GET_B_kj ;               // bkj = B(k,j)
                     // scan A(:,k)
@@ -797,7 +803,88 @@
             int64_t nk = klast - kfirst + 1 ;
             int64_t mark = 2*nk + 1 ;
 
-            if (use_Gustavson)
+            if (TaskList [taskid].use_heap)
+            {
+
+                //--------------------------------------------------------------
+                // phase5: coarse heap task
+                //--------------------------------------------------------------
+
+                // The entries of each C(:,j) are found in sorted order.
+
+                GB_Element *GB_RESTRICT Heap = TaskList [taskid].Heap ;
+                int64_t *GB_RESTRICT Hpos = TaskList [taskid].Hi ;
+                int64_t *GB_RESTRICT Hpos_end = Hpos + hash_size ;
+
+                if (M == NULL)
+                {
+
+                    //----------------------------------------------------------
+                    // phase5: coarse heap task, C=A*B
+                    //----------------------------------------------------------
+
+                    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+                    {
+                        int64_t pC = Cp [kk] ;
+                        int64_t cjnz = Cp [kk+1] - pC ;
+                        if (cjnz == 0) continue ;   // nothing to do
+                        GB_GET_B_j ;                // get B(:,j)
+                        if (bjnz == 1)              // C(:,j) = A(:,k)*B(k,j)
+                        { 
+                            GB_COMPUTE_C_j_WHEN_NNZ_B_j_IS_ONE ;
+                            continue ;
+                        }
+                        const int64_t pB_start = pB ;
+                        int64_t ilast = -1 ;
+                        #define GB_HEAP_IKJ                                    \
+                        {                                                      \
+                            GB_HEAP_CIJ_UPDATE ;                               \
+                        }
+                        GB_HEAP_MERGE_j ;
+                        #undef GB_HEAP_IKJ
+                        ASSERT (pC == Cp [kk+1]) ;
+                    }
+
+                }
+                else
+                {
+
+                    //----------------------------------------------------------
+                    // phase5: coarse heap task, C<M>=A*B or C<!M>=A*B
+                    //----------------------------------------------------------
+
+                    for (int64_t kk = kfirst ; kk <= klast ; kk++)
+                    {
+                        int64_t pC = Cp [kk] ;
+                        int64_t cjnz = Cp [kk+1] - pC ;
+                        if (cjnz == 0) continue ;   // nothing to do
+                        GB_GET_M_j ;                // get M(:,j)
+                        GB_GET_B_j ;                // get B(:,j)
+                        const int64_t pB_start = pB ;
+                        int64_t pM = pM_start ;
+                        int64_t ilast = -1, imask = -1 ;
+                        bool keep = false ;
+                        #define GB_HEAP_IKJ                                    \
+                        {                                                      \
+                            if (i != imask)                                    \
+                            {                                                  \
+                                imask = i ;                                    \
+                                GB_HEAP_GET_M_ij (i) ;      /* get M(i,j) */   \
+                                keep = (mij == mask_is_M) ;                    \
+                            }                                                  \
+                            if (keep)                                          \
+                            {                                                  \
+                                GB_HEAP_CIJ_UPDATE ;                           \
+                            }                                                  \
+                        }
+                        GB_HEAP_MERGE_j ;
+                        #undef GB_HEAP_IKJ
+                        ASSERT (pC == Cp [kk+1]) ;
+                    }
+                }
+
+            }
+            else if (use_Gustavson)
             {
 
                 //--------------------------------------------------------------
@@ -881,7 +968,7 @@
                                     }
                                 }
                             }
-                            GB_SORT_AND_GATHER_C_j ;    // gather into C(:,j)
+                            GB_GATHER_C_j ;             // gather into C(:,j)
                         }
                     }
 
@@ -975,7 +1062,7 @@
                                 GB_SCAN_M_j_OR_A_k ;
                                 #undef GB_IKJ
                             }
-                            GB_SORT_AND_GATHER_C_j ;    // gather into C(:,j)
+                            GB_GATHER_C_j ;             // gather into C(:,j)
                         }
                     }
 
@@ -1067,7 +1154,7 @@
                                     }
                                 }
                             }
-                            GB_SORT_AND_GATHER_C_j ;    // gather into C(:,j)
+                            GB_GATHER_C_j ;             // gather into C(:,j)
                         }
                     }
                 }
@@ -1145,7 +1232,7 @@
                             }
                         }
                         // found i if: Hf [hash] == mark and Hi [hash] == i
-                        GB_SORT_AND_GATHER_HASHED_C_j (mark, Hi [hash] == i)
+                        GB_GATHER_HASHED_C_j (mark, Hi [hash] == i)
                     }
 
                 }
@@ -1209,7 +1296,7 @@
                             #undef GB_IKJ
                         }
                         // found i if: Hf [hash] == mark1 and Hi [hash] == i
-                        GB_SORT_AND_GATHER_HASHED_C_j (mark1, Hi [hash] == i) ;
+                        GB_GATHER_HASHED_C_j (mark1, Hi [hash] == i) ;
                     }
 
                 }
@@ -1274,7 +1361,7 @@
                             }
                         }
                         // found i if: Hf [hash] == mark1 and Hi [hash] == i
-                        GB_SORT_AND_GATHER_HASHED_C_j (mark1, Hi [hash] == i) ;
+                        GB_GATHER_HASHED_C_j (mark1, Hi [hash] == i) ;
                     }
                 }
             }
@@ -1285,22 +1372,9 @@
     // phase6: final gather phase for fine hash tasks
     //==========================================================================
 
+    #if !GB_IS_ANY_PAIR_SEMIRING
     if (cjnz_max > 0)
     {
-        int64_t *GB_RESTRICT W = NULL ;
-        int nthreads_msort = GB_MSORT_NTHREADS (nthreads) ;
-        if (cjnz_max <= GB_BASECASE) nthreads_msort = 1 ;
-        if (nthreads_msort > 1)
-        {
-            // allocate workspace for parallel mergesort
-            W = GB_MALLOC (cjnz_max, int64_t) ;
-            if (W == NULL)
-            { 
-                // out of memory
-                return (GrB_OUT_OF_MEMORY) ;
-            }
-        }
-
         for (taskid = 0 ; taskid < nfine ; taskid++)
         {
             int64_t hash_size = TaskList [taskid].hsize ;
@@ -1321,40 +1395,32 @@
                     Hf = (int64_t  *GB_RESTRICT) TaskList [taskid].Hf ;
                 int64_t cjnz = Cp [kk+1] - Cp [kk] ;
 
-                // sort the pattern of C(:,j)
-                int nth = GB_nthreads (cjnz, chunk, nthreads_msort) ;
-                GB_msort_1 (Ci + Cp [kk], W, cjnz, nth) ;
+                // The pattern of C(:,j) is left unsorted; C is jumbled
+                int nth = GB_nthreads (cjnz, chunk, nthreads) ;
 
-                #if !GB_IS_ANY_PAIR_SEMIRING
-
-                    GB_CTYPE *GB_RESTRICT Hx =
-                        (GB_CTYPE *) TaskList [taskid].Hx ;
-                    // gather the values of C(:,j)
-                    int64_t pC ;
-                    #pragma omp parallel for num_threads(nth) schedule(static)
-                    for (pC = Cp [kk] ; pC < Cp [kk+1] ; pC++)
+                GB_CTYPE *GB_RESTRICT Hx = (GB_CTYPE *) TaskList [taskid].Hx ;
+                // gather the values of C(:,j)
+                int64_t pC ;
+                #pragma omp parallel for num_threads(nth) schedule(static)
+                for (pC = Cp [kk] ; pC < Cp [kk+1] ; pC++)
+                {
+                    int64_t i = Ci [pC] ;   // get C(i,j)
+                    int64_t i1 = i + 1 ;
+                    for (GB_HASH (i))       // find i in hash table
                     {
-                        int64_t i = Ci [pC] ;   // get C(i,j)
-                        int64_t i1 = i + 1 ;
-                        for (GB_HASH (i))       // find i in hash table
-                        {
-                            int64_t hf = Hf [hash] ;
-                            if ((hf & 3) == 2 && (hf >> 2) == i1)
-                            { 
-                                // found i in the hash table
-                                GB_CIJ_GATHER (pC, hash) ; // Cx[pC] = Hx[hash]
-                                break ;
-                            }
+                        int64_t hf = Hf [hash] ;
+                        if ((hf & 3) == 2 && (hf >> 2) == i1)
+                        { 
+                            // found i in the hash table
+                            GB_CIJ_GATHER (pC, hash) ; // Cx[pC] = Hx[hash]
+                            break ;
                         }
                     }
-
-                #endif
+                }
             }
         }
-
-        // free workspace
-        GB_FREE (W) ;
     }
+    #endif
 }
 
 #undef Cx
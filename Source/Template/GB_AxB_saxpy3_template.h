@@ -16,15 +16,27 @@
 // GB_GET_M_j: prepare to iterate over M(:,j)
 //------------------------------------------------------------------------------
 
-// prepare to iterate over the vector M(:,j), for the (kk)th vector of B
-// FUTURE::: lookup all M(:,j) for all vectors in B, in a single pass,
-// and save the mapping (like C_to_M mapping in GB_ewise_slice)
-#define GB_GET_M_j                                              \
-    int64_t mpleft = 0 ;                                        \
-    int64_t mpright = mnvec-1 ;                                 \
-    int64_t pM_start, pM_end ;                                  \
-    GB_lookup (M_is_hyper, Mh, Mp, &mpleft, mpright,            \
-        ((Bh == NULL) ? kk : Bh [kk]), &pM_start, &pM_end) ;    \
+// prepare to iterate over the vector M(:,j), for the (kk)th vector of B.
+// If M is hypersparse, all M(:,j) have already been found for all vectors in
+// B, in a single pass, and the mapping is in B_to_M (like the C_to_M mapping
+// in GB_ewise_slice), so no binary search of M->h is needed here.
+#define GB_GET_M_j                                                         \
+    int64_t pM_start, pM_end ;                                             \
+    const int64_t *GB_RESTRICT B_to_M = TaskList [taskid].B_to_M ;         \
+    if (B_to_M != NULL)                                                    \
+    {                                                                      \
+        /* M(:,j) is the (kM)th vector of M, or empty if kM < 0 */         \
+        int64_t kM = B_to_M [kk] ;                                         \
+        pM_start = (kM < 0) ? 0 : Mp [kM] ;                                \
+        pM_end   = (kM < 0) ? 0 : Mp [kM+1] ;                              \
+    }                                                                      \
+    else                                                                   \
+    {                                                                      \
+        int64_t mpleft = 0 ;                                               \
+        int64_t mpright = mnvec-1 ;                                        \
+        GB_lookup (M_is_hyper, Mh, Mp, &mpleft, mpright,                   \
+            ((Bh == NULL) ? kk : Bh [kk]), &pM_start, &pM_end) ;           \
+    }                                                                      \
     int64_t mjnz = pM_end - pM_start ;    /* nnz (M (:,j)) */
 
 //------------------------------------------------------------------------------
@@ -112,7 +124,6 @@ break ;
     int64_t pB = Bp [kk] ;                                                  \
     int64_t pB_end = Bp [kk+1] ;                                            \
     int64_t bjnz = pB_end - pB ;  /* nnz (B (:,j) */                        \
-    /* FUTURE::: can skip if mjnz == 0 for C<M>=A*B tasks */                \
     if (A_is_hyper && bjnz > 2)                                             \
     {                                                                       \
         /* trim Ah [0..pright] to remove any entries past last B(:,j), */   \
@@ -136,6 +147,20 @@ break ;
     GB_lookup (A_is_hyper, Ah, Ap, &pleft, pright, k, &pA_start, &pA_end) ; \
     int64_t aknz = pA_end - pA_start ;    /* nnz (A (:,k)) */
 
+//------------------------------------------------------------------------------
+// GB_GET_A_k_FINE: get A(:,k), or the part of it used by an ultra-fine task
+//------------------------------------------------------------------------------
+
+// The first and last entries B(k,j) of a fine task may share A(:,k)*B(k,j)
+// with other fine tasks.  In that case, A(:,k) is trimmed to the contiguous
+// part of A(:,k) for this task, A(i1:i2,k).
+
+#define GB_GET_A_k_FINE                                                     \
+    GB_GET_A_k ;                                                            \
+    if (pB == pB_last && alast >= 0) pA_end = pA_start + alast ;            \
+    if (pB == pB_first) pA_start += afirst ;                                \
+    aknz = pA_end - pA_start ;    /* nnz (A (i1:i2,k)) */
+
 //------------------------------------------------------------------------------
 // GB_SKIP_IF_A_k_DISJOINT_WITH_M_j:  skip if A(:,k) and M(:,j) are disjoint
 //------------------------------------------------------------------------------
@@ -205,13 +230,27 @@ break ;
             GB_GET_A_k ;                /* get A(:,k) */            \
             if (aknz == 0) continue ;                               \
             GB_GET_B_kj ;               /* bkj = B(k,j) */          \
-            /* FUTURE::: handle the case when A(:,k) is dense */    \
-            /* scan A(:,k) */                                       \
-            for (int64_t pA = pA_start ; pA < pA_end ; pA++)        \
+            if (aknz == cvlen && !A_jumbled)                        \
+            {                                                       \
+                /* A(:,k) is dense: C(:,j) += A(:,k)*B(k,j), with */\
+                /* i = pA - pA_start, so Ai is not accessed */      \
+                GB_PRAGMA_SIMD                                      \
+                for (int64_t i = 0 ; i < cvlen ; i++)               \
+                {                                                   \
+                    int64_t pA = pA_start + i ;                     \
+                    GB_MULT_A_ik_B_kj ;      /* t = A(i,k)*B(k,j) */\
+                    GB_CIJ_UPDATE (pC + i, t) ; /* Cx [pC+i]+=t */  \
+                }                                                   \
+            }                                                       \
+            else                                                    \
             {                                                       \
-                int64_t i = Ai [pA] ;    /* get A(i,k) */           \
-                GB_MULT_A_ik_B_kj ;      /* t = A(i,k)*B(k,j) */    \
-                GB_CIJ_UPDATE (pC + i, t) ; /* Cx [pC+i]+=t */      \
+                /* scan A(:,k) */                                   \
+                for (int64_t pA = pA_start ; pA < pA_end ; pA++)    \
+                {                                                   \
+                    int64_t i = Ai [pA] ;    /* get A(i,k) */       \
+                    GB_MULT_A_ik_B_kj ;      /* t = A(i,k)*B(k,j) */\
+                    GB_CIJ_UPDATE (pC + i, t) ; /* Cx [pC+i]+=t */  \
+                }                                                   \
             }                                                       \
         }
 
@@ -281,23 +320,20 @@ break ;
 #endif
 
 //------------------------------------------------------------------------------
-// GB_SORT_AND_GATHER_C_j: sort the pattern of C(:,j) and gather values
+// GB_GATHER_C_j: gather the values of C(:,j)
 //------------------------------------------------------------------------------
 
-// sort the pattern of C(:,j) then gather the values for a coarse Gustavson task
+// gather the values of C(:,j) for a coarse Gustavson task.  The pattern of
+// C(:,j) is left unsorted, and C is returned as jumbled.
 #if GB_IS_ANY_PAIR_SEMIRING
 
-    // ANY_PAIR: result is purely symbolic; just sort the pattern
-    #define GB_SORT_AND_GATHER_C_j                              \
-        /* sort the pattern of C(:,j) */                        \
-        GB_qsort_1a (Ci + Cp [kk], cjnz) ;
+    // ANY_PAIR: result is purely symbolic; no values to gather
+    #define GB_GATHER_C_j
 
 #else
 
     // typical semiring
-    #define GB_SORT_AND_GATHER_C_j                              \
-        /* sort the pattern of C(:,j) */                        \
-        GB_qsort_1a (Ci + Cp [kk], cjnz) ;                      \
+    #define GB_GATHER_C_j                                       \
         /* gather the values into C(:,j) */                     \
         for (int64_t pC = Cp [kk] ; pC < Cp [kk+1] ; pC++)      \
         {                                                       \
@@ -308,22 +344,19 @@ break ;
 #endif
 
 //------------------------------------------------------------------------------
-// GB_SORT_AND_GATHER_HASHED_C_j: sort pattern, gather values, for coarse hash 
+// GB_GATHER_HASHED_C_j: gather values for coarse hash
 //------------------------------------------------------------------------------
 
 #if GB_IS_ANY_PAIR_SEMIRING
 
-    // ANY_PAIR: result is purely symbolic; just sort the pattern
-    #define GB_SORT_AND_GATHER_HASHED_C_j(hash_mark,Hi_hash_equals_i)       \
-        /* sort the pattern of C(:,j) */                                    \
-        GB_qsort_1a (Ci + Cp [kk], cjnz) ;
+    // ANY_PAIR: result is purely symbolic; no values to gather
+    #define GB_GATHER_HASHED_C_j(hash_mark,Hi_hash_equals_i)
 
 #else
 
-    // sort the pattern of C(:,j) then gather the values for a coarse hash task
-    #define GB_SORT_AND_GATHER_HASHED_C_j(hash_mark,Hi_hash_equals_i)       \
-        /* sort the pattern of C(:,j) */                                    \
-        GB_qsort_1a (Ci + Cp [kk], cjnz) ;                                  \
+    // gather the values of C(:,j) for a coarse hash task; the pattern of
+    // C(:,j) is left unsorted
+    #define GB_GATHER_HASHED_C_j(hash_mark,Hi_hash_equals_i)                \
         for (int64_t pC = Cp [kk] ; pC < Cp [kk+1] ; pC++)                  \
         {                                                                   \
             int64_t i = Ci [pC] ;                                           \
@@ -346,10 +379,22 @@ break ;
 // GB_SCAN_M_j_OR_A_k: compute C(:,j) using linear scan or binary search
 //------------------------------------------------------------------------------
 
-// C(:,j)<M(:,j)>=A(:,k)*B(k,j) using one of two methods
+// C(:,j)<M(:,j)>=A(:,k)*B(k,j) using one of three methods
 #define GB_SCAN_M_j_OR_A_k                                              \
 {                                                                       \
-    if (aknz > 256 && mjnz_much < aknz)                                 \
+    if (aknz == cvlen && mjnz < aknz)                                   \
+    {                                                                   \
+        /* A(:,k) is dense: scan M(:,j), and A(i,k) is Ax [pA_start+i] */ \
+        for (int64_t pM = pM_start ; pM < pM_end ; pM++)                \
+        {                                                               \
+            GB_GET_M_ij ;           /* get M(i,j) */                    \
+            if (!mij) continue ;    /* skip if M(i,j)=0 */              \
+            int64_t i = Mi [pM] ;                                       \
+            int64_t pA = pA_start + i ;                                 \
+            GB_IKJ ;                                                    \
+        }                                                               \
+    }                                                                   \
+    else if (aknz > 256 && mjnz_much < aknz)                            \
     /* nnz(M(:,j)) much less than nnz(A(:,k)) */                        \
     {                                                                   \
         /* scan M(:,j), and do binary search for A(i,k) */              \
@@ -389,6 +434,101 @@ break ;
     }                                                                   \
 }
 
+//------------------------------------------------------------------------------
+// GB_HEAP_MERGE_j: merge the vectors A(:,k) for each B(k,j), for coarse heap
+//------------------------------------------------------------------------------
+
+// The heap holds one element for each nonempty A(:,k) where B(k,j) is
+// present.  The key of each element is the row index i of the next entry
+// A(i,k) to merge, and its name s is the position of B(k,j) in B(:,j).
+// GB_HEAP_IKJ is done for each entry A(i,k) in increasing order of i, where
+// pA is the position of A(i,k).  Hpos [s] is the position of the next entry
+// in A(:,k), and Hpos_end [s] is the end of A(:,k).
+
+#define GB_HEAP_MERGE_j                                                 \
+{                                                                       \
+    /* construct the heap for B(:,j) */                                 \
+    int64_t nheap = 0 ;                                                 \
+    for (int64_t s = 0 ; s < bjnz ; s++)                                \
+    {                                                                   \
+        int64_t k = Bi [pB + s] ;       /* get B(k,j) */                \
+        GB_GET_A_k ;                    /* get A(:,k) */                \
+        if (aknz == 0) continue ;                                       \
+        Hpos [s] = pA_start ;                                           \
+        Hpos_end [s] = pA_end ;                                         \
+        nheap++ ;                                                       \
+        Heap [nheap].key  = Ai [pA_start] ;                             \
+        Heap [nheap].name = s ;                                         \
+    }                                                                   \
+    GB_heap_build (Heap, nheap) ;                                       \
+    /* merge all of A(:,k), in order of the row indices */              \
+    while (nheap > 0)                                                   \
+    {                                                                   \
+        int64_t i = Heap [1].key ;      /* get A(i,k) */                \
+        int64_t s = Heap [1].name ;                                     \
+        int64_t pA = Hpos [s] ;                                         \
+        GB_HEAP_IKJ ;                                                   \
+        /* advance to the next entry in A(:,k), if any */               \
+        if (++(Hpos [s]) < Hpos_end [s])                                \
+        {                                                               \
+            Heap [1].key = Ai [Hpos [s]] ;                              \
+            GB_heapify (1, Heap, nheap) ;                               \
+        }                                                               \
+        else                                                            \
+        {                                                               \
+            GB_heap_delete (1, Heap, &nheap) ;                          \
+        }                                                               \
+    }                                                                   \
+}
+
+//------------------------------------------------------------------------------
+// GB_HEAP_GET_M_ij: get M(i,j) for a coarse heap task
+//------------------------------------------------------------------------------
+
+// The row indices i are visited in increasing order by GB_HEAP_MERGE_j, so
+// M(:,j) is scanned just once, and pM never moves backwards.
+#define GB_HEAP_GET_M_ij(i)                                             \
+    while (pM < pM_end && Mi [pM] < i) pM++ ;                           \
+    bool mij = (pM < pM_end && Mi [pM] == i) && GB_mcast (Mx, pM, msize)
+
+//------------------------------------------------------------------------------
+// GB_HEAP_CIJ_UPDATE: C(i,j) += A(i,k)*B(k,j) for a coarse heap task
+//------------------------------------------------------------------------------
+
+// The entries of C(:,j) are found in order, so C(i,j) is a new entry if i
+// differs from ilast, the last row index appended to C(:,j).
+#if GB_IS_ANY_PAIR_SEMIRING
+
+    // ANY_PAIR: result is purely symbolic; no numeric work to do
+    #define GB_HEAP_CIJ_UPDATE                                      \
+        if (i != ilast)                                             \
+        {                                                           \
+            ilast = i ;                                             \
+            Ci [pC++] = i ;                                         \
+        }
+
+#else
+
+    // typical semiring
+    #define GB_HEAP_CIJ_UPDATE                                      \
+        int64_t pB = pB_start + s ;     /* get B(k,j) */            \
+        GB_GET_B_kj ;                   /* bkj = B(k,j) */          \
+        GB_MULT_A_ik_B_kj ;             /* t = A(i,k)*B(k,j) */     \
+        if (i != ilast)                                             \
+        {                                                           \
+            /* C(i,j) = A(i,k) * B(k,j) */                          \
+            ilast = i ;                                             \
+            GB_CIJ_WRITE (pC, t) ;      /* Cx [pC] = t */           \
+            Ci [pC++] = i ;                                         \
+        }                                                           \
+        else                                                        \
+        {                                                           \
+            /* C(i,j) += A(i,k) * B(k,j) */                         \
+            GB_CIJ_UPDATE (pC-1, t) ;   /* Cx [pC-1] += t */        \
+        }
+
+#endif
+
 //------------------------------------------------------------------------------
 // GB_ATOMIC_UPDATE_HX:  Hx [i] += t
 //------------------------------------------------------------------------------
@@ -16,7 +16,10 @@
 // This template constructs GrB_Matrix_extractElement_[TYPE] for each of the
 // 13 built-in types, and the _UDT method for all user-defined types.
 
-// FUTURE: tolerate zombies
+// Zombies are tolerated: they are skipped by the binary search, so a lookup
+// after GrB_*_removeElement does not force the matrix to be finalized.  Any
+// pending tuples must still be assembled first, since the value of an entry
+// may depend on several pending tuples and on the dup operator.
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
 (
@@ -34,8 +37,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     GB_CONTEXT_RETURN_IF_NULL (A) ;
     GB_CONTEXT_RETURN_IF_FAULTY (A) ;
 
-    // delete any lingering zombies and assemble any pending tuples
-    if (GB_PENDING_OR_ZOMBIES (A))
+    // assemble any pending tuples, and sort any jumbled vectors, since the
+    // entry is found by binary search.  Zombies are left in place.
+    if (GB_PENDING (A) || GB_JUMBLED (A))
     { 
         GrB_Info info ;
         GB_WHERE (GB_WHERE_STRING) ;
@@ -103,37 +107,59 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = A(row,col)
     const int64_t *GB_RESTRICT Ap = A->p ;
     const int64_t *GB_RESTRICT Ai = A->i ;
     bool found ;
+    int64_t pleft ;
 
-    // extract from vector j of a GrB_Matrix
-    int64_t k ;
-    if (A->is_hyper)
-    {
-        // look for vector j in hyperlist A->h [0 ... A->nvec-1]
-        const int64_t *Ah = A->h ;
-        int64_t pleft = 0 ;
-        int64_t pright = A->nvec-1 ;
-        GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
-        if (!found)
-        { 
-            // vector j is empty
-            return (GrB_NO_VALUE) ;
-        }
-        ASSERT (j == Ah [pleft]) ;
-        k = pleft ;
+    if (GB_IS_FULL (A))
+    { 
+        // A is full: A(i,j) is always present, at position i+j*vlen
+        pleft = i + j * A->vlen ;
+        found = true ;
     }
-    else
+    else if (GB_IS_BITMAP (A))
     { 
-        k = j ;
+        // A is bitmap: A(i,j) is present if A->b [i+j*vlen] is nonzero
+        pleft = i + j * A->vlen ;
+        found = (A->b [pleft] != 0) ;
     }
-    int64_t pleft = Ap [k] ;
-    int64_t pright = Ap [k+1] - 1 ;
-
-    //--------------------------------------------------------------------------
-    // binary search in kth vector for index i
-    //--------------------------------------------------------------------------
+    else
+    {
 
-    // Time taken for this step is at most O(log(nnz(A(:,j))).
-    GB_BINARY_SEARCH (i, Ai, pleft, pright, found) ;
+        // extract from vector j of a GrB_Matrix
+        int64_t k ;
+        if (A->is_hyper)
+        {
+            // look for vector j in hyperlist A->h [0 ... A->nvec-1]
+            const int64_t *Ah = A->h ;
+            int64_t pleft = 0 ;
+            int64_t pright = A->nvec-1 ;
+            GB_BINARY_SEARCH (j, Ah, pleft, pright, found) ;
+            if (!found)
+            { 
+                // vector j is empty
+                return (GrB_NO_VALUE) ;
+            }
+            ASSERT (j == Ah [pleft]) ;
+            k = pleft ;
+        }
+        else
+        { 
+            k = j ;
+        }
+        pleft = Ap [k] ;
+        int64_t pright = Ap [k+1] - 1 ;
+
+        //----------------------------------------------------------------------
+        // binary search in kth vector for index i
+        //----------------------------------------------------------------------
+
+        // Time taken for this step is at most O(log(nnz(A(:,j))).  A zombie
+        // A(i,j) is an entry that has been deleted, so it is not found.
+        bool is_zombie ;
+        int64_t nzombies = A->nzombies ;
+        GB_BINARY_SEARCH_ZOMBIE (i, Ai, pleft, pright, found, nzombies,
+            is_zombie) ;
+        found = found && !is_zombie ;
+    }
 
     //--------------------------------------------------------------------------
     // extract the element
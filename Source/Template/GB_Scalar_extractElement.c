@@ -31,8 +31,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry from S
     GB_CONTEXT_RETURN_IF_NULL (S) ;
     GB_CONTEXT_RETURN_IF_FAULTY (S) ;
 
-    // delete any lingering zombies and assemble any pending tuples
-    if (GB_PENDING_OR_ZOMBIES (S))
+    // finish any pending work
+    if (GB_ANY_PENDING_WORK (S))
     { 
         GrB_Info info ;
         GB_WHERE (GB_WHERE_STRING) ;
@@ -56,7 +56,8 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry from S
             S->type->name, GB_code_string (GB_XCODE)))) ;
     }
 
-    if (S->nzmax == 0 || S->p [1] == 0)
+    if (S->nzmax == 0 || (S->p != NULL && S->p [1] == 0)
+        || (S->b != NULL && S->b [0] == 0))
     { 
         // quick return
         return (GrB_NO_VALUE) ;
@@ -16,7 +16,10 @@
 // This template constructs GrB_Vector_extractElement_[TYPE], for each of the
 // 13 built-in types, and the _UDT method for all user-defined types.
 
-// FUTURE: tolerate zombies
+// Zombies are tolerated: they are skipped by the binary search, so a lookup
+// after GrB_*_removeElement does not force the matrix to be finalized.  Any
+// pending tuples must still be assembled first, since the value of an entry
+// may depend on several pending tuples and on the dup operator.
 
 GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
 (
@@ -33,8 +36,9 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     GB_CONTEXT_RETURN_IF_NULL (V) ;
     GB_CONTEXT_RETURN_IF_FAULTY (V) ;
 
-    // delete any lingering zombies and assemble any pending tuples
-    if (GB_PENDING_OR_ZOMBIES (V))
+    // assemble any pending tuples, and sort any jumbled vectors, since the
+    // entry is found by binary search.  Zombies are left in place.
+    if (GB_PENDING (V) || GB_JUMBLED (V))
     { 
         GrB_Info info ;
         GB_WHERE (GB_WHERE_STRING) ;
@@ -79,17 +83,39 @@ GrB_Info GB_EXTRACT_ELEMENT     // extract a single entry, x = V(i)
     const int64_t *GB_RESTRICT Vp = V->p ;
     const int64_t *GB_RESTRICT Vi = V->i ;
     bool found ;
+    int64_t pleft ;
 
-    // extract from a GrB_Vector
-    int64_t pleft = 0 ;
-    int64_t pright = Vp [1] - 1 ;
-
-    //--------------------------------------------------------------------------
-    // binary search in kth vector for index i
-    //--------------------------------------------------------------------------
+    if (GB_IS_FULL (V))
+    { 
+        // V is full: V(i) is always present, at position i
+        pleft = i ;
+        found = true ;
+    }
+    else if (GB_IS_BITMAP (V))
+    { 
+        // V is bitmap: V(i) is present if V->b [i] is nonzero
+        pleft = i ;
+        found = (V->b [i] != 0) ;
+    }
+    else
+    { 
 
-    // Time taken for this step is at most O(log(nnz(V))).
-    GB_BINARY_SEARCH (i, Vi, pleft, pright, found) ;
+        // extract from a GrB_Vector
+        pleft = 0 ;
+        int64_t pright = Vp [1] - 1 ;
+
+        //----------------------------------------------------------------------
+        // binary search in kth vector for index i
+        //----------------------------------------------------------------------
+
+        // Time taken for this step is at most O(log(nnz(V))).  A zombie V(i)
+        // is an entry that has been deleted, so it is not found.
+        bool is_zombie ;
+        int64_t nzombies = V->nzombies ;
+        GB_BINARY_SEARCH_ZOMBIE (i, Vi, pleft, pright, found, nzombies,
+            is_zombie) ;
+        found = found && !is_zombie ;
+    }
 
     //--------------------------------------------------------------------------
     // extract the element
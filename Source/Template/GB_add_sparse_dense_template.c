@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+// GB_add_sparse_dense_template: C<S>=A+B where S is A or B, the other is dense
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The pattern of C has already been copied from the sparse matrix S, which is
+// A if A_is_sparse is true, or B otherwise.  The other matrix is dense, so
+// its entry (i,j) is located at position i + j*vlen.  All entries in C are
+// computed fully in parallel, using the same kind of parallelism as
+// Template/GB_AxB_colscale_meta.c.
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A, B, and C
+    //--------------------------------------------------------------------------
+
+    const GB_ATYPE *GB_RESTRICT Ax = (GB_ATYPE *) A->x ;
+    const GB_BTYPE *GB_RESTRICT Bx = (GB_BTYPE *) B->x ;
+    GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
+
+    const int64_t *GB_RESTRICT Cp = C->p ;
+    const int64_t *GB_RESTRICT Ch = C->h ;
+    const int64_t *GB_RESTRICT Ci = C->i ;
+    const int64_t vlen = C->vlen ;
+
+    //--------------------------------------------------------------------------
+    // C<S> = A+B
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        // if kfirst > klast then task tid does no work at all
+        int64_t kfirst = kfirst_slice [tid] ;
+        int64_t klast  = klast_slice  [tid] ;
+
+        for (int64_t k = kfirst ; k <= klast ; k++)
+        {
+
+            //------------------------------------------------------------------
+            // find the part of C(:,k) to be computed by this task
+            //------------------------------------------------------------------
+
+            int64_t j = (Ch == NULL) ? k : Ch [k] ;
+            int64_t pC_start, pC_end ;
+            GB_get_pA_and_pC (&pC_start, &pC_end, NULL,
+                tid, k, kfirst, klast, pstart_slice, NULL, NULL, Cp) ;
+            int64_t pD_start = j * vlen ;
+
+            //------------------------------------------------------------------
+            // C(:,j)<S(:,j)> = A(:,j) + B(:,j)
+            //------------------------------------------------------------------
+
+            if (A_is_sparse)
+            {
+                // A(:,j) is sparse and B(:,j) is dense
+                GB_PRAGMA_SIMD_VECTORIZE
+                for (int64_t p = pC_start ; p < pC_end ; p++)
+                {
+                    int64_t pB = pD_start + Ci [p] ;
+                    GB_GETA (aij, Ax, p) ;              // aij = A(i,j)
+                    GB_GETB (bij, Bx, pB) ;             // bij = B(i,j)
+                    GB_BINOP (GB_CX (p), aij, bij) ;    // C(i,j) = aij + bij
+                }
+            }
+            else
+            {
+                // A(:,j) is dense and B(:,j) is sparse
+                GB_PRAGMA_SIMD_VECTORIZE
+                for (int64_t p = pC_start ; p < pC_end ; p++)
+                {
+                    int64_t pA = pD_start + Ci [p] ;
+                    GB_GETA (aij, Ax, pA) ;             // aij = A(i,j)
+                    GB_GETB (bij, Bx, p) ;              // bij = B(i,j)
+                    GB_BINOP (GB_CX (p), aij, bij) ;    // C(i,j) = aij + bij
+                }
+            }
+        }
+    }
+}
+
@@ -0,0 +1,143 @@
+//------------------------------------------------------------------------------
+// GB_dense_subassign_23_tran_template: C += B' where C is dense
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The entries of B are scattered directly into C, so B' is never formed.
+// Each entry B(i,j) is accumulated into C(j,i), and no two entries of B modify
+// the same entry of C, so all tasks can operate in parallel with no
+// synchronization.  If B is sparse, the entries of B are sliced with the same
+// kind of parallelism as Template/GB_AxB_colscale.c.  If B is dense, each
+// task operates on a set of tiles of B, each of size
+// GB_DENSE_TRAN_TILE-by-GB_DENSE_TRAN_TILE, so that both the reads of B and
+// the writes to C stay in cache.
+
+#include "GB_unused.h"
+
+{
+
+    //--------------------------------------------------------------------------
+    // get C and B
+    //--------------------------------------------------------------------------
+
+    const GB_BTYPE *GB_RESTRICT Bx = (GB_BTYPE *) B->x ;
+    GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
+    const int64_t bvlen = B->vlen ;
+    const int64_t cvlen = C->vlen ;
+    ASSERT (GB_is_dense (C)) ;
+    ASSERT (bvlen == C->vdim && B->vdim == cvlen) ;
+
+    if (kfirst_slice == NULL)
+    {
+
+        //----------------------------------------------------------------------
+        // C += B' when both C and B are dense
+        //----------------------------------------------------------------------
+
+        ASSERT (GB_is_dense (B)) ;
+        const int64_t bvdim = B->vdim ;
+        const int64_t nitiles =
+            (bvlen + GB_DENSE_TRAN_TILE - 1) / GB_DENSE_TRAN_TILE ;
+        const int64_t nktiles =
+            (bvdim + GB_DENSE_TRAN_TILE - 1) / GB_DENSE_TRAN_TILE ;
+
+        int taskid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+
+            // this task operates on tiles tfirst:tlast-1 of B, where tile t
+            // is B (i1:i2-1,k1:k2-1) with i1 = (t % nitiles) * tile size and
+            // k1 = (t / nitiles) * tile size.  Tiling over both dimensions
+            // keeps all tasks busy even if B is tall and thin, or short and
+            // wide.
+            int64_t tfirst, tlast ;
+            GB_PARTITION (tfirst, tlast, nitiles * nktiles, taskid, ntasks) ;
+
+            for (int64_t t = tfirst ; t < tlast ; t++)
+            {
+                int64_t i1 = (t % nitiles) * GB_DENSE_TRAN_TILE ;
+                int64_t k1 = (t / nitiles) * GB_DENSE_TRAN_TILE ;
+                int64_t i2 = GB_IMIN (i1 + GB_DENSE_TRAN_TILE, bvlen) ;
+                int64_t k2 = GB_IMIN (k1 + GB_DENSE_TRAN_TILE, bvdim) ;
+
+                //--------------------------------------------------------------
+                // C (k1:k2-1,i1:i2-1) += B (i1:i2-1,k1:k2-1)'
+                //--------------------------------------------------------------
+
+                for (int64_t i = i1 ; i < i2 ; i++)
+                {
+                    // pC points to the start of C(:,i)
+                    int64_t pC = i * cvlen ;
+                    GB_PRAGMA_SIMD_VECTORIZE
+                    for (int64_t k = k1 ; k < k2 ; k++)
+                    {
+                        int64_t pB = i + k * bvlen ;
+                        int64_t p = pC + k ;
+                        // bij = B(i,k)
+                        GB_GETB (bij, Bx, pB) ;
+                        // C(k,i) += bij
+                        GB_BINOP (GB_CX (p), GB_CX (p), bij) ;
+                    }
+                }
+            }
+        }
+
+    }
+    else
+    {
+
+        //----------------------------------------------------------------------
+        // C += B' when C is dense and B is sparse
+        //----------------------------------------------------------------------
+
+        const int64_t *GB_RESTRICT Bp = B->p ;
+        const int64_t *GB_RESTRICT Bh = B->h ;
+        const int64_t *GB_RESTRICT Bi = B->i ;
+
+        int taskid ;
+        #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+        for (taskid = 0 ; taskid < ntasks ; taskid++)
+        {
+
+            // if kfirst > klast then taskid does no work at all
+            int64_t kfirst = kfirst_slice [taskid] ;
+            int64_t klast  = klast_slice  [taskid] ;
+
+            //------------------------------------------------------------------
+            // C(j,:) += B(:,j)' for each vector j in this task
+            //------------------------------------------------------------------
+
+            for (int64_t k = kfirst ; k <= klast ; k++)
+            {
+
+                //--------------------------------------------------------------
+                // find the part of B(:,k) for this task
+                //--------------------------------------------------------------
+
+                int64_t j = (Bh == NULL) ? k : Bh [k] ;
+                int64_t my_pB_start, my_pB_end ;
+                GB_get_pA_and_pC (&my_pB_start, &my_pB_end, NULL,
+                    taskid, k, kfirst, klast, pstart_slice, NULL, NULL, Bp) ;
+
+                //--------------------------------------------------------------
+                // C(j,:) += B(:,j)'
+                //--------------------------------------------------------------
+
+                GB_PRAGMA_SIMD_VECTORIZE
+                for (int64_t pB = my_pB_start ; pB < my_pB_end ; pB++)
+                {
+                    int64_t i = Bi [pB] ;
+                    int64_t p = j + i * cvlen ;
+                    GB_GETB (bij, Bx, pB) ;                 // bij = B(i,j)
+                    GB_BINOP (GB_CX (p), GB_CX (p), bij) ;  // C(j,i) += bij
+                }
+            }
+        }
+    }
+}
+
@@ -0,0 +1,111 @@
+//------------------------------------------------------------------------------
+// GB_kroner_template: Kronecker product, C = kron (A,B)
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// The pattern of C, in C->p and C->h, has already been computed, and C has
+// space for all nnz(A)*nnz(B) entries.  This template computes C->i and C->x.
+
+// The entries of C are split evenly into ntasks tasks, regardless of how they
+// are distributed across the vectors of C.  A single vector C(:,kC) can be
+// computed by many tasks, and a single task can compute many vectors.  The
+// entries in C(:,kC) are ordered by A(:,kA) and then by B(:,kB), where kC =
+// kA*bnvec + kB, so the kth entry in C(:,kC) is the product of entry
+// k / bknz in A(:,kA) and entry k % bknz in B(:,kB).
+
+{
+
+    //--------------------------------------------------------------------------
+    // get A, B, and C
+    //--------------------------------------------------------------------------
+
+    const int64_t *GB_RESTRICT Ap = A->p ;
+    const int64_t *GB_RESTRICT Ai = A->i ;
+    const GB_ATYPE *GB_RESTRICT Ax = (GB_ATYPE *) A->x ;
+
+    const int64_t *GB_RESTRICT Bp = B->p ;
+    const int64_t *GB_RESTRICT Bi = B->i ;
+    const GB_BTYPE *GB_RESTRICT Bx = (GB_BTYPE *) B->x ;
+    const int64_t bvlen = B->vlen ;
+    const int64_t bnvec = B->nvec ;
+
+    const int64_t *GB_RESTRICT Cp = C->p ;
+    int64_t *GB_RESTRICT Ci = C->i ;
+    GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) C->x ;
+    const int64_t cnvec = C->nvec ;
+    const int64_t cnz = Cp [cnvec] ;
+
+    //--------------------------------------------------------------------------
+    // C = kron (A,B)
+    //--------------------------------------------------------------------------
+
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(dynamic,1)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+
+        //----------------------------------------------------------------------
+        // get the task descriptor
+        //----------------------------------------------------------------------
+
+        int64_t pC, pC_end ;
+        GB_PARTITION (pC, pC_end, cnz, tid, ntasks) ;
+        if (pC >= pC_end) continue ;
+
+        // find the vector kC that contains the first entry for this task
+        int64_t kC = GB_search_for_vector (pC, Cp, 0, cnvec) ;
+
+        //----------------------------------------------------------------------
+        // compute the entries pC:pC_end-1 of C
+        //----------------------------------------------------------------------
+
+        for ( ; pC < pC_end ; kC++)
+        {
+
+            //------------------------------------------------------------------
+            // get C(:,kC), A(:,kA), and B(:,kB)
+            //------------------------------------------------------------------
+
+            // this task computes C(:,kC) in Cx [pC ... pC_vend-1]
+            int64_t pC_vend = GB_IMIN (Cp [kC+1], pC_end) ;
+            if (pC >= pC_vend) continue ;
+            int64_t kA = kC / bnvec ;
+            int64_t kB = kC % bnvec ;
+            int64_t pB_start = Bp [kB] ;
+            int64_t pB_end   = Bp [kB+1] ;
+            int64_t bknz = pB_end - pB_start ;
+            ASSERT (bknz > 0) ;
+
+            // the first entry C(iC,jC) to compute is A(iA,jA)*B(iB,jB),
+            // located in Ax [pA] and Bx [pB]
+            int64_t q = pC - Cp [kC] ;
+            int64_t pA = Ap [kA] + q / bknz ;
+            int64_t pB = pB_start + q % bknz ;
+
+            //------------------------------------------------------------------
+            // C(:,kC) = kron (A(:,kA), B(:,kB))
+            //------------------------------------------------------------------
+
+            while (pC < pC_vend)
+            {
+                // aij = A(iA,jA)
+                int64_t iAblock = Ai [pA] * bvlen ;
+                GB_GETA (aij, Ax, pA) ;
+                for ( ; pB < pB_end && pC < pC_vend ; pB++, pC++)
+                {
+                    // C(iC,jC) = A(iA,jA) * B(iB,jB)
+                    GB_GETB (bij, Bx, pB) ;
+                    Ci [pC] = iAblock + Bi [pB] ;
+                    GB_BINOP (GB_CX (pC), aij, bij) ;
+                }
+                pA++ ;
+                pB = pB_start ;
+            }
+        }
+    }
+}
+
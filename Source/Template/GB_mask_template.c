@@ -18,6 +18,9 @@
 
 // phase2: computes R, using the counts computed by phase1.
 
+// If M is bitmap, each M(i,j) is found in O(1) time, for each entry in
+// C(:,j) and Z(:,j), and the pattern of M is never traversed.
+
 // FUTURE:: add special cases for C==Z, C==M, and Z==M aliases
 
 //------------------------------------------------------------------------------
@@ -76,6 +79,7 @@
     const int64_t *GB_RESTRICT Mp = NULL ;
     // const int64_t *GB_RESTRICT Mh = NULL ;
     const int64_t *GB_RESTRICT Mi = NULL ;
+    const int8_t  *GB_RESTRICT Mb = NULL ;
     const GB_void *GB_RESTRICT Mx = NULL ;
     size_t msize = 0 ;
     // int64_t Mnvec = 0 ;
@@ -85,6 +89,7 @@
         Mp = M->p ;
         // Mh = M->h ;
         Mi = M->i ;
+        Mb = M->b ;
         Mx = (GB_void *) (Mask_struct ? NULL : (M->x)) ;
         msize = M->type->size ;
         // Mnvec = M->nvec ;
@@ -241,7 +246,12 @@
             //------------------------------------------------------------------
 
             int64_t pM = -1, pM_end = -1 ;
-            if (fine_task)
+            if (Mb != NULL)
+            { 
+                // M is bitmap, and M(i,j) is found in O(1) time below.  The
+                // tasks were not sliced by M, and M(:,j) is not counted.
+            }
+            else if (fine_task)
             { 
                 // A fine task operates on Mi,Mx [pM...pM_end-1], which is
                 // a subset of the vector M(:,j)
@@ -271,7 +281,57 @@
             // phase1: count nnz (R(:,j)); phase2: compute R(:,j)
             //------------------------------------------------------------------
 
-            if (mjnz == 0)
+            if (Mb != NULL)
+            {
+
+                //--------------------------------------------------------------
+                // M is bitmap: 2-way merge of C(:,j) and Z(:,j)
+                //--------------------------------------------------------------
+
+                // M(i,j) is at position pM_start + i in Mb and Mx
+                int64_t pM_start = j * vlen ;
+                while (pC < pC_end || pZ < pZ_end)
+                {
+                    int64_t iC = (pC < pC_end) ? Ci [pC] : INT64_MAX ;
+                    int64_t iZ = (pZ < pZ_end) ? Zi [pZ] : INT64_MAX ;
+                    int64_t i = GB_IMIN (iC, iZ) ;
+                    pM = pM_start + i ;
+                    bool mij = Mb [pM] && GB_mcast (Mx, pM, msize) ;
+                    if (Mask_comp) mij = !mij ;
+                    if (iC < iZ)
+                    { 
+                        // C(i,j) is present but Z(i,j) is not
+                        if (!mij) GB_COPY_C ;
+                        pC++ ;
+                    }
+                    else if (iC > iZ)
+                    { 
+                        // Z(i,j) is present but C(i,j) is not
+                        if (mij) GB_COPY_Z ;
+                        pZ++ ;
+                    }
+                    else
+                    {
+                        // both C(i,j) and Z(i,j) are present
+                        if (mij)
+                        { 
+                            GB_COPY_Z ;
+                        }
+                        else
+                        { 
+                            GB_COPY_C ;
+                        }
+                        pC++ ;
+                        pZ++ ;
+                    }
+                }
+
+                #if defined ( GB_PHASE_2_OF_2 )
+                ASSERT (pR == pR_end) ;
+                #endif
+
+            }
+            else if (mjnz == 0)
             {
 
                 //--------------------------------------------------------------
@@ -134,6 +134,40 @@ size_t type_size ;      // type->size, copied here since the type could be
 
         // A is m-by-n: where A->vdim = n, and A->vlen = m
 
+//------------------------------------------------------------------------------
+// Full format: all entries present (either CSR or CSC)
+//------------------------------------------------------------------------------
+
+    // A->is_hyper and A->is_slice are false.  Ap, Ah, and Ai are all NULL,
+    // and A->nzmax >= A->vlen*A->vdim > 0.  The pattern of A is implicit:
+    // every entry A(i,j) is present.  The entry in position i of vector j is
+    // held in Ax [i + j*A->vlen].  The nvec and plen of a full matrix are
+    // both equal to A->vdim, just like the standard sparse format.
+
+    // A full matrix never has zombies or pending tuples.  It is converted to
+    // the standard sparse format by GB_convert_full_to_sparse whenever a
+    // method requires the pattern of A, or if an entry is deleted.  A sparse
+    // matrix with all entries present is converted to full by GB_conform,
+    // but only if A->sparsity includes GxB_FULL.
+
+//------------------------------------------------------------------------------
+// Bitmap format: a dense array of values and a presence array (CSR or CSC)
+//------------------------------------------------------------------------------
+
+    // A->is_hyper and A->is_slice are false.  Ap, Ah, and Ai are all NULL,
+    // and Ax and Ab both have size A->nzmax >= A->vlen*A->vdim > 0.  The
+    // entry in position i of vector j is present if Ab [i + j*A->vlen] is 1,
+    // in which case its value is Ax [i + j*A->vlen].  If Ab [...] is zero,
+    // the value in Ax [...] is undefined.  The number of entries present is
+    // held in A->nvals.  The nvec and plen of a bitmap matrix are both
+    // A->vdim.
+
+    // Like the full format, a bitmap matrix never has zombies or pending
+    // tuples: entries are inserted or deleted in O(1) time, by setting or
+    // clearing Ab [...].  GB_conform converts a matrix to and from the bitmap
+    // format if A->sparsity includes GxB_BITMAP, depending on A->bitmap_switch.
+    // Methods that are not bitmap-aware convert it to sparse first.
+
 //------------------------------------------------------------------------------
 // Internal formats: a slice or hyperslice (either CSR or CSC)
 //------------------------------------------------------------------------------
@@ -161,9 +195,11 @@ size_t type_size ;      // type->size, copied here since the type could be
 //------------------------------------------------------------------------------
 
 // Like MATLAB, the indices in a GraphBLAS matrix (as implemented here) are
-// "always" kept sorted.  There is one temporary exception to this rule.
-// GB_subref is allowed return a matrix with unsorted vectors, if it will be
-// later be transposed by its caller.  The transpose does the sort.
+// "always" kept sorted.  There are two exceptions to this rule.  GB_subref is
+// allowed return a matrix with unsorted vectors, if it will be later be
+// transposed by its caller.  The transpose does the sort.  Second, a matrix
+// may be left "jumbled", with A->jumbled true (see below), in which case the
+// sort is left pending until a method needs it.
 
 // Unlike MATLAB, explicit zeros are never dropped in a GraphBLAS matrix.  They
 // cannot be since the semiring "zero" might be something else, like -Infinity
@@ -197,6 +233,9 @@ size_t type_size ;      // type->size, copied here since the type could be
                         // false if by row (CSR or hypersparse CSR)
 
 double hyper_ratio ;    // controls conversion to/from hypersparse
+int sparsity ;          // controls conversion to/from bitmap and full: any
+                        // sum of GxB_SPARSE, GxB_BITMAP, and GxB_FULL
+double bitmap_switch ;  // controls conversion to/from bitmap
 
 int64_t plen ;          // A->h has size plen, A->p has size plen+1
 int64_t vlen ;          // length of each sparse vector
@@ -212,6 +251,9 @@ int64_t *p ;            // array of size plen+1
 int64_t *i ;            // array of size nzmax
 void *x ;               // size nzmax; each entry of size A->type->size
 int64_t nzmax ;         // size of i and x arrays
+int8_t *b ;             // bitmap of size nzmax, or NULL if not bitmap;
+                        // never shallow
+int64_t nvals ;         // # of entries present, if A is bitmap
 
 int64_t hfirst ;        // if A->is_hyper is false but A->is_slice is true,
                         // then A->h is NULL, and the matrix A is a slice
@@ -252,6 +294,23 @@ int64_t hfirst ;        // if A->is_hyper is false but A->is_slice is true,
 // predefined for the user application as the constants GxB_ALWAYS_HYPER and
 // GxB_NEVER_HYPER.
 
+// A->sparsity determines which formats the matrix may take.  If it includes
+// GxB_SPARSE, the matrix can be held in the standard or hypersparse formats
+// (as determined by the hyper_ratio).  If it includes GxB_FULL, a matrix with
+// all entries present is held in the full format.  The default value is
+// GxB_SPARSE, and it can be modified globally or for a single matrix with
+// the GxB_SPARSITY_CONTROL option.
+
+// If A->sparsity includes GxB_BITMAP, the bitmap_switch determines how the
+// matrix is converted between the sparse and bitmap formats, much like the
+// hyper_ratio.  Let N = A->vlen*A->vdim and let e be the number of entries in
+// A.  If A is sparse it is converted to bitmap if e >= N*bitmap_switch.  If A
+// is bitmap, it is converted to sparse if e < N*bitmap_switch/2.  If
+// A->sparsity does not include GxB_SPARSE, a matrix that is not full is
+// always held as bitmap.  The default bitmap_switch is
+// GB_BITMAP_SWITCH_DEFAULT, and it can be modified globally or for a single
+// matrix with the GxB_BITMAP_SWITCH option.
+
 //------------------------------------------------------------------------------
 // pending tuples
 //------------------------------------------------------------------------------
@@ -313,6 +372,17 @@ int64_t hfirst ;        // if A->is_hyper is false but A->is_slice is true,
 
 GB_Pending Pending ;        // list of pending tuples
 
+// If the matrix allows concurrent insertion (see GxB_CONCURRENT_INSERT), then
+// GrB_setElement does not append to A->Pending.  Instead, each user thread
+// appends to the list of pending tuples in one of GB_PENDING_NSLOTS slots,
+// each with its own lock.  The tuples are typecast to A->type when inserted.
+// A->Pending_slots_used becomes true when a tuple is added to any slot, and
+// the slots are merged into A->Pending (by GB_Pending_merge) before the
+// pending tuples are assembled, or before GB_subassigner appends more tuples.
+
+GB_Pending_slots Pending_slots ;    // per-thread pending tuples, or NULL
+bool Pending_slots_used ;           // true if any slot has pending tuples
+
 //-----------------------------------------------------------------------------
 // zombies
 //-----------------------------------------------------------------------------
@@ -343,6 +413,28 @@ GB_Pending Pending ;        // list of pending tuples
 
 uint64_t nzombies ;     // number of zombies marked for deletion
 
+//------------------------------------------------------------------------------
+// jumbled matrices
+//------------------------------------------------------------------------------
+
+// The indices in each vector of a sparse or hypersparse matrix are normally
+// kept sorted.  Some methods (GB_AxB_saxpy3 in particular) compute their
+// result in an unsorted order, and sorting it can take as much time as the
+// computation itself.  In this case, the matrix may be returned with its
+// vectors left unsorted, and A->jumbled is set to true.  The sort is a
+// pending computation, just like zombies and pending tuples, and is done by
+// GB_Matrix_wait (via GB_unjumble).  Many methods do not depend on the order
+// of the entries in each vector (GrB_reduce to scalar, GrB_apply, and
+// GrB_Matrix_nvals, for example); they can operate on a jumbled matrix
+// directly.  All other methods sort the matrix first, via GB_MATRIX_WAIT.
+
+// A jumbled matrix is never full or bitmap, and it is never a slice or
+// hyperslice.  It may have zombies and pending tuples; GB_Matrix_wait deletes
+// the zombies first, then sorts the vectors, and then assembles the pending
+// tuples.
+
+bool jumbled ;          // true if the indices in any vector may be unsorted
+
 //------------------------------------------------------------------------------
 // statistics
 //------------------------------------------------------------------------------
@@ -360,9 +452,9 @@ bool enqueued ;         // TODO in 4.0: delete
 // Internal matrices in this implementation of GraphBLAS may have "shallow"
 // components.  These are pointers A->p, A->i, and A->x that point to the
 // content of another matrix.  Using shallow components speeds up computations
-// and saves memory, but shallow matrices are never passed back to the user
-// application.  They could be in the future, since the GraphBLAS objects are
-// opaque to the user application.
+// and saves memory.  The only shallow matrices passed back to the user
+// application are those created by GxB_Matrix_import_mmap, whose components
+// point into a memory-mapped file.
 
 // If the following are true, then the corresponding component of the
 // object is a pointer into components of another object.  They must not
@@ -373,6 +465,14 @@ bool h_shallow ;        // true if h is a shallow copy
 bool i_shallow ;        // true if i is a shallow copy
 bool x_shallow ;        // true if x is a shallow copy
 
+// If A->mmap_base is not NULL, the shallow components of A point into a
+// private, copy-on-write mapping of a file, which is owned by A.  The mapping
+// is released by GB_mmap_free when the content of A is freed, or when
+// GB_unshare gives A its own copy of the content.
+
+void *mmap_base ;       // start of the file mapping, or NULL if none
+size_t mmap_size ;      // size of the file mapping
+
 //------------------------------------------------------------------------------
 // other bool content
 //------------------------------------------------------------------------------
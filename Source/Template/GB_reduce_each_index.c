@@ -8,11 +8,20 @@
 //------------------------------------------------------------------------------
 
 // Reduce a matrix to a vector.  All entries in A(i,:) are reduced to T(i).
-// First, all threads reduce their slice to their own workspace, operating on
-// roughly the same number of entries each.  The vectors in A are ignored; the
-// reduction only depends on the indices.  Next, the threads cooperate to
-// reduce all workspaces to the workspace of thread 0.  Finally, this last
-// workspace is collected into T.
+// The vectors in A are ignored; the reduction only depends on the indices.
+// All entries are reduced into a single dense workspace (Work0 and Mark0) of
+// size n, which is then collected into T.
+
+// With a single thread (nth == 1), all entries are reduced directly into the
+// workspace.  Otherwise, the indices 0:n-1 are split into npanels panels,
+// and the reduction takes three phases.  First, each thread counts how many
+// entries in its slice of A fall into each panel.  Next, each thread
+// scatters the positions of its entries into the buckets Perm for each
+// panel.  Finally, each panel is reduced into its own part of the shared
+// workspace.  No two panels share an index i, so no atomics and no per-thread
+// O(n) workspace are needed, and all threads can be used even if anz is
+// small compared with n.  The entries in each panel are reduced in the same
+// order as the single-threaded method (in increasing position in A).
 
 // If an out-of-memory condition occurs, the macro GB_FREE_ALL frees any
 // workspace.  This has no effect on the built-in workers (GB_FREE_ALL does
@@ -28,146 +37,155 @@
     const GB_ATYPE *GB_RESTRICT Ax = (GB_ATYPE *) A->x ;
     const int64_t  *GB_RESTRICT Ai = A->i ;
     const int64_t n = A->vlen ;
+    const int64_t anz = GB_NNZ (A) ;
     size_t zsize = ttype->size ;
 
     //--------------------------------------------------------------------------
-    // allocate workspace for each thread
+    // allocate workspace
     //--------------------------------------------------------------------------
 
     int ntasks = 256 * nthreads ;
     ntasks = GB_IMIN (ntasks, n) ;
 
-    GB_void *GB_RESTRICT *Works = GB_CALLOC (nth, GB_void *) ;
-    bool    *GB_RESTRICT *Marks = GB_CALLOC (nth, bool *) ;
-    int64_t *GB_RESTRICT Tnz    = GB_CALLOC (nth, int64_t) ;
-    int64_t *GB_RESTRICT Count  = GB_CALLOC (ntasks+1, int64_t) ;
-    bool ok = (Works != NULL && Marks != NULL && Tnz != NULL && Count != NULL) ;
-
-    // This does not need to be parallel.  The calloc does not take O(n) time.
-    if (ok)
-    {
-        for (int tid = 0 ; tid < nth ; tid++)
-        { 
-            Works [tid] = GB_MALLOC (n * zsize, GB_void) ;
-            Marks [tid] = GB_CALLOC (n, bool) ;
-            ok = ok && (Works [tid] != NULL && Marks [tid] != NULL) ;
-        }
+    // panel b holds the indices b*psize to (b+1)*psize-1
+    int npanels = (nth == 1) ? 1 : (8 * nth) ;
+    npanels = GB_IMIN (npanels, n) ;
+    npanels = GB_IMAX (npanels, 1) ;
+    int64_t psize = (n + npanels - 1) / npanels ;
+    psize = GB_IMAX (psize, 1) ;
+
+    GB_CTYPE *GB_RESTRICT Work0 = (GB_CTYPE *) GB_MALLOC (n * zsize, GB_void) ;
+    bool     *GB_RESTRICT Mark0 = GB_CALLOC (n, bool) ;
+    int64_t  *GB_RESTRICT Count = GB_CALLOC (ntasks+1, int64_t) ;
+    int64_t  *GB_RESTRICT Perm = NULL ;
+    int64_t  *GB_RESTRICT Pcount = NULL ;
+    int64_t  *GB_RESTRICT Pstart = NULL ;
+    bool ok = (Work0 != NULL && Mark0 != NULL && Count != NULL) ;
+
+    if (ok && nth > 1)
+    { 
+        Perm   = GB_MALLOC (anz, int64_t) ;
+        Pcount = GB_CALLOC (npanels * nth + 1, int64_t) ;
+        Pstart = GB_MALLOC (npanels + 1, int64_t) ;
+        ok = (Perm != NULL && Pcount != NULL && Pstart != NULL) ;
     }
 
     if (!ok)
-    {
+    { 
         // out of memory
-        if (Works != NULL)
-        {
-            for (int tid = 0 ; tid < nth ; tid++)
-            { 
-                GB_FREE (Works [tid]) ;
-            }
-        }
-        if (Marks != NULL)
-        {
-            for (int tid = 0 ; tid < nth ; tid++)
-            { 
-                GB_FREE (Marks [tid]) ;
-            }
-        }
-        GB_FREE (Works) ;
-        GB_FREE (Marks) ;
-        GB_FREE (Tnz) ;
+        GB_FREE (Work0) ;
+        GB_FREE (Mark0) ;
         GB_FREE (Count) ;
+        GB_FREE (Perm) ;
+        GB_FREE (Pcount) ;
+        GB_FREE (Pstart) ;
         GB_FREE_ALL ;
         return (GB_OUT_OF_MEMORY) ;
     }
 
     //--------------------------------------------------------------------------
-    // reduce each slice in its own workspace
+    // reduce all entries into Work0 and count # entries in T
     //--------------------------------------------------------------------------
 
-    // each thread reduces its own slice in parallel
-    int tid ;
-    #pragma omp parallel for num_threads(nth) schedule(static)
-    for (tid = 0 ; tid < nth ; tid++)
-    {
-
-        //----------------------------------------------------------------------
-        // get the workspace for this thread
-        //----------------------------------------------------------------------
+    int64_t tnz = 0 ;
 
-        GB_CTYPE *GB_RESTRICT Work = (GB_CTYPE *) Works [tid] ;
-        bool     *GB_RESTRICT Mark = Marks [tid] ;
-        int64_t my_tnz = 0 ;
+    if (nth == 1)
+    {
 
         //----------------------------------------------------------------------
-        // reduce the entries
+        // reduce all entries using a single thread
         //----------------------------------------------------------------------
 
-        for (int64_t p = pstart_slice [tid] ; p < pstart_slice [tid+1] ;p++)
+        for (int64_t p = 0 ; p < anz ; p++)
         {
             int64_t i = Ai [p] ;
             // ztype aij = (ztype) Ax [p], with typecast
             GB_SCALAR (aij) ;
             GB_CAST_ARRAY_TO_SCALAR (aij, Ax, p) ;
-            if (!Mark [i])
+            if (!Mark0 [i])
             { 
                 // first time index i has been seen
-                // Work [i] = aij ; no typecast
-                GB_COPY_SCALAR_TO_ARRAY (Work, i, aij) ;
-                Mark [i] = true ;
-                my_tnz++ ;
+                // Work0 [i] = aij ; no typecast
+                GB_COPY_SCALAR_TO_ARRAY (Work0, i, aij) ;
+                Mark0 [i] = true ;
+                tnz++ ;
             }
             else
             { 
-                // Work [i] += aij ; no typecast
-                GB_ADD_SCALAR_TO_ARRAY (Work, i, aij) ;
+                // Work0 [i] += aij ; no typecast
+                GB_ADD_SCALAR_TO_ARRAY (Work0, i, aij) ;
             }
         }
-        Tnz [tid] = my_tnz ;
+
     }
+    else
+    {
 
-    //--------------------------------------------------------------------------
-    // reduce all workspace to Work [0] and count # entries in T
-    //--------------------------------------------------------------------------
+        //----------------------------------------------------------------------
+        // count the entries in each slice that fall in each panel
+        //----------------------------------------------------------------------
 
-    GB_CTYPE *GB_RESTRICT Work0 = (GB_CTYPE *) Works [0] ;
-    bool     *GB_RESTRICT Mark0 = Marks [0] ;
-    int64_t tnz = Tnz [0] ;
+        // Pcount [b*nth+tid] is the # of entries in slice tid and panel b
+        int tid, b ;
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (tid = 0 ; tid < nth ; tid++)
+        {
+            for (int64_t p = pstart_slice [tid] ; p < pstart_slice [tid+1] ;p++)
+            { 
+                int64_t panel = Ai [p] / psize ;
+                Pcount [panel*nth + tid]++ ;
+            }
+        }
 
-    if (nth > 1)
-    {
-        int64_t i ;
-        #pragma omp parallel for num_threads(nthreads) schedule(static) \
-            reduction(+:tnz)
-        for (i = 0 ; i < n ; i++)
+        GB_cumsum (Pcount, npanels * nth, NULL, 1) ;
+        for (b = 0 ; b <= npanels ; b++)
+        { 
+            Pstart [b] = Pcount [b*nth] ;
+        }
+
+        //----------------------------------------------------------------------
+        // scatter the positions of the entries into the bucket for each panel
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nth) schedule(static)
+        for (tid = 0 ; tid < nth ; tid++)
         {
-            for (int tid = 1 ; tid < nth ; tid++)
-            {
-                const bool *GB_RESTRICT Mark = Marks [tid] ;
-                if (Mark [i])
-                {
-                    // thread tid has a contribution to index i
-                    const GB_CTYPE *GB_RESTRICT Work = (GB_CTYPE *) Works [tid];
-                    if (!Mark0 [i])
-                    { 
-                        // first time index i has been seen
-                        // Work0 [i] = Work [i] ; no typecast
-                        GB_COPY_ARRAY_TO_ARRAY (Work0, i, Work, i) ;
-                        Mark0 [i] = true ;
-                        tnz++ ;
-                    }
-                    else
-                    { 
-                        // Work0 [i] += Work [i] ; no typecast
-                        GB_ADD_ARRAY_TO_ARRAY (Work0, i, Work, i) ;
-                    }
-                }
+            for (int64_t p = pstart_slice [tid] ; p < pstart_slice [tid+1] ;p++)
+            { 
+                int64_t panel = Ai [p] / psize ;
+                Perm [Pcount [panel*nth + tid]++] = p ;
             }
         }
 
-        // free all but workspace for thread 0
-        for (int tid = 1 ; tid < nth ; tid++)
+        //----------------------------------------------------------------------
+        // reduce each panel into its own part of the workspace
+        //----------------------------------------------------------------------
+
+        #pragma omp parallel for num_threads(nth) schedule(dynamic,1) \
+            reduction(+:tnz)
+        for (b = 0 ; b < npanels ; b++)
         {
-            GB_FREE (Works [tid]) ;
-            GB_FREE (Marks [tid]) ;
+            for (int64_t q = Pstart [b] ; q < Pstart [b+1] ; q++)
+            {
+                int64_t p = Perm [q] ;
+                int64_t i = Ai [p] ;
+                // ztype aij = (ztype) Ax [p], with typecast
+                GB_SCALAR (aij) ;
+                GB_CAST_ARRAY_TO_SCALAR (aij, Ax, p) ;
+                if (!Mark0 [i])
+                { 
+                    // first time index i has been seen
+                    // Work0 [i] = aij ; no typecast
+                    GB_COPY_SCALAR_TO_ARRAY (Work0, i, aij) ;
+                    Mark0 [i] = true ;
+                    tnz++ ;
+                }
+                else
+                { 
+                    // Work0 [i] += aij ; no typecast
+                    GB_ADD_SCALAR_TO_ARRAY (Work0, i, aij) ;
+                }
+            }
         }
     }
 
@@ -175,9 +193,9 @@
     // free workspace
     //--------------------------------------------------------------------------
 
-    GB_FREE (Works) ;
-    GB_FREE (Marks) ;
-    GB_FREE (Tnz) ;
+    GB_FREE (Perm) ;
+    GB_FREE (Pcount) ;
+    GB_FREE (Pstart) ;
 
     //--------------------------------------------------------------------------
     // allocate T
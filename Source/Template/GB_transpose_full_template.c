@@ -0,0 +1,38 @@
+//------------------------------------------------------------------------------
+// GB_transpose_full_template: transpose the values of a full matrix
+//------------------------------------------------------------------------------
+
+// SuiteSparse:GraphBLAS, Timothy A. Davis, (c) 2017-2020, All Rights Reserved.
+// http://suitesparse.com   See GraphBLAS/Doc/License.txt for license.
+
+//------------------------------------------------------------------------------
+
+// Cx = Ax', where Ax is avlen-by-avdim and Cx is avdim-by-avlen, both held by
+// column.  The matrix is partitioned into GB_TILE-by-GB_TILE tiles, so that
+// each tile of Ax and Cx remains in cache while it is being transposed.  The
+// type GB_CTYPE defines the size of each entry; no typecasting is done.
+
+{
+    const GB_CTYPE *GB_RESTRICT Ax = (GB_CTYPE *) Ax_input ;
+    GB_CTYPE *GB_RESTRICT Cx = (GB_CTYPE *) Cx_output ;
+    int tid ;
+    #pragma omp parallel for num_threads(nthreads) schedule(static)
+    for (tid = 0 ; tid < ntasks ; tid++)
+    {
+        // tile (ti,tj) covers Ax (i1:i2-1, j1:j2-1)
+        int64_t ti = tid % ntiles_i ;
+        int64_t tj = tid / ntiles_i ;
+        int64_t i1 = ti * GB_TILE, i2 = GB_IMIN (i1 + GB_TILE, avlen) ;
+        int64_t j1 = tj * GB_TILE, j2 = GB_IMIN (j1 + GB_TILE, avdim) ;
+        for (int64_t i = i1 ; i < i2 ; i++)
+        {
+            for (int64_t j = j1 ; j < j2 ; j++)
+            { 
+                // C(j,i) = A(i,j)
+                Cx [j + i*avdim] = Ax [i + j*avlen] ;
+            }
+        }
+    }
+}
+
+#undef GB_CTYPE
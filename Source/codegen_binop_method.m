@@ -15,7 +15,10 @@ name = sprintf ('%s_%s', binop, fname) ;
 % function names
 fprintf (f, 'define(`GB_AaddB'', `GB_AaddB__%s'')\n', name) ;
 fprintf (f, 'define(`GB_AemultB'', `GB_AemultB__%s'')\n', name) ;
+fprintf (f, 'define(`GB_AkronB'', `GB_AkronB__%s'')\n', name) ;
+fprintf (f, 'define(`GB_AaddB_sparse_dense'', `GB_AaddB_sparse_dense__%s'')\n', name) ;
 fprintf (f, 'define(`GB_Cdense_accumB'', `GB_Cdense_accumB__%s'')\n', name) ;
+fprintf (f, 'define(`GB_Cdense_accumB_tran'', `GB_Cdense_accumB_tran__%s'')\n', name) ;
 fprintf (f, 'define(`GB_Cdense_accumb'', `GB_Cdense_accumb__%s'')\n', name) ;
 fprintf (f, 'define(`GB_Cdense_ewise3_noaccum'', `GB_Cdense_ewise3_noaccum__%s'')\n', name) ;
 